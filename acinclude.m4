@@ -4,7 +4,33 @@ dnl Version: 20201125
 
 dnl Function to detect if libbfio dependencies are available
 AC_DEFUN([AX_LIBBFIO_CHECK_LOCAL],
-  [dnl No additional checks.
+  [dnl Headers included in libbfio/libbfio_descriptor_cache.c, libbfio/libbfio_file_io_handle.c, libbfio/libbfio_io_uring.c and libbfio/libbfio_mmap_io_handle.c
+  AC_CHECK_HEADERS([errno.h fcntl.h linux/fs.h linux/io_uring.h sys/disk.h sys/ioctl.h sys/mman.h sys/resource.h sys/sendfile.h sys/stat.h sys/syscall.h sys/uio.h unistd.h])
+
+  dnl Functions used in libbfio/libbfio_descriptor_cache.c, libbfio/libbfio_file_io_handle.c and libbfio/libbfio_mmap_io_handle.c
+  AC_CHECK_FUNCS([clock_gettime close copy_file_range fstat getrlimit ioctl madvise mmap munmap nanosleep open posix_fadvise posix_madvise pread preadv pwrite sendfile])
+
+  dnl The C library can provide copy_file_range without declaring it, for example without _GNU_SOURCE
+  AS_IF(
+    [test "x$ac_cv_func_copy_file_range" = xyes],
+    [AC_CHECK_DECLS(
+      [copy_file_range],
+      [],
+      [],
+      [[#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif]])
+  ])
+
+  dnl The io_uring system calls are used without liburing, hence their numbers must be defined
+  AS_IF(
+    [test "x$ac_cv_header_linux_io_uring_h" = xyes && test "x$ac_cv_header_sys_syscall_h" = xyes],
+    [AC_CHECK_DECLS(
+      [__NR_io_uring_setup, __NR_io_uring_enter],
+      [],
+      [],
+      [[#include <sys/syscall.h>]])
+  ])
   ])
 
 dnl Function to check if DLL support is needed
@@ -0,0 +1,1788 @@
+/*
+ * The block cache functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libbfio_block_cache.h"
+#include "libbfio_libcerror.h"
+#include "libbfio_libcthreads.h"
+#include "libbfio_types.h"
+
+/* Creates a block cache
+ * The maximum number of blocks is the maximum cache size divided by the block size
+ * Make sure the value block_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_block_cache_initialize(
+     libbfio_block_cache_t **block_cache,
+     size_t block_size,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libbfio_block_cache_initialize";
+	size64_t number_of_blocks = 0;
+	size_t hash_table_size    = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid block cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( block_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_blocks = maximum_cache_size / block_size;
+
+	if( ( number_of_blocks == 0 )
+	 || ( number_of_blocks > (size64_t) INT_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum cache size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	hash_table_size = sizeof( libbfio_block_cache_block_t * ) * (size_t) number_of_blocks;
+
+	if( hash_table_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid hash table size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*block_cache = memory_allocate_structure(
+	                libbfio_block_cache_t );
+
+	if( *block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *block_cache,
+	     0,
+	     sizeof( libbfio_block_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear block cache.",
+		 function );
+
+		memory_free(
+		 *block_cache );
+
+		*block_cache = NULL;
+
+		return( -1 );
+	}
+	( *block_cache )->hash_table = (libbfio_block_cache_block_t **) memory_allocate(
+	                                                                 hash_table_size );
+
+	if( ( *block_cache )->hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *block_cache )->hash_table,
+	     0,
+	     hash_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_initialize(
+	     &( ( *block_cache )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *block_cache )->block_size               = block_size;
+	( *block_cache )->maximum_number_of_blocks = (int) number_of_blocks;
+
+	return( 1 );
+
+on_error:
+	if( *block_cache != NULL )
+	{
+		if( ( *block_cache )->hash_table != NULL )
+		{
+			memory_free(
+			 ( *block_cache )->hash_table );
+		}
+		memory_free(
+		 *block_cache );
+
+		*block_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a block cache
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_block_cache_free(
+     libbfio_block_cache_t **block_cache,
+     libcerror_error_t **error )
+{
+	libbfio_block_cache_block_t *block = NULL;
+	static char *function              = "libbfio_block_cache_free";
+	int result                         = 1;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_cache != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+		if( libcthreads_mutex_free(
+		     &( ( *block_cache )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		while( ( *block_cache )->first_block != NULL )
+		{
+			block = ( *block_cache )->first_block;
+
+			( *block_cache )->first_block = block->next_block;
+
+			memory_free(
+			 block );
+		}
+		while( ( *block_cache )->first_detached_block != NULL )
+		{
+			block = ( *block_cache )->first_detached_block;
+
+			( *block_cache )->first_detached_block = block->next_block;
+
+			memory_free(
+			 block );
+		}
+		memory_free(
+		 ( *block_cache )->hash_table );
+
+		memory_free(
+		 *block_cache );
+
+		*block_cache = NULL;
+	}
+	return( result );
+}
+
+/* Empties a block cache
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_block_cache_empty(
+     libbfio_block_cache_t *block_cache,
+     libcerror_error_t **error )
+{
+	libbfio_block_cache_block_t *block = NULL;
+	static char *function              = "libbfio_block_cache_empty";
+	int result                         = 1;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     block_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	while( block_cache->first_block != NULL )
+	{
+		block = block_cache->first_block;
+
+		block_cache->first_block = block->next_block;
+
+		/* A block that is referenced by a data pointer is detached
+		 */
+		if( block->number_of_references > 0 )
+		{
+			block->next_hash_block = NULL;
+			block->previous_block  = NULL;
+			block->next_block      = block_cache->first_detached_block;
+
+			block_cache->first_detached_block = block;
+		}
+		else
+		{
+			memory_free(
+			 block );
+		}
+	}
+	block_cache->last_block       = NULL;
+	block_cache->number_of_blocks = 0;
+
+	if( memory_set(
+	     block_cache->hash_table,
+	     0,
+	     sizeof( libbfio_block_cache_block_t * ) * (size_t) block_cache->maximum_number_of_blocks ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		result = -1;
+	}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     block_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a specific block of an entry
+ * This function is not multi-thread safe acquire the mutex before call
+ * Returns 1 if successful, 0 if no such block or -1 on error
+ */
+int libbfio_block_cache_get_block_by_number(
+     libbfio_block_cache_t *block_cache,
+     int entry,
+     uint64_t block_number,
+     libbfio_block_cache_block_t **block,
+     libcerror_error_t **error )
+{
+	libbfio_block_cache_block_t *hash_block = NULL;
+	static char *function                   = "libbfio_block_cache_get_block_by_number";
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block.",
+		 function );
+
+		return( -1 );
+	}
+	hash_block = block_cache->hash_table[ ( block_number + (uint64_t) entry ) % (uint64_t) block_cache->maximum_number_of_blocks ];
+
+	while( hash_block != NULL )
+	{
+		if( ( hash_block->entry == entry )
+		 && ( hash_block->block_number == block_number ) )
+		{
+			*block = hash_block;
+
+			return( 1 );
+		}
+		hash_block = hash_block->next_hash_block;
+	}
+	return( 0 );
+}
+
+/* Removes a block from the hash table and the last used list
+ * This function is not multi-thread safe acquire the mutex before call
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_block_cache_remove_block(
+     libbfio_block_cache_t *block_cache,
+     libbfio_block_cache_block_t *block,
+     libcerror_error_t **error )
+{
+	libbfio_block_cache_block_t **hash_block = NULL;
+	static char *function                    = "libbfio_block_cache_remove_block";
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block.",
+		 function );
+
+		return( -1 );
+	}
+	hash_block = &( block_cache->hash_table[ ( block->block_number + (uint64_t) block->entry ) % (uint64_t) block_cache->maximum_number_of_blocks ] );
+
+	while( *hash_block != NULL )
+	{
+		if( *hash_block == block )
+		{
+			*hash_block = block->next_hash_block;
+
+			break;
+		}
+		hash_block = &( ( *hash_block )->next_hash_block );
+	}
+	if( block->previous_block == NULL )
+	{
+		block_cache->first_block = block->next_block;
+	}
+	else
+	{
+		block->previous_block->next_block = block->next_block;
+	}
+	if( block->next_block == NULL )
+	{
+		block_cache->last_block = block->previous_block;
+	}
+	else
+	{
+		block->next_block->previous_block = block->previous_block;
+	}
+	block->next_hash_block = NULL;
+	block->previous_block  = NULL;
+	block->next_block      = NULL;
+
+	return( 1 );
+}
+
+/* Appends a block to the hash table and to the front of the last used list
+ * This function is not multi-thread safe acquire the mutex before call
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_block_cache_append_block(
+     libbfio_block_cache_t *block_cache,
+     libbfio_block_cache_block_t *block,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_block_cache_append_block";
+	uint64_t hash_index   = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block.",
+		 function );
+
+		return( -1 );
+	}
+	hash_index = ( block->block_number + (uint64_t) block->entry ) % (uint64_t) block_cache->maximum_number_of_blocks;
+
+	block->next_hash_block = block_cache->hash_table[ hash_index ];
+
+	block_cache->hash_table[ hash_index ] = block;
+
+	block->previous_block = NULL;
+	block->next_block     = block_cache->first_block;
+
+	if( block_cache->first_block != NULL )
+	{
+		block_cache->first_block->previous_block = block;
+	}
+	block_cache->first_block = block;
+
+	if( block_cache->last_block == NULL )
+	{
+		block_cache->last_block = block;
+	}
+	return( 1 );
+}
+
+/* Retrieves a block that is not in use
+ * A new block is created if the maximum number of blocks has not been reached
+ * or if all blocks are referenced, otherwise the least recently used block
+ * that is not referenced is evicted
+ * This function is not multi-thread safe acquire the mutex before call
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_block_cache_get_free_block(
+     libbfio_block_cache_t *block_cache,
+     libbfio_block_cache_block_t **block,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_block_cache_get_free_block";
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_cache->number_of_blocks >= block_cache->maximum_number_of_blocks )
+	{
+		/* A block that is referenced by a data pointer cannot be evicted
+		 */
+		*block = block_cache->last_block;
+
+		while( ( *block != NULL )
+		    && ( ( *block )->number_of_references > 0 ) )
+		{
+			*block = ( *block )->previous_block;
+		}
+		if( *block != NULL )
+		{
+			if( libbfio_block_cache_remove_block(
+			     block_cache,
+			     *block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove least recently used block.",
+				 function );
+
+				*block = NULL;
+
+				return( -1 );
+			}
+			block_cache->number_of_evictions += 1;
+
+			return( 1 );
+		}
+	}
+	/* The block data is stored directly after the block
+	 */
+	*block = (libbfio_block_cache_block_t *) memory_allocate(
+	                                          sizeof( libbfio_block_cache_block_t ) + block_cache->block_size );
+
+	if( *block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *block,
+	     0,
+	     sizeof( libbfio_block_cache_block_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear block.",
+		 function );
+
+		memory_free(
+		 *block );
+
+		*block = NULL;
+
+		return( -1 );
+	}
+	( *block )->data = (uint8_t *) &( ( *block )[ 1 ] );
+
+	block_cache->number_of_blocks += 1;
+
+	return( 1 );
+}
+
+/* Frees a block that was removed from the block cache
+ * A block that is referenced by a data pointer is detached instead
+ * and freed when its last reference is released
+ * This function is not multi-thread safe acquire the mutex before call
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_block_cache_free_block(
+     libbfio_block_cache_t *block_cache,
+     libbfio_block_cache_block_t *block,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_block_cache_free_block";
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block.",
+		 function );
+
+		return( -1 );
+	}
+	block_cache->number_of_blocks -= 1;
+
+	if( block->number_of_references > 0 )
+	{
+		block->next_hash_block = NULL;
+		block->previous_block  = NULL;
+		block->next_block      = block_cache->first_detached_block;
+
+		block_cache->first_detached_block = block;
+	}
+	else
+	{
+		memory_free(
+		 block );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific block of an entry, the block is read if it is not cached
+ * The block becomes the most recently used block
+ * This function is not multi-thread safe acquire the mutex before call
+ * Returns 1 if successful, 0 if there is no data for the block or -1 on error
+ */
+int libbfio_block_cache_get_block(
+     libbfio_block_cache_t *block_cache,
+     int entry,
+     intptr_t *io_handle,
+     ssize_t (*read_buffer_at_offset)(
+                intptr_t *io_handle,
+                int entry,
+                uint8_t *buffer,
+                size_t size,
+                off64_t offset,
+                libcerror_error_t **error ),
+     uint64_t block_number,
+     libbfio_block_cache_block_t **block,
+     libcerror_error_t **error )
+{
+	libbfio_block_cache_block_t *safe_block = NULL;
+	static char *function                   = "libbfio_block_cache_get_block";
+	ssize_t read_count                      = 0;
+	int result                              = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_buffer_at_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read buffer at offset function.",
+		 function );
+
+		return( -1 );
+	}
+	if( block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block.",
+		 function );
+
+		return( -1 );
+	}
+	result = libbfio_block_cache_get_block_by_number(
+	          block_cache,
+	          entry,
+	          block_number,
+	          &safe_block,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve block: %" PRIu64 ".",
+		 function,
+		 block_number );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		block_cache->number_of_hits += 1;
+
+		if( safe_block != block_cache->first_block )
+		{
+			if( libbfio_block_cache_remove_block(
+			     block_cache,
+			     safe_block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove block: %" PRIu64 ".",
+				 function,
+				 block_number );
+
+				return( -1 );
+			}
+			if( libbfio_block_cache_append_block(
+			     block_cache,
+			     safe_block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append block: %" PRIu64 ".",
+				 function,
+				 block_number );
+
+				libbfio_block_cache_free_block(
+				 block_cache,
+				 safe_block,
+				 NULL );
+
+				return( -1 );
+			}
+		}
+		*block = safe_block;
+
+		return( 1 );
+	}
+	block_cache->number_of_misses += 1;
+
+	if( libbfio_block_cache_get_free_block(
+	     block_cache,
+	     &safe_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve free block.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = read_buffer_at_offset(
+	              io_handle,
+	              entry,
+	              safe_block->data,
+	              block_cache->block_size,
+	              (off64_t) ( block_number * block_cache->block_size ),
+	              error );
+
+	if( read_count <= 0 )
+	{
+		block_cache->number_of_blocks -= 1;
+
+		memory_free(
+		 safe_block );
+
+		if( read_count == 0 )
+		{
+			return( 0 );
+		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block: %" PRIu64 " of entry: %d.",
+		 function,
+		 block_number,
+		 entry );
+
+		return( -1 );
+	}
+	safe_block->entry        = entry;
+	safe_block->block_number = block_number;
+	safe_block->data_size    = (size_t) read_count;
+
+	if( libbfio_block_cache_append_block(
+	     block_cache,
+	     safe_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append block: %" PRIu64 ".",
+		 function,
+		 block_number );
+
+		block_cache->number_of_blocks -= 1;
+
+		memory_free(
+		 safe_block );
+
+		return( -1 );
+	}
+	*block = safe_block;
+
+	return( 1 );
+}
+
+/* Reads data of a specific entry at a specific offset using the block cache
+ * Reads larger than the block size bypass the cache
+ * The data that is not cached is read with the read buffer at offset function
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libbfio_block_cache_read_buffer_at_offset(
+         libbfio_block_cache_t *block_cache,
+         int entry,
+         intptr_t *io_handle,
+         ssize_t (*read_buffer_at_offset)(
+                    intptr_t *io_handle,
+                    int entry,
+                    uint8_t *buffer,
+                    size_t size,
+                    off64_t offset,
+                    libcerror_error_t **error ),
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libbfio_block_cache_block_t *block = NULL;
+	static char *function              = "libbfio_block_cache_read_buffer_at_offset";
+	size_t block_offset                = 0;
+	size_t buffer_offset               = 0;
+	size_t read_size                   = 0;
+	ssize_t read_count                 = 0;
+	uint64_t block_number              = 0;
+	int result                         = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_buffer_at_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read buffer at offset function.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > block_cache->block_size )
+	{
+		read_count = read_buffer_at_offset(
+		              io_handle,
+		              entry,
+		              buffer,
+		              size,
+		              offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer of entry: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 entry,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		return( read_count );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     block_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	while( buffer_offset < size )
+	{
+		block_number = (uint64_t) offset / block_cache->block_size;
+		block_offset = (size_t) ( (uint64_t) offset % block_cache->block_size );
+
+		result = libbfio_block_cache_get_block(
+		          block_cache,
+		          entry,
+		          io_handle,
+		          read_buffer_at_offset,
+		          block_number,
+		          &block,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve block: %" PRIu64 " of entry: %d.",
+			 function,
+			 block_number,
+			 entry );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( block_offset >= block->data_size )
+		{
+			break;
+		}
+		read_size = block->data_size - block_offset;
+
+		if( read_size > ( size - buffer_offset ) )
+		{
+			read_size = size - buffer_offset;
+		}
+		if( memory_copy(
+		     &( buffer[ buffer_offset ] ),
+		     &( block->data[ block_offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy block data.",
+			 function );
+
+			goto on_error;
+		}
+		buffer_offset += read_size;
+		offset        += (off64_t) read_size;
+
+		/* A block that is smaller than the block size contains the end of the data
+		 */
+		if( block->data_size < block_cache->block_size )
+		{
+			break;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     block_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( (ssize_t) buffer_offset );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	libcthreads_mutex_release(
+	 block_cache->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves a pointer to data of a specific entry at a specific offset in the block cache
+ * The data that is not cached is read with the read buffer at offset function
+ * The block that contains the data is not evicted or freed until the data pointer is released
+ * Returns 1 if successful, 0 if the data is not available in a single block or -1 on error
+ */
+int libbfio_block_cache_get_data_pointer(
+     libbfio_block_cache_t *block_cache,
+     int entry,
+     intptr_t *io_handle,
+     ssize_t (*read_buffer_at_offset)(
+                intptr_t *io_handle,
+                int entry,
+                uint8_t *buffer,
+                size_t size,
+                off64_t offset,
+                libcerror_error_t **error ),
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error )
+{
+	libbfio_block_cache_block_t *block = NULL;
+	static char *function              = "libbfio_block_cache_get_data_pointer";
+	size_t block_offset                = 0;
+	uint64_t block_number              = 0;
+	int result                         = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_buffer_at_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read buffer at offset function.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	*data = NULL;
+
+	block_number = (uint64_t) offset / block_cache->block_size;
+	block_offset = (size_t) ( (uint64_t) offset % block_cache->block_size );
+
+	/* Data that spans multiple blocks is not available as a pointer
+	 */
+	if( size > ( block_cache->block_size - block_offset ) )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     block_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libbfio_block_cache_get_block(
+	          block_cache,
+	          entry,
+	          io_handle,
+	          read_buffer_at_offset,
+	          block_number,
+	          &block,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve block: %" PRIu64 " of entry: %d.",
+		 function,
+		 block_number,
+		 entry );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( ( block_offset >= block->data_size )
+		 || ( size > ( block->data_size - block_offset ) ) )
+		{
+			result = 0;
+		}
+		else
+		{
+			block->number_of_references += 1;
+
+			*data = &( block->data[ block_offset ] );
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     block_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	libcthreads_mutex_release(
+	 block_cache->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Releases a pointer to data retrieved with libbfio_block_cache_get_data_pointer
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_block_cache_release_data_pointer(
+     libbfio_block_cache_t *block_cache,
+     int entry,
+     off64_t offset,
+     const uint8_t *data,
+     libcerror_error_t **error )
+{
+	libbfio_block_cache_block_t *block          = NULL;
+	libbfio_block_cache_block_t *previous_block = NULL;
+	static char *function                       = "libbfio_block_cache_release_data_pointer";
+	size_t block_offset                         = 0;
+	uint64_t block_number                       = 0;
+	int result                                  = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	block_number = (uint64_t) offset / block_cache->block_size;
+	block_offset = (size_t) ( (uint64_t) offset % block_cache->block_size );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     block_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libbfio_block_cache_get_block_by_number(
+	          block_cache,
+	          entry,
+	          block_number,
+	          &block,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve block: %" PRIu64 ".",
+		 function,
+		 block_number );
+
+		goto on_error;
+	}
+	else if( ( result != 0 )
+	      && ( block->number_of_references > 0 )
+	      && ( data == &( block->data[ block_offset ] ) ) )
+	{
+		block->number_of_references -= 1;
+	}
+	else
+	{
+		/* The block was removed from the cache while it was referenced
+		 */
+		block = block_cache->first_detached_block;
+
+		while( block != NULL )
+		{
+			if( ( block->entry == entry )
+			 && ( block->block_number == block_number )
+			 && ( data == &( block->data[ block_offset ] ) ) )
+			{
+				break;
+			}
+			previous_block = block;
+			block          = block->next_block;
+		}
+		if( block == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid data - no such data pointer.",
+			 function );
+
+			goto on_error;
+		}
+		block->number_of_references -= 1;
+
+		if( block->number_of_references == 0 )
+		{
+			if( previous_block == NULL )
+			{
+				block_cache->first_detached_block = block->next_block;
+			}
+			else
+			{
+				previous_block->next_block = block->next_block;
+			}
+			memory_free(
+			 block );
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     block_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	libcthreads_mutex_release(
+	 block_cache->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Removes the blocks that contain data of a specific range of an entry from the block cache
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_block_cache_invalidate_range(
+     libbfio_block_cache_t *block_cache,
+     int entry,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	libbfio_block_cache_block_t *block = NULL;
+	static char *function              = "libbfio_block_cache_invalidate_range";
+	uint64_t block_number              = 0;
+	uint64_t last_block_number         = 0;
+	int result                         = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		return( 1 );
+	}
+	block_number      = (uint64_t) offset / block_cache->block_size;
+	last_block_number = ( (uint64_t) offset + size - 1 ) / block_cache->block_size;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     block_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* Stop when there are no more blocks to remove, so that large ranges are not walked needlessly
+	 */
+	while( ( block_number <= last_block_number )
+	    && ( block_cache->number_of_blocks > 0 ) )
+	{
+		result = libbfio_block_cache_get_block_by_number(
+		          block_cache,
+		          entry,
+		          block_number,
+		          &block,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve block: %" PRIu64 ".",
+			 function,
+			 block_number );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( libbfio_block_cache_remove_block(
+			     block_cache,
+			     block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove block: %" PRIu64 ".",
+				 function,
+				 block_number );
+
+				goto on_error;
+			}
+			if( libbfio_block_cache_free_block(
+			     block_cache,
+			     block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free block: %" PRIu64 ".",
+				 function,
+				 block_number );
+
+				goto on_error;
+			}
+		}
+		block_number++;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     block_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	libcthreads_mutex_release(
+	 block_cache->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Removes the blocks that contain data of a specific entry from the block cache
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_block_cache_invalidate_entry(
+     libbfio_block_cache_t *block_cache,
+     int entry,
+     libcerror_error_t **error )
+{
+	libbfio_block_cache_block_t *block      = NULL;
+	libbfio_block_cache_block_t *next_block = NULL;
+	static char *function                   = "libbfio_block_cache_invalidate_entry";
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     block_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	block = block_cache->first_block;
+
+	while( block != NULL )
+	{
+		next_block = block->next_block;
+
+		if( block->entry == entry )
+		{
+			if( libbfio_block_cache_remove_block(
+			     block_cache,
+			     block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove block: %" PRIu64 ".",
+				 function,
+				 block->block_number );
+
+				goto on_error;
+			}
+			if( libbfio_block_cache_free_block(
+			     block_cache,
+			     block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free block: %" PRIu64 ".",
+				 function,
+				 block->block_number );
+
+				goto on_error;
+			}
+		}
+		block = next_block;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     block_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	libcthreads_mutex_release(
+	 block_cache->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the block cache statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_block_cache_get_statistics(
+     libbfio_block_cache_t *block_cache,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     uint64_t *number_of_evictions,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_block_cache_get_statistics";
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_misses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of misses.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_evictions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of evictions.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     block_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_hits      = block_cache->number_of_hits;
+	*number_of_misses    = block_cache->number_of_misses;
+	*number_of_evictions = block_cache->number_of_evictions;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     block_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
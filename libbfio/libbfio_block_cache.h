@@ -0,0 +1,245 @@
+/*
+ * The block cache functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBBFIO_BLOCK_CACHE_H )
+#define _LIBBFIO_BLOCK_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libbfio_libcerror.h"
+#include "libbfio_libcthreads.h"
+#include "libbfio_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libbfio_block_cache_block libbfio_block_cache_block_t;
+
+struct libbfio_block_cache_block
+{
+	/* The entry of the data the block belongs to
+	 */
+	int entry;
+
+	/* The block number
+	 */
+	uint64_t block_number;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The number of data pointers that reference the data
+	 */
+	int number_of_references;
+
+	/* The next block in the same hash table entry
+	 */
+	libbfio_block_cache_block_t *next_hash_block;
+
+	/* The previous (more recently used) block
+	 */
+	libbfio_block_cache_block_t *previous_block;
+
+	/* The next (less recently used) block
+	 */
+	libbfio_block_cache_block_t *next_block;
+};
+
+typedef struct libbfio_block_cache libbfio_block_cache_t;
+
+struct libbfio_block_cache
+{
+	/* The block size
+	 */
+	size_t block_size;
+
+	/* The maximum number of blocks
+	 */
+	int maximum_number_of_blocks;
+
+	/* The number of blocks
+	 */
+	int number_of_blocks;
+
+	/* The hash table, the blocks are stored by entry and block number
+	 */
+	libbfio_block_cache_block_t **hash_table;
+
+	/* The first (most recently used) block
+	 */
+	libbfio_block_cache_block_t *first_block;
+
+	/* The last (least recently used) block
+	 */
+	libbfio_block_cache_block_t *last_block;
+
+	/* The first detached block
+	 * a detached block was removed from the cache while it was referenced
+	 * and is freed when its last reference is released
+	 */
+	libbfio_block_cache_block_t *first_detached_block;
+
+	/* The number of cache hits
+	 */
+	uint64_t number_of_hits;
+
+	/* The number of cache misses
+	 */
+	uint64_t number_of_misses;
+
+	/* The number of evicted blocks
+	 */
+	uint64_t number_of_evictions;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libbfio_block_cache_initialize(
+     libbfio_block_cache_t **block_cache,
+     size_t block_size,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+int libbfio_block_cache_free(
+     libbfio_block_cache_t **block_cache,
+     libcerror_error_t **error );
+
+int libbfio_block_cache_empty(
+     libbfio_block_cache_t *block_cache,
+     libcerror_error_t **error );
+
+int libbfio_block_cache_get_block_by_number(
+     libbfio_block_cache_t *block_cache,
+     int entry,
+     uint64_t block_number,
+     libbfio_block_cache_block_t **block,
+     libcerror_error_t **error );
+
+int libbfio_block_cache_remove_block(
+     libbfio_block_cache_t *block_cache,
+     libbfio_block_cache_block_t *block,
+     libcerror_error_t **error );
+
+int libbfio_block_cache_append_block(
+     libbfio_block_cache_t *block_cache,
+     libbfio_block_cache_block_t *block,
+     libcerror_error_t **error );
+
+int libbfio_block_cache_get_free_block(
+     libbfio_block_cache_t *block_cache,
+     libbfio_block_cache_block_t **block,
+     libcerror_error_t **error );
+
+int libbfio_block_cache_free_block(
+     libbfio_block_cache_t *block_cache,
+     libbfio_block_cache_block_t *block,
+     libcerror_error_t **error );
+
+int libbfio_block_cache_get_block(
+     libbfio_block_cache_t *block_cache,
+     int entry,
+     intptr_t *io_handle,
+     ssize_t (*read_buffer_at_offset)(
+                intptr_t *io_handle,
+                int entry,
+                uint8_t *buffer,
+                size_t size,
+                off64_t offset,
+                libcerror_error_t **error ),
+     uint64_t block_number,
+     libbfio_block_cache_block_t **block,
+     libcerror_error_t **error );
+
+ssize_t libbfio_block_cache_read_buffer_at_offset(
+         libbfio_block_cache_t *block_cache,
+         int entry,
+         intptr_t *io_handle,
+         ssize_t (*read_buffer_at_offset)(
+                    intptr_t *io_handle,
+                    int entry,
+                    uint8_t *buffer,
+                    size_t size,
+                    off64_t offset,
+                    libcerror_error_t **error ),
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+int libbfio_block_cache_get_data_pointer(
+     libbfio_block_cache_t *block_cache,
+     int entry,
+     intptr_t *io_handle,
+     ssize_t (*read_buffer_at_offset)(
+                intptr_t *io_handle,
+                int entry,
+                uint8_t *buffer,
+                size_t size,
+                off64_t offset,
+                libcerror_error_t **error ),
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error );
+
+int libbfio_block_cache_release_data_pointer(
+     libbfio_block_cache_t *block_cache,
+     int entry,
+     off64_t offset,
+     const uint8_t *data,
+     libcerror_error_t **error );
+
+int libbfio_block_cache_invalidate_range(
+     libbfio_block_cache_t *block_cache,
+     int entry,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libbfio_block_cache_invalidate_entry(
+     libbfio_block_cache_t *block_cache,
+     int entry,
+     libcerror_error_t **error );
+
+int libbfio_block_cache_get_statistics(
+     libbfio_block_cache_t *block_cache,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     uint64_t *number_of_evictions,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBBFIO_BLOCK_CACHE_H ) */
+
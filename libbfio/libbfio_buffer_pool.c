@@ -0,0 +1,765 @@
+/*
+ * The buffer pool functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libbfio_buffer_pool.h"
+#include "libbfio_definitions.h"
+#include "libbfio_libcerror.h"
+#include "libbfio_libcthreads.h"
+#include "libbfio_types.h"
+
+#if defined( LIBBFIO_BUFFER_POOL_HAVE_THREAD_FREE_LIST )
+
+/* The last identifier assigned to a buffer pool
+ */
+static uint64_t libbfio_buffer_pool_last_identifier = 0;
+
+/* The free list of the current thread
+ */
+static __thread libbfio_buffer_pool_thread_free_list_t libbfio_buffer_pool_thread_free_list;
+
+#endif /* defined( LIBBFIO_BUFFER_POOL_HAVE_THREAD_FREE_LIST ) */
+
+/* Creates a buffer pool
+ * The buffer pool preallocates an arena of number of buffers of buffer size
+ * The buffer size is rounded up to a multitude of LIBBFIO_BUFFER_POOL_ALIGNMENT
+ * Make sure the value buffer_pool is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_buffer_pool_initialize(
+     libbfio_buffer_pool_t **buffer_pool,
+     size_t buffer_size,
+     int number_of_buffers,
+     libcerror_error_t **error )
+{
+	libbfio_internal_buffer_pool_t *internal_buffer_pool = NULL;
+	static char *function                                = "libbfio_buffer_pool_initialize";
+	size_t arena_size                                    = 0;
+	int buffer_index                                     = 0;
+
+	if( buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *buffer_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid buffer pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - LIBBFIO_BUFFER_POOL_ALIGNMENT ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_buffers <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of buffers value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size % LIBBFIO_BUFFER_POOL_ALIGNMENT ) != 0 )
+	{
+		buffer_size += LIBBFIO_BUFFER_POOL_ALIGNMENT - ( buffer_size % LIBBFIO_BUFFER_POOL_ALIGNMENT );
+	}
+	if( (size_t) number_of_buffers > ( ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - LIBBFIO_BUFFER_POOL_ALIGNMENT ) / buffer_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of buffers value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	arena_size = (size_t) number_of_buffers * buffer_size;
+
+	internal_buffer_pool = memory_allocate_structure(
+	                        libbfio_internal_buffer_pool_t );
+
+	if( internal_buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_buffer_pool,
+	     0,
+	     sizeof( libbfio_internal_buffer_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buffer pool.",
+		 function );
+
+		memory_free(
+		 internal_buffer_pool );
+
+		return( -1 );
+	}
+	/* The arena data is allocated with room to align the start of the arena
+	 */
+	internal_buffer_pool->arena_data = (uint8_t *) memory_allocate(
+	                                                sizeof( uint8_t ) * ( arena_size + LIBBFIO_BUFFER_POOL_ALIGNMENT ) );
+
+	if( internal_buffer_pool->arena_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create arena data.",
+		 function );
+
+		goto on_error;
+	}
+	internal_buffer_pool->arena = &( internal_buffer_pool->arena_data[ ( LIBBFIO_BUFFER_POOL_ALIGNMENT - ( (intptr_t) internal_buffer_pool->arena_data % LIBBFIO_BUFFER_POOL_ALIGNMENT ) ) % LIBBFIO_BUFFER_POOL_ALIGNMENT ] );
+
+	internal_buffer_pool->free_buffers = (uint8_t **) memory_allocate(
+	                                                   sizeof( uint8_t * ) * number_of_buffers );
+
+	if( internal_buffer_pool->free_buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create free buffers.",
+		 function );
+
+		goto on_error;
+	}
+	/* The free buffers are stacked in reverse order so that the first buffer of the arena is handed out first
+	 */
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		internal_buffer_pool->free_buffers[ number_of_buffers - 1 - buffer_index ] = &( internal_buffer_pool->arena[ (size_t) buffer_index * buffer_size ] );
+	}
+	internal_buffer_pool->buffer_size            = buffer_size;
+	internal_buffer_pool->number_of_buffers      = number_of_buffers;
+	internal_buffer_pool->number_of_free_buffers = number_of_buffers;
+
+#if defined( LIBBFIO_BUFFER_POOL_HAVE_THREAD_FREE_LIST )
+	/* A per-thread free list holds at most a quarter of the buffers
+	 * so that the buffers are not kept from the other threads
+	 */
+	internal_buffer_pool->identifier            = __atomic_add_fetch( &libbfio_buffer_pool_last_identifier, 1, __ATOMIC_RELAXED );
+	internal_buffer_pool->thread_free_list_size = number_of_buffers / 4;
+
+	if( internal_buffer_pool->thread_free_list_size > LIBBFIO_BUFFER_POOL_MAXIMUM_THREAD_FREE_LIST_SIZE )
+	{
+		internal_buffer_pool->thread_free_list_size = LIBBFIO_BUFFER_POOL_MAXIMUM_THREAD_FREE_LIST_SIZE;
+	}
+#endif
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_initialize(
+	     &( internal_buffer_pool->free_buffers_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize free buffers mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	*buffer_pool = (libbfio_buffer_pool_t *) internal_buffer_pool;
+
+	return( 1 );
+
+on_error:
+	if( internal_buffer_pool != NULL )
+	{
+		if( internal_buffer_pool->free_buffers != NULL )
+		{
+			memory_free(
+			 internal_buffer_pool->free_buffers );
+		}
+		if( internal_buffer_pool->arena_data != NULL )
+		{
+			memory_free(
+			 internal_buffer_pool->arena_data );
+		}
+		memory_free(
+		 internal_buffer_pool );
+	}
+	return( -1 );
+}
+
+/* Frees a buffer pool
+ * The buffers retrieved from the buffer pool can no longer be used
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_buffer_pool_free(
+     libbfio_buffer_pool_t **buffer_pool,
+     libcerror_error_t **error )
+{
+	libbfio_internal_buffer_pool_t *internal_buffer_pool = NULL;
+	static char *function                                = "libbfio_buffer_pool_free";
+	int result                                           = 1;
+
+	if( buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *buffer_pool != NULL )
+	{
+		internal_buffer_pool = (libbfio_internal_buffer_pool_t *) *buffer_pool;
+		*buffer_pool         = NULL;
+
+#if defined( LIBBFIO_BUFFER_POOL_HAVE_THREAD_FREE_LIST )
+		/* The free lists of other threads are invalidated by the identifier of the buffer pool
+		 */
+		if( libbfio_buffer_pool_thread_free_list.buffer_pool_identifier == internal_buffer_pool->identifier )
+		{
+			libbfio_buffer_pool_thread_free_list.buffer_pool_identifier = 0;
+			libbfio_buffer_pool_thread_free_list.number_of_buffers      = 0;
+		}
+#endif
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+		if( libcthreads_mutex_free(
+		     &( internal_buffer_pool->free_buffers_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free free buffers mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 internal_buffer_pool->free_buffers );
+
+		memory_free(
+		 internal_buffer_pool->arena_data );
+
+		memory_free(
+		 internal_buffer_pool );
+	}
+	return( result );
+}
+
+/* Retrieves the buffer size
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_buffer_pool_get_buffer_size(
+     libbfio_buffer_pool_t *buffer_pool,
+     size_t *buffer_size,
+     libcerror_error_t **error )
+{
+	libbfio_internal_buffer_pool_t *internal_buffer_pool = NULL;
+	static char *function                                = "libbfio_buffer_pool_get_buffer_size";
+
+	if( buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_buffer_pool = (libbfio_internal_buffer_pool_t *) buffer_pool;
+
+	if( buffer_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer size.",
+		 function );
+
+		return( -1 );
+	}
+	*buffer_size = internal_buffer_pool->buffer_size;
+
+	return( 1 );
+}
+
+/* Retrieves a buffer
+ * The buffer is taken from the free list of the current thread or from the arena
+ * if the arena has no buffers left a separate aligned buffer is allocated
+ * The buffer must be released with libbfio_buffer_pool_release_buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_buffer_pool_get_buffer(
+     libbfio_buffer_pool_t *buffer_pool,
+     uint8_t **buffer,
+     libcerror_error_t **error )
+{
+	libbfio_internal_buffer_pool_t *internal_buffer_pool = NULL;
+	static char *function                                = "libbfio_buffer_pool_get_buffer";
+
+#if defined( LIBBFIO_BUFFER_POOL_HAVE_THREAD_FREE_LIST )
+	libbfio_buffer_pool_thread_free_list_t *free_list    = NULL;
+#endif
+
+	if( buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_buffer_pool = (libbfio_internal_buffer_pool_t *) buffer_pool;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	*buffer = NULL;
+
+#if defined( LIBBFIO_BUFFER_POOL_HAVE_THREAD_FREE_LIST )
+	free_list = &libbfio_buffer_pool_thread_free_list;
+
+	if( ( free_list->buffer_pool_identifier == internal_buffer_pool->identifier )
+	 && ( free_list->number_of_buffers > 0 ) )
+	{
+		free_list->number_of_buffers -= 1;
+
+		*buffer = free_list->buffers[ free_list->number_of_buffers ];
+
+		return( 1 );
+	}
+#endif
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     internal_buffer_pool->free_buffers_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab free buffers mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_buffer_pool->number_of_free_buffers > 0 )
+	{
+		internal_buffer_pool->number_of_free_buffers -= 1;
+
+		*buffer = internal_buffer_pool->free_buffers[ internal_buffer_pool->number_of_free_buffers ];
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     internal_buffer_pool->free_buffers_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release free buffers mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( *buffer == NULL )
+	{
+		if( libbfio_internal_buffer_pool_allocate_overflow_buffer(
+		     internal_buffer_pool,
+		     buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create overflow buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Releases a buffer
+ * A buffer of the arena is kept for reuse, an overflow buffer is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_buffer_pool_release_buffer(
+     libbfio_buffer_pool_t *buffer_pool,
+     uint8_t *buffer,
+     libcerror_error_t **error )
+{
+	libbfio_internal_buffer_pool_t *internal_buffer_pool = NULL;
+	static char *function                                = "libbfio_buffer_pool_release_buffer";
+	size_t arena_offset                                  = 0;
+	int result                                           = 1;
+
+#if defined( LIBBFIO_BUFFER_POOL_HAVE_THREAD_FREE_LIST )
+	libbfio_buffer_pool_thread_free_list_t *free_list    = NULL;
+#endif
+
+	if( buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_buffer_pool = (libbfio_internal_buffer_pool_t *) buffer_pool;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer < internal_buffer_pool->arena )
+	 || ( buffer >= &( internal_buffer_pool->arena[ (size_t) internal_buffer_pool->number_of_buffers * internal_buffer_pool->buffer_size ] ) ) )
+	{
+		if( libbfio_internal_buffer_pool_free_overflow_buffer(
+		     internal_buffer_pool,
+		     buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free overflow buffer.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	arena_offset = (size_t) ( buffer - internal_buffer_pool->arena );
+
+	if( ( arena_offset % internal_buffer_pool->buffer_size ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBBFIO_BUFFER_POOL_HAVE_THREAD_FREE_LIST )
+	free_list = &libbfio_buffer_pool_thread_free_list;
+
+	/* An empty free list is claimed by the buffer pool the buffer belongs to
+	 */
+	if( free_list->number_of_buffers == 0 )
+	{
+		free_list->buffer_pool_identifier = internal_buffer_pool->identifier;
+	}
+	if( ( free_list->buffer_pool_identifier == internal_buffer_pool->identifier )
+	 && ( free_list->number_of_buffers < internal_buffer_pool->thread_free_list_size ) )
+	{
+		free_list->buffers[ free_list->number_of_buffers ] = buffer;
+
+		free_list->number_of_buffers += 1;
+
+		return( 1 );
+	}
+#endif
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     internal_buffer_pool->free_buffers_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab free buffers mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_buffer_pool->number_of_free_buffers >= internal_buffer_pool->number_of_buffers )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer pool - number of free buffers value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		internal_buffer_pool->free_buffers[ internal_buffer_pool->number_of_free_buffers ] = buffer;
+
+		internal_buffer_pool->number_of_free_buffers += 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     internal_buffer_pool->free_buffers_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release free buffers mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Allocates an overflow buffer, an aligned buffer outside of the arena
+ * The allocated data is stored in front of the aligned buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_buffer_pool_allocate_overflow_buffer(
+     libbfio_internal_buffer_pool_t *internal_buffer_pool,
+     uint8_t **buffer,
+     libcerror_error_t **error )
+{
+	uint8_t *buffer_data  = NULL;
+	static char *function = "libbfio_internal_buffer_pool_allocate_overflow_buffer";
+	size_t buffer_offset  = 0;
+
+	if( internal_buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	buffer_data = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * ( internal_buffer_pool->buffer_size + LIBBFIO_BUFFER_POOL_ALIGNMENT ) );
+
+	if( buffer_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer data.",
+		 function );
+
+		return( -1 );
+	}
+	/* The allocated data is aligned to at least the size of a pointer
+	 * hence there is always room in front of the aligned buffer
+	 */
+	buffer_offset = LIBBFIO_BUFFER_POOL_ALIGNMENT - (size_t) ( (intptr_t) buffer_data % LIBBFIO_BUFFER_POOL_ALIGNMENT );
+
+	if( buffer_offset < sizeof( uint8_t * ) )
+	{
+		buffer_offset += LIBBFIO_BUFFER_POOL_ALIGNMENT;
+	}
+	if( ( buffer_offset + internal_buffer_pool->buffer_size ) > ( internal_buffer_pool->buffer_size + LIBBFIO_BUFFER_POOL_ALIGNMENT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer offset value out of bounds.",
+		 function );
+
+		memory_free(
+		 buffer_data );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( buffer_data[ buffer_offset - sizeof( uint8_t * ) ] ),
+	     &buffer_data,
+	     sizeof( uint8_t * ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy buffer data reference.",
+		 function );
+
+		memory_free(
+		 buffer_data );
+
+		return( -1 );
+	}
+	*buffer = &( buffer_data[ buffer_offset ] );
+
+	return( 1 );
+}
+
+/* Frees an overflow buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_buffer_pool_free_overflow_buffer(
+     libbfio_internal_buffer_pool_t *internal_buffer_pool,
+     uint8_t *buffer,
+     libcerror_error_t **error )
+{
+	uint8_t *buffer_data  = NULL;
+	static char *function = "libbfio_internal_buffer_pool_free_overflow_buffer";
+
+	if( internal_buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( (intptr_t) buffer % LIBBFIO_BUFFER_POOL_ALIGNMENT ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported buffer - not aligned.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     &buffer_data,
+	     &( buffer[ -( (ssize_t) sizeof( uint8_t * ) ) ] ),
+	     sizeof( uint8_t * ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy buffer data reference.",
+		 function );
+
+		return( -1 );
+	}
+	memory_free(
+	 buffer_data );
+
+	return( 1 );
+}
+
@@ -0,0 +1,162 @@
+/*
+ * The buffer pool functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBBFIO_BUFFER_POOL_H )
+#define _LIBBFIO_BUFFER_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libbfio_extern.h"
+#include "libbfio_libcerror.h"
+#include "libbfio_libcthreads.h"
+#include "libbfio_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The per-thread free lists require thread-local storage and atomic operations
+ */
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO ) && defined( __GNUC__ )
+#define LIBBFIO_BUFFER_POOL_HAVE_THREAD_FREE_LIST	1
+#endif
+
+/* The alignment of the buffers
+ */
+#define LIBBFIO_BUFFER_POOL_ALIGNMENT			4096
+
+/* The maximum number of buffers in a per-thread free list
+ */
+#define LIBBFIO_BUFFER_POOL_MAXIMUM_THREAD_FREE_LIST_SIZE	4
+
+typedef struct libbfio_internal_buffer_pool libbfio_internal_buffer_pool_t;
+
+struct libbfio_internal_buffer_pool
+{
+	/* The size of a buffer
+	 */
+	size_t buffer_size;
+
+	/* The number of buffers in the arena
+	 */
+	int number_of_buffers;
+
+	/* The (allocated) arena data
+	 */
+	uint8_t *arena_data;
+
+	/* The arena, the aligned start of the arena data
+	 */
+	uint8_t *arena;
+
+	/* The buffers in the arena that are not in use
+	 */
+	uint8_t **free_buffers;
+
+	/* The number of buffers in the arena that are not in use
+	 */
+	int number_of_free_buffers;
+
+#if defined( LIBBFIO_BUFFER_POOL_HAVE_THREAD_FREE_LIST )
+	/* The identifier of the buffer pool in the per-thread free lists
+	 */
+	uint64_t identifier;
+
+	/* The maximum number of buffers in a per-thread free list
+	 */
+	int thread_free_list_size;
+#endif
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	/* The mutex that protects the buffers that are not in use
+	 */
+	libcthreads_mutex_t *free_buffers_mutex;
+#endif
+};
+
+#if defined( LIBBFIO_BUFFER_POOL_HAVE_THREAD_FREE_LIST )
+
+typedef struct libbfio_buffer_pool_thread_free_list libbfio_buffer_pool_thread_free_list_t;
+
+struct libbfio_buffer_pool_thread_free_list
+{
+	/* The identifier of the buffer pool the buffers belong to
+	 */
+	uint64_t buffer_pool_identifier;
+
+	/* The buffers
+	 */
+	uint8_t *buffers[ LIBBFIO_BUFFER_POOL_MAXIMUM_THREAD_FREE_LIST_SIZE ];
+
+	/* The number of buffers
+	 */
+	int number_of_buffers;
+};
+
+#endif /* defined( LIBBFIO_BUFFER_POOL_HAVE_THREAD_FREE_LIST ) */
+
+LIBBFIO_EXTERN \
+int libbfio_buffer_pool_initialize(
+     libbfio_buffer_pool_t **buffer_pool,
+     size_t buffer_size,
+     int number_of_buffers,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_buffer_pool_free(
+     libbfio_buffer_pool_t **buffer_pool,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_buffer_pool_get_buffer_size(
+     libbfio_buffer_pool_t *buffer_pool,
+     size_t *buffer_size,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_buffer_pool_get_buffer(
+     libbfio_buffer_pool_t *buffer_pool,
+     uint8_t **buffer,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_buffer_pool_release_buffer(
+     libbfio_buffer_pool_t *buffer_pool,
+     uint8_t *buffer,
+     libcerror_error_t **error );
+
+int libbfio_internal_buffer_pool_allocate_overflow_buffer(
+     libbfio_internal_buffer_pool_t *internal_buffer_pool,
+     uint8_t **buffer,
+     libcerror_error_t **error );
+
+int libbfio_internal_buffer_pool_free_overflow_buffer(
+     libbfio_internal_buffer_pool_t *internal_buffer_pool,
+     uint8_t *buffer,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBBFIO_BUFFER_POOL_H ) */
+
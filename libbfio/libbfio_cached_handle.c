@@ -0,0 +1,244 @@
+/*
+ * The cached handle functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libbfio_block_cache.h"
+#include "libbfio_cached_handle.h"
+#include "libbfio_cached_io_handle.h"
+#include "libbfio_definitions.h"
+#include "libbfio_handle.h"
+#include "libbfio_libcerror.h"
+#include "libbfio_types.h"
+
+/* Creates a cached handle
+ * The cached handle reads the data of the parent handle in blocks of block size
+ * and keeps the most recently used blocks, up to maximum cache size, in memory
+ * Reads that are larger than the block size bypass the cache
+ * Writes are passed to the parent handle and remove the corresponding blocks from the cache
+ * Data within a single block can be retrieved without copying with libbfio_handle_get_data_pointer
+ * The parent handle is not managed by the cached handle and must remain available
+ * while the cached handle is used
+ * Make sure the value handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_cached_handle_initialize(
+     libbfio_handle_t **handle,
+     libbfio_handle_t *parent_handle,
+     size_t block_size,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	libbfio_cached_io_handle_t *cached_io_handle = NULL;
+	static char *function                        = "libbfio_cached_handle_initialize";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_cached_io_handle_initialize(
+	     &cached_io_handle,
+	     parent_handle,
+	     block_size,
+	     maximum_cache_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create cached IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_initialize(
+	     handle,
+	     (intptr_t *) cached_io_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) libbfio_cached_io_handle_free,
+	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) libbfio_cached_io_handle_clone,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) libbfio_cached_io_handle_open,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libbfio_cached_io_handle_close,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) libbfio_cached_io_handle_read_buffer,
+	     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) libbfio_cached_io_handle_write_buffer,
+	     (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) libbfio_cached_io_handle_seek_offset,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libbfio_cached_io_handle_exists,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libbfio_cached_io_handle_is_open,
+	     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libbfio_cached_io_handle_get_size,
+	     LIBBFIO_FLAG_IO_HANDLE_MANAGED | LIBBFIO_FLAG_IO_HANDLE_CLONE_BY_FUNCTION,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_set_read_at_offset_function(
+	     *handle,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, off64_t, libcerror_error_t **)) libbfio_cached_io_handle_read_buffer_at_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set read at offset function.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libbfio_handle_set_write_at_offset_function(
+	     *handle,
+	     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, off64_t, libcerror_error_t **)) libbfio_cached_io_handle_write_buffer_at_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set write at offset function.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libbfio_handle_set_data_pointer_functions(
+	     *handle,
+	     (int (*)(intptr_t *, off64_t, size_t, const uint8_t **, libcerror_error_t **)) libbfio_cached_io_handle_get_data_pointer,
+	     (int (*)(intptr_t *, off64_t, const uint8_t *, libcerror_error_t **)) libbfio_cached_io_handle_release_data_pointer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set data pointer functions.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( cached_io_handle != NULL )
+	{
+		libbfio_cached_io_handle_free(
+		 &cached_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the cache statistics of the cached handle
+ * The number of hits and misses are counted per block
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_cached_handle_get_cache_statistics(
+     libbfio_handle_t *handle,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     uint64_t *number_of_evictions,
+     libcerror_error_t **error )
+{
+	libbfio_cached_io_handle_t *cached_io_handle = NULL;
+	libbfio_internal_handle_t *internal_handle   = NULL;
+	static char *function                        = "libbfio_cached_handle_get_cache_statistics";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	cached_io_handle = (libbfio_cached_io_handle_t *) internal_handle->io_handle;
+
+	if( libbfio_block_cache_get_statistics(
+	     cached_io_handle->block_cache,
+	     number_of_hits,
+	     number_of_misses,
+	     number_of_evictions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve block cache statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
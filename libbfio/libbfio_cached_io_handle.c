@@ -0,0 +1,1026 @@
+/*
+ * The cached IO handle functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libbfio_block_cache.h"
+#include "libbfio_cached_io_handle.h"
+#include "libbfio_definitions.h"
+#include "libbfio_handle.h"
+#include "libbfio_libcerror.h"
+#include "libbfio_types.h"
+#include "libbfio_unused.h"
+
+/* Creates a cached IO handle
+ * The parent handle is not managed by the cached IO handle and must remain
+ * available while the cached IO handle is used
+ * Make sure the value cached_io_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_cached_io_handle_initialize(
+     libbfio_cached_io_handle_t **cached_io_handle,
+     libbfio_handle_t *parent_handle,
+     size_t block_size,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_cached_io_handle_initialize";
+
+	if( cached_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cached IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cached_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid cached IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( parent_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parent handle.",
+		 function );
+
+		return( -1 );
+	}
+	*cached_io_handle = memory_allocate_structure(
+	                     libbfio_cached_io_handle_t );
+
+	if( *cached_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cached IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *cached_io_handle,
+	     0,
+	     sizeof( libbfio_cached_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cached IO handle.",
+		 function );
+
+		memory_free(
+		 *cached_io_handle );
+
+		*cached_io_handle = NULL;
+
+		return( -1 );
+	}
+	if( libbfio_block_cache_initialize(
+	     &( ( *cached_io_handle )->block_cache ),
+	     block_size,
+	     maximum_cache_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create block cache.",
+		 function );
+
+		goto on_error;
+	}
+	( *cached_io_handle )->parent_handle      = parent_handle;
+	( *cached_io_handle )->block_size         = block_size;
+	( *cached_io_handle )->maximum_cache_size = maximum_cache_size;
+
+	return( 1 );
+
+on_error:
+	if( *cached_io_handle != NULL )
+	{
+		memory_free(
+		 *cached_io_handle );
+
+		*cached_io_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a cached IO handle
+ * Returns 1 if succesful or -1 on error
+ */
+int libbfio_cached_io_handle_free(
+     libbfio_cached_io_handle_t **cached_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_cached_io_handle_free";
+	int result            = 1;
+
+	if( cached_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cached IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cached_io_handle != NULL )
+	{
+		if( libbfio_block_cache_free(
+		     &( ( *cached_io_handle )->block_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free block cache.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *cached_io_handle );
+
+		*cached_io_handle = NULL;
+	}
+	return( result );
+}
+
+/* Clones (duplicates) the cached IO handle and its attributes
+ * The destination cached IO handle uses the same parent handle with an empty block cache
+ * Returns 1 if succesful or -1 on error
+ */
+int libbfio_cached_io_handle_clone(
+     libbfio_cached_io_handle_t **destination_cached_io_handle,
+     libbfio_cached_io_handle_t *source_cached_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_cached_io_handle_clone";
+
+	if( destination_cached_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination cached IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_cached_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: destination cached IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_cached_io_handle == NULL )
+	{
+		*destination_cached_io_handle = NULL;
+
+		return( 1 );
+	}
+	if( libbfio_cached_io_handle_initialize(
+	     destination_cached_io_handle,
+	     source_cached_io_handle->parent_handle,
+	     source_cached_io_handle->block_size,
+	     source_cached_io_handle->maximum_cache_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create cached IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_cached_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing destination cached IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	( *destination_cached_io_handle )->current_offset = source_cached_io_handle->current_offset;
+	( *destination_cached_io_handle )->access_flags   = source_cached_io_handle->access_flags;
+
+	return( 1 );
+}
+
+/* Opens the cached IO handle
+ * The parent handle is opened if it is not open
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_cached_io_handle_open(
+     libbfio_cached_io_handle_t *cached_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_cached_io_handle_open";
+	int result            = 0;
+
+	if( cached_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cached IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( cached_io_handle->is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid cached IO handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	/* Either read or write flag should be set
+	 */
+	if( ( ( access_flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags: 0x%02x.",
+		 function,
+		 access_flags );
+
+		return( -1 );
+	}
+	result = libbfio_handle_is_open(
+	          cached_io_handle->parent_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if parent handle is open.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		if( libbfio_handle_open(
+		     cached_io_handle->parent_handle,
+		     access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open parent handle.",
+			 function );
+
+			return( -1 );
+		}
+		cached_io_handle->close_parent_handle = 1;
+	}
+	cached_io_handle->current_offset = 0;
+	cached_io_handle->access_flags   = access_flags;
+	cached_io_handle->is_open        = 1;
+
+	return( 1 );
+}
+
+/* Closes the cached IO handle
+ * The block cache is emptied and the parent handle is closed if it was opened by the cached IO handle
+ * Returns 0 if successful or -1 on error
+ */
+int libbfio_cached_io_handle_close(
+     libbfio_cached_io_handle_t *cached_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_cached_io_handle_close";
+	int result            = 0;
+
+	if( cached_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cached IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( cached_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cached IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_block_cache_empty(
+	     cached_io_handle->block_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty block cache.",
+		 function );
+
+		result = -1;
+	}
+	if( cached_io_handle->close_parent_handle != 0 )
+	{
+		if( libbfio_handle_close(
+		     cached_io_handle->parent_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close parent handle.",
+			 function );
+
+			result = -1;
+		}
+		cached_io_handle->close_parent_handle = 0;
+	}
+	cached_io_handle->is_open = 0;
+
+	return( result );
+}
+
+/* Reads a buffer from the cached IO handle
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libbfio_cached_io_handle_read_buffer(
+         libbfio_cached_io_handle_t *cached_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function = "libbfio_cached_io_handle_read_buffer";
+	ssize_t read_count    = 0;
+
+	if( cached_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cached IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_cached_io_handle_read_buffer_at_offset(
+	              cached_io_handle,
+	              buffer,
+	              size,
+	              cached_io_handle->current_offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer.",
+		 function );
+
+		return( -1 );
+	}
+	cached_io_handle->current_offset += (off64_t) read_count;
+
+	return( read_count );
+}
+
+/* Reads a buffer at a specific offset from the cached IO handle
+ * This function does not change the current offset of the cached IO handle
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libbfio_cached_io_handle_read_buffer_at_offset(
+         libbfio_cached_io_handle_t *cached_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libbfio_cached_io_handle_read_buffer_at_offset";
+	ssize_t read_count    = 0;
+
+	if( cached_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cached IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( cached_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cached IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( cached_io_handle->access_flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cached IO handle - no read access.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_block_cache_read_buffer_at_offset(
+	              cached_io_handle->block_cache,
+	              0,
+	              (intptr_t *) cached_io_handle,
+	              (ssize_t (*)(intptr_t *, int, uint8_t *, size_t, off64_t, libcerror_error_t **)) libbfio_cached_io_handle_read_parent_buffer_at_offset,
+	              buffer,
+	              size,
+	              offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ") from block cache.",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Retrieves a pointer to size bytes of data at a specific offset from the block cache
+ * Returns 1 if successful, 0 if the data is not available in a single block or -1 on error
+ */
+int libbfio_cached_io_handle_get_data_pointer(
+     libbfio_cached_io_handle_t *cached_io_handle,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_cached_io_handle_get_data_pointer";
+	int result            = 0;
+
+	if( cached_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cached IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( cached_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cached IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( cached_io_handle->access_flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cached IO handle - no read access.",
+		 function );
+
+		return( -1 );
+	}
+	result = libbfio_block_cache_get_data_pointer(
+	          cached_io_handle->block_cache,
+	          0,
+	          (intptr_t *) cached_io_handle,
+	          (ssize_t (*)(intptr_t *, int, uint8_t *, size_t, off64_t, libcerror_error_t **)) libbfio_cached_io_handle_read_parent_buffer_at_offset,
+	          offset,
+	          size,
+	          data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data pointer at offset: %" PRIi64 " (0x%08" PRIx64 ") from block cache.",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Releases a pointer to data retrieved with libbfio_cached_io_handle_get_data_pointer
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_cached_io_handle_release_data_pointer(
+     libbfio_cached_io_handle_t *cached_io_handle,
+     off64_t offset,
+     const uint8_t *data,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_cached_io_handle_release_data_pointer";
+
+	if( cached_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cached IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_block_cache_release_data_pointer(
+	     cached_io_handle->block_cache,
+	     0,
+	     offset,
+	     data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release data pointer at offset: %" PRIi64 " (0x%08" PRIx64 ") from block cache.",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads a buffer at a specific offset from the parent handle
+ * This function is used by the block cache to read the data that is not cached
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libbfio_cached_io_handle_read_parent_buffer_at_offset(
+         libbfio_cached_io_handle_t *cached_io_handle,
+         int entry LIBBFIO_ATTRIBUTE_UNUSED,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libbfio_cached_io_handle_read_parent_buffer_at_offset";
+	ssize_t read_count    = 0;
+
+	LIBBFIO_UNREFERENCED_PARAMETER( entry )
+
+	if( cached_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cached IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              cached_io_handle->parent_handle,
+	              buffer,
+	              size,
+	              offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ") from parent handle.",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Writes a buffer to the cached IO handle
+ * Returns the number of bytes written if successful, or -1 on error
+ */
+ssize_t libbfio_cached_io_handle_write_buffer(
+         libbfio_cached_io_handle_t *cached_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function = "libbfio_cached_io_handle_write_buffer";
+	ssize_t write_count   = 0;
+
+	if( cached_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cached IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	write_count = libbfio_cached_io_handle_write_buffer_at_offset(
+	               cached_io_handle,
+	               buffer,
+	               size,
+	               cached_io_handle->current_offset,
+	               error );
+
+	if( write_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write buffer.",
+		 function );
+
+		return( -1 );
+	}
+	cached_io_handle->current_offset += (off64_t) write_count;
+
+	return( write_count );
+}
+
+/* Writes a buffer at a specific offset to the cached IO handle
+ * The data is written to the parent handle and the corresponding cached blocks are removed
+ * This function does not change the current offset of the cached IO handle
+ * Returns the number of bytes written if successful, or -1 on error
+ */
+ssize_t libbfio_cached_io_handle_write_buffer_at_offset(
+         libbfio_cached_io_handle_t *cached_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libbfio_cached_io_handle_write_buffer_at_offset";
+	ssize_t write_count   = 0;
+
+	if( cached_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cached IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( cached_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cached IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( cached_io_handle->access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cached IO handle - no write access.",
+		 function );
+
+		return( -1 );
+	}
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               cached_io_handle->parent_handle,
+	               buffer,
+	               size,
+	               offset,
+	               error );
+
+	if( write_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write buffer at offset: %" PRIi64 " (0x%08" PRIx64 ") to parent handle.",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	if( libbfio_block_cache_invalidate_range(
+	     cached_io_handle->block_cache,
+	     0,
+	     offset,
+	     (size64_t) write_count,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to invalidate block cache range.",
+		 function );
+
+		return( -1 );
+	}
+	return( write_count );
+}
+
+/* Seeks a certain offset within the cached IO handle
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t libbfio_cached_io_handle_seek_offset(
+         libbfio_cached_io_handle_t *cached_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libbfio_cached_io_handle_seek_offset";
+	size64_t size         = 0;
+
+	if( cached_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cached IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( cached_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cached IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += cached_io_handle->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		if( libbfio_handle_get_size(
+		     cached_io_handle->parent_handle,
+		     &size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve parent handle size.",
+			 function );
+
+			return( -1 );
+		}
+		offset += (off64_t) size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset.",
+		 function );
+
+		return( -1 );
+	}
+	cached_io_handle->current_offset = offset;
+
+	return( offset );
+}
+
+/* Function to determine if the parent handle exists
+ * Returns 1 if the parent handle exists, 0 if not or -1 on error
+ */
+int libbfio_cached_io_handle_exists(
+     libbfio_cached_io_handle_t *cached_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_cached_io_handle_exists";
+	int result            = 0;
+
+	if( cached_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cached IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libbfio_handle_exists(
+	          cached_io_handle->parent_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if parent handle exists.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Check if the cached IO handle is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int libbfio_cached_io_handle_is_open(
+     libbfio_cached_io_handle_t *cached_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_cached_io_handle_is_open";
+
+	if( cached_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cached IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( cached_io_handle->is_open == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the parent handle
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_cached_io_handle_get_size(
+     libbfio_cached_io_handle_t *cached_io_handle,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_cached_io_handle_get_size";
+
+	if( cached_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cached IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     cached_io_handle->parent_handle,
+	     size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve parent handle size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,169 @@
+/*
+ * The cached IO handle functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBBFIO_CACHED_IO_HANDLE_H )
+#define _LIBBFIO_CACHED_IO_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libbfio_block_cache.h"
+#include "libbfio_libcerror.h"
+#include "libbfio_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libbfio_cached_io_handle libbfio_cached_io_handle_t;
+
+struct libbfio_cached_io_handle
+{
+	/* The parent handle
+	 */
+	libbfio_handle_t *parent_handle;
+
+	/* The block cache
+	 */
+	libbfio_block_cache_t *block_cache;
+
+	/* The block size
+	 */
+	size_t block_size;
+
+	/* The maximum cache size
+	 */
+	size64_t maximum_cache_size;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* Value to indicate the cached IO handle is open
+	 */
+	uint8_t is_open;
+
+	/* Value to indicate the parent handle was opened by the cached IO handle
+	 */
+	uint8_t close_parent_handle;
+
+	/* The current access flags
+	 */
+	int access_flags;
+};
+
+int libbfio_cached_io_handle_initialize(
+     libbfio_cached_io_handle_t **cached_io_handle,
+     libbfio_handle_t *parent_handle,
+     size_t block_size,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+int libbfio_cached_io_handle_free(
+     libbfio_cached_io_handle_t **cached_io_handle,
+     libcerror_error_t **error );
+
+int libbfio_cached_io_handle_clone(
+     libbfio_cached_io_handle_t **destination_cached_io_handle,
+     libbfio_cached_io_handle_t *source_cached_io_handle,
+     libcerror_error_t **error );
+
+int libbfio_cached_io_handle_open(
+     libbfio_cached_io_handle_t *cached_io_handle,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libbfio_cached_io_handle_close(
+     libbfio_cached_io_handle_t *cached_io_handle,
+     libcerror_error_t **error );
+
+ssize_t libbfio_cached_io_handle_read_buffer(
+         libbfio_cached_io_handle_t *cached_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+ssize_t libbfio_cached_io_handle_read_buffer_at_offset(
+         libbfio_cached_io_handle_t *cached_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+int libbfio_cached_io_handle_get_data_pointer(
+     libbfio_cached_io_handle_t *cached_io_handle,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error );
+
+int libbfio_cached_io_handle_release_data_pointer(
+     libbfio_cached_io_handle_t *cached_io_handle,
+     off64_t offset,
+     const uint8_t *data,
+     libcerror_error_t **error );
+
+ssize_t libbfio_cached_io_handle_read_parent_buffer_at_offset(
+         libbfio_cached_io_handle_t *cached_io_handle,
+         int entry,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+ssize_t libbfio_cached_io_handle_write_buffer(
+         libbfio_cached_io_handle_t *cached_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+ssize_t libbfio_cached_io_handle_write_buffer_at_offset(
+         libbfio_cached_io_handle_t *cached_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+off64_t libbfio_cached_io_handle_seek_offset(
+         libbfio_cached_io_handle_t *cached_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+int libbfio_cached_io_handle_exists(
+     libbfio_cached_io_handle_t *cached_io_handle,
+     libcerror_error_t **error );
+
+int libbfio_cached_io_handle_is_open(
+     libbfio_cached_io_handle_t *cached_io_handle,
+     libcerror_error_t **error );
+
+int libbfio_cached_io_handle_get_size(
+     libbfio_cached_io_handle_t *cached_io_handle,
+     size64_t *size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBBFIO_CACHED_IO_HANDLE_H ) */
+
@@ -0,0 +1,1892 @@
+/*
+ * The descriptor cache functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_SYS_RESOURCE_H )
+#include <sys/resource.h>
+#endif
+
+#if defined( WINAPI )
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#include "libbfio_definitions.h"
+#include "libbfio_descriptor_cache.h"
+#include "libbfio_handle.h"
+#include "libbfio_libcerror.h"
+#include "libbfio_libcthreads.h"
+#include "libbfio_types.h"
+
+/* Creates a descriptor cache
+ * The descriptor cache keeps the descriptors of handles that are opened on demand
+ * open after a read, up to the maximum number of open descriptors
+ * A maximum number of open descriptors of LIBBFIO_DESCRIPTOR_CACHE_AUTOMATIC_NUMBER_OF_OPEN_DESCRIPTORS
+ * determines the maximum from the limit of the number of open files of the process
+ * When another descriptor needs to be opened the least recently used idle descriptor is closed
+ * The file shared by file range handles is accounted for as one descriptor
+ * A descriptor that has not been used for the idle timeout, in milliseconds, is closed,
+ * if multi-threading is supported by a background thread, otherwise when the descriptor
+ * cache is used or by libbfio_descriptor_cache_close_idle_descriptors
+ * An idle timeout of 0 represents that descriptors are only closed to stay within
+ * the maximum number of open descriptors
+ * Make sure the value descriptor_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_descriptor_cache_initialize(
+     libbfio_descriptor_cache_t **descriptor_cache,
+     int maximum_number_of_open_descriptors,
+     uint32_t idle_timeout,
+     libcerror_error_t **error )
+{
+	libbfio_internal_descriptor_cache_t *internal_descriptor_cache = NULL;
+	static char *function                                          = "libbfio_descriptor_cache_initialize";
+
+	if( descriptor_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *descriptor_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid descriptor cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_open_descriptors < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of open descriptors value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_open_descriptors == LIBBFIO_DESCRIPTOR_CACHE_AUTOMATIC_NUMBER_OF_OPEN_DESCRIPTORS )
+	{
+		if( libbfio_internal_descriptor_cache_get_automatic_maximum_number_of_open_descriptors(
+		     &maximum_number_of_open_descriptors,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine maximum number of open descriptors.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_descriptor_cache = memory_allocate_structure(
+	                             libbfio_internal_descriptor_cache_t );
+
+	if( internal_descriptor_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create descriptor cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_descriptor_cache,
+	     0,
+	     sizeof( libbfio_internal_descriptor_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear descriptor cache.",
+		 function );
+
+		memory_free(
+		 internal_descriptor_cache );
+
+		return( -1 );
+	}
+	internal_descriptor_cache->maximum_number_of_open_descriptors = maximum_number_of_open_descriptors;
+	internal_descriptor_cache->idle_timeout                       = idle_timeout;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_initialize(
+	     &( internal_descriptor_cache->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+#if defined( LIBBFIO_DESCRIPTOR_CACHE_HAVE_EXPIRY_THREAD )
+	if( idle_timeout != 0 )
+	{
+		if( libcthreads_thread_create(
+		     &( internal_descriptor_cache->expiry_thread ),
+		     NULL,
+		     (int (*)(void *)) &libbfio_internal_descriptor_cache_expire_idle_handles,
+		     (void *) internal_descriptor_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create expiry thread.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	*descriptor_cache = (libbfio_descriptor_cache_t *) internal_descriptor_cache;
+
+	return( 1 );
+
+on_error:
+	if( internal_descriptor_cache != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+		if( internal_descriptor_cache->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( internal_descriptor_cache->mutex ),
+			 NULL );
+		}
+#endif
+		memory_free(
+		 internal_descriptor_cache );
+	}
+	return( -1 );
+}
+
+/* Frees a descriptor cache
+ * The descriptor cache cannot be freed while it is used by handles
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_descriptor_cache_free(
+     libbfio_descriptor_cache_t **descriptor_cache,
+     libcerror_error_t **error )
+{
+	libbfio_internal_descriptor_cache_t *internal_descriptor_cache = NULL;
+	static char *function                                          = "libbfio_descriptor_cache_free";
+	int result                                                     = 1;
+
+	if( descriptor_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *descriptor_cache != NULL )
+	{
+		internal_descriptor_cache = (libbfio_internal_descriptor_cache_t *) *descriptor_cache;
+
+		if( internal_descriptor_cache->number_of_handles != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid descriptor cache - still used by: %d handles.",
+			 function,
+			 internal_descriptor_cache->number_of_handles );
+
+			return( -1 );
+		}
+		*descriptor_cache = NULL;
+
+#if defined( LIBBFIO_DESCRIPTOR_CACHE_HAVE_EXPIRY_THREAD )
+		if( internal_descriptor_cache->expiry_thread != NULL )
+		{
+			if( libbfio_internal_descriptor_cache_stop_expiry_thread(
+			     internal_descriptor_cache,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to stop expiry thread.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+		if( libcthreads_mutex_free(
+		     &( internal_descriptor_cache->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 internal_descriptor_cache );
+	}
+	return( result );
+}
+
+/* Determines the maximum number of open descriptors from the limit of the number of open files
+ * of the process, a quarter of the limit is left for descriptors that are not in a descriptor cache
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_descriptor_cache_get_automatic_maximum_number_of_open_descriptors(
+     int *maximum_number_of_open_descriptors,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_GETRLIMIT ) && defined( RLIMIT_NOFILE )
+	struct rlimit resource_limit;
+#endif
+
+	static char *function  = "libbfio_internal_descriptor_cache_get_automatic_maximum_number_of_open_descriptors";
+	int open_files_limit   = LIBBFIO_DESCRIPTOR_CACHE_DEFAULT_OPEN_FILES_LIMIT;
+
+	if( maximum_number_of_open_descriptors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum number of open descriptors.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_GETRLIMIT ) && defined( RLIMIT_NOFILE )
+	if( getrlimit(
+	     RLIMIT_NOFILE,
+	     &resource_limit ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve open files limit.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( resource_limit.rlim_cur == RLIM_INFINITY )
+	 || ( resource_limit.rlim_cur > (rlim_t) INT_MAX ) )
+	{
+		open_files_limit = INT_MAX;
+	}
+	else
+	{
+		open_files_limit = (int) resource_limit.rlim_cur;
+	}
+#endif
+	*maximum_number_of_open_descriptors = open_files_limit - ( open_files_limit / 4 );
+
+	if( *maximum_number_of_open_descriptors < 1 )
+	{
+		*maximum_number_of_open_descriptors = 1;
+	}
+	return( 1 );
+}
+
+/* Retrieves the current time of a monotonic clock in milliseconds
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_descriptor_cache_get_current_time(
+     uint64_t *current_time,
+     libcerror_error_t **error )
+{
+#if !defined( WINAPI ) && defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_value;
+#endif
+
+	static char *function = "libbfio_internal_descriptor_cache_get_current_time";
+
+	if( current_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current time.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+	*current_time = (uint64_t) GetTickCount64();
+
+#elif defined( WINAPI )
+	*current_time = (uint64_t) GetTickCount();
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve monotonic clock time.",
+		 function );
+
+		return( -1 );
+	}
+	*current_time = ( (uint64_t) time_value.tv_sec * 1000 ) + (uint64_t) ( time_value.tv_nsec / 1000000 );
+
+#else
+	*current_time = (uint64_t) time( NULL ) * 1000;
+
+#endif
+	return( 1 );
+}
+
+#if defined( LIBBFIO_DESCRIPTOR_CACHE_HAVE_EXPIRY_THREAD )
+
+/* Suspends the calling thread for a number of milliseconds
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_descriptor_cache_sleep(
+     uint32_t milliseconds,
+     libcerror_error_t **error )
+{
+#if !defined( WINAPI )
+	struct timespec time_value;
+#endif
+
+	static char *function = "libbfio_internal_descriptor_cache_sleep";
+
+#if defined( WINAPI )
+	Sleep(
+	 (DWORD) milliseconds );
+
+#else
+	time_value.tv_sec  = (time_t) ( milliseconds / 1000 );
+	time_value.tv_nsec = (long) ( milliseconds % 1000 ) * 1000000;
+
+	/* The remaining time is slept again if the sleep was interrupted by a signal
+	 */
+	while( nanosleep(
+	        &time_value,
+	        &time_value ) != 0 )
+	{
+		if( errno != EINTR )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 errno,
+			 "%s: unable to sleep.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( 1 );
+}
+
+/* Closes the descriptors that exceeded the idle timeout until the expiry thread is stopped
+ * The descriptors are checked every half of the idle timeout, at most every second,
+ * hence a descriptor is closed at most one and a half times the idle timeout after it was last used
+ * This function is used as the expiry thread callback function
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_descriptor_cache_expire_idle_handles(
+     libbfio_internal_descriptor_cache_t *internal_descriptor_cache )
+{
+	libcerror_error_t *error   = NULL;
+	uint32_t elapsed_time      = 0;
+	uint32_t expiry_interval   = 0;
+	uint32_t sleep_interval    = 0;
+	uint8_t stop_expiry_thread = 0;
+
+	if( internal_descriptor_cache == NULL )
+	{
+		return( -1 );
+	}
+	expiry_interval = internal_descriptor_cache->idle_timeout / 2;
+
+	if( expiry_interval < LIBBFIO_DESCRIPTOR_CACHE_EXPIRY_SLEEP_INTERVAL )
+	{
+		expiry_interval = LIBBFIO_DESCRIPTOR_CACHE_EXPIRY_SLEEP_INTERVAL;
+	}
+	else if( expiry_interval > LIBBFIO_DESCRIPTOR_CACHE_MAXIMUM_EXPIRY_INTERVAL )
+	{
+		expiry_interval = LIBBFIO_DESCRIPTOR_CACHE_MAXIMUM_EXPIRY_INTERVAL;
+	}
+	while( stop_expiry_thread == 0 )
+	{
+		/* The thread sleeps in short intervals so that it stops shortly after it was requested
+		 */
+		sleep_interval = expiry_interval - elapsed_time;
+
+		if( sleep_interval > LIBBFIO_DESCRIPTOR_CACHE_EXPIRY_SLEEP_INTERVAL )
+		{
+			sleep_interval = LIBBFIO_DESCRIPTOR_CACHE_EXPIRY_SLEEP_INTERVAL;
+		}
+		if( libbfio_internal_descriptor_cache_sleep(
+		     sleep_interval,
+		     &error ) != 1 )
+		{
+			libcerror_error_free(
+			 &error );
+		}
+		elapsed_time += sleep_interval;
+
+		if( libcthreads_mutex_grab(
+		     internal_descriptor_cache->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_free(
+			 &error );
+
+			return( -1 );
+		}
+		stop_expiry_thread = internal_descriptor_cache->stop_expiry_thread;
+
+		if( ( stop_expiry_thread == 0 )
+		 && ( elapsed_time >= expiry_interval ) )
+		{
+			/* A descriptor that cannot be closed is no longer counted as open,
+			 * hence the next check continues with the other descriptors
+			 */
+			if( libbfio_internal_descriptor_cache_close_idle_handles(
+			     internal_descriptor_cache,
+			     internal_descriptor_cache->maximum_number_of_open_descriptors,
+			     &error ) != 1 )
+			{
+				libcerror_error_free(
+				 &error );
+			}
+			elapsed_time = 0;
+		}
+		if( libcthreads_mutex_release(
+		     internal_descriptor_cache->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_free(
+			 &error );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Stops the expiry thread
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_descriptor_cache_stop_expiry_thread(
+     libbfio_internal_descriptor_cache_t *internal_descriptor_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_internal_descriptor_cache_stop_expiry_thread";
+
+	if( internal_descriptor_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     internal_descriptor_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	internal_descriptor_cache->stop_expiry_thread = 1;
+
+	if( libcthreads_mutex_release(
+	     internal_descriptor_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_thread_join(
+	     &( internal_descriptor_cache->expiry_thread ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join expiry thread.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( LIBBFIO_DESCRIPTOR_CACHE_HAVE_EXPIRY_THREAD ) */
+
+/* Removes a handle from the idle list
+ * This function is not multi-thread safe acquire the mutex before call
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_descriptor_cache_remove_handle_from_idle_list(
+     libbfio_internal_descriptor_cache_t *internal_descriptor_cache,
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_internal_descriptor_cache_remove_handle_from_idle_list";
+
+	if( internal_descriptor_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->descriptor_cache_in_idle_list == 0 )
+	{
+		return( 1 );
+	}
+	if( internal_handle->descriptor_cache_previous_handle != NULL )
+	{
+		internal_handle->descriptor_cache_previous_handle->descriptor_cache_next_handle = internal_handle->descriptor_cache_next_handle;
+	}
+	else
+	{
+		internal_descriptor_cache->idle_list_first_handle = internal_handle->descriptor_cache_next_handle;
+	}
+	if( internal_handle->descriptor_cache_next_handle != NULL )
+	{
+		internal_handle->descriptor_cache_next_handle->descriptor_cache_previous_handle = internal_handle->descriptor_cache_previous_handle;
+	}
+	else
+	{
+		internal_descriptor_cache->idle_list_last_handle = internal_handle->descriptor_cache_previous_handle;
+	}
+	internal_handle->descriptor_cache_previous_handle = NULL;
+	internal_handle->descriptor_cache_next_handle     = NULL;
+	internal_handle->descriptor_cache_in_idle_list    = 0;
+
+	return( 1 );
+}
+
+/* Accounts for the descriptor of a handle that is about to be opened
+ * If the maximum number of open descriptors has been reached the least recently used
+ * idle descriptors are closed first
+ * A descriptor that is shared by multiple handles is accounted for once,
+ * when the first of the handles opens it
+ * This function is not multi-thread safe acquire the mutex before call
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_descriptor_cache_append_open_descriptor(
+     libbfio_internal_descriptor_cache_t *internal_descriptor_cache,
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	libbfio_descriptor_cache_shared_descriptor_t *shared_descriptor = NULL;
+	static char *function                                           = "libbfio_internal_descriptor_cache_append_open_descriptor";
+
+	if( internal_descriptor_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->descriptor_cache_is_open != 0 )
+	{
+		return( 1 );
+	}
+	if( internal_handle->descriptor_cache_shared_key != NULL )
+	{
+		shared_descriptor = internal_descriptor_cache->first_shared_descriptor;
+
+		while( shared_descriptor != NULL )
+		{
+			if( shared_descriptor->key == internal_handle->descriptor_cache_shared_key )
+			{
+				break;
+			}
+			shared_descriptor = shared_descriptor->next_shared_descriptor;
+		}
+		/* The shared descriptor is already open by another handle
+		 */
+		if( shared_descriptor != NULL )
+		{
+			shared_descriptor->number_of_open_handles += 1;
+
+			internal_handle->descriptor_cache_is_open = 1;
+
+			return( 1 );
+		}
+		shared_descriptor = memory_allocate_structure(
+		                     libbfio_descriptor_cache_shared_descriptor_t );
+
+		if( shared_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create shared descriptor.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libbfio_internal_descriptor_cache_close_idle_handles(
+	     internal_descriptor_cache,
+	     internal_descriptor_cache->maximum_number_of_open_descriptors - 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close idle handles.",
+		 function );
+
+		if( shared_descriptor != NULL )
+		{
+			memory_free(
+			 shared_descriptor );
+		}
+		return( -1 );
+	}
+	if( shared_descriptor != NULL )
+	{
+		shared_descriptor->key                    = internal_handle->descriptor_cache_shared_key;
+		shared_descriptor->number_of_open_handles = 1;
+		shared_descriptor->next_shared_descriptor = internal_descriptor_cache->first_shared_descriptor;
+
+		internal_descriptor_cache->first_shared_descriptor = shared_descriptor;
+	}
+	internal_handle->descriptor_cache_is_open = 1;
+
+	internal_descriptor_cache->number_of_open_descriptors += 1;
+
+	if( internal_descriptor_cache->number_of_open_descriptors > internal_descriptor_cache->peak_number_of_open_descriptors )
+	{
+		internal_descriptor_cache->peak_number_of_open_descriptors = internal_descriptor_cache->number_of_open_descriptors;
+	}
+	return( 1 );
+}
+
+/* Removes the accounting of the descriptor of a handle
+ * A descriptor that is shared by multiple handles is no longer accounted for
+ * when the last of the handles closes it
+ * This function is not multi-thread safe acquire the mutex before call
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_descriptor_cache_remove_open_descriptor(
+     libbfio_internal_descriptor_cache_t *internal_descriptor_cache,
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	libbfio_descriptor_cache_shared_descriptor_t *previous_shared_descriptor = NULL;
+	libbfio_descriptor_cache_shared_descriptor_t *shared_descriptor          = NULL;
+	static char *function                                                    = "libbfio_internal_descriptor_cache_remove_open_descriptor";
+
+	if( internal_descriptor_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->descriptor_cache_is_open == 0 )
+	{
+		return( 1 );
+	}
+	internal_handle->descriptor_cache_is_open = 0;
+
+	if( internal_handle->descriptor_cache_shared_key != NULL )
+	{
+		shared_descriptor = internal_descriptor_cache->first_shared_descriptor;
+
+		while( shared_descriptor != NULL )
+		{
+			if( shared_descriptor->key == internal_handle->descriptor_cache_shared_key )
+			{
+				break;
+			}
+			previous_shared_descriptor = shared_descriptor;
+			shared_descriptor          = shared_descriptor->next_shared_descriptor;
+		}
+		if( shared_descriptor != NULL )
+		{
+			shared_descriptor->number_of_open_handles -= 1;
+
+			/* The shared descriptor is still open by another handle
+			 */
+			if( shared_descriptor->number_of_open_handles > 0 )
+			{
+				return( 1 );
+			}
+			if( previous_shared_descriptor != NULL )
+			{
+				previous_shared_descriptor->next_shared_descriptor = shared_descriptor->next_shared_descriptor;
+			}
+			else
+			{
+				internal_descriptor_cache->first_shared_descriptor = shared_descriptor->next_shared_descriptor;
+			}
+			memory_free(
+			 shared_descriptor );
+		}
+	}
+	internal_descriptor_cache->number_of_open_descriptors -= 1;
+
+	return( 1 );
+}
+
+/* Closes the descriptor of an idle handle
+ * The descriptor is closed without the read/write lock of the handle, this is safe
+ * since a handle in the idle list is not used until it is acquired again
+ * This function is not multi-thread safe acquire the mutex before call
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_descriptor_cache_close_handle(
+     libbfio_internal_descriptor_cache_t *internal_descriptor_cache,
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_internal_descriptor_cache_close_handle";
+	int result            = 1;
+
+	if( internal_descriptor_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->close == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing close function.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_internal_descriptor_cache_remove_handle_from_idle_list(
+	     internal_descriptor_cache,
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove handle from idle list.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->descriptor_cache_is_open == 0 )
+	{
+		return( 1 );
+	}
+	/* The descriptor is no longer counted as open even if closing it fails
+	 */
+	if( internal_handle->close(
+	     internal_handle->io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close handle.",
+		 function );
+
+		result = -1;
+	}
+	if( libbfio_internal_descriptor_cache_remove_open_descriptor(
+	     internal_descriptor_cache,
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove open descriptor.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Closes the descriptors of the least recently used idle handles while there are more than
+ * the maximum number of open descriptors and the descriptors that exceeded the idle timeout
+ * This function is not multi-thread safe acquire the mutex before call
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_descriptor_cache_close_idle_handles(
+     libbfio_internal_descriptor_cache_t *internal_descriptor_cache,
+     int maximum_number_of_open_descriptors,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_internal_descriptor_cache_close_idle_handles";
+	uint64_t current_time                      = 0;
+	int number_of_open_descriptors             = 0;
+
+	if( internal_descriptor_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_descriptor_cache->idle_timeout != 0 )
+	{
+		if( libbfio_internal_descriptor_cache_get_current_time(
+		     &current_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve current time.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The idle list is ordered by the time the handles were last used
+	 * hence only the least recently used handles need to be checked
+	 */
+	internal_handle = internal_descriptor_cache->idle_list_last_handle;
+
+	while( internal_handle != NULL )
+	{
+		if( internal_descriptor_cache->number_of_open_descriptors <= maximum_number_of_open_descriptors )
+		{
+			if( internal_descriptor_cache->idle_timeout == 0 )
+			{
+				break;
+			}
+			if( ( current_time - internal_handle->descriptor_cache_last_used_time ) < (uint64_t) internal_descriptor_cache->idle_timeout )
+			{
+				break;
+			}
+		}
+		number_of_open_descriptors = internal_descriptor_cache->number_of_open_descriptors;
+
+		if( libbfio_internal_descriptor_cache_close_handle(
+		     internal_descriptor_cache,
+		     internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close idle handle.",
+			 function );
+
+			return( -1 );
+		}
+		/* Closing a handle of a shared descriptor that is still open by another handle
+		 * does not close a descriptor
+		 */
+		if( internal_descriptor_cache->number_of_open_descriptors < number_of_open_descriptors )
+		{
+			if( number_of_open_descriptors > maximum_number_of_open_descriptors )
+			{
+				internal_descriptor_cache->number_of_evictions += 1;
+			}
+			else
+			{
+				internal_descriptor_cache->number_of_expirations += 1;
+			}
+		}
+		internal_handle = internal_descriptor_cache->idle_list_last_handle;
+	}
+	return( 1 );
+}
+
+/* Retrieves the maximum number of open descriptors
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_descriptor_cache_get_maximum_number_of_open_descriptors(
+     libbfio_descriptor_cache_t *descriptor_cache,
+     int *maximum_number_of_open_descriptors,
+     libcerror_error_t **error )
+{
+	libbfio_internal_descriptor_cache_t *internal_descriptor_cache = NULL;
+	static char *function                                          = "libbfio_descriptor_cache_get_maximum_number_of_open_descriptors";
+
+	if( descriptor_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_open_descriptors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum number of open descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	internal_descriptor_cache = (libbfio_internal_descriptor_cache_t *) descriptor_cache;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     internal_descriptor_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*maximum_number_of_open_descriptors = internal_descriptor_cache->maximum_number_of_open_descriptors;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     internal_descriptor_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the descriptor cache statistics
+ * The number of evictions is the number of descriptors closed to stay within
+ * the maximum number of open descriptors and the number of expirations the number
+ * of descriptors closed since they exceeded the idle timeout
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_descriptor_cache_get_statistics(
+     libbfio_descriptor_cache_t *descriptor_cache,
+     int *number_of_open_descriptors,
+     int *peak_number_of_open_descriptors,
+     uint64_t *number_of_evictions,
+     uint64_t *number_of_expirations,
+     libcerror_error_t **error )
+{
+	libbfio_internal_descriptor_cache_t *internal_descriptor_cache = NULL;
+	static char *function                                          = "libbfio_descriptor_cache_get_statistics";
+
+	if( descriptor_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_open_descriptors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of open descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	if( peak_number_of_open_descriptors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid peak number of open descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_evictions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of evictions.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_expirations == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of expirations.",
+		 function );
+
+		return( -1 );
+	}
+	internal_descriptor_cache = (libbfio_internal_descriptor_cache_t *) descriptor_cache;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     internal_descriptor_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_open_descriptors      = internal_descriptor_cache->number_of_open_descriptors;
+	*peak_number_of_open_descriptors = internal_descriptor_cache->peak_number_of_open_descriptors;
+	*number_of_evictions             = internal_descriptor_cache->number_of_evictions;
+	*number_of_expirations           = internal_descriptor_cache->number_of_expirations;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     internal_descriptor_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Closes the descriptors that exceeded the idle timeout
+ * Descriptors are also closed when the descriptor cache is used, this function
+ * allows to close the descriptors when the handles are no longer read and
+ * multi-threading is not supported
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_descriptor_cache_close_idle_descriptors(
+     libbfio_descriptor_cache_t *descriptor_cache,
+     libcerror_error_t **error )
+{
+	libbfio_internal_descriptor_cache_t *internal_descriptor_cache = NULL;
+	static char *function                                          = "libbfio_descriptor_cache_close_idle_descriptors";
+	int result                                                     = 1;
+
+	if( descriptor_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_descriptor_cache = (libbfio_internal_descriptor_cache_t *) descriptor_cache;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     internal_descriptor_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libbfio_internal_descriptor_cache_close_idle_handles(
+	     internal_descriptor_cache,
+	     internal_descriptor_cache->maximum_number_of_open_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close idle handles.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     internal_descriptor_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Attaches a handle to the descriptor cache
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_descriptor_cache_attach_handle(
+     libbfio_descriptor_cache_t *descriptor_cache,
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	libbfio_internal_descriptor_cache_t *internal_descriptor_cache = NULL;
+	static char *function                                          = "libbfio_descriptor_cache_attach_handle";
+	int result                                                     = 1;
+
+	if( descriptor_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_descriptor_cache = (libbfio_internal_descriptor_cache_t *) descriptor_cache;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     internal_descriptor_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_descriptor_cache->number_of_handles += 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     internal_descriptor_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Detaches a handle from the descriptor cache
+ * The descriptor of the handle is no longer accounted for by the descriptor cache
+ * and is left for the handle to close
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_descriptor_cache_detach_handle(
+     libbfio_descriptor_cache_t *descriptor_cache,
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	libbfio_internal_descriptor_cache_t *internal_descriptor_cache = NULL;
+	static char *function                                          = "libbfio_descriptor_cache_detach_handle";
+	int result                                                     = 1;
+
+	if( descriptor_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_descriptor_cache = (libbfio_internal_descriptor_cache_t *) descriptor_cache;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     internal_descriptor_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libbfio_internal_descriptor_cache_remove_handle_from_idle_list(
+	     internal_descriptor_cache,
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove handle from idle list.",
+		 function );
+
+		result = -1;
+	}
+	if( libbfio_internal_descriptor_cache_remove_open_descriptor(
+	     internal_descriptor_cache,
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove open descriptor.",
+		 function );
+
+		result = -1;
+	}
+	internal_descriptor_cache->number_of_handles -= 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     internal_descriptor_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Acquires a handle before its descriptor is used
+ * This removes the handle from the idle list so that its descriptor is not closed while in use
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_descriptor_cache_acquire_handle(
+     libbfio_descriptor_cache_t *descriptor_cache,
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	libbfio_internal_descriptor_cache_t *internal_descriptor_cache = NULL;
+	static char *function                                          = "libbfio_descriptor_cache_acquire_handle";
+	int result                                                     = 1;
+
+	if( descriptor_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_descriptor_cache = (libbfio_internal_descriptor_cache_t *) descriptor_cache;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     internal_descriptor_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libbfio_internal_descriptor_cache_remove_handle_from_idle_list(
+	     internal_descriptor_cache,
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove handle from idle list.",
+		 function );
+
+		result = -1;
+	}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     internal_descriptor_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Appends a handle of which the descriptor is about to be opened
+ * If the maximum number of open descriptors has been reached the least recently used
+ * idle descriptors are closed first
+ * Call this function before opening the descriptor, the descriptor is not accounted for
+ * if closing the idle descriptors failed
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_descriptor_cache_append_open_handle(
+     libbfio_descriptor_cache_t *descriptor_cache,
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	libbfio_internal_descriptor_cache_t *internal_descriptor_cache = NULL;
+	static char *function                                          = "libbfio_descriptor_cache_append_open_handle";
+	int result                                                     = 1;
+
+	if( descriptor_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_descriptor_cache = (libbfio_internal_descriptor_cache_t *) descriptor_cache;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     internal_descriptor_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libbfio_internal_descriptor_cache_append_open_descriptor(
+	     internal_descriptor_cache,
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append open descriptor.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     internal_descriptor_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Removes a handle of which the descriptor is closed by the handle itself
+ * Call this function before closing the descriptor or when opening the descriptor failed
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_descriptor_cache_remove_open_handle(
+     libbfio_descriptor_cache_t *descriptor_cache,
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	libbfio_internal_descriptor_cache_t *internal_descriptor_cache = NULL;
+	static char *function                                          = "libbfio_descriptor_cache_remove_open_handle";
+	int result                                                     = 1;
+
+	if( descriptor_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_descriptor_cache = (libbfio_internal_descriptor_cache_t *) descriptor_cache;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     internal_descriptor_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libbfio_internal_descriptor_cache_remove_handle_from_idle_list(
+	     internal_descriptor_cache,
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove handle from idle list.",
+		 function );
+
+		result = -1;
+	}
+	if( libbfio_internal_descriptor_cache_remove_open_descriptor(
+	     internal_descriptor_cache,
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove open descriptor.",
+		 function );
+
+		result = -1;
+	}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     internal_descriptor_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Releases a handle after its descriptor was used
+ * This appends the handle with an open descriptor to the front of the idle list
+ * and closes the idle descriptors that exceed the maximum number of open descriptors
+ * or the idle timeout
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_descriptor_cache_release_handle(
+     libbfio_descriptor_cache_t *descriptor_cache,
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	libbfio_internal_descriptor_cache_t *internal_descriptor_cache = NULL;
+	static char *function                                          = "libbfio_descriptor_cache_release_handle";
+	int result                                                     = 1;
+	uint64_t current_time                                          = 0;
+
+	if( descriptor_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_descriptor_cache = (libbfio_internal_descriptor_cache_t *) descriptor_cache;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     internal_descriptor_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_handle->descriptor_cache_is_open != 0 )
+	{
+		if( libbfio_internal_descriptor_cache_get_current_time(
+		     &current_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve current time.",
+			 function );
+
+			result = -1;
+		}
+		else if( libbfio_internal_descriptor_cache_remove_handle_from_idle_list(
+		          internal_descriptor_cache,
+		          internal_handle,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove handle from idle list.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			internal_handle->descriptor_cache_last_used_time  = current_time;
+			internal_handle->descriptor_cache_previous_handle = NULL;
+			internal_handle->descriptor_cache_next_handle     = internal_descriptor_cache->idle_list_first_handle;
+			internal_handle->descriptor_cache_in_idle_list    = 1;
+
+			if( internal_descriptor_cache->idle_list_first_handle != NULL )
+			{
+				internal_descriptor_cache->idle_list_first_handle->descriptor_cache_previous_handle = internal_handle;
+			}
+			else
+			{
+				internal_descriptor_cache->idle_list_last_handle = internal_handle;
+			}
+			internal_descriptor_cache->idle_list_first_handle = internal_handle;
+		}
+	}
+	if( result == 1 )
+	{
+		if( libbfio_internal_descriptor_cache_close_idle_handles(
+		     internal_descriptor_cache,
+		     internal_descriptor_cache->maximum_number_of_open_descriptors,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close idle handles.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     internal_descriptor_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
@@ -0,0 +1,248 @@
+/*
+ * The descriptor cache functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBBFIO_DESCRIPTOR_CACHE_H )
+#define _LIBBFIO_DESCRIPTOR_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libbfio_extern.h"
+#include "libbfio_handle.h"
+#include "libbfio_libcerror.h"
+#include "libbfio_libcthreads.h"
+#include "libbfio_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The descriptors that exceeded the idle timeout are closed by a background thread
+ */
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO ) && ( defined( WINAPI ) || defined( HAVE_NANOSLEEP ) )
+#define LIBBFIO_DESCRIPTOR_CACHE_HAVE_EXPIRY_THREAD	1
+#endif
+
+/* The maximum time, in milliseconds, the expiry thread sleeps before it checks if it needs to stop
+ */
+#define LIBBFIO_DESCRIPTOR_CACHE_EXPIRY_SLEEP_INTERVAL	50
+
+/* The maximum time, in milliseconds, between checks for descriptors that exceeded the idle timeout
+ */
+#define LIBBFIO_DESCRIPTOR_CACHE_MAXIMUM_EXPIRY_INTERVAL	1000
+
+typedef struct libbfio_descriptor_cache_shared_descriptor libbfio_descriptor_cache_shared_descriptor_t;
+
+struct libbfio_descriptor_cache_shared_descriptor
+{
+	/* The key that identifies the shared descriptor
+	 */
+	intptr_t *key;
+
+	/* The number of handles that have the shared descriptor open
+	 */
+	int number_of_open_handles;
+
+	/* The next shared descriptor
+	 */
+	libbfio_descriptor_cache_shared_descriptor_t *next_shared_descriptor;
+};
+
+typedef struct libbfio_internal_descriptor_cache libbfio_internal_descriptor_cache_t;
+
+struct libbfio_internal_descriptor_cache
+{
+	/* The maximum number of open descriptors
+	 */
+	int maximum_number_of_open_descriptors;
+
+	/* The idle timeout in milliseconds
+	 * 0 represents that idle descriptors are only closed to stay within the maximum number of open descriptors
+	 */
+	uint32_t idle_timeout;
+
+	/* The number of open descriptors
+	 */
+	int number_of_open_descriptors;
+
+	/* The peak number of open descriptors
+	 */
+	int peak_number_of_open_descriptors;
+
+	/* The number of descriptors closed to stay within the maximum number of open descriptors
+	 */
+	uint64_t number_of_evictions;
+
+	/* The number of descriptors closed since they exceeded the idle timeout
+	 */
+	uint64_t number_of_expirations;
+
+	/* The number of handles that use the descriptor cache
+	 */
+	int number_of_handles;
+
+	/* The first (most recently used) handle in the idle list
+	 * the idle list is linked through the handles themselves
+	 */
+	libbfio_internal_handle_t *idle_list_first_handle;
+
+	/* The last (least recently used) handle in the idle list
+	 */
+	libbfio_internal_handle_t *idle_list_last_handle;
+
+	/* The first of the descriptors that are shared by multiple handles
+	 * a shared descriptor is accounted for once
+	 */
+	libbfio_descriptor_cache_shared_descriptor_t *first_shared_descriptor;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	/* The mutex that protects the idle list and the number of open descriptors
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+
+#if defined( LIBBFIO_DESCRIPTOR_CACHE_HAVE_EXPIRY_THREAD )
+	/* The thread that closes the descriptors that exceeded the idle timeout
+	 */
+	libcthreads_thread_t *expiry_thread;
+
+	/* Value to indicate the expiry thread should stop
+	 */
+	uint8_t stop_expiry_thread;
+#endif
+};
+
+LIBBFIO_EXTERN \
+int libbfio_descriptor_cache_initialize(
+     libbfio_descriptor_cache_t **descriptor_cache,
+     int maximum_number_of_open_descriptors,
+     uint32_t idle_timeout,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_descriptor_cache_free(
+     libbfio_descriptor_cache_t **descriptor_cache,
+     libcerror_error_t **error );
+
+int libbfio_internal_descriptor_cache_get_automatic_maximum_number_of_open_descriptors(
+     int *maximum_number_of_open_descriptors,
+     libcerror_error_t **error );
+
+int libbfio_internal_descriptor_cache_get_current_time(
+     uint64_t *current_time,
+     libcerror_error_t **error );
+
+#if defined( LIBBFIO_DESCRIPTOR_CACHE_HAVE_EXPIRY_THREAD )
+
+int libbfio_internal_descriptor_cache_sleep(
+     uint32_t milliseconds,
+     libcerror_error_t **error );
+
+int libbfio_internal_descriptor_cache_expire_idle_handles(
+     libbfio_internal_descriptor_cache_t *internal_descriptor_cache );
+
+int libbfio_internal_descriptor_cache_stop_expiry_thread(
+     libbfio_internal_descriptor_cache_t *internal_descriptor_cache,
+     libcerror_error_t **error );
+
+#endif /* defined( LIBBFIO_DESCRIPTOR_CACHE_HAVE_EXPIRY_THREAD ) */
+
+int libbfio_internal_descriptor_cache_remove_handle_from_idle_list(
+     libbfio_internal_descriptor_cache_t *internal_descriptor_cache,
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+int libbfio_internal_descriptor_cache_append_open_descriptor(
+     libbfio_internal_descriptor_cache_t *internal_descriptor_cache,
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+int libbfio_internal_descriptor_cache_remove_open_descriptor(
+     libbfio_internal_descriptor_cache_t *internal_descriptor_cache,
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+int libbfio_internal_descriptor_cache_close_handle(
+     libbfio_internal_descriptor_cache_t *internal_descriptor_cache,
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+int libbfio_internal_descriptor_cache_close_idle_handles(
+     libbfio_internal_descriptor_cache_t *internal_descriptor_cache,
+     int maximum_number_of_open_descriptors,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_descriptor_cache_get_maximum_number_of_open_descriptors(
+     libbfio_descriptor_cache_t *descriptor_cache,
+     int *maximum_number_of_open_descriptors,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_descriptor_cache_get_statistics(
+     libbfio_descriptor_cache_t *descriptor_cache,
+     int *number_of_open_descriptors,
+     int *peak_number_of_open_descriptors,
+     uint64_t *number_of_evictions,
+     uint64_t *number_of_expirations,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_descriptor_cache_close_idle_descriptors(
+     libbfio_descriptor_cache_t *descriptor_cache,
+     libcerror_error_t **error );
+
+int libbfio_descriptor_cache_attach_handle(
+     libbfio_descriptor_cache_t *descriptor_cache,
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+int libbfio_descriptor_cache_detach_handle(
+     libbfio_descriptor_cache_t *descriptor_cache,
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+int libbfio_descriptor_cache_acquire_handle(
+     libbfio_descriptor_cache_t *descriptor_cache,
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+int libbfio_descriptor_cache_append_open_handle(
+     libbfio_descriptor_cache_t *descriptor_cache,
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+int libbfio_descriptor_cache_remove_open_handle(
+     libbfio_descriptor_cache_t *descriptor_cache,
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+int libbfio_descriptor_cache_release_handle(
+     libbfio_descriptor_cache_t *descriptor_cache,
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBBFIO_DESCRIPTOR_CACHE_H ) */
+
@@ -102,6 +102,147 @@ int libbfio_file_initialize(
 
 		goto on_error;
 	}
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+	if( libbfio_handle_set_read_at_offset_function(
+	     *handle,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, off64_t, libcerror_error_t **)) libbfio_file_io_handle_read_buffer_at_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set read at offset function.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_VECTOR_READ )
+	if( libbfio_handle_set_read_vector_at_offset_function(
+	     *handle,
+	     (ssize_t (*)(intptr_t *, uint8_t **, size_t *, int, off64_t, libcerror_error_t **)) libbfio_file_io_handle_read_vector_at_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set read vector at offset function.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_WRITE )
+	if( libbfio_handle_set_write_at_offset_function(
+	     *handle,
+	     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, off64_t, libcerror_error_t **)) libbfio_file_io_handle_write_buffer_at_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set write at offset function.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_ACCESS_HINT )
+	if( libbfio_handle_set_access_hint_function(
+	     *handle,
+	     (int (*)(intptr_t *, off64_t, size64_t, int, libcerror_error_t **)) libbfio_file_io_handle_set_access_hint,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set access hint function.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_COPY_FROM_DESCRIPTOR )
+	if( libbfio_handle_set_descriptor_functions(
+	     *handle,
+	     (int (*)(intptr_t *, int *, off64_t *, libcerror_error_t **)) libbfio_file_io_handle_get_descriptor,
+	     (int (*)(intptr_t *, off64_t, int, off64_t, size_t, size_t *, libcerror_error_t **)) libbfio_file_io_handle_copy_from_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set descriptor functions.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+#elif defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+	if( libbfio_handle_set_descriptor_functions(
+	     *handle,
+	     (int (*)(intptr_t *, int *, off64_t *, libcerror_error_t **)) libbfio_file_io_handle_get_descriptor,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set descriptor functions.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_EXTENTS )
+	if( libbfio_handle_set_extent_function(
+	     *handle,
+	     (int (*)(intptr_t *, off64_t, size64_t, size64_t *, uint32_t *, libcerror_error_t **)) libbfio_file_io_handle_get_extent,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set extent function.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
 	return( 1 );
 
 on_error:
@@ -26,6 +26,43 @@
 #include <types.h>
 #include <wide_string.h>
 
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_LINUX_FS_H )
+#include <linux/fs.h>
+#endif
+
+#if defined( HAVE_SYS_DISK_H )
+#include <sys/disk.h>
+#endif
+
+#if defined( HAVE_SYS_IOCTL_H )
+#include <sys/ioctl.h>
+#endif
+
+#if defined( HAVE_SYS_SENDFILE_H )
+#include <sys/sendfile.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_SYS_UIO_H )
+#include <sys/uio.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libbfio_buffer_pool.h"
 #include "libbfio_definitions.h"
 #include "libbfio_file_io_handle.h"
 #include "libbfio_libcerror.h"
@@ -92,6 +129,9 @@ int libbfio_file_io_handle_initialize(
 
 		goto on_error;
 	}
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+	( *file_io_handle )->descriptor = -1;
+#else
 	if( libcfile_file_initialize(
 	     &( ( *file_io_handle )->file ),
 	     error ) != 1 )
@@ -105,11 +145,20 @@ int libbfio_file_io_handle_initialize(
 
 		goto on_error;
 	}
+#endif
 	return( 1 );
 
 on_error:
 	if( *file_io_handle != NULL )
 	{
+#if !defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+		if( ( *file_io_handle )->file != NULL )
+		{
+			libcfile_file_free(
+			 &( ( *file_io_handle )->file ),
+			 NULL );
+		}
+#endif
 		memory_free(
 		 *file_io_handle );
 
@@ -146,6 +195,40 @@ int libbfio_file_io_handle_free(
 			memory_free(
 			 ( *file_io_handle )->name );
 		}
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+		if( ( *file_io_handle )->descriptor != -1 )
+		{
+			if( close(
+			     ( *file_io_handle )->descriptor ) != 0 )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 errno,
+				 "%s: unable to close descriptor.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *file_io_handle )->bounce_buffer_pool != NULL )
+		{
+			if( libbfio_buffer_pool_free(
+			     &( ( *file_io_handle )->bounce_buffer_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free bounce buffer pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+#else
 		if( libcfile_file_free(
 		     &( ( *file_io_handle )->file ),
 		     error ) != 1 )
@@ -159,6 +242,8 @@ int libbfio_file_io_handle_free(
 
 			result = -1;
 		}
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ ) */
+
 		memory_free(
 		 *file_io_handle );
 
@@ -430,8 +515,8 @@ int libbfio_file_io_handle_set_name(
 	}
 	if( file_io_handle->name != NULL )
 	{
-		result = libcfile_file_is_open(
-		          file_io_handle->file,
+		result = libbfio_file_io_handle_is_open(
+		          file_io_handle,
 		          error );
 
 		if( result == -1 )
@@ -666,8 +751,8 @@ int libbfio_file_io_handle_set_name_wide(
 	}
 	if( file_io_handle->name != NULL )
 	{
-		result = libcfile_file_is_open(
-		          file_io_handle->file,
+		result = libbfio_file_io_handle_is_open(
+		          file_io_handle,
 		          error );
 
 		if( result == -1 )
@@ -781,6 +866,11 @@ int libbfio_file_io_handle_open(
      libcerror_error_t **error )
 {
 	static char *function = "libbfio_file_io_handle_open";
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+	size_t block_size     = 0;
+	int descriptor_flags  = 0;
+#endif
 	int result            = 0;
 
 	if( file_io_handle == NULL )
@@ -805,17 +895,164 @@ int libbfio_file_io_handle_open(
 
 		return( -1 );
 	}
+	if( ( ( access_flags & LIBBFIO_ACCESS_FLAG_DIRECT ) != 0 )
+	 && ( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags - direct IO requires read-only access.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+	/* The file is opened once as a system file descriptor that is used for
+	 * both the sequential and the positional IO
+	 */
+	if( file_io_handle->descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file IO handle - descriptor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & ( LIBBFIO_ACCESS_FLAG_READ | LIBBFIO_ACCESS_FLAG_WRITE ) ) == ( LIBBFIO_ACCESS_FLAG_READ | LIBBFIO_ACCESS_FLAG_WRITE ) )
+	{
+		descriptor_flags = O_RDWR | O_CREAT;
+	}
+	else if( ( access_flags & LIBBFIO_ACCESS_FLAG_READ ) != 0 )
+	{
+		descriptor_flags = O_RDONLY;
+	}
+	else if( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		descriptor_flags = O_WRONLY | O_CREAT;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags: 0x%02x.",
+		 function,
+		 access_flags );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) != 0 )
+	 && ( ( access_flags & LIBBFIO_ACCESS_FLAG_TRUNCATE ) != 0 ) )
+	{
+		descriptor_flags |= O_TRUNC;
+	}
+#if defined( O_CLOEXEC )
+	descriptor_flags |= O_CLOEXEC;
+#endif
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_DIRECT_IO )
+	if( ( access_flags & LIBBFIO_ACCESS_FLAG_DIRECT ) != 0 )
+	{
+		descriptor_flags |= O_DIRECT;
+	}
+#endif
+	file_io_handle->descriptor = open(
+	                              file_io_handle->name,
+	                              descriptor_flags,
+	                              0644 );
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_DIRECT_IO )
+	/* Fall back to buffered IO if the file system does not support direct IO
+	 */
+	if( ( file_io_handle->descriptor == -1 )
+	 && ( errno == EINVAL )
+	 && ( ( descriptor_flags & O_DIRECT ) != 0 ) )
+	{
+		descriptor_flags &= ~( O_DIRECT );
+
+		file_io_handle->descriptor = open(
+		                              file_io_handle->name,
+		                              descriptor_flags,
+		                              0644 );
+	}
+	file_io_handle->direct_io = (uint8_t) ( ( descriptor_flags & O_DIRECT ) != 0 );
+#endif
+	if( file_io_handle->descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open file: %" PRIs_SYSTEM ".",
+		 function,
+		 file_io_handle->name );
+
+		goto on_error;
+	}
+	/* Raw disk devices only support reads of a multitude of the block size
+	 */
+	result = libbfio_file_io_handle_get_device_block_size(
+	          file_io_handle,
+	          &block_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve device block size of file: %" PRIs_SYSTEM ".",
+		 function,
+		 file_io_handle->name );
+
+		goto on_error;
+	}
+	file_io_handle->alignment = block_size;
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_DIRECT_IO )
+	if( ( file_io_handle->direct_io != 0 )
+	 && ( file_io_handle->alignment < LIBBFIO_FILE_IO_HANDLE_DIRECT_IO_ALIGNMENT ) )
+	{
+		file_io_handle->alignment = LIBBFIO_FILE_IO_HANDLE_DIRECT_IO_ALIGNMENT;
+	}
+#endif
+	if( ( file_io_handle->alignment != 0 )
+	 && ( file_io_handle->bounce_buffer_pool == NULL ) )
+	{
+		if( libbfio_buffer_pool_initialize(
+		     &( file_io_handle->bounce_buffer_pool ),
+		     LIBBFIO_FILE_IO_HANDLE_BOUNCE_BUFFER_SIZE,
+		     LIBBFIO_FILE_IO_HANDLE_NUMBER_OF_BOUNCE_BUFFERS,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create bounce buffer pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#else
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	result = libcfile_file_open_wide(
 	          file_io_handle->file,
 	          file_io_handle->name,
-	          access_flags,
+	          access_flags & ~( LIBBFIO_ACCESS_FLAG_DIRECT ),
 	          error );
 #else
 	result = libcfile_file_open(
 	          file_io_handle->file,
 	          file_io_handle->name,
-	          access_flags,
+	          access_flags & ~( LIBBFIO_ACCESS_FLAG_DIRECT ),
 	          error );
 #endif
 	if( result != 1 )
@@ -830,9 +1067,28 @@ int libbfio_file_io_handle_open(
 
 		return( -1 );
 	}
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ ) */
+
 	file_io_handle->access_flags = access_flags;
 
 	return( 1 );
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+on_error:
+	if( file_io_handle->descriptor != -1 )
+	{
+		close(
+		 file_io_handle->descriptor );
+
+		file_io_handle->descriptor = -1;
+	}
+	file_io_handle->alignment = 0;
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_DIRECT_IO )
+	file_io_handle->direct_io = 0;
+#endif
+	return( -1 );
+#endif
 }
 
 /* Closes the file handle
@@ -866,6 +1122,28 @@ int libbfio_file_io_handle_close(
 
 		return( -1 );
 	}
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+	if( file_io_handle->descriptor != -1 )
+	{
+		if( close(
+		     file_io_handle->descriptor ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 errno,
+			 "%s: unable to close file: %" PRIs_SYSTEM ".",
+			 function,
+			 file_io_handle->name );
+
+			file_io_handle->descriptor = -1;
+
+			return( -1 );
+		}
+		file_io_handle->descriptor = -1;
+	}
+#else
 	if( libcfile_file_close(
 	     file_io_handle->file,
 	     error ) != 0 )
@@ -880,6 +1158,31 @@ int libbfio_file_io_handle_close(
 
 		return( -1 );
 	}
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ ) */
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_DIRECT_IO )
+	file_io_handle->direct_io = 0;
+#endif
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+	file_io_handle->alignment = 0;
+
+	if( file_io_handle->bounce_buffer_pool != NULL )
+	{
+		if( libbfio_buffer_pool_free(
+		     &( file_io_handle->bounce_buffer_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free bounce buffer pool.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
 	file_io_handle->access_flags = 0;
 
 	return( 0 );
@@ -897,6 +1200,10 @@ ssize_t libbfio_file_io_handle_read_buffer(
 	static char *function = "libbfio_file_io_handle_read_buffer";
 	ssize_t read_count    = 0;
 
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+	off64_t file_offset   = 0;
+#endif
+
 	if( file_io_handle == NULL )
 	{
 		libcerror_error_set(
@@ -919,6 +1226,115 @@ ssize_t libbfio_file_io_handle_read_buffer(
 
 		return( -1 );
 	}
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+	if( file_io_handle->alignment != 0 )
+	{
+		/* The data is read with an aligned read at the current offset of the file
+		 * so that a sequential read also satisfies the alignment requirements
+		 */
+		file_offset = (off64_t) lseek(
+		                         file_io_handle->descriptor,
+		                         0,
+		                         SEEK_CUR );
+
+		if( file_offset < 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 errno,
+			 "%s: unable to determine current offset of file: %" PRIs_SYSTEM ".",
+			 function,
+			 file_io_handle->name );
+
+			return( -1 );
+		}
+		read_count = libbfio_file_io_handle_read_buffer_at_offset_aligned(
+		              file_io_handle,
+		              buffer,
+		              size,
+		              file_offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from file: %" PRIs_SYSTEM ".",
+			 function,
+			 file_io_handle->name );
+
+			return( -1 );
+		}
+		if( lseek(
+		     file_io_handle->descriptor,
+		     (off_t) ( file_offset + read_count ),
+		     SEEK_SET ) == (off_t) -1 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 errno,
+			 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ") in file: %" PRIs_SYSTEM ".",
+			 function,
+			 file_offset + read_count,
+			 file_offset + read_count,
+			 file_io_handle->name );
+
+			return( -1 );
+		}
+		return( read_count );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		read_count = read(
+		              file_io_handle->descriptor,
+		              (void *) buffer,
+		              size );
+	}
+	while( ( read_count == -1 )
+	    && ( errno == EINTR ) );
+
+	if( read_count < 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 errno,
+		 "%s: unable to read from file: %" PRIs_SYSTEM ".",
+		 function,
+		 file_io_handle->name );
+
+		return( -1 );
+	}
+#else
 	read_count = libcfile_file_read_buffer(
 	              file_io_handle->file,
 	              buffer,
@@ -937,6 +1353,8 @@ ssize_t libbfio_file_io_handle_read_buffer(
 
 		return( -1 );
 	}
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ ) */
+
 	return( read_count );
 }
 
@@ -974,6 +1392,53 @@ ssize_t libbfio_file_io_handle_write_buffer(
 
 		return( -1 );
 	}
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		write_count = write(
+		               file_io_handle->descriptor,
+		               (const void *) buffer,
+		               size );
+	}
+	while( ( write_count == -1 )
+	    && ( errno == EINTR ) );
+
+	if( write_count < 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 errno,
+		 "%s: unable to write to file: %" PRIs_SYSTEM ".",
+		 function,
+		 file_io_handle->name );
+
+		return( -1 );
+	}
+#else
 	write_count = libcfile_file_write_buffer(
 	               file_io_handle->file,
 	               buffer,
@@ -992,20 +1457,26 @@ ssize_t libbfio_file_io_handle_write_buffer(
 
 		return( -1 );
 	}
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ ) */
+
 	return( write_count );
 }
 
-/* Seeks a certain offset within the file handle
- * Returns the offset if the seek is successful or -1 on error
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+
+/* Reads a buffer at a specific offset from the file handle
+ * This function does not change the current offset of the file handle
+ * Returns the number of bytes read if successful, or -1 on error
  */
-off64_t libbfio_file_io_handle_seek_offset(
+ssize_t libbfio_file_io_handle_read_buffer_at_offset(
          libbfio_file_io_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t size,
          off64_t offset,
-         int whence,
          libcerror_error_t **error )
 {
-	static char *function = "libbfio_file_seek_offset";
-	off64_t seek_offset   = 0;
+	static char *function = "libbfio_file_io_handle_read_buffer_at_offset";
+	ssize_t read_count    = 0;
 
 	if( file_io_handle == NULL )
 	{
@@ -1029,10 +1500,1762 @@ off64_t libbfio_file_io_handle_seek_offset(
 
 		return( -1 );
 	}
-	seek_offset = libcfile_file_seek_offset(
-	               file_io_handle->file,
-	               offset,
-	               whence,
+	if( file_io_handle->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO handle - file not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->alignment != 0 )
+	{
+		read_count = libbfio_file_io_handle_read_buffer_at_offset_aligned(
+		              file_io_handle,
+		              buffer,
+		              size,
+		              offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from file: %" PRIs_SYSTEM " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_io_handle->name,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		return( read_count );
+	}
+	read_count = pread(
+	              file_io_handle->descriptor,
+	              (void *) buffer,
+	              size,
+	              (off_t) offset );
+
+	if( read_count < 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 errno,
+		 "%s: unable to read from file: %" PRIs_SYSTEM " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_io_handle->name,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ ) */
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+
+/* Reads a buffer at a specific offset using reads that satisfy the alignment of the file handle
+ * Aligned parts of the buffer are read directly, unaligned parts are read into a bounce buffer
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libbfio_file_io_handle_read_buffer_at_offset_aligned(
+         libbfio_file_io_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	uint8_t *bounce_buffer  = NULL;
+	static char *function   = "libbfio_file_io_handle_read_buffer_at_offset_aligned";
+	size_t alignment        = 0;
+	size_t alignment_offset = 0;
+	size_t buffer_offset    = 0;
+	size_t copy_size        = 0;
+	size_t read_size        = 0;
+	ssize_t read_count      = 0;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO handle - file not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	alignment = file_io_handle->alignment;
+
+	if( alignment == 0 )
+	{
+		read_count = pread(
+		              file_io_handle->descriptor,
+		              (void *) buffer,
+		              size,
+		              (off_t) offset );
+
+		if( read_count < 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 errno,
+			 "%s: unable to read from file: %" PRIs_SYSTEM " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_io_handle->name,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		return( read_count );
+	}
+	if( file_io_handle->bounce_buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO handle - missing bounce buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < size )
+	{
+		read_size        = size - buffer_offset;
+		alignment_offset = (size_t) ( offset % alignment );
+
+		if( ( alignment_offset == 0 )
+		 && ( ( (intptr_t) &( buffer[ buffer_offset ] ) % alignment ) == 0 )
+		 && ( read_size >= alignment ) )
+		{
+			/* The aligned part of the data is read directly into the buffer
+			 */
+			read_size -= read_size % alignment;
+
+			read_count = pread(
+			              file_io_handle->descriptor,
+			              (void *) &( buffer[ buffer_offset ] ),
+			              read_size,
+			              (off_t) offset );
+
+			if( read_count < 0 )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 errno,
+				 "%s: unable to read from file: %" PRIs_SYSTEM " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 file_io_handle->name,
+				 offset,
+				 offset );
+
+				goto on_error;
+			}
+			copy_size = (size_t) read_count;
+		}
+		else
+		{
+			/* The unaligned part of the data is read into a bounce buffer
+			 */
+			if( bounce_buffer == NULL )
+			{
+				if( libbfio_buffer_pool_get_buffer(
+				     file_io_handle->bounce_buffer_pool,
+				     &bounce_buffer,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve bounce buffer.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( read_size > ( LIBBFIO_FILE_IO_HANDLE_BOUNCE_BUFFER_SIZE - alignment_offset ) )
+			{
+				read_size = LIBBFIO_FILE_IO_HANDLE_BOUNCE_BUFFER_SIZE;
+			}
+			else
+			{
+				read_size += alignment_offset;
+
+				if( ( read_size % alignment ) != 0 )
+				{
+					read_size += alignment - ( read_size % alignment );
+				}
+			}
+			read_count = pread(
+			              file_io_handle->descriptor,
+			              (void *) bounce_buffer,
+			              read_size,
+			              (off_t) ( offset - alignment_offset ) );
+
+			if( read_count < 0 )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 errno,
+				 "%s: unable to read from file: %" PRIs_SYSTEM " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 file_io_handle->name,
+				 offset - alignment_offset,
+				 offset - alignment_offset );
+
+				goto on_error;
+			}
+			if( (size_t) read_count <= alignment_offset )
+			{
+				break;
+			}
+			copy_size = (size_t) read_count - alignment_offset;
+
+			if( copy_size > ( size - buffer_offset ) )
+			{
+				copy_size = size - buffer_offset;
+			}
+			if( memory_copy(
+			     &( buffer[ buffer_offset ] ),
+			     &( bounce_buffer[ alignment_offset ] ),
+			     copy_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy data from bounce buffer.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		buffer_offset += copy_size;
+		offset        += (off64_t) copy_size;
+
+		/* A short read indicates the end of the file
+		 */
+		if( (size_t) read_count < read_size )
+		{
+			break;
+		}
+	}
+	if( bounce_buffer != NULL )
+	{
+		if( libbfio_buffer_pool_release_buffer(
+		     file_io_handle->bounce_buffer_pool,
+		     bounce_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release bounce buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( (ssize_t) buffer_offset );
+
+on_error:
+	if( bounce_buffer != NULL )
+	{
+		libbfio_buffer_pool_release_buffer(
+		 file_io_handle->bounce_buffer_pool,
+		 bounce_buffer,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the size of a device
+ * The size is determined with the device specific IO control
+ * Returns 1 if successful, 0 if the size cannot be determined by the device or -1 on error
+ */
+int libbfio_file_io_handle_get_device_size(
+     libbfio_file_io_handle_t *file_io_handle,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function        = "libbfio_file_io_handle_get_device_size";
+
+#if defined( HAVE_IOCTL )
+#if defined( BLKGETSIZE64 )
+	uint64_t device_size         = 0;
+#elif defined( DIOCGMEDIASIZE )
+	off_t media_size             = 0;
+#elif defined( DKIOCGETBLOCKCOUNT ) && defined( DKIOCGETBLOCKSIZE )
+	uint64_t device_block_count  = 0;
+	uint32_t device_block_size   = 0;
+#endif
+	int result                   = 0;
+#endif /* defined( HAVE_IOCTL ) */
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO handle - file not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_IOCTL ) && defined( BLKGETSIZE64 )
+	result = ioctl(
+	          file_io_handle->descriptor,
+	          BLKGETSIZE64,
+	          &device_size );
+
+	if( result != -1 )
+	{
+		*size = (size64_t) device_size;
+	}
+#elif defined( HAVE_IOCTL ) && defined( DIOCGMEDIASIZE )
+	result = ioctl(
+	          file_io_handle->descriptor,
+	          DIOCGMEDIASIZE,
+	          &media_size );
+
+	if( result != -1 )
+	{
+		*size = (size64_t) media_size;
+	}
+#elif defined( HAVE_IOCTL ) && defined( DKIOCGETBLOCKCOUNT ) && defined( DKIOCGETBLOCKSIZE )
+	result = ioctl(
+	          file_io_handle->descriptor,
+	          DKIOCGETBLOCKSIZE,
+	          &device_block_size );
+
+	if( result != -1 )
+	{
+		result = ioctl(
+		          file_io_handle->descriptor,
+		          DKIOCGETBLOCKCOUNT,
+		          &device_block_count );
+	}
+	if( result != -1 )
+	{
+		*size = (size64_t) device_block_count * device_block_size;
+	}
+#else
+	return( 0 );
+#endif
+
+#if defined( HAVE_IOCTL ) && ( defined( BLKGETSIZE64 ) || defined( DIOCGMEDIASIZE ) || ( defined( DKIOCGETBLOCKCOUNT ) && defined( DKIOCGETBLOCKSIZE ) ) )
+	if( result == -1 )
+	{
+		/* The file is not a device that supports the IO control
+		 */
+		if( ( errno == ENOTTY )
+		 || ( errno == EINVAL ) )
+		{
+			return( 0 );
+		}
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+		 errno,
+		 "%s: unable to query device size of file: %" PRIs_SYSTEM ".",
+		 function,
+		 file_io_handle->name );
+
+		return( -1 );
+	}
+	return( 1 );
+#endif
+}
+
+/* Retrieves the block size of a device that requires block aligned reads
+ * Raw disk devices, such as /dev/rdisk# on Mac OS X and the disk devices on FreeBSD,
+ * are character devices that only support reads of a multitude of the block size
+ * Returns 1 if successful, 0 if the file does not require block aligned reads or -1 on error
+ */
+int libbfio_file_io_handle_get_device_block_size(
+     libbfio_file_io_handle_t *file_io_handle,
+     size_t *block_size,
+     libcerror_error_t **error )
+{
+	static char *function       = "libbfio_file_io_handle_get_device_block_size";
+
+#if defined( HAVE_FSTAT ) && defined( HAVE_IOCTL ) && ( defined( DKIOCGETBLOCKSIZE ) || defined( DIOCGSECTORSIZE ) )
+	struct stat file_statistics;
+
+	uint32_t device_block_size  = 0;
+	int result                  = 0;
+#endif
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO handle - file not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block size.",
+		 function );
+
+		return( -1 );
+	}
+	*block_size = 0;
+
+#if defined( HAVE_FSTAT ) && defined( HAVE_IOCTL ) && ( defined( DKIOCGETBLOCKSIZE ) || defined( DIOCGSECTORSIZE ) )
+	if( fstat(
+	     file_io_handle->descriptor,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 errno,
+		 "%s: unable to retrieve file statistics: %" PRIs_SYSTEM ".",
+		 function,
+		 file_io_handle->name );
+
+		return( -1 );
+	}
+	/* Block devices are read through the system cache and do not require aligned reads
+	 */
+	if( !S_ISCHR( file_statistics.st_mode ) )
+	{
+		return( 0 );
+	}
+#if defined( DKIOCGETBLOCKSIZE )
+	result = ioctl(
+	          file_io_handle->descriptor,
+	          DKIOCGETBLOCKSIZE,
+	          &device_block_size );
+#else
+	result = ioctl(
+	          file_io_handle->descriptor,
+	          DIOCGSECTORSIZE,
+	          &device_block_size );
+#endif
+	if( result == -1 )
+	{
+		/* The character device is not a disk device
+		 */
+		if( ( errno == ENOTTY )
+		 || ( errno == EINVAL ) )
+		{
+			return( 0 );
+		}
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+		 errno,
+		 "%s: unable to query device block size of file: %" PRIs_SYSTEM ".",
+		 function,
+		 file_io_handle->name );
+
+		return( -1 );
+	}
+	if( device_block_size <= 1 )
+	{
+		return( 0 );
+	}
+	/* The bounce buffer must contain a whole number of blocks
+	 */
+	if( ( device_block_size > LIBBFIO_FILE_IO_HANDLE_BOUNCE_BUFFER_SIZE )
+	 || ( ( device_block_size & ( device_block_size - 1 ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported device block size: %" PRIu32 " of file: %" PRIs_SYSTEM ".",
+		 function,
+		 device_block_size,
+		 file_io_handle->name );
+
+		return( -1 );
+	}
+	*block_size = (size_t) device_block_size;
+
+	return( 1 );
+#else
+	return( 0 );
+#endif
+}
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ ) */
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+
+/* Retrieves the system file descriptor
+ * The descriptor offset contains the offset of the data in the file
+ * Returns 1 if successful, 0 if the file is not open or requires aligned reads or -1 on error
+ */
+int libbfio_file_io_handle_get_descriptor(
+     libbfio_file_io_handle_t *file_io_handle,
+     int *descriptor,
+     off64_t *descriptor_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_file_io_handle_get_descriptor";
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( descriptor_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_io_handle->descriptor == -1 )
+	 || ( file_io_handle->alignment != 0 ) )
+	{
+		return( 0 );
+	}
+	*descriptor        = file_io_handle->descriptor;
+	*descriptor_offset = 0;
+
+	return( 1 );
+}
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ ) */
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_COPY_FROM_DESCRIPTOR )
+
+/* Copies data from a source system file descriptor to a specific offset in the file handle
+ * The data is copied by the kernel using copy_file_range, which can share the data
+ * of the source (reflink) if the file system supports it, or sendfile otherwise
+ * This function does not change the current offset of the file handle
+ * Returns 1 if successful, 0 if the kernel cannot copy between the descriptors or -1 on error
+ */
+int libbfio_file_io_handle_copy_from_descriptor(
+     libbfio_file_io_handle_t *file_io_handle,
+     off64_t offset,
+     int source_descriptor,
+     off64_t source_offset,
+     size_t size,
+     size_t *copy_size,
+     libcerror_error_t **error )
+{
+	static char *function          = "libbfio_file_io_handle_copy_from_descriptor";
+	size_t copy_offset             = 0;
+	ssize_t copy_count             = 0;
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_COPY_FILE_RANGE )
+	loff_t destination_copy_offset = 0;
+	loff_t source_copy_offset      = 0;
+	uint8_t use_copy_file_range    = 1;
+#endif
+#if defined( HAVE_SYS_SENDFILE_H ) && defined( HAVE_SENDFILE )
+	off_t current_offset           = -1;
+	off_t source_sendfile_offset   = 0;
+#endif
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO handle - file not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_descriptor < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source descriptor value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( copy_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid copy size.",
+		 function );
+
+		return( -1 );
+	}
+	*copy_size = 0;
+
+	while( copy_offset < size )
+	{
+		copy_count = -1;
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_COPY_FILE_RANGE )
+		if( use_copy_file_range != 0 )
+		{
+			source_copy_offset      = (loff_t) ( source_offset + copy_offset );
+			destination_copy_offset = (loff_t) ( offset + copy_offset );
+
+			copy_count = copy_file_range(
+			              source_descriptor,
+			              &source_copy_offset,
+			              file_io_handle->descriptor,
+			              &destination_copy_offset,
+			              size - copy_offset,
+			              0 );
+
+			/* Fall back to sendfile if the kernel or file systems do not support copy_file_range
+			 */
+			if( ( copy_count < 0 )
+			 && ( ( errno == EXDEV )
+			  ||  ( errno == EINVAL )
+			  ||  ( errno == ENOSYS )
+			  ||  ( errno == EOPNOTSUPP ) ) )
+			{
+				use_copy_file_range = 0;
+			}
+			else if( copy_count < 0 )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 errno,
+				 "%s: unable to copy to file: %" PRIs_SYSTEM " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 file_io_handle->name,
+				 offset + copy_offset,
+				 offset + copy_offset );
+
+				return( -1 );
+			}
+		}
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_COPY_FILE_RANGE ) */
+
+#if defined( HAVE_SYS_SENDFILE_H ) && defined( HAVE_SENDFILE )
+		if( copy_count < 0 )
+		{
+			/* sendfile writes at the current offset of the descriptor
+			 * which is restored after the copy
+			 */
+			if( current_offset == -1 )
+			{
+				current_offset = lseek(
+				                  file_io_handle->descriptor,
+				                  0,
+				                  SEEK_CUR );
+
+				if( current_offset == (off_t) -1 )
+				{
+					libcerror_system_set_error(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_SEEK_FAILED,
+					 errno,
+					 "%s: unable to determine current offset of file: %" PRIs_SYSTEM ".",
+					 function,
+					 file_io_handle->name );
+
+					return( -1 );
+				}
+			}
+			if( lseek(
+			     file_io_handle->descriptor,
+			     (off_t) ( offset + copy_offset ),
+			     SEEK_SET ) == (off_t) -1 )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_SEEK_FAILED,
+				 errno,
+				 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ") in file: %" PRIs_SYSTEM ".",
+				 function,
+				 offset + copy_offset,
+				 offset + copy_offset,
+				 file_io_handle->name );
+
+				goto on_error;
+			}
+			source_sendfile_offset = (off_t) ( source_offset + copy_offset );
+
+			copy_count = sendfile(
+			              file_io_handle->descriptor,
+			              source_descriptor,
+			              &source_sendfile_offset,
+			              size - copy_offset );
+
+			if( ( copy_count < 0 )
+			 && ( ( errno == EINVAL )
+			  ||  ( errno == ENOSYS ) ) )
+			{
+				break;
+			}
+			else if( copy_count < 0 )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 errno,
+				 "%s: unable to copy to file: %" PRIs_SYSTEM " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 file_io_handle->name,
+				 offset + copy_offset,
+				 offset + copy_offset );
+
+				goto on_error;
+			}
+		}
+#endif /* defined( HAVE_SYS_SENDFILE_H ) && defined( HAVE_SENDFILE ) */
+
+		/* A copy count of 0 indicates the end of the source data
+		 */
+		if( copy_count <= 0 )
+		{
+			break;
+		}
+		copy_offset += (size_t) copy_count;
+	}
+#if defined( HAVE_SYS_SENDFILE_H ) && defined( HAVE_SENDFILE )
+	if( current_offset != -1 )
+	{
+		if( lseek(
+		     file_io_handle->descriptor,
+		     current_offset,
+		     SEEK_SET ) == (off_t) -1 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 errno,
+			 "%s: unable to restore current offset of file: %" PRIs_SYSTEM ".",
+			 function,
+			 file_io_handle->name );
+
+			return( -1 );
+		}
+	}
+#endif
+	if( ( copy_offset == 0 )
+	 && ( copy_count < 0 ) )
+	{
+		return( 0 );
+	}
+	*copy_size = copy_offset;
+
+	return( 1 );
+
+#if defined( HAVE_SYS_SENDFILE_H ) && defined( HAVE_SENDFILE )
+on_error:
+	if( current_offset != -1 )
+	{
+		lseek(
+		 file_io_handle->descriptor,
+		 current_offset,
+		 SEEK_SET );
+	}
+	return( -1 );
+#endif
+}
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_COPY_FROM_DESCRIPTOR ) */
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_EXTENTS )
+
+/* Retrieves the extent of the file at a specific offset
+ * The extent is the data or the hole that contains the offset, up to the next
+ * transition between data and a hole as reported by SEEK_DATA and SEEK_HOLE
+ * The extent size is at most size bytes
+ * This function does not change the current offset of the file handle
+ * Returns 1 if successful, 0 if the extents cannot be determined or -1 on error
+ */
+int libbfio_file_io_handle_get_extent(
+     libbfio_file_io_handle_t *file_io_handle,
+     off64_t offset,
+     size64_t size,
+     size64_t *extent_size,
+     uint32_t *extent_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_file_io_handle_get_extent";
+	off_t current_offset  = 0;
+	off_t data_offset     = 0;
+	off_t hole_offset     = 0;
+	int result            = 1;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent size.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_io_handle->descriptor == -1 )
+	 || ( size == 0 ) )
+	{
+		return( 0 );
+	}
+	/* SEEK_DATA and SEEK_HOLE change the current offset of the descriptor
+	 * which is restored after the extent was determined
+	 */
+	current_offset = lseek(
+	                  file_io_handle->descriptor,
+	                  0,
+	                  SEEK_CUR );
+
+	if( current_offset == (off_t) -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 errno,
+		 "%s: unable to determine current offset of file: %" PRIs_SYSTEM ".",
+		 function,
+		 file_io_handle->name );
+
+		return( -1 );
+	}
+	data_offset = lseek(
+	               file_io_handle->descriptor,
+	               (off_t) offset,
+	               SEEK_DATA );
+
+	if( data_offset == (off_t) -1 )
+	{
+		/* ENXIO indicates there is no more data after the offset
+		 */
+		if( errno == ENXIO )
+		{
+			*extent_size  = size;
+			*extent_flags = LIBBFIO_EXTENT_FLAG_IS_SPARSE;
+		}
+		/* The file system does not support determining holes
+		 */
+		else if( errno == EINVAL )
+		{
+			result = 0;
+		}
+		else
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 errno,
+			 "%s: unable to seek data from offset: %" PRIi64 " (0x%08" PRIx64 ") in file: %" PRIs_SYSTEM ".",
+			 function,
+			 offset,
+			 offset,
+			 file_io_handle->name );
+
+			result = -1;
+		}
+	}
+	else if( (off64_t) data_offset > offset )
+	{
+		*extent_size  = (size64_t) ( (off64_t) data_offset - offset );
+		*extent_flags = LIBBFIO_EXTENT_FLAG_IS_SPARSE;
+	}
+	else
+	{
+		hole_offset = lseek(
+		               file_io_handle->descriptor,
+		               (off_t) offset,
+		               SEEK_HOLE );
+
+		if( hole_offset == (off_t) -1 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 errno,
+			 "%s: unable to seek hole from offset: %" PRIi64 " (0x%08" PRIx64 ") in file: %" PRIs_SYSTEM ".",
+			 function,
+			 offset,
+			 offset,
+			 file_io_handle->name );
+
+			result = -1;
+		}
+		/* The file was truncated after seeking the data
+		 */
+		else if( (off64_t) hole_offset <= offset )
+		{
+			result = 0;
+		}
+		else
+		{
+			*extent_size  = (size64_t) ( (off64_t) hole_offset - offset );
+			*extent_flags = 0;
+		}
+	}
+	if( lseek(
+	     file_io_handle->descriptor,
+	     current_offset,
+	     SEEK_SET ) == (off_t) -1 )
+	{
+		if( result != -1 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 errno,
+			 "%s: unable to restore current offset of file: %" PRIs_SYSTEM ".",
+			 function,
+			 file_io_handle->name );
+		}
+		return( -1 );
+	}
+	if( ( result == 1 )
+	 && ( *extent_size > size ) )
+	{
+		*extent_size = size;
+	}
+	return( result );
+}
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_EXTENTS ) */
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_VECTOR_READ )
+
+/* Reads a contiguous range at a specific offset from the file handle into multiple buffers
+ * The range is read with as few preadv calls as possible
+ * This function does not change the current offset of the file handle
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libbfio_file_io_handle_read_vector_at_offset(
+         libbfio_file_io_handle_t *file_io_handle,
+         uint8_t **buffers,
+         size_t *buffer_sizes,
+         int number_of_buffers,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	struct iovec io_vectors[ LIBBFIO_FILE_IO_HANDLE_MAXIMUM_NUMBER_OF_IO_VECTORS ];
+
+	static char *function    = "libbfio_file_io_handle_read_vector_at_offset";
+	size_t buffer_offset     = 0;
+	size_t vector_size       = 0;
+	ssize_t read_count       = 0;
+	ssize_t total_read_count = 0;
+	int buffer_index         = 0;
+	int number_of_io_vectors = 0;
+	int vector_index         = 0;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO handle - missing name.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO handle - file not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_buffers < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of buffers value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		if( buffers[ buffer_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid buffer: %d.",
+			 function,
+			 buffer_index );
+
+			return( -1 );
+		}
+		if( buffer_sizes[ buffer_index ] > (size_t) ( SSIZE_MAX - total_read_count ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid buffer: %d size value exceeds maximum.",
+			 function,
+			 buffer_index );
+
+			return( -1 );
+		}
+		total_read_count += (ssize_t) buffer_sizes[ buffer_index ];
+	}
+	total_read_count = 0;
+
+	if( file_io_handle->alignment != 0 )
+	{
+		/* Aligned reads require aligned IO vectors hence the buffers are read one at a time
+		 */
+		for( buffer_index = 0;
+		     buffer_index < number_of_buffers;
+		     buffer_index++ )
+		{
+			read_count = libbfio_file_io_handle_read_buffer_at_offset_aligned(
+			              file_io_handle,
+			              buffers[ buffer_index ],
+			              buffer_sizes[ buffer_index ],
+			              offset,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read buffer: %d from file: %" PRIs_SYSTEM " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 buffer_index,
+				 file_io_handle->name,
+				 offset,
+				 offset );
+
+				return( -1 );
+			}
+			offset           += (off64_t) read_count;
+			total_read_count += read_count;
+
+			if( (size_t) read_count < buffer_sizes[ buffer_index ] )
+			{
+				break;
+			}
+		}
+		return( total_read_count );
+	}
+
+	buffer_index = 0;
+
+	while( buffer_index < number_of_buffers )
+	{
+		/* A buffer that was partially read by the previous preadv call
+		 * is continued from the buffer offset
+		 */
+		vector_size          = 0;
+		number_of_io_vectors = 0;
+
+		for( vector_index = buffer_index;
+		     vector_index < number_of_buffers;
+		     vector_index++ )
+		{
+			if( number_of_io_vectors >= LIBBFIO_FILE_IO_HANDLE_MAXIMUM_NUMBER_OF_IO_VECTORS )
+			{
+				break;
+			}
+			io_vectors[ number_of_io_vectors ].iov_base = (void *) buffers[ vector_index ];
+			io_vectors[ number_of_io_vectors ].iov_len  = buffer_sizes[ vector_index ];
+
+			if( vector_index == buffer_index )
+			{
+				io_vectors[ number_of_io_vectors ].iov_base = (void *) &( buffers[ vector_index ][ buffer_offset ] );
+				io_vectors[ number_of_io_vectors ].iov_len -= buffer_offset;
+			}
+			vector_size += io_vectors[ number_of_io_vectors ].iov_len;
+
+			number_of_io_vectors++;
+		}
+		if( vector_size == 0 )
+		{
+			buffer_index  = vector_index;
+			buffer_offset = 0;
+
+			continue;
+		}
+		read_count = preadv(
+		              file_io_handle->descriptor,
+		              io_vectors,
+		              number_of_io_vectors,
+		              (off_t) offset );
+
+		if( read_count < 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 errno,
+			 "%s: unable to read from file: %" PRIs_SYSTEM " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_io_handle->name,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		else if( read_count == 0 )
+		{
+			break;
+		}
+		offset           += (off64_t) read_count;
+		total_read_count += read_count;
+
+		/* Determine the buffer and buffer offset the next preadv call starts at
+		 */
+		while( ( buffer_index < number_of_buffers )
+		    && ( read_count > 0 ) )
+		{
+			if( (size_t) read_count < ( buffer_sizes[ buffer_index ] - buffer_offset ) )
+			{
+				buffer_offset += (size_t) read_count;
+
+				break;
+			}
+			read_count   -= (ssize_t) ( buffer_sizes[ buffer_index ] - buffer_offset );
+			buffer_offset = 0;
+
+			buffer_index++;
+		}
+	}
+	return( total_read_count );
+}
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_VECTOR_READ ) */
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_WRITE )
+
+/* Writes a buffer at a specific offset to the file handle
+ * This function does not change the current offset of the file handle
+ * Returns the number of bytes written if successful, or -1 on error
+ */
+ssize_t libbfio_file_io_handle_write_buffer_at_offset(
+         libbfio_file_io_handle_t *file_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libbfio_file_io_handle_write_buffer_at_offset";
+	ssize_t write_count   = 0;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO handle - missing name.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO handle - file not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	write_count = pwrite(
+	               file_io_handle->descriptor,
+	               (const void *) buffer,
+	               size,
+	               (off_t) offset );
+
+	if( write_count < 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 errno,
+		 "%s: unable to write to file: %" PRIs_SYSTEM " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_io_handle->name,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	return( write_count );
+}
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_WRITE ) */
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_ACCESS_HINT )
+
+/* Passes an access pattern hint for a range of the file to the system
+ * The hint applies from offset to the end of the file if size is 0
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_file_io_handle_set_access_hint(
+     libbfio_file_io_handle_t *file_io_handle,
+     off64_t offset,
+     size64_t size,
+     int access_hint,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_file_io_handle_set_access_hint";
+	int advice            = 0;
+	int result            = 0;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO handle - missing name.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO handle - file not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	switch( access_hint )
+	{
+		case LIBBFIO_ACCESS_HINT_NORMAL:
+			advice = POSIX_FADV_NORMAL;
+			break;
+
+		case LIBBFIO_ACCESS_HINT_SEQUENTIAL:
+			advice = POSIX_FADV_SEQUENTIAL;
+			break;
+
+		case LIBBFIO_ACCESS_HINT_RANDOM:
+			advice = POSIX_FADV_RANDOM;
+			break;
+
+		case LIBBFIO_ACCESS_HINT_WILLNEED:
+			advice = POSIX_FADV_WILLNEED;
+			break;
+
+		case LIBBFIO_ACCESS_HINT_DONTNEED:
+			advice = POSIX_FADV_DONTNEED;
+			break;
+
+		case LIBBFIO_ACCESS_HINT_NOREUSE:
+			advice = POSIX_FADV_NOREUSE;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported access hint: %d.",
+			 function,
+			 access_hint );
+
+			return( -1 );
+	}
+	/* posix_fadvise returns the error number instead of setting errno
+	 */
+	result = posix_fadvise(
+	          file_io_handle->descriptor,
+	          (off_t) offset,
+	          (off_t) size,
+	          advice );
+
+	if( result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 result,
+		 "%s: unable to set access hint for file: %" PRIs_SYSTEM ".",
+		 function,
+		 file_io_handle->name );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_ACCESS_HINT ) */
+
+/* Seeks a certain offset within the file handle
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t libbfio_file_io_handle_seek_offset(
+         libbfio_file_io_handle_t *file_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libbfio_file_seek_offset";
+	off64_t seek_offset   = 0;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO handle - missing name.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	seek_offset = (off64_t) lseek(
+	                         file_io_handle->descriptor,
+	                         (off_t) offset,
+	                         whence );
+
+	if( seek_offset < 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 errno,
+		 "%s: unable to seek offset: %" PRIi64 " in file: %" PRIs_SYSTEM ".",
+		 function,
+		 offset,
+		 file_io_handle->name );
+
+		return( -1 );
+	}
+#else
+	seek_offset = libcfile_file_seek_offset(
+	               file_io_handle->file,
+	               offset,
+	               whence,
 	               error );
 
 	if( seek_offset == -1 )
@@ -1048,6 +3271,8 @@ off64_t libbfio_file_io_handle_seek_offset(
 
 		return( -1 );
 	}
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ ) */
+
 	return( seek_offset );
 }
 
@@ -1128,6 +3353,12 @@ int libbfio_file_io_handle_is_open(
 
 		return( -1 );
 	}
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+	if( file_io_handle->descriptor != -1 )
+	{
+		result = 1;
+	}
+#else
 	result = libcfile_file_is_open(
 	          file_io_handle->file,
 	          error );
@@ -1143,6 +3374,8 @@ int libbfio_file_io_handle_is_open(
 
 		return( -1 );
 	}
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ ) */
+
 	return( result );
 }
 
@@ -1156,6 +3389,16 @@ int libbfio_file_io_handle_get_size(
 {
 	static char *function = "libbfio_file_get_size";
 
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+	off64_t current_offset = 0;
+	off64_t end_offset     = 0;
+	int result             = 0;
+
+#if defined( HAVE_FSTAT )
+	struct stat file_statistics;
+#endif
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ ) */
+
 	if( file_io_handle == NULL )
 	{
 		libcerror_error_set(
@@ -1178,6 +3421,133 @@ int libbfio_file_io_handle_get_size(
 
 		return( -1 );
 	}
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO handle - missing descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_FSTAT )
+	if( fstat(
+	     file_io_handle->descriptor,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 errno,
+		 "%s: unable to retrieve file statistics: %" PRIs_SYSTEM ".",
+		 function,
+		 file_io_handle->name );
+
+		return( -1 );
+	}
+	if( S_ISREG( file_statistics.st_mode ) )
+	{
+		*size = (size64_t) file_statistics.st_size;
+
+		return( 1 );
+	}
+#endif /* defined( HAVE_FSTAT ) */
+
+	result = libbfio_file_io_handle_get_device_size(
+	          file_io_handle,
+	          size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve device size of file: %" PRIs_SYSTEM ".",
+		 function,
+		 file_io_handle->name );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		return( 1 );
+	}
+	/* Otherwise the size is determined by seeking the end of the file
+	 * after which the current offset is restored
+	 */
+	current_offset = (off64_t) lseek(
+	                            file_io_handle->descriptor,
+	                            0,
+	                            SEEK_CUR );
+
+	if( current_offset < 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 errno,
+		 "%s: unable to determine current offset of file: %" PRIs_SYSTEM ".",
+		 function,
+		 file_io_handle->name );
+
+		return( -1 );
+	}
+	end_offset = (off64_t) lseek(
+	                        file_io_handle->descriptor,
+	                        0,
+	                        SEEK_END );
+
+	if( end_offset < 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 errno,
+		 "%s: unable to seek end of file: %" PRIs_SYSTEM ".",
+		 function,
+		 file_io_handle->name );
+
+		return( -1 );
+	}
+	if( lseek(
+	     file_io_handle->descriptor,
+	     (off_t) current_offset,
+	     SEEK_SET ) == (off_t) -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 errno,
+		 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ") in file: %" PRIs_SYSTEM ".",
+		 function,
+		 current_offset,
+		 current_offset,
+		 file_io_handle->name );
+
+		return( -1 );
+	}
+	*size = (size64_t) end_offset;
+#else
 	if( libcfile_file_get_size(
 	     file_io_handle->file,
 	     size,
@@ -1193,6 +3563,8 @@ int libbfio_file_io_handle_get_size(
 
 		return( -1 );
 	}
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ ) */
+
 	return( 1 );
 }
 
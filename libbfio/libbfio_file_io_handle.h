@@ -25,6 +25,15 @@
 #include <common.h>
 #include <types.h>
 
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libbfio_buffer_pool.h"
 #include "libbfio_libcerror.h"
 #include "libbfio_libcfile.h"
 
@@ -32,6 +41,66 @@
 extern "C" {
 #endif
 
+/* The positional (offset-based) read and write require a system file descriptor
+ */
+#if !defined( WINAPI ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) && defined( HAVE_OPEN ) && defined( HAVE_CLOSE ) && defined( HAVE_PREAD )
+#define LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ	1
+#endif
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ ) && defined( HAVE_PWRITE )
+#define LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_WRITE	1
+#endif
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ ) && defined( HAVE_SYS_UIO_H ) && defined( HAVE_PREADV )
+#define LIBBFIO_FILE_IO_HANDLE_HAVE_VECTOR_READ		1
+#endif
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ ) && defined( HAVE_POSIX_FADVISE )
+#define LIBBFIO_FILE_IO_HANDLE_HAVE_ACCESS_HINT		1
+#endif
+
+/* Direct IO requires the system file descriptor
+ */
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ ) && defined( O_DIRECT )
+#define LIBBFIO_FILE_IO_HANDLE_HAVE_DIRECT_IO		1
+#endif
+
+/* copy_file_range can be provided by the C library without being declared
+ */
+#if defined( HAVE_COPY_FILE_RANGE ) && ( HAVE_DECL_COPY_FILE_RANGE == 1 )
+#define LIBBFIO_FILE_IO_HANDLE_HAVE_COPY_FILE_RANGE	1
+#endif
+
+/* Copying data between system file descriptors in the kernel requires copy_file_range or the Linux sendfile
+ */
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_WRITE ) && defined( __linux__ ) && ( defined( LIBBFIO_FILE_IO_HANDLE_HAVE_COPY_FILE_RANGE ) || ( defined( HAVE_SYS_SENDFILE_H ) && defined( HAVE_SENDFILE ) ) )
+#define LIBBFIO_FILE_IO_HANDLE_HAVE_COPY_FROM_DESCRIPTOR	1
+#endif
+
+/* Determining the data and holes of a sparse file requires the SEEK_DATA and SEEK_HOLE seek whence values
+ */
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ ) && defined( SEEK_DATA ) && defined( SEEK_HOLE )
+#define LIBBFIO_FILE_IO_HANDLE_HAVE_EXTENTS		1
+#endif
+
+/* The maximum number of IO vectors passed to a single preadv call
+ */
+#define LIBBFIO_FILE_IO_HANDLE_MAXIMUM_NUMBER_OF_IO_VECTORS	64
+
+/* The alignment of the offset, size and buffer of a direct IO read
+ * a multitude of the page size satisfies the alignment requirements of the common file systems
+ */
+#define LIBBFIO_FILE_IO_HANDLE_DIRECT_IO_ALIGNMENT		4096
+
+/* The size of a bounce buffer used by an aligned read
+ * the largest supported device block size
+ */
+#define LIBBFIO_FILE_IO_HANDLE_BOUNCE_BUFFER_SIZE		( 1024 * 1024 )
+
+/* The number of preallocated bounce buffers
+ */
+#define LIBBFIO_FILE_IO_HANDLE_NUMBER_OF_BOUNCE_BUFFERS		2
+
 typedef struct libbfio_file_io_handle libbfio_file_io_handle_t;
 
 struct libbfio_file_io_handle
@@ -44,13 +113,34 @@ struct libbfio_file_io_handle
 	 */
 	size_t name_size;
 
+	/* The access flags
+	 */
+	int access_flags;
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+	/* The system file descriptor used for both the sequential and the positional IO
+	 */
+	int descriptor;
+
+	/* The alignment of the offset and size of a read, 0 if reads do not need to be aligned
+	 * direct IO and devices such as raw disk devices require aligned reads
+	 */
+	size_t alignment;
+
+	/* The bounce buffer pool used by aligned reads
+	 */
+	libbfio_buffer_pool_t *bounce_buffer_pool;
+#else
 	/* The file (handle)
 	 */
 	libcfile_file_t *file;
+#endif
 
-	/* The access flags
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_DIRECT_IO )
+	/* Value to indicate the file descriptor was opened for direct IO
 	 */
-	int access_flags;
+	uint8_t direct_io;
+#endif
 };
 
 int libbfio_file_io_handle_initialize(
@@ -125,6 +215,99 @@ ssize_t libbfio_file_io_handle_write_buffer(
          size_t size,
          libcerror_error_t **error );
 
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+
+ssize_t libbfio_file_io_handle_read_buffer_at_offset(
+         libbfio_file_io_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+ssize_t libbfio_file_io_handle_read_buffer_at_offset_aligned(
+         libbfio_file_io_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+int libbfio_file_io_handle_get_device_size(
+     libbfio_file_io_handle_t *file_io_handle,
+     size64_t *size,
+     libcerror_error_t **error );
+
+int libbfio_file_io_handle_get_device_block_size(
+     libbfio_file_io_handle_t *file_io_handle,
+     size_t *block_size,
+     libcerror_error_t **error );
+
+int libbfio_file_io_handle_get_descriptor(
+     libbfio_file_io_handle_t *file_io_handle,
+     int *descriptor,
+     off64_t *descriptor_offset,
+     libcerror_error_t **error );
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ ) */
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_COPY_FROM_DESCRIPTOR )
+
+int libbfio_file_io_handle_copy_from_descriptor(
+     libbfio_file_io_handle_t *file_io_handle,
+     off64_t offset,
+     int source_descriptor,
+     off64_t source_offset,
+     size_t size,
+     size_t *copy_size,
+     libcerror_error_t **error );
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_COPY_FROM_DESCRIPTOR ) */
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_EXTENTS )
+
+int libbfio_file_io_handle_get_extent(
+     libbfio_file_io_handle_t *file_io_handle,
+     off64_t offset,
+     size64_t size,
+     size64_t *extent_size,
+     uint32_t *extent_flags,
+     libcerror_error_t **error );
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_EXTENTS ) */
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_VECTOR_READ )
+
+ssize_t libbfio_file_io_handle_read_vector_at_offset(
+         libbfio_file_io_handle_t *file_io_handle,
+         uint8_t **buffers,
+         size_t *buffer_sizes,
+         int number_of_buffers,
+         off64_t offset,
+         libcerror_error_t **error );
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_VECTOR_READ ) */
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_WRITE )
+
+ssize_t libbfio_file_io_handle_write_buffer_at_offset(
+         libbfio_file_io_handle_t *file_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_WRITE ) */
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_ACCESS_HINT )
+
+int libbfio_file_io_handle_set_access_hint(
+     libbfio_file_io_handle_t *file_io_handle,
+     off64_t offset,
+     size64_t size,
+     int access_hint,
+     libcerror_error_t **error );
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_ACCESS_HINT ) */
+
 off64_t libbfio_file_io_handle_seek_offset(
          libbfio_file_io_handle_t *file_io_handle,
          off64_t offset,
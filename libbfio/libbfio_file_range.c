@@ -105,6 +105,127 @@ int libbfio_file_range_initialize(
 
 		goto on_error;
 	}
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+	if( libbfio_handle_set_read_at_offset_function(
+	     *handle,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, off64_t, libcerror_error_t **)) libbfio_file_range_io_handle_read_buffer_at_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set read at offset function.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_WRITE )
+	if( libbfio_handle_set_write_at_offset_function(
+	     *handle,
+	     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, off64_t, libcerror_error_t **)) libbfio_file_range_io_handle_write_buffer_at_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set write at offset function.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_ACCESS_HINT )
+	if( libbfio_handle_set_access_hint_function(
+	     *handle,
+	     (int (*)(intptr_t *, off64_t, size64_t, int, libcerror_error_t **)) libbfio_file_range_io_handle_set_access_hint,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set access hint function.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_COPY_FROM_DESCRIPTOR )
+	if( libbfio_handle_set_descriptor_functions(
+	     *handle,
+	     (int (*)(intptr_t *, int *, off64_t *, libcerror_error_t **)) libbfio_file_range_io_handle_get_descriptor,
+	     (int (*)(intptr_t *, off64_t, int, off64_t, size_t, size_t *, libcerror_error_t **)) libbfio_file_range_io_handle_copy_from_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set descriptor functions.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+#elif defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+	if( libbfio_handle_set_descriptor_functions(
+	     *handle,
+	     (int (*)(intptr_t *, int *, off64_t *, libcerror_error_t **)) libbfio_file_range_io_handle_get_descriptor,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set descriptor functions.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_EXTENTS )
+	if( libbfio_handle_set_extent_function(
+	     *handle,
+	     (int (*)(intptr_t *, off64_t, size64_t, size64_t *, uint32_t *, libcerror_error_t **)) libbfio_file_range_io_handle_get_extent,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set extent function.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
 	return( 1 );
 
 on_error:
@@ -117,6 +238,109 @@ on_error:
 	return( -1 );
 }
 
+/* Creates a file range handle that shares the file of another file range handle
+ * The shared file is opened once and read using positional reads
+ * The name of the other file range handle must be set before its file is shared
+ * Make sure the value handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_file_range_initialize_with_shared_file(
+     libbfio_handle_t **handle,
+     libbfio_handle_t *file_range_handle,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_file_range_handle = NULL;
+	libbfio_internal_handle_t *internal_handle            = NULL;
+	static char *function                                 = "libbfio_file_range_initialize_with_shared_file";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_range_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file range handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_range_handle = (libbfio_internal_handle_t *) file_range_handle;
+
+	if( internal_file_range_handle->free_io_handle != (int (*)(intptr_t **, libcerror_error_t **)) libbfio_file_range_io_handle_free )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported file range handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_range_initialize(
+	     handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) *handle;
+
+	if( libbfio_file_range_io_handle_set_shared_file(
+	     (libbfio_file_range_io_handle_t *) internal_handle->io_handle,
+	     (libbfio_file_range_io_handle_t *) internal_file_range_handle->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set shared file in file range IO handle.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+	/* The descriptor cache accounts for the shared file once
+	 */
+	internal_handle->descriptor_cache_shared_key            = (intptr_t *) ( (libbfio_file_range_io_handle_t *) internal_handle->io_handle )->shared_file_io_handle;
+	internal_file_range_handle->descriptor_cache_shared_key = internal_handle->descriptor_cache_shared_key;
+#endif
+	return( 1 );
+}
+
 /* Retrieves the name size of the file range handle
  * The name size includes the end of string character
  * Returns 1 if succesful or -1 on error
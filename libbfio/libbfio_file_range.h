@@ -38,6 +38,12 @@ int libbfio_file_range_initialize(
      libbfio_handle_t **handle,
      libcerror_error_t **error );
 
+LIBBFIO_EXTERN \
+int libbfio_file_range_initialize_with_shared_file(
+     libbfio_handle_t **handle,
+     libbfio_handle_t *file_range_handle,
+     libcerror_error_t **error );
+
 LIBBFIO_EXTERN \
 int libbfio_file_range_get_name_size(
      libbfio_handle_t *handle,
@@ -31,6 +31,7 @@
 #include "libbfio_file_io_handle.h"
 #include "libbfio_file_range_io_handle.h"
 #include "libbfio_libcerror.h"
+#include "libbfio_shared_file_io_handle.h"
 
 /* Creates a file range IO handle
  * Make sure the value file_range_io_handle is referencing, is set to NULL
@@ -141,18 +142,59 @@ int libbfio_file_range_io_handle_free(
 	}
 	if( *file_range_io_handle != NULL )
 	{
-		if( libbfio_file_io_handle_free(
-		     &( ( *file_range_io_handle )->file_io_handle ),
-		     error ) != 1 )
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+		if( ( *file_range_io_handle )->shared_file_io_handle != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file IO handle.",
-			 function );
-
-			result = -1;
+			if( ( *file_range_io_handle )->is_open != 0 )
+			{
+				if( libbfio_shared_file_io_handle_close(
+				     ( *file_range_io_handle )->shared_file_io_handle,
+				     error ) != 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+					 "%s: unable to close shared file IO handle.",
+					 function );
+
+					result = -1;
+				}
+			}
+			/* The file IO handle is managed by the shared file IO handle
+			 */
+			( *file_range_io_handle )->file_io_handle = NULL;
+
+			if( libbfio_shared_file_io_handle_free(
+			     &( ( *file_range_io_handle )->shared_file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free shared file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		if( ( *file_range_io_handle )->file_io_handle != NULL )
+		{
+			if( libbfio_file_io_handle_free(
+			     &( ( *file_range_io_handle )->file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file IO handle.",
+				 function );
+
+				result = -1;
+			}
 		}
 		memory_free(
 		 *file_range_io_handle );
@@ -233,6 +275,29 @@ int libbfio_file_range_io_handle_clone(
 
 		return( -1 );
 	}
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+	if( source_file_range_io_handle->shared_file_io_handle != NULL )
+	{
+		/* The clone shares the file of the source file range IO handle
+		 */
+		if( libbfio_shared_file_io_handle_add_reference(
+		     source_file_range_io_handle->shared_file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add reference to shared file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		( *destination_file_range_io_handle )->shared_file_io_handle = source_file_range_io_handle->shared_file_io_handle;
+		( *destination_file_range_io_handle )->file_io_handle        = source_file_range_io_handle->shared_file_io_handle->file_io_handle;
+	}
+	else
+#endif
 	if( libbfio_file_io_handle_clone(
 	     &( ( *destination_file_range_io_handle )->file_io_handle ),
 	     source_file_range_io_handle->file_io_handle,
@@ -262,6 +327,181 @@ on_error:
 	return( -1 );
 }
 
+/* Sets the file range IO handle to share the file of the source file range IO handle
+ * The shared file is read using positional reads so that the file ranges do not share a current offset
+ * Neither of the file range IO handles can be open
+ * Returns 1 if succesful or -1 on error
+ */
+int libbfio_file_range_io_handle_set_shared_file(
+     libbfio_file_range_io_handle_t *file_range_io_handle,
+     libbfio_file_range_io_handle_t *source_file_range_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_file_range_io_handle_set_shared_file";
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+	int result            = 0;
+#endif
+
+	if( file_range_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file range IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_file_range_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source file range IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_file_range_io_handle == file_range_io_handle )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source file range IO handle value same as file range IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+	result = libbfio_file_range_io_handle_is_open(
+	          file_range_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if file range IO handle is open.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file range IO handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_file_range_io_handle->shared_file_io_handle == NULL )
+	{
+		result = libbfio_file_io_handle_is_open(
+		          source_file_range_io_handle->file_io_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if source file range IO handle is open.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid source file range IO handle - already open.",
+			 function );
+
+			return( -1 );
+		}
+		/* The shared file IO handle takes over the file IO handle of the source file range IO handle
+		 */
+		if( libbfio_shared_file_io_handle_initialize(
+		     &( source_file_range_io_handle->shared_file_io_handle ),
+		     source_file_range_io_handle->file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create shared file IO handle.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libbfio_shared_file_io_handle_add_reference(
+	     source_file_range_io_handle->shared_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add reference to shared file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_range_io_handle->shared_file_io_handle != NULL )
+	{
+		file_range_io_handle->file_io_handle = NULL;
+
+		result = libbfio_shared_file_io_handle_free(
+		          &( file_range_io_handle->shared_file_io_handle ),
+		          error );
+	}
+	else
+	{
+		result = libbfio_file_io_handle_free(
+		          &( file_range_io_handle->file_io_handle ),
+		          error );
+	}
+	file_range_io_handle->shared_file_io_handle = source_file_range_io_handle->shared_file_io_handle;
+	file_range_io_handle->file_io_handle        = source_file_range_io_handle->shared_file_io_handle->file_io_handle;
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: sharing a file requires positional reads.",
+	 function );
+
+	return( -1 );
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ ) */
+}
+
 /* Retrieves the name size of the file range IO handle
  * The name size includes the end of string character
  * Returns 1 if succesful or -1 on error
@@ -364,6 +604,19 @@ int libbfio_file_range_io_handle_set_name(
 
 		return( -1 );
 	}
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+	if( file_range_io_handle->shared_file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file range IO handle - file is shared.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	if( libbfio_file_io_handle_set_name(
 	     file_range_io_handle->file_io_handle,
 	     name,
@@ -486,6 +739,19 @@ int libbfio_file_range_io_handle_set_name_wide(
 
 		return( -1 );
 	}
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+	if( file_range_io_handle->shared_file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file range IO handle - file is shared.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	if( libbfio_file_io_handle_set_name_wide(
 	     file_range_io_handle->file_io_handle,
 	     name,
@@ -608,6 +874,7 @@ int libbfio_file_range_io_handle_set(
 }
 
 /* Opens the file range IO handle
+ * A file range IO handle that shares its file can only be opened for reading
  * Returns 1 if successful or -1 on error
  */
 int libbfio_file_range_io_handle_open(
@@ -629,6 +896,51 @@ int libbfio_file_range_io_handle_open(
 
 		return( -1 );
 	}
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+	if( file_range_io_handle->shared_file_io_handle != NULL )
+	{
+		if( file_range_io_handle->is_open != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid file range IO handle - already open.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: write access to shared file currently not supported.",
+			 function );
+
+			return( -1 );
+		}
+		/* Only the first file range that opens the shared file opens the file
+		 */
+		if( libbfio_shared_file_io_handle_open(
+		     file_range_io_handle->shared_file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open shared file IO handle.",
+			 function );
+
+			return( -1 );
+		}
+		file_range_io_handle->is_open = 1;
+	}
+	else
+#endif
 	if( libbfio_file_io_handle_open(
 	     file_range_io_handle->file_io_handle,
 	     access_flags,
@@ -655,7 +967,7 @@ int libbfio_file_range_io_handle_open(
 		 "%s: unable to retrieve size from file IO handle.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( file_range_io_handle->range_offset >= (off64_t) file_size )
 	{
@@ -666,7 +978,7 @@ int libbfio_file_range_io_handle_open(
 		 "%s: invalid range offset value exceeds file size.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	file_size -= file_range_io_handle->range_offset;
 
@@ -679,8 +991,18 @@ int libbfio_file_range_io_handle_open(
 		 "%s: invalid range size value exceeds file size.",
 		 function );
 
-		return( -1 );
+		goto on_error;
+	}
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+	if( file_range_io_handle->shared_file_io_handle != NULL )
+	{
+		/* The shared file is not seeked since the current offset is maintained per file range
+		 */
+		file_range_io_handle->current_offset = 0;
+
+		return( 1 );
 	}
+#endif
 	if( libbfio_file_io_handle_seek_offset(
 	     file_range_io_handle->file_io_handle,
 	     file_range_io_handle->range_offset,
@@ -697,6 +1019,19 @@ int libbfio_file_range_io_handle_open(
 		return( -1 );
 	}
 	return( 1 );
+
+on_error:
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+	if( file_range_io_handle->is_open != 0 )
+	{
+		libbfio_shared_file_io_handle_close(
+		 file_range_io_handle->shared_file_io_handle,
+		 NULL );
+
+		file_range_io_handle->is_open = 0;
+	}
+#endif
+	return( -1 );
 }
 
 /* Closes the file range IO handle
@@ -719,6 +1054,33 @@ int libbfio_file_range_io_handle_close(
 
 		return( -1 );
 	}
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+	if( file_range_io_handle->shared_file_io_handle != NULL )
+	{
+		if( file_range_io_handle->is_open == 0 )
+		{
+			return( 0 );
+		}
+		file_range_io_handle->is_open = 0;
+
+		/* Only the last file range that closes the shared file closes the file
+		 */
+		if( libbfio_shared_file_io_handle_close(
+		     file_range_io_handle->shared_file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close shared file IO handle.",
+			 function );
+
+			return( -1 );
+		}
+		return( 0 );
+	}
+#endif
 	if( libbfio_file_io_handle_close(
 	     file_range_io_handle->file_io_handle,
 	     error ) != 0 )
@@ -759,6 +1121,34 @@ ssize_t libbfio_file_range_io_handle_read_buffer(
 
 		return( -1 );
 	}
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+	if( file_range_io_handle->shared_file_io_handle != NULL )
+	{
+		/* The shared file is read at the current offset of the file range
+		 */
+		read_count = libbfio_file_range_io_handle_read_buffer_at_offset(
+		              file_range_io_handle,
+		              buffer,
+		              size,
+		              file_range_io_handle->current_offset,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from shared file IO handle.",
+			 function );
+
+			return( -1 );
+		}
+		file_range_io_handle->current_offset += (off64_t) read_count;
+
+		return( read_count );
+	}
+#endif
 	file_offset = libbfio_file_io_handle_seek_offset(
 	               file_range_io_handle->file_io_handle,
 	               0,
@@ -818,18 +1208,22 @@ ssize_t libbfio_file_range_io_handle_read_buffer(
 	return( read_count );
 }
 
-/* Writes a buffer to the file range IO handle
- * Returns the number of bytes written if successful, or -1 on error
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+
+/* Reads a buffer at a specific offset from the file range IO handle
+ * The offset is relative to the start of the range
+ * This function does not change the current offset of the file IO handle
+ * Returns the number of bytes read if successful, or -1 on error
  */
-ssize_t libbfio_file_range_io_handle_write_buffer(
+ssize_t libbfio_file_range_io_handle_read_buffer_at_offset(
          libbfio_file_range_io_handle_t *file_range_io_handle,
-         const uint8_t *buffer,
+         uint8_t *buffer,
          size_t size,
+         off64_t offset,
          libcerror_error_t **error )
 {
-	static char *function = "libbfio_file_range_io_handle_write_buffer";
-	off64_t file_offset   = 0;
-	ssize_t write_count   = 0;
+	static char *function = "libbfio_file_range_io_handle_read_buffer_at_offset";
+	ssize_t read_count    = 0;
 
 	if( file_range_io_handle == NULL )
 	{
@@ -842,20 +1236,122 @@ ssize_t libbfio_file_range_io_handle_write_buffer(
 
 		return( -1 );
 	}
-	file_offset = libbfio_file_io_handle_seek_offset(
-	               file_range_io_handle->file_io_handle,
-	               0,
-	               SEEK_CUR,
-	               error );
-
-	if( file_offset == -1 )
+	if( buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve current offset from file IO handle.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_range_io_handle->range_size != 0 )
+	{
+		if( (size64_t) offset >= file_range_io_handle->range_size )
+		{
+			return( 0 );
+		}
+		if( (size64_t) size > ( file_range_io_handle->range_size - (size64_t) offset ) )
+		{
+			size = (size_t) ( file_range_io_handle->range_size - (size64_t) offset );
+		}
+	}
+	if( offset > ( (off64_t) INT64_MAX - file_range_io_handle->range_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_file_io_handle_read_buffer_at_offset(
+	              file_range_io_handle->file_io_handle,
+	              buffer,
+	              size,
+	              file_range_io_handle->range_offset + offset,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ ) */
+
+/* Writes a buffer to the file range IO handle
+ * Returns the number of bytes written if successful, or -1 on error
+ */
+ssize_t libbfio_file_range_io_handle_write_buffer(
+         libbfio_file_range_io_handle_t *file_range_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function = "libbfio_file_range_io_handle_write_buffer";
+	off64_t file_offset   = 0;
+	ssize_t write_count   = 0;
+
+	if( file_range_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file range IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	file_offset = libbfio_file_io_handle_seek_offset(
+	               file_range_io_handle->file_io_handle,
+	               0,
+	               SEEK_CUR,
+	               error );
+
+	if( file_offset == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current offset from file IO handle.",
+		 function );
 
 		return( -1 );
 	}
@@ -901,6 +1397,433 @@ ssize_t libbfio_file_range_io_handle_write_buffer(
 	return( write_count );
 }
 
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_WRITE )
+
+/* Writes a buffer at a specific offset to the file range IO handle
+ * The offset is relative to the start of the range
+ * This function does not change the current offset of the file IO handle
+ * Returns the number of bytes written if successful, or -1 on error
+ */
+ssize_t libbfio_file_range_io_handle_write_buffer_at_offset(
+         libbfio_file_range_io_handle_t *file_range_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libbfio_file_range_io_handle_write_buffer_at_offset";
+	ssize_t write_count   = 0;
+
+	if( file_range_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file range IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_range_io_handle->range_size != 0 )
+	{
+		if( (size64_t) offset >= file_range_io_handle->range_size )
+		{
+			return( 0 );
+		}
+		if( (size64_t) size > ( file_range_io_handle->range_size - (size64_t) offset ) )
+		{
+			size = (size_t) ( file_range_io_handle->range_size - (size64_t) offset );
+		}
+	}
+	if( offset > ( (off64_t) INT64_MAX - file_range_io_handle->range_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	write_count = libbfio_file_io_handle_write_buffer_at_offset(
+	               file_range_io_handle->file_io_handle,
+	               buffer,
+	               size,
+	               file_range_io_handle->range_offset + offset,
+	               error );
+
+	if( write_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write to file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( write_count );
+}
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_WRITE ) */
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_ACCESS_HINT )
+
+/* Passes an access pattern hint for a range of the file range to the system
+ * The offset is relative to the start of the range
+ * The hint applies from offset to the end of the range if size is 0
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_file_range_io_handle_set_access_hint(
+     libbfio_file_range_io_handle_t *file_range_io_handle,
+     off64_t offset,
+     size64_t size,
+     int access_hint,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_file_range_io_handle_set_access_hint";
+
+	if( file_range_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file range IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_range_io_handle->range_size != 0 )
+	{
+		if( (size64_t) offset >= file_range_io_handle->range_size )
+		{
+			return( 1 );
+		}
+		if( ( size == 0 )
+		 || ( size > ( file_range_io_handle->range_size - (size64_t) offset ) ) )
+		{
+			size = file_range_io_handle->range_size - (size64_t) offset;
+		}
+	}
+	if( offset > ( (off64_t) INT64_MAX - file_range_io_handle->range_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_io_handle_set_access_hint(
+	     file_range_io_handle->file_io_handle,
+	     file_range_io_handle->range_offset + offset,
+	     size,
+	     access_hint,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set access hint in file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_ACCESS_HINT ) */
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+
+/* Retrieves the system file descriptor
+ * The descriptor offset contains the offset of the start of the range in the file
+ * Returns 1 if successful, 0 if the file is not open or -1 on error
+ */
+int libbfio_file_range_io_handle_get_descriptor(
+     libbfio_file_range_io_handle_t *file_range_io_handle,
+     int *descriptor,
+     off64_t *descriptor_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_file_range_io_handle_get_descriptor";
+	int result            = 0;
+
+	if( file_range_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file range IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libbfio_file_io_handle_get_descriptor(
+	          file_range_io_handle->file_io_handle,
+	          descriptor,
+	          descriptor_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve descriptor from file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*descriptor_offset += file_range_io_handle->range_offset;
+	}
+	return( result );
+}
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ ) */
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_COPY_FROM_DESCRIPTOR )
+
+/* Copies data from a source system file descriptor to a specific offset in the file range
+ * The offset is relative to the start of the range
+ * This function does not change the current offset of the file IO handle
+ * Returns 1 if successful, 0 if the kernel cannot copy between the descriptors or -1 on error
+ */
+int libbfio_file_range_io_handle_copy_from_descriptor(
+     libbfio_file_range_io_handle_t *file_range_io_handle,
+     off64_t offset,
+     int source_descriptor,
+     off64_t source_offset,
+     size_t size,
+     size_t *copy_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_file_range_io_handle_copy_from_descriptor";
+	int result            = 0;
+
+	if( file_range_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file range IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( copy_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid copy size.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_range_io_handle->range_size != 0 )
+	{
+		if( (size64_t) offset >= file_range_io_handle->range_size )
+		{
+			*copy_size = 0;
+
+			return( 1 );
+		}
+		if( (size64_t) size > ( file_range_io_handle->range_size - (size64_t) offset ) )
+		{
+			size = (size_t) ( file_range_io_handle->range_size - (size64_t) offset );
+		}
+	}
+	if( offset > ( (off64_t) INT64_MAX - file_range_io_handle->range_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = libbfio_file_io_handle_copy_from_descriptor(
+	          file_range_io_handle->file_io_handle,
+	          file_range_io_handle->range_offset + offset,
+	          source_descriptor,
+	          source_offset,
+	          size,
+	          copy_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to copy to file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_COPY_FROM_DESCRIPTOR ) */
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_EXTENTS )
+
+/* Retrieves the extent of the file range at a specific offset
+ * The offset is relative to the start of the range
+ * The extent size is at most size bytes and does not extend beyond the end of the range
+ * Returns 1 if successful, 0 if the extents cannot be determined or -1 on error
+ */
+int libbfio_file_range_io_handle_get_extent(
+     libbfio_file_range_io_handle_t *file_range_io_handle,
+     off64_t offset,
+     size64_t size,
+     size64_t *extent_size,
+     uint32_t *extent_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_file_range_io_handle_get_extent";
+	int result            = 0;
+
+	if( file_range_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file range IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_range_io_handle->range_size != 0 )
+	{
+		if( (size64_t) offset >= file_range_io_handle->range_size )
+		{
+			return( 0 );
+		}
+		if( size > ( file_range_io_handle->range_size - (size64_t) offset ) )
+		{
+			size = file_range_io_handle->range_size - (size64_t) offset;
+		}
+	}
+	if( offset > ( (off64_t) INT64_MAX - file_range_io_handle->range_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = libbfio_file_io_handle_get_extent(
+	          file_range_io_handle->file_io_handle,
+	          file_range_io_handle->range_offset + offset,
+	          size,
+	          extent_size,
+	          extent_flags,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve extent from file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_EXTENTS ) */
+
 /* Seeks a certain offset within the file range IO handle
  * Returns the offset if the seek is successful or -1 on error
  */
@@ -914,6 +1837,10 @@ off64_t libbfio_file_range_io_handle_seek_offset(
 	off64_t file_offset   = 0;
 	off64_t seek_offset   = 0;
 
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+	size64_t range_size   = 0;
+#endif
+
 	if( file_range_io_handle == NULL )
 	{
 		libcerror_error_set(
@@ -938,6 +1865,50 @@ off64_t libbfio_file_range_io_handle_seek_offset(
 
 		return( -1 );
 	}
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+	if( file_range_io_handle->shared_file_io_handle != NULL )
+	{
+		/* The current offset is maintained per file range since the file is shared
+		 */
+		if( whence == SEEK_CUR )
+		{
+			offset += file_range_io_handle->current_offset;
+		}
+		else if( whence == SEEK_END )
+		{
+			if( libbfio_file_range_io_handle_get_size(
+			     file_range_io_handle,
+			     &range_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve range size.",
+				 function );
+
+				return( -1 );
+			}
+			offset += (off64_t) range_size;
+		}
+		if( offset < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid offset: %" PRIi64 " value out of bounds.",
+			 function,
+			 offset );
+
+			return( -1 );
+		}
+		file_range_io_handle->current_offset = offset;
+
+		return( offset );
+	}
+#endif
 	if( whence == SEEK_CUR )
 	{
 		file_offset = libbfio_file_io_handle_seek_offset(
@@ -1081,6 +2052,12 @@ int libbfio_file_range_io_handle_is_open(
 
 		return( -1 );
 	}
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+	if( file_range_io_handle->shared_file_io_handle != NULL )
+	{
+		return( (int) file_range_io_handle->is_open );
+	}
+#endif
 	result = libbfio_file_io_handle_is_open(
 	          file_range_io_handle->file_io_handle,
 	          error );
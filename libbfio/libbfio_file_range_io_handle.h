@@ -27,6 +27,7 @@
 
 #include "libbfio_file_io_handle.h"
 #include "libbfio_libcerror.h"
+#include "libbfio_shared_file_io_handle.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -47,6 +48,21 @@ struct libbfio_file_range_io_handle
 	/* The range size
 	 */
 	size64_t range_size;
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+	/* The shared file IO handle
+	 * the file IO handle refers to the file IO handle of the shared file IO handle when set
+	 */
+	libbfio_shared_file_io_handle_t *shared_file_io_handle;
+
+	/* The current offset relative to the start of the range, used when the file is shared
+	 */
+	off64_t current_offset;
+
+	/* Value to indicate the file range is open, used when the file is shared
+	 */
+	uint8_t is_open;
+#endif
 };
 
 int libbfio_file_range_io_handle_initialize(
@@ -62,6 +78,11 @@ int libbfio_file_range_io_handle_clone(
      libbfio_file_range_io_handle_t *source_file_range_io_handle,
      libcerror_error_t **error );
 
+int libbfio_file_range_io_handle_set_shared_file(
+     libbfio_file_range_io_handle_t *file_range_io_handle,
+     libbfio_file_range_io_handle_t *source_file_range_io_handle,
+     libcerror_error_t **error );
+
 int libbfio_file_range_io_handle_get_name_size(
      libbfio_file_range_io_handle_t *file_range_io_handle,
      size_t *name_size,
@@ -127,12 +148,80 @@ ssize_t libbfio_file_range_io_handle_read_buffer(
          size_t size,
          libcerror_error_t **error );
 
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+
+ssize_t libbfio_file_range_io_handle_read_buffer_at_offset(
+         libbfio_file_range_io_handle_t *file_range_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ ) */
+
 ssize_t libbfio_file_range_io_handle_write_buffer(
          libbfio_file_range_io_handle_t *file_range_io_handle,
          const uint8_t *buffer,
          size_t size,
          libcerror_error_t **error );
 
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_WRITE )
+
+ssize_t libbfio_file_range_io_handle_write_buffer_at_offset(
+         libbfio_file_range_io_handle_t *file_range_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_WRITE ) */
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_ACCESS_HINT )
+
+int libbfio_file_range_io_handle_set_access_hint(
+     libbfio_file_range_io_handle_t *file_range_io_handle,
+     off64_t offset,
+     size64_t size,
+     int access_hint,
+     libcerror_error_t **error );
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_ACCESS_HINT ) */
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+
+int libbfio_file_range_io_handle_get_descriptor(
+     libbfio_file_range_io_handle_t *file_range_io_handle,
+     int *descriptor,
+     off64_t *descriptor_offset,
+     libcerror_error_t **error );
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ ) */
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_COPY_FROM_DESCRIPTOR )
+
+int libbfio_file_range_io_handle_copy_from_descriptor(
+     libbfio_file_range_io_handle_t *file_range_io_handle,
+     off64_t offset,
+     int source_descriptor,
+     off64_t source_offset,
+     size_t size,
+     size_t *copy_size,
+     libcerror_error_t **error );
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_COPY_FROM_DESCRIPTOR ) */
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_EXTENTS )
+
+int libbfio_file_range_io_handle_get_extent(
+     libbfio_file_range_io_handle_t *file_range_io_handle,
+     off64_t offset,
+     size64_t size,
+     size64_t *extent_size,
+     uint32_t *extent_flags,
+     libcerror_error_t **error );
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_EXTENTS ) */
+
 off64_t libbfio_file_range_io_handle_seek_offset(
          libbfio_file_range_io_handle_t *file_range_io_handle,
          off64_t offset,
@@ -23,11 +23,20 @@
 #include <memory.h>
 #include <types.h>
 
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
 #if defined( HAVE_UNISTD_H )
 #include <unistd.h>
 #endif
 
 #include "libbfio_definitions.h"
+#include "libbfio_descriptor_cache.h"
 #include "libbfio_handle.h"
 #include "libbfio_libcdata.h"
 #include "libbfio_libcerror.h"
@@ -226,6 +235,46 @@ int libbfio_handle_free(
 		internal_handle = (libbfio_internal_handle_t *) *handle;
 		*handle         = NULL;
 
+		/* The prefetcher is freed before the IO handle is closed
+		 * since the prefetcher can be reading from the IO handle
+		 */
+		if( internal_handle->prefetcher != NULL )
+		{
+			if( libbfio_prefetcher_free(
+			     &( internal_handle->prefetcher ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free prefetcher.",
+				 function );
+
+				result = -1;
+			}
+		}
+		/* The handle is detached from the descriptor cache before the IO handle is closed
+		 * since the descriptor cache can close the IO handle when it is idle
+		 */
+		if( internal_handle->descriptor_cache != NULL )
+		{
+			if( libbfio_descriptor_cache_detach_handle(
+			     internal_handle->descriptor_cache,
+			     internal_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to detach handle from descriptor cache.",
+				 function );
+
+				result = -1;
+			}
+			internal_handle->descriptor_cache = NULL;
+		}
 		if( internal_handle->is_open != NULL )
 		{
 			is_open = internal_handle->is_open(
@@ -319,6 +368,11 @@ int libbfio_handle_free(
 				result = -1;
 			}
 		}
+		if( internal_handle->readahead_buffer != NULL )
+		{
+			memory_free(
+			 internal_handle->readahead_buffer );
+		}
 		memory_free(
 		 internal_handle );
 	}
@@ -449,6 +503,37 @@ int libbfio_handle_clone(
 	}
 	destination_io_handle = NULL;
 
+	( (libbfio_internal_handle_t *) *destination_handle )->read_at_offset = internal_source_handle->read_at_offset;
+	( (libbfio_internal_handle_t *) *destination_handle )->write_at_offset = internal_source_handle->write_at_offset;
+	( (libbfio_internal_handle_t *) *destination_handle )->read_vector_at_offset = internal_source_handle->read_vector_at_offset;
+	( (libbfio_internal_handle_t *) *destination_handle )->access_hint = internal_source_handle->access_hint;
+	( (libbfio_internal_handle_t *) *destination_handle )->get_data_pointer = internal_source_handle->get_data_pointer;
+	( (libbfio_internal_handle_t *) *destination_handle )->release_data_pointer = internal_source_handle->release_data_pointer;
+	( (libbfio_internal_handle_t *) *destination_handle )->get_descriptor = internal_source_handle->get_descriptor;
+	( (libbfio_internal_handle_t *) *destination_handle )->copy_from_descriptor = internal_source_handle->copy_from_descriptor;
+	( (libbfio_internal_handle_t *) *destination_handle )->get_extent = internal_source_handle->get_extent;
+	( (libbfio_internal_handle_t *) *destination_handle )->descriptor_cache_shared_key = internal_source_handle->descriptor_cache_shared_key;
+	( (libbfio_internal_handle_t *) *destination_handle )->maximum_readahead_size = internal_source_handle->maximum_readahead_size;
+	( (libbfio_internal_handle_t *) *destination_handle )->readahead_next_offset = -1;
+
+	if( internal_source_handle->prefetcher != NULL )
+	{
+		if( libbfio_handle_set_prefetch(
+		     *destination_handle,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set prefetch in destination handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+
 	if( internal_source_handle->access_flags != 0 )
 	{
 		if( libbfio_handle_open(
@@ -635,7 +720,9 @@ int libbfio_handle_open(
 			goto on_error;
 		}
 	}
-	internal_handle->access_flags = access_flags;
+	internal_handle->access_flags          = access_flags;
+	internal_handle->readahead_data_offset = 0;
+	internal_handle->readahead_data_size   = 0;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -762,6 +849,42 @@ int libbfio_handle_reopen(
 	 */
 	if( internal_handle->access_flags != access_flags )
 	{
+		internal_handle->readahead_data_offset = 0;
+		internal_handle->readahead_data_size   = 0;
+
+		if( internal_handle->prefetcher != NULL )
+		{
+			if( libbfio_prefetcher_cancel(
+			     internal_handle->prefetcher,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to cancel prefetch.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( internal_handle->descriptor_cache != NULL )
+		{
+			if( libbfio_descriptor_cache_remove_open_handle(
+			     internal_handle->descriptor_cache,
+			     internal_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove handle from descriptor cache.",
+				 function );
+
+				goto on_error;
+			}
+		}
 		if( internal_handle->close(
 		     internal_handle->io_handle,
 		     error ) != 0 )
@@ -905,6 +1028,22 @@ int libbfio_handle_close(
 		return( -1 );
 	}
 #endif
+	if( internal_handle->prefetcher != NULL )
+	{
+		if( libbfio_prefetcher_cancel(
+		     internal_handle->prefetcher,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to cancel prefetch.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	if( internal_handle->open_on_demand != 0 )
 	{
 		if( internal_handle->is_open == NULL )
@@ -918,6 +1057,23 @@ int libbfio_handle_close(
 
 			goto on_error;
 		}
+		if( internal_handle->descriptor_cache != NULL )
+		{
+			if( libbfio_descriptor_cache_remove_open_handle(
+			     internal_handle->descriptor_cache,
+			     internal_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove handle from descriptor cache.",
+				 function );
+
+				goto on_error;
+			}
+		}
 		is_open = internal_handle->is_open(
 			   internal_handle->io_handle,
 		           error );
@@ -950,6 +1106,8 @@ int libbfio_handle_close(
 			goto on_error;
 		}
 	}
+	internal_handle->readahead_data_offset = 0;
+	internal_handle->readahead_data_size   = 0;
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_handle->read_write_lock,
@@ -976,20 +1134,17 @@ on_error:
 	return( -1 );
 }
 
-/* Reads data at the current offset into the buffer
+/* Discards the data in the readahead buffer and cancels the submitted prefetch
+ * If data remains in the readahead buffer the IO handle is positioned
+ * at the current offset again
  * This function is not multi-thread safe acquire write lock before call
- * Returns the number of bytes read if successful, or -1 on error
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libbfio_internal_handle_read_buffer(
-         libbfio_internal_handle_t *internal_handle,
-         uint8_t *buffer,
-         size_t size,
-         libcerror_error_t **error )
+int libbfio_internal_handle_discard_readahead(
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
 {
-	static char *function = "libbfio_internal_handle_read_buffer";
-	ssize_t read_count    = 0;
-	int is_open           = 0;
-	int result            = 0;
+	static char *function = "libbfio_internal_handle_discard_readahead";
 
 	if( internal_handle == NULL )
 	{
@@ -1002,63 +1157,33 @@ ssize_t libbfio_internal_handle_read_buffer(
 
 		return( -1 );
 	}
-	if( internal_handle->read == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing read function.",
-		 function );
-
-		return( -1 );
-	}
-	if( buffer == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid buffer.",
-		 function );
-
-		return( -1 );
-	}
-	if( size > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid size value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	if( internal_handle->open_on_demand != 0 )
+	if( internal_handle->prefetcher != NULL )
 	{
-		if( internal_handle->is_open == NULL )
+		if( libbfio_prefetcher_cancel(
+		     internal_handle->prefetcher,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid handle - missing is open function.",
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to cancel prefetch.",
 			 function );
 
 			return( -1 );
 		}
-		if( internal_handle->open == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid handle - missing open function.",
-			 function );
+	}
+	if( internal_handle->readahead_data_size == 0 )
+	{
+		return( 1 );
+	}
+	internal_handle->readahead_data_offset = 0;
+	internal_handle->readahead_data_size   = 0;
 
-			return( -1 );
-		}
+	/* If the handle is opened on demand the current offset is set when the IO handle is opened
+	 */
+	if( internal_handle->open_on_demand == 0 )
+	{
 		if( internal_handle->seek_offset == NULL )
 		{
 			libcerror_error_set(
@@ -1070,81 +1195,90 @@ ssize_t libbfio_internal_handle_read_buffer(
 
 			return( -1 );
 		}
-		is_open = internal_handle->is_open(
-			   internal_handle->io_handle,
-		           error );
-
-		if( is_open == -1 )
+		if( internal_handle->seek_offset(
+		     internal_handle->io_handle,
+		     internal_handle->current_offset,
+		     SEEK_SET,
+		     error ) == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_OPEN_FAILED,
-			 "%s: unable to determine if handle is open.",
-			 function );
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek current offset: %" PRIi64 " in handle.",
+			 function,
+			 internal_handle->current_offset );
 
 			return( -1 );
 		}
-		else if( is_open == 0 )
-		{
-			if( internal_handle->open(
-			     internal_handle->io_handle,
-			     internal_handle->access_flags,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_OPEN_FAILED,
-				 "%s: unable to open handle on demand.",
-				 function );
+	}
+	return( 1 );
+}
 
-				return( -1 );
-			}
-			if( internal_handle->seek_offset(
-			     internal_handle->io_handle,
-			     internal_handle->current_offset,
-			     SEEK_SET,
-			     error ) == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_SEEK_FAILED,
-				 "%s: unable to seek current offset: %" PRIi64 " in handle.",
-				 function,
-				 internal_handle->current_offset );
+/* Updates the handle after data was written to the IO handle
+ * Extends the size if the data was written beyond it and discards
+ * the readahead buffer and the submitted prefetch if they overlap
+ * with the data written
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_handle_update_written_range(
+     libbfio_internal_handle_t *internal_handle,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libbfio_internal_handle_update_written_range";
+	uint8_t discard_readahead = 0;
+	int result                = 0;
 
-				return( -1 );
-			}
-		}
-	}
-	read_count = internal_handle->read(
-	              internal_handle->io_handle,
-	              buffer,
-	              size,
-	              error );
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
 
-	if( read_count < 0 )
+		return( -1 );
+	}
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read from handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->track_offsets_read != 0 )
+	if( size == 0 )
 	{
-		result = libcdata_range_list_insert_range(
-		          internal_handle->offsets_read,
-		          (uint64_t) internal_handle->current_offset,
-		          (uint64_t) read_count,
-		          NULL,
-		          NULL,
-		          NULL,
+		return( 1 );
+	}
+	if( ( (size64_t) offset + size ) > internal_handle->size )
+	{
+		internal_handle->size = (size64_t) offset + size;
+	}
+	/* Data in the readahead buffer that overlaps with the data written is no longer valid
+	 */
+	if( ( internal_handle->readahead_data_size > 0 )
+	 && ( offset < ( internal_handle->readahead_data_offset + (off64_t) internal_handle->readahead_data_size ) )
+	 && ( ( offset + (off64_t) size ) > internal_handle->readahead_data_offset ) )
+	{
+		discard_readahead = 1;
+	}
+	/* The same applies to the data of the submitted prefetch, which is
+	 * checked under the completion mutex of the prefetcher
+	 */
+	else if( internal_handle->prefetcher != NULL )
+	{
+		result = libbfio_prefetcher_overlaps(
+		          internal_handle->prefetcher,
+		          offset,
+		          size,
 		          error );
 
 		if( result == -1 )
@@ -1152,57 +1286,3850 @@ ssize_t libbfio_internal_handle_read_buffer(
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to insert offset range to offsets read table.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if prefetched data overlaps.",
 			 function );
 
 			return( -1 );
 		}
+		else if( result != 0 )
+		{
+			discard_readahead = 1;
+		}
 	}
-	internal_handle->current_offset += (off64_t) read_count;
-
-	if( internal_handle->open_on_demand != 0 )
+	if( discard_readahead != 0 )
 	{
-		if( internal_handle->close == NULL )
+		if( libbfio_internal_handle_discard_readahead(
+		     internal_handle,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid handle - missing close function.",
-			 function );
-
-			return( -1 );
-		}
-		if( internal_handle->close(
-		     internal_handle->io_handle,
-		     error ) != 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_OPEN_FAILED,
-			 "%s: unable to close handle on demand.",
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to discard readahead data.",
 			 function );
 
 			return( -1 );
 		}
 	}
-	return( read_count );
+	return( 1 );
+}
+
+/* Reads data at the current offset into the buffer using the readahead buffer
+ * When the handle is read sequentially more data than requested is read
+ * into the readahead buffer, the readahead size is doubled on every
+ * sequential read up to the maximum readahead size
+ * If prefetch is enabled the data following the readahead buffer is read
+ * by the prefetcher while the data in the readahead buffer is consumed
+ * The IO handle is positioned at the end of the data in the readahead buffer
+ * This function does not change the current offset
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libbfio_internal_handle_read_buffer_with_readahead(
+         libbfio_internal_handle_t *internal_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	uint8_t *readahead_buffer = NULL;
+	static char *function     = "libbfio_internal_handle_read_buffer_with_readahead";
+	size_t buffer_offset      = 0;
+	size_t read_size          = 0;
+	ssize_t read_count        = 0;
+	ssize_t total_read_count  = 0;
+	off64_t fill_offset       = 0;
+	uint8_t is_sequential     = 0;
+	int result                = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->read == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing read function.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->current_offset == internal_handle->readahead_next_offset )
+	{
+		is_sequential = 1;
+	}
+	else
+	{
+		internal_handle->readahead_size = 0;
+	}
+	/* The current offset is within the readahead buffer if it contains data
+	 */
+	if( internal_handle->readahead_data_size > 0 )
+	{
+		buffer_offset = (size_t) ( internal_handle->current_offset - internal_handle->readahead_data_offset );
+		read_size     = internal_handle->readahead_data_size - buffer_offset;
+
+		if( read_size > size )
+		{
+			read_size = size;
+		}
+		if( memory_copy(
+		     buffer,
+		     &( internal_handle->readahead_buffer[ buffer_offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy readahead data.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( buffer_offset + read_size ) == internal_handle->readahead_data_size )
+		{
+			internal_handle->readahead_data_offset = 0;
+			internal_handle->readahead_data_size   = 0;
+		}
+		total_read_count = (ssize_t) read_size;
+	}
+	read_size = size - (size_t) total_read_count;
+
+	if( read_size > 0 )
+	{
+		if( is_sequential != 0 )
+		{
+			if( internal_handle->readahead_size == 0 )
+			{
+				internal_handle->readahead_size = LIBBFIO_HANDLE_INITIAL_READAHEAD_SIZE;
+			}
+			else if( internal_handle->readahead_size < internal_handle->maximum_readahead_size )
+			{
+				internal_handle->readahead_size *= 2;
+			}
+			if( internal_handle->readahead_size > internal_handle->maximum_readahead_size )
+			{
+				internal_handle->readahead_size = internal_handle->maximum_readahead_size;
+			}
+		}
+		/* Reads that are not sequential or are larger than the readahead size
+		 * are read directly into the buffer
+		 */
+		if( ( is_sequential == 0 )
+		 || ( read_size >= internal_handle->readahead_size ) )
+		{
+			read_count = internal_handle->read(
+			              internal_handle->io_handle,
+			              &( buffer[ total_read_count ] ),
+			              read_size,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read from handle.",
+				 function );
+
+				return( -1 );
+			}
+			total_read_count += read_count;
+		}
+		else
+		{
+			fill_offset = internal_handle->current_offset + (off64_t) total_read_count;
+
+			/* The data at the fill offset was prefetched if the previous
+			 * readahead buffer was filled by the same sequential read
+			 */
+			if( internal_handle->prefetcher != NULL )
+			{
+				result = libbfio_prefetcher_exchange_buffer(
+				          internal_handle->prefetcher,
+				          fill_offset,
+				          &( internal_handle->readahead_buffer ),
+				          &( internal_handle->readahead_buffer_size ),
+				          &read_count,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve prefetched data.",
+					 function );
+
+					return( -1 );
+				}
+				/* The readahead size can have grown since the prefetch was submitted,
+				 * prefetched data that does not contain the data requested is read again
+				 */
+				if( ( result != 0 )
+				 && ( (size_t) read_count < read_size ) )
+				{
+					result = 0;
+				}
+				if( result != 0 )
+				{
+					/* The prefetched data was read without changing the offset of the IO handle
+					 */
+					if( internal_handle->seek_offset(
+					     internal_handle->io_handle,
+					     fill_offset + (off64_t) read_count,
+					     SEEK_SET,
+					     error ) == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_SEEK_FAILED,
+						 "%s: unable to seek offset: %" PRIi64 " in handle.",
+						 function,
+						 fill_offset + (off64_t) read_count );
+
+						return( -1 );
+					}
+				}
+			}
+			if( result == 0 )
+			{
+				if( internal_handle->readahead_buffer_size < internal_handle->readahead_size )
+				{
+					readahead_buffer = (uint8_t *) memory_reallocate(
+					                                internal_handle->readahead_buffer,
+					                                sizeof( uint8_t ) * internal_handle->readahead_size );
+
+					if( readahead_buffer == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_MEMORY,
+						 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+						 "%s: unable to resize readahead buffer.",
+						 function );
+
+						return( -1 );
+					}
+					internal_handle->readahead_buffer      = readahead_buffer;
+					internal_handle->readahead_buffer_size = internal_handle->readahead_size;
+				}
+				read_count = internal_handle->read(
+				              internal_handle->io_handle,
+				              internal_handle->readahead_buffer,
+				              internal_handle->readahead_size,
+				              error );
+
+				if( read_count < 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read readahead data from handle.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			if( read_size > (size_t) read_count )
+			{
+				read_size = (size_t) read_count;
+			}
+			if( memory_copy(
+			     &( buffer[ total_read_count ] ),
+			     internal_handle->readahead_buffer,
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy readahead data.",
+				 function );
+
+				return( -1 );
+			}
+			if( read_size < (size_t) read_count )
+			{
+				internal_handle->readahead_data_offset = fill_offset;
+				internal_handle->readahead_data_size   = (size_t) read_count;
+			}
+			total_read_count += (ssize_t) read_size;
+
+			/* Prefetch the data following the readahead buffer while the readahead buffer is read
+			 */
+			if( ( internal_handle->prefetcher != NULL )
+			 && ( internal_handle->open_on_demand == 0 )
+			 && ( read_count > 0 ) )
+			{
+				if( libbfio_prefetcher_submit(
+				     internal_handle->prefetcher,
+				     fill_offset + (off64_t) read_count,
+				     internal_handle->readahead_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to submit prefetch.",
+					 function );
+
+					return( -1 );
+				}
+			}
+		}
+	}
+	internal_handle->readahead_next_offset = internal_handle->current_offset + (off64_t) total_read_count;
+
+	return( total_read_count );
+}
+
+/* Opens the IO handle of a handle that is opened on demand
+ * The IO handle is positioned at the end of the data in the readahead buffer
+ * or at the current offset
+ * If the handle uses a descriptor cache the descriptor can still be open from a previous read
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_handle_open_on_demand(
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_internal_handle_open_on_demand";
+	off64_t offset        = 0;
+	int is_open           = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->is_open == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing is open function.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->open == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing open function.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->seek_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing seek offset function.",
+		 function );
+
+		return( -1 );
+	}
+	/* The descriptor cache does not close the descriptor of an acquired handle
+	 */
+	if( internal_handle->descriptor_cache != NULL )
+	{
+		if( libbfio_descriptor_cache_acquire_handle(
+		     internal_handle->descriptor_cache,
+		     internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to acquire handle from descriptor cache.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	is_open = internal_handle->is_open(
+		   internal_handle->io_handle,
+	           error );
+
+	if( is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( is_open != 0 )
+	{
+		/* The descriptor can have been opened before the handle was attached
+		 * to the descriptor cache
+		 */
+		if( ( internal_handle->descriptor_cache != NULL )
+		 && ( internal_handle->descriptor_cache_is_open == 0 ) )
+		{
+			if( libbfio_descriptor_cache_append_open_handle(
+			     internal_handle->descriptor_cache,
+			     internal_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append handle to descriptor cache.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		return( 1 );
+	}
+	if( internal_handle->descriptor_cache != NULL )
+	{
+		if( libbfio_descriptor_cache_append_open_handle(
+		     internal_handle->descriptor_cache,
+		     internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append handle to descriptor cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( internal_handle->open(
+	     internal_handle->io_handle,
+	     internal_handle->access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open handle on demand.",
+		 function );
+
+		if( internal_handle->descriptor_cache != NULL )
+		{
+			libbfio_descriptor_cache_remove_open_handle(
+			 internal_handle->descriptor_cache,
+			 internal_handle,
+			 NULL );
+		}
+		goto on_error;
+	}
+	/* The IO handle is positioned at the end of the data in the readahead buffer
+	 */
+	if( internal_handle->readahead_data_size > 0 )
+	{
+		offset = internal_handle->readahead_data_offset + (off64_t) internal_handle->readahead_data_size;
+	}
+	else
+	{
+		offset = internal_handle->current_offset;
+	}
+	if( internal_handle->seek_offset(
+	     internal_handle->io_handle,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 " in handle.",
+		 function,
+		 offset );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_handle->descriptor_cache != NULL )
+	{
+		libbfio_descriptor_cache_release_handle(
+		 internal_handle->descriptor_cache,
+		 internal_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes the IO handle of a handle that is opened on demand
+ * If the handle uses a descriptor cache the descriptor is left open
+ * until the descriptor cache closes it
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_handle_close_on_demand(
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_internal_handle_close_on_demand";
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->descriptor_cache != NULL )
+	{
+		if( libbfio_descriptor_cache_release_handle(
+		     internal_handle->descriptor_cache,
+		     internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release handle to descriptor cache.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( internal_handle->close == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing close function.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->close(
+	     internal_handle->io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads data at the current offset into the buffer
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libbfio_internal_handle_read_buffer(
+         libbfio_internal_handle_t *internal_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function = "libbfio_internal_handle_read_buffer";
+	ssize_t read_count    = 0;
+	int result            = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->read == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing read function.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->open_on_demand != 0 )
+	{
+		if( libbfio_internal_handle_open_on_demand(
+		     internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open handle on demand.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_handle->maximum_readahead_size == 0 )
+	{
+		read_count = internal_handle->read(
+		              internal_handle->io_handle,
+		              buffer,
+		              size,
+		              error );
+	}
+	else
+	{
+		read_count = libbfio_internal_handle_read_buffer_with_readahead(
+		              internal_handle,
+		              buffer,
+		              size,
+		              error );
+	}
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_handle->track_offsets_read != 0 )
+	{
+		result = libcdata_range_list_insert_range(
+		          internal_handle->offsets_read,
+		          (uint64_t) internal_handle->current_offset,
+		          (uint64_t) read_count,
+		          NULL,
+		          NULL,
+		          NULL,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert offset range to offsets read table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_handle->current_offset += (off64_t) read_count;
+
+	if( internal_handle->open_on_demand != 0 )
+	{
+		if( libbfio_internal_handle_close_on_demand(
+		     internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close handle on demand.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( read_count );
+
+on_error:
+	if( internal_handle->open_on_demand != 0 )
+	{
+		libbfio_internal_handle_close_on_demand(
+		 internal_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads data at the current offset into the buffer
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libbfio_handle_read_buffer(
+         libbfio_handle_t *handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_read_buffer";
+	ssize_t read_count                         = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	read_count = libbfio_internal_handle_read_buffer(
+	              internal_handle,
+	              buffer,
+	              size,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer.",
+		 function );
+
+		read_count = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
+/* Reads data at a specific offset into the buffer using the read at offset function
+ * This function does not change the current offset
+ * This function is not multi-thread safe acquire read lock before call
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libbfio_internal_handle_read_buffer_at_offset(
+         libbfio_internal_handle_t *internal_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libbfio_internal_handle_read_buffer_at_offset";
+	ssize_t read_count    = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->read_at_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing read at offset function.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = internal_handle->read_at_offset(
+	              internal_handle->io_handle,
+	              buffer,
+	              size,
+	              offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from handle at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Reads data at a specific offset into the buffer
+ * If the handle has a read at offset function and neither open on demand
+ * nor tracking offsets read is enabled, the data is read without changing
+ * the current offset while holding the read lock, so that concurrent reads
+ * of the same handle are not serialized
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libbfio_handle_read_buffer_at_offset(
+         libbfio_handle_t *handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_read_buffer_at_offset";
+	ssize_t read_count                         = 0;
+	uint8_t read_at_offset                     = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( internal_handle->read_at_offset != NULL )
+	 && ( internal_handle->open_on_demand == 0 )
+	 && ( internal_handle->track_offsets_read == 0 ) )
+	{
+		read_at_offset = 1;
+
+		read_count = libbfio_internal_handle_read_buffer_at_offset(
+		              internal_handle,
+		              buffer,
+		              size,
+		              offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer.",
+			 function );
+
+			read_count = -1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( read_at_offset != 0 )
+	{
+		return( read_count );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libbfio_internal_handle_seek_offset(
+	     internal_handle,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ") in handle.",
+		 function,
+		 offset,
+		 offset );
+
+		read_count = -1;
+	}
+	else
+	{
+		read_count = libbfio_internal_handle_read_buffer(
+		              internal_handle,
+		              buffer,
+		              size,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer.",
+			 function );
+
+			read_count = -1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
+/* Reads data at multiple offsets into the buffers
+ * The buffers are read in order of offset and buffers that are adjacent
+ * in the data are read together, using the read vector at offset function if set
+ * If read at offset is set the read at offset function is used, otherwise
+ * the data is read at the current offset and the current offset is changed
+ * Reading stops at the first buffer that cannot be filled completely,
+ * such as when the end of the data is reached
+ * This function is not multi-thread safe acquire read lock before call if
+ * read at offset is set, otherwise acquire write lock
+ * Returns the number of bytes read into the buffers, in the order provided,
+ * up to and including the first buffer that was not filled completely
+ * if successful, or -1 on error
+ */
+ssize_t libbfio_internal_handle_read_vector(
+         libbfio_internal_handle_t *internal_handle,
+         uint8_t **buffers,
+         size_t *buffer_sizes,
+         off64_t *offsets,
+         int number_of_buffers,
+         uint8_t read_at_offset,
+         libcerror_error_t **error )
+{
+	uint8_t **sorted_buffers    = NULL;
+	uint8_t *buffer             = NULL;
+	size_t *read_counts         = NULL;
+	size_t *sorted_buffer_sizes = NULL;
+	off64_t *sorted_offsets     = NULL;
+	int *sorted_indexes         = NULL;
+	static char *function       = "libbfio_internal_handle_read_vector";
+	size64_t run_size           = 0;
+	size_t buffer_read_count    = 0;
+	size_t buffer_size          = 0;
+	ssize_t read_count          = 0;
+	ssize_t run_read_count      = 0;
+	ssize_t total_read_count    = 0;
+	off64_t buffer_offset       = 0;
+	off64_t run_offset          = 0;
+	int buffer_index            = 0;
+	int number_of_run_buffers   = 0;
+	int run_buffer_index        = 0;
+	int sort_index              = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_at_offset != 0 )
+	{
+		if( internal_handle->read_at_offset == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid handle - missing read at offset function.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_buffers < 0 )
+	 || ( (size_t) number_of_buffers > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( off64_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of buffers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_buffers == 0 )
+	{
+		return( 0 );
+	}
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		if( buffers[ buffer_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid buffer: %d.",
+			 function,
+			 buffer_index );
+
+			return( -1 );
+		}
+		if( buffer_sizes[ buffer_index ] > (size_t) ( SSIZE_MAX - total_read_count ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid buffer: %d size value exceeds maximum.",
+			 function,
+			 buffer_index );
+
+			return( -1 );
+		}
+		if( ( offsets[ buffer_index ] < 0 )
+		 || ( (size64_t) offsets[ buffer_index ] > (size64_t) ( INT64_MAX - buffer_sizes[ buffer_index ] ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid buffer: %d offset value out of bounds.",
+			 function,
+			 buffer_index );
+
+			return( -1 );
+		}
+		total_read_count += (ssize_t) buffer_sizes[ buffer_index ];
+	}
+	total_read_count = 0;
+
+	sorted_buffers = (uint8_t **) memory_allocate(
+	                               sizeof( uint8_t * ) * number_of_buffers );
+
+	if( sorted_buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sorted buffers.",
+		 function );
+
+		goto on_error;
+	}
+	sorted_buffer_sizes = (size_t *) memory_allocate(
+	                                  sizeof( size_t ) * number_of_buffers );
+
+	if( sorted_buffer_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sorted buffer sizes.",
+		 function );
+
+		goto on_error;
+	}
+	sorted_offsets = (off64_t *) memory_allocate(
+	                              sizeof( off64_t ) * number_of_buffers );
+
+	if( sorted_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sorted offsets.",
+		 function );
+
+		goto on_error;
+	}
+	sorted_indexes = (int *) memory_allocate(
+	                          sizeof( int ) * number_of_buffers );
+
+	if( sorted_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sorted indexes.",
+		 function );
+
+		goto on_error;
+	}
+	read_counts = (size_t *) memory_allocate(
+	                          sizeof( size_t ) * number_of_buffers );
+
+	if( read_counts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read counts.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     read_counts,
+	     0,
+	     sizeof( size_t ) * number_of_buffers ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read counts.",
+		 function );
+
+		goto on_error;
+	}
+	/* Sort the buffers by offset, an insertion sort is used since
+	 * the buffers are typically provided (almost) in order of offset
+	 */
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		buffer        = buffers[ buffer_index ];
+		buffer_size   = buffer_sizes[ buffer_index ];
+		buffer_offset = offsets[ buffer_index ];
+
+		for( sort_index = buffer_index;
+		     sort_index > 0;
+		     sort_index-- )
+		{
+			if( sorted_offsets[ sort_index - 1 ] <= buffer_offset )
+			{
+				break;
+			}
+			sorted_buffers[ sort_index ]      = sorted_buffers[ sort_index - 1 ];
+			sorted_buffer_sizes[ sort_index ] = sorted_buffer_sizes[ sort_index - 1 ];
+			sorted_offsets[ sort_index ]      = sorted_offsets[ sort_index - 1 ];
+			sorted_indexes[ sort_index ]      = sorted_indexes[ sort_index - 1 ];
+		}
+		sorted_buffers[ sort_index ]      = buffer;
+		sorted_buffer_sizes[ sort_index ] = buffer_size;
+		sorted_offsets[ sort_index ]      = buffer_offset;
+		sorted_indexes[ sort_index ]      = buffer_index;
+	}
+	buffer_index = 0;
+
+	while( buffer_index < number_of_buffers )
+	{
+		/* Coalesce the buffers that are adjacent in the data into a single run
+		 */
+		run_offset            = sorted_offsets[ buffer_index ];
+		run_size              = (size64_t) sorted_buffer_sizes[ buffer_index ];
+		number_of_run_buffers = 1;
+
+		while( ( ( buffer_index + number_of_run_buffers ) < number_of_buffers )
+		    && ( sorted_offsets[ buffer_index + number_of_run_buffers ] == ( run_offset + (off64_t) run_size ) ) )
+		{
+			run_size += (size64_t) sorted_buffer_sizes[ buffer_index + number_of_run_buffers ];
+
+			number_of_run_buffers++;
+		}
+		if( ( read_at_offset != 0 )
+		 && ( internal_handle->read_vector_at_offset != NULL ) )
+		{
+			run_read_count = internal_handle->read_vector_at_offset(
+			                  internal_handle->io_handle,
+			                  &( sorted_buffers[ buffer_index ] ),
+			                  &( sorted_buffer_sizes[ buffer_index ] ),
+			                  number_of_run_buffers,
+			                  run_offset,
+			                  error );
+
+			if( run_read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read vector from handle at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 run_offset,
+				 run_offset );
+
+				goto on_error;
+			}
+			/* The data read by the read vector at offset function fills
+			 * the buffers of the run in order of offset
+			 */
+			buffer_read_count = (size_t) run_read_count;
+
+			for( run_buffer_index = buffer_index;
+			     run_buffer_index < ( buffer_index + number_of_run_buffers );
+			     run_buffer_index++ )
+			{
+				if( buffer_read_count > sorted_buffer_sizes[ run_buffer_index ] )
+				{
+					read_counts[ sorted_indexes[ run_buffer_index ] ] = sorted_buffer_sizes[ run_buffer_index ];
+				}
+				else
+				{
+					read_counts[ sorted_indexes[ run_buffer_index ] ] = buffer_read_count;
+				}
+				buffer_read_count -= read_counts[ sorted_indexes[ run_buffer_index ] ];
+			}
+		}
+		else
+		{
+			if( read_at_offset == 0 )
+			{
+				if( libbfio_internal_handle_seek_offset(
+				     internal_handle,
+				     run_offset,
+				     SEEK_SET,
+				     error ) == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_SEEK_FAILED,
+					 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ") in handle.",
+					 function,
+					 run_offset,
+					 run_offset );
+
+					goto on_error;
+				}
+			}
+			run_read_count = 0;
+
+			for( run_buffer_index = buffer_index;
+			     run_buffer_index < ( buffer_index + number_of_run_buffers );
+			     run_buffer_index++ )
+			{
+				if( read_at_offset != 0 )
+				{
+					read_count = libbfio_internal_handle_read_buffer_at_offset(
+					              internal_handle,
+					              sorted_buffers[ run_buffer_index ],
+					              sorted_buffer_sizes[ run_buffer_index ],
+					              sorted_offsets[ run_buffer_index ],
+					              error );
+				}
+				else
+				{
+					read_count = libbfio_internal_handle_read_buffer(
+					              internal_handle,
+					              sorted_buffers[ run_buffer_index ],
+					              sorted_buffer_sizes[ run_buffer_index ],
+					              error );
+				}
+				if( read_count < 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 sorted_offsets[ run_buffer_index ],
+					 sorted_offsets[ run_buffer_index ] );
+
+					goto on_error;
+				}
+				read_counts[ sorted_indexes[ run_buffer_index ] ] = (size_t) read_count;
+
+				run_read_count += read_count;
+
+				if( (size_t) read_count < sorted_buffer_sizes[ run_buffer_index ] )
+				{
+					break;
+				}
+			}
+		}
+		/* Stop at the first short read, the data of the buffers with
+		 * a larger offset is not available either
+		 */
+		if( (size64_t) run_read_count < run_size )
+		{
+			break;
+		}
+		buffer_index += number_of_run_buffers;
+	}
+	/* Count the data read in the order the buffers were provided
+	 */
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		total_read_count += (ssize_t) read_counts[ buffer_index ];
+
+		if( read_counts[ buffer_index ] < buffer_sizes[ buffer_index ] )
+		{
+			break;
+		}
+	}
+	memory_free(
+	 read_counts );
+
+	memory_free(
+	 sorted_indexes );
+
+	memory_free(
+	 sorted_offsets );
+
+	memory_free(
+	 sorted_buffer_sizes );
+
+	memory_free(
+	 sorted_buffers );
+
+	return( total_read_count );
+
+on_error:
+	if( read_counts != NULL )
+	{
+		memory_free(
+		 read_counts );
+	}
+	if( sorted_indexes != NULL )
+	{
+		memory_free(
+		 sorted_indexes );
+	}
+	if( sorted_offsets != NULL )
+	{
+		memory_free(
+		 sorted_offsets );
+	}
+	if( sorted_buffer_sizes != NULL )
+	{
+		memory_free(
+		 sorted_buffer_sizes );
+	}
+	if( sorted_buffers != NULL )
+	{
+		memory_free(
+		 sorted_buffers );
+	}
+	return( -1 );
+}
+
+/* Reads data at multiple offsets into the buffers
+ * Buffer sizes and offsets contain the size and offset of each buffer
+ * Buffers that are adjacent in the data are read together and all buffers
+ * are read while holding the lock only once
+ * If the handle has a read at offset function and neither open on demand
+ * nor tracking offsets read is enabled, the data is read without changing
+ * the current offset while holding the read lock
+ * Reading stops at the first buffer that cannot be filled completely
+ * Returns the number of bytes read into the buffers, in the order provided,
+ * up to and including the first buffer that was not filled completely
+ * if successful, or -1 on error
+ */
+ssize_t libbfio_handle_read_vector(
+         libbfio_handle_t *handle,
+         uint8_t **buffers,
+         size_t *buffer_sizes,
+         off64_t *offsets,
+         int number_of_buffers,
+         libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_read_vector";
+	ssize_t read_count                         = 0;
+	uint8_t read_at_offset                     = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( internal_handle->read_at_offset != NULL )
+	 && ( internal_handle->open_on_demand == 0 )
+	 && ( internal_handle->track_offsets_read == 0 ) )
+	{
+		read_at_offset = 1;
+
+		read_count = libbfio_internal_handle_read_vector(
+		              internal_handle,
+		              buffers,
+		              buffer_sizes,
+		              offsets,
+		              number_of_buffers,
+		              read_at_offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read vector.",
+			 function );
+
+			read_count = -1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( read_at_offset != 0 )
+	{
+		return( read_count );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	read_count = libbfio_internal_handle_read_vector(
+	              internal_handle,
+	              buffers,
+	              buffer_sizes,
+	              offsets,
+	              number_of_buffers,
+	              read_at_offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read vector.",
+		 function );
+
+		read_count = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
+/* Writes data at the current offset from the buffer
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns the number of bytes written if successful, or -1 on error
+ */
+ssize_t libbfio_internal_handle_write_buffer(
+         libbfio_internal_handle_t *internal_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function = "libbfio_internal_handle_write_buffer";
+	ssize_t write_count   = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->write == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing write function.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_internal_handle_discard_readahead(
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to discard readahead data.",
+		 function );
+
+		return( -1 );
+	}
+	write_count = internal_handle->write(
+	               internal_handle->io_handle,
+	               buffer,
+	               size,
+	               error );
+
+	if( write_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write to handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle->current_offset += (off64_t) write_count;
+
+	if( (size64_t) internal_handle->current_offset > internal_handle->size )
+	{
+		internal_handle->size = (size64_t) internal_handle->current_offset;
+	}
+	return( write_count );
+}
+
+/* Writes data at the current offset from the buffer
+ * Returns the number of bytes written if successful, or -1 on error
+ */
+ssize_t libbfio_handle_write_buffer(
+         libbfio_handle_t *handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_write_buffer";
+	ssize_t write_count                        = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	write_count = libbfio_internal_handle_write_buffer(
+	               internal_handle,
+	               buffer,
+	               size,
+	               error );
+
+	if( write_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write to handle.",
+		 function );
+
+		write_count = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( write_count );
+}
+
+/* Writes data at a specific offset from the buffer using the write at offset function
+ * This function does not change the current offset
+ * This function is not multi-thread safe acquire read lock before call
+ * Returns the number of bytes written if successful, or -1 on error
+ */
+ssize_t libbfio_internal_handle_write_buffer_at_offset(
+         libbfio_internal_handle_t *internal_handle,
+         const uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libbfio_internal_handle_write_buffer_at_offset";
+	ssize_t write_count   = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->write_at_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing write at offset function.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	write_count = internal_handle->write_at_offset(
+	               internal_handle->io_handle,
+	               buffer,
+	               size,
+	               offset,
+	               error );
+
+	if( write_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write to handle at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	return( write_count );
+}
+
+/* Writes data at a specific offset from the buffer
+ * If the handle has a write at offset function and open on demand is not
+ * enabled, the data is written without changing the current offset while
+ * holding the read lock, the write lock is only grabbed when the size
+ * of the handle needs to be updated
+ * Returns the number of bytes written if successful, or -1 on error
+ */
+ssize_t libbfio_handle_write_buffer_at_offset(
+         libbfio_handle_t *handle,
+         const uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_write_buffer_at_offset";
+	ssize_t write_count                        = 0;
+	uint8_t write_at_offset                    = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( internal_handle->write_at_offset != NULL )
+	 && ( internal_handle->open_on_demand == 0 ) )
+	{
+		write_at_offset = 1;
+
+		write_count = libbfio_internal_handle_write_buffer_at_offset(
+		               internal_handle,
+		               buffer,
+		               size,
+		               offset,
+		               error );
+
+		if( write_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write to handle.",
+			 function );
+
+			write_count = -1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( write_at_offset != 0 )
+	{
+		if( write_count <= 0 )
+		{
+			return( write_count );
+		}
+		/* The size, the readahead buffer and the prefetcher are shared with
+		 * the readers, hence they are checked and updated under the write lock
+		 */
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     internal_handle->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		if( libbfio_internal_handle_update_written_range(
+		     internal_handle,
+		     offset,
+		     (size64_t) write_count,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update handle after write.",
+			 function );
+
+			write_count = -1;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+		if( libcthreads_read_write_lock_release_for_write(
+		     internal_handle->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		return( write_count );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libbfio_internal_handle_seek_offset(
+	     internal_handle,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ") in handle.",
+		 function,
+		 offset,
+		 offset );
+
+		write_count = -1;
+	}
+	else
+	{
+		write_count = libbfio_internal_handle_write_buffer(
+		               internal_handle,
+		               buffer,
+		               size,
+		               error );
+
+		if( write_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write to handle.",
+			 function );
+
+			write_count = -1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( write_count );
+}
+
+/* Seeks a certain offset within the handle
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t libbfio_internal_handle_seek_offset(
+         libbfio_internal_handle_t *internal_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libbfio_internal_handle_seek_offset";
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->seek_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing seek offset function.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	/* The IO handle is positioned at the end of the data in the readahead buffer
+	 * seeking within the data in the readahead buffer does not change the IO handle offset
+	 */
+	if( internal_handle->readahead_data_size > 0 )
+	{
+		if( whence == SEEK_CUR )
+		{
+			offset += internal_handle->current_offset;
+			whence  = SEEK_SET;
+		}
+		if( ( whence == SEEK_SET )
+		 && ( offset >= internal_handle->readahead_data_offset )
+		 && ( offset < ( internal_handle->readahead_data_offset + (off64_t) internal_handle->readahead_data_size ) ) )
+		{
+			internal_handle->current_offset = offset;
+
+			return( offset );
+		}
+		internal_handle->readahead_data_offset = 0;
+		internal_handle->readahead_data_size   = 0;
+	}
+	if( internal_handle->open_on_demand != 0 )
+	{
+		if( libbfio_internal_handle_open_on_demand(
+		     internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open handle on demand.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	offset = internal_handle->seek_offset(
+	          internal_handle->io_handle,
+	          offset,
+	          whence,
+	          error );
+
+	if( internal_handle->open_on_demand != 0 )
+	{
+		if( libbfio_internal_handle_close_on_demand(
+		     internal_handle,
+		     ( offset == -1 ) ? NULL : error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close handle on demand.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( offset == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset in handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle->current_offset = offset;
+
+	return( offset );
+}
+
+/* Seeks a certain offset within the handle
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t libbfio_handle_seek_offset(
+         libbfio_handle_t *handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_seek_offset";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	offset = libbfio_internal_handle_seek_offset(
+	          internal_handle,
+	          offset,
+	          whence,
+	          error );
+
+	if( offset == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset in handle.",
+		 function );
+
+		offset = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( offset );
+}
+
+/* Function to determine if a file object exists
+ * Returns 1 if file object exists, 0 if not or -1 on error
+ */
+int libbfio_handle_exists(
+     libbfio_handle_t *handle,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_exists";
+	int result                                 = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->exists == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing exists function.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = internal_handle->exists(
+	          internal_handle->io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if handle exists.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_handle->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Check if the handle is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int libbfio_handle_is_open(
+     libbfio_handle_t *handle,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_is_open";
+	int result                                 = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->is_open == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing is open function.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* The descriptor cache can close the descriptor of an idle handle
+	 */
+	if( ( internal_handle->open_on_demand != 0 )
+	 && ( internal_handle->descriptor_cache != NULL ) )
+	{
+		if( libbfio_descriptor_cache_acquire_handle(
+		     internal_handle->descriptor_cache,
+		     internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to acquire handle from descriptor cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	result = internal_handle->is_open(
+	          internal_handle->io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( internal_handle->open_on_demand != 0 )
+	 && ( internal_handle->descriptor_cache != NULL ) )
+	{
+		if( libbfio_descriptor_cache_release_handle(
+		     internal_handle->descriptor_cache,
+		     internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release handle to descriptor cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+	if( ( internal_handle->open_on_demand != 0 )
+	 && ( internal_handle->descriptor_cache != NULL ) )
+	{
+		libbfio_descriptor_cache_release_handle(
+		 internal_handle->descriptor_cache,
+		 internal_handle,
+		 NULL );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_handle->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_get_io_handle(
+     libbfio_handle_t *handle,
+     intptr_t **io_handle,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_get_io_handle";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*io_handle = internal_handle->io_handle;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the access flags
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_get_access_flags(
+     libbfio_handle_t *handle,
+     int *access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_get_access_flags";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( access_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access flags.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*access_flags = internal_handle->access_flags;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the access flags
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_set_access_flags(
+     libbfio_handle_t *handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_set_access_flags";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( ( ( access_flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_handle->access_flags = access_flags;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the current offset
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_get_offset(
+     libbfio_handle_t *handle,
+     off64_t *offset,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_get_offset";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*offset = internal_handle->current_offset;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Returns the size of the data of the handle
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_get_size(
+     libbfio_handle_t *handle,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_get_size";
+	uint8_t size_set                           = 0;
+	int result                                 = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_handle->size_set != 0 )
+	{
+		*size    = internal_handle->size;
+		size_set = 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( size_set != 0 )
+	{
+		return( 1 );
+	}
+	/* The size has not been determined yet, the size is determined
+	 * once while holding the write lock
+	 */
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_handle->size_set == 0 )
+	{
+		if( internal_handle->get_size == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid handle - missing get size function.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( internal_handle->open_on_demand != 0 )
+		 && ( internal_handle->descriptor_cache != NULL ) )
+		{
+			if( libbfio_descriptor_cache_acquire_handle(
+			     internal_handle->descriptor_cache,
+			     internal_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to acquire handle from descriptor cache.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		result = internal_handle->get_size(
+		          internal_handle->io_handle,
+		          &( internal_handle->size ),
+		          error );
+
+		if( ( internal_handle->open_on_demand != 0 )
+		 && ( internal_handle->descriptor_cache != NULL ) )
+		{
+			if( libbfio_descriptor_cache_release_handle(
+			     internal_handle->descriptor_cache,
+			     internal_handle,
+			     ( result != 1 ) ? NULL : error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release handle to descriptor cache.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size.",
+			 function );
+
+			goto on_error;
+		}
+		internal_handle->size_set = 1;
+	}
+	*size = internal_handle->size;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_handle->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Sets the value to have the library open and close
+ * the systems file descriptor or handle on demand
+ * 0 disables open on demand any other value enables it
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_set_open_on_demand(
+     libbfio_handle_t *handle,
+     uint8_t open_on_demand,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_set_open_on_demand";
+	int result                                 = 1;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( ( ( internal_handle->access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) != 0 )
+	 && ( open_on_demand != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: open on demand cannot be used in combination with write access.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* The prefetcher cannot read from an IO handle that is opened on demand
+	 */
+	if( internal_handle->prefetcher != NULL )
+	{
+		if( libbfio_prefetcher_cancel(
+		     internal_handle->prefetcher,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to cancel prefetch.",
+			 function );
+
+			result = -1;
+		}
+	}
+	/* The descriptor cache no longer accounts for the descriptor
+	 * when the handle is no longer opened on demand
+	 */
+	if( ( result == 1 )
+	 && ( open_on_demand == 0 )
+	 && ( internal_handle->descriptor_cache != NULL ) )
+	{
+		if( libbfio_descriptor_cache_remove_open_handle(
+		     internal_handle->descriptor_cache,
+		     internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove handle from descriptor cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		internal_handle->open_on_demand = open_on_demand;
+	}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the descriptor cache
+ * The descriptor cache keeps the descriptor of a handle that is opened on demand
+ * open between reads, it has no effect on a handle that is not opened on demand
+ * The descriptor cache must remain available until the handle is freed or
+ * another descriptor cache is set, NULL removes the descriptor cache
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_set_descriptor_cache(
+     libbfio_handle_t *handle,
+     libbfio_descriptor_cache_t *descriptor_cache,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_set_descriptor_cache";
+	int result                                 = 1;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_handle->descriptor_cache != descriptor_cache )
+	{
+		/* A descriptor that was left open by the previous descriptor cache
+		 * is closed on the next read
+		 */
+		if( internal_handle->descriptor_cache != NULL )
+		{
+			if( libbfio_descriptor_cache_detach_handle(
+			     internal_handle->descriptor_cache,
+			     internal_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to detach handle from descriptor cache.",
+				 function );
+
+				result = -1;
+			}
+			internal_handle->descriptor_cache = NULL;
+		}
+		if( ( result == 1 )
+		 && ( descriptor_cache != NULL ) )
+		{
+			if( libbfio_descriptor_cache_attach_handle(
+			     descriptor_cache,
+			     internal_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to attach handle to descriptor cache.",
+				 function );
+
+				result = -1;
+			}
+			else
+			{
+				internal_handle->descriptor_cache = descriptor_cache;
+			}
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the value to have the library track the offsets read
+ * 0 disables tracking any other value enables it
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_set_track_offsets_read(
+     libbfio_handle_t *handle,
+     uint8_t track_offsets_read,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_set_track_offsets_read";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_handle->track_offsets_read = track_offsets_read;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the maximum readahead size
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_get_maximum_readahead_size(
+     libbfio_handle_t *handle,
+     size_t *maximum_readahead_size,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_get_maximum_readahead_size";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( maximum_readahead_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum readahead size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*maximum_readahead_size = internal_handle->maximum_readahead_size;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the maximum readahead size
+ * When the handle is read sequentially libbfio_handle_read_buffer reads
+ * ahead in increasingly larger reads up to the maximum readahead size
+ * 0 disables readahead
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_set_maximum_readahead_size(
+     libbfio_handle_t *handle,
+     size_t maximum_readahead_size,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_set_maximum_readahead_size";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( maximum_readahead_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum readahead size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libbfio_internal_handle_discard_readahead(
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to discard readahead data.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_handle->readahead_buffer != NULL )
+	{
+		memory_free(
+		 internal_handle->readahead_buffer );
+
+		internal_handle->readahead_buffer      = NULL;
+		internal_handle->readahead_buffer_size = 0;
+	}
+	internal_handle->maximum_readahead_size = maximum_readahead_size;
+	internal_handle->readahead_size         = 0;
+	internal_handle->readahead_next_offset  = -1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_handle->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Sets the value to have the library prefetch data
+ * When the handle is read sequentially with readahead enabled the data
+ * following the readahead buffer is read in the background while the data
+ * in the readahead buffer is consumed, this requires a read at offset function
+ * Prefetching is not used when the handle is opened on demand
+ * 0 disables prefetching any other value enables it
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_set_prefetch(
+     libbfio_handle_t *handle,
+     uint8_t prefetch,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_set_prefetch";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( prefetch == 0 )
+	{
+		if( internal_handle->prefetcher != NULL )
+		{
+			if( libbfio_prefetcher_free(
+			     &( internal_handle->prefetcher ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free prefetcher.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	else if( internal_handle->prefetcher == NULL )
+	{
+		if( ( internal_handle->read_at_offset == NULL )
+		 || ( internal_handle->seek_offset == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: prefetch requires a read at offset and seek offset function.",
+			 function );
+
+			goto on_error;
+		}
+		if( libbfio_prefetcher_initialize(
+		     &( internal_handle->prefetcher ),
+		     internal_handle->io_handle,
+		     internal_handle->read_at_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create prefetcher.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_handle->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Sets the read at offset function
+ * The read at offset function reads data at a specific offset without
+ * changing the current offset of the IO handle, which allows
+ * libbfio_handle_read_buffer_at_offset to read concurrently
+ * A value of NULL disables reading at offset
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_set_read_at_offset_function(
+     libbfio_handle_t *handle,
+     ssize_t (*read_at_offset)(
+                intptr_t *io_handle,
+                uint8_t *buffer,
+                size_t size,
+                off64_t offset,
+                libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_set_read_at_offset_function";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_handle->read_at_offset = read_at_offset;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
 }
 
-/* Reads data at the current offset into the buffer
- * Returns the number of bytes read if successful, or -1 on error
+/* Sets the write at offset function
+ * The write at offset function writes data at a specific offset without
+ * changing the current offset of the IO handle, which allows
+ * libbfio_handle_write_buffer_at_offset to write concurrently
+ * A value of NULL disables writing at offset
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libbfio_handle_read_buffer(
-         libbfio_handle_t *handle,
-         uint8_t *buffer,
-         size_t size,
-         libcerror_error_t **error )
+int libbfio_handle_set_write_at_offset_function(
+     libbfio_handle_t *handle,
+     ssize_t (*write_at_offset)(
+                intptr_t *io_handle,
+                const uint8_t *buffer,
+                size_t size,
+                off64_t offset,
+                libcerror_error_t **error ),
+     libcerror_error_t **error )
 {
 	libbfio_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libbfio_handle_read_buffer";
-	ssize_t read_count                         = 0;
+	static char *function                      = "libbfio_handle_set_write_at_offset_function";
 
 	if( handle == NULL )
 	{
@@ -1217,17 +5144,76 @@ ssize_t libbfio_handle_read_buffer(
 	}
 	internal_handle = (libbfio_internal_handle_t *) handle;
 
-	if( internal_handle->io_handle == NULL )
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_handle->write_at_offset = write_at_offset;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the read vector at offset function
+ * The read vector at offset function reads a contiguous range at a specific
+ * offset into multiple buffers without changing the current offset of the
+ * IO handle, which allows libbfio_handle_read_vector to read adjacent
+ * buffers with a single call
+ * A value of NULL disables reading vectors at offset
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_set_read_vector_at_offset_function(
+     libbfio_handle_t *handle,
+     ssize_t (*read_vector_at_offset)(
+                intptr_t *io_handle,
+                uint8_t **buffers,
+                size_t *buffer_sizes,
+                int number_of_buffers,
+                off64_t offset,
+                libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_set_read_vector_at_offset_function";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_handle->read_write_lock,
@@ -1243,23 +5229,75 @@ ssize_t libbfio_handle_read_buffer(
 		return( -1 );
 	}
 #endif
-	read_count = libbfio_internal_handle_read_buffer(
-	              internal_handle,
-	              buffer,
-	              size,
-	              error );
+	internal_handle->read_vector_at_offset = read_vector_at_offset;
 
-	if( read_count < 0 )
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read buffer.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		read_count = -1;
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the access hint function
+ * The access hint function passes an access pattern hint for a range
+ * of the data to the IO handle, such as posix_fadvise
+ * A value of NULL disables access hints
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_set_access_hint_function(
+     libbfio_handle_t *handle,
+     int (*access_hint)(
+            intptr_t *io_handle,
+            off64_t offset,
+            size64_t size,
+            int access_hint,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_set_access_hint_function";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
 	}
+#endif
+	internal_handle->access_hint = access_hint;
+
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_handle->read_write_lock,
@@ -1275,22 +5313,26 @@ ssize_t libbfio_handle_read_buffer(
 		return( -1 );
 	}
 #endif
-	return( read_count );
+	return( 1 );
 }
 
-/* Reads data at a specific offset into the buffer
- * Returns the number of bytes read if successful, or -1 on error
+/* Passes an access pattern hint for a range of the data to the IO handle
+ * The hint applies from offset to the end of the data if size is 0
+ * The hint is ignored if the IO handle does not support access hints
+ * or if open on demand is enabled, since the system file descriptor
+ * or handle is only kept open for the duration of an individual read
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libbfio_handle_read_buffer_at_offset(
-         libbfio_handle_t *handle,
-         uint8_t *buffer,
-         size_t size,
-         off64_t offset,
-         libcerror_error_t **error )
+int libbfio_handle_set_access_hint(
+     libbfio_handle_t *handle,
+     off64_t offset,
+     size64_t size,
+     int access_hint,
+     libcerror_error_t **error )
 {
 	libbfio_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libbfio_handle_read_buffer_at_offset";
-	ssize_t read_count                         = 0;
+	static char *function                      = "libbfio_handle_set_access_hint";
+	int result                                 = 1;
 
 	if( handle == NULL )
 	{
@@ -1316,6 +5358,151 @@ ssize_t libbfio_handle_read_buffer_at_offset(
 
 		return( -1 );
 	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_hint != LIBBFIO_ACCESS_HINT_NORMAL )
+	 && ( access_hint != LIBBFIO_ACCESS_HINT_SEQUENTIAL )
+	 && ( access_hint != LIBBFIO_ACCESS_HINT_RANDOM )
+	 && ( access_hint != LIBBFIO_ACCESS_HINT_WILLNEED )
+	 && ( access_hint != LIBBFIO_ACCESS_HINT_DONTNEED )
+	 && ( access_hint != LIBBFIO_ACCESS_HINT_NOREUSE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access hint: %d.",
+		 function,
+		 access_hint );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( internal_handle->access_hint != NULL )
+	 && ( internal_handle->open_on_demand == 0 ) )
+	{
+		result = internal_handle->access_hint(
+		          internal_handle->io_handle,
+		          offset,
+		          size,
+		          access_hint,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set access hint.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the data pointer functions
+ * The get data pointer function retrieves a pointer to data that is
+ * already in memory, such as a memory range or a memory-mapped file,
+ * so that the data does not need to be copied into a buffer
+ * The release data pointer function releases the pointer again
+ * A value of NULL for both functions disables data pointers
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_set_data_pointer_functions(
+     libbfio_handle_t *handle,
+     int (*get_data_pointer)(
+            intptr_t *io_handle,
+            off64_t offset,
+            size_t size,
+            const uint8_t **data,
+            libcerror_error_t **error ),
+     int (*release_data_pointer)(
+            intptr_t *io_handle,
+            off64_t offset,
+            const uint8_t *data,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_set_data_pointer_functions";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( ( get_data_pointer == NULL )
+	 != ( release_data_pointer == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid get and release data pointer functions - both must be set or both must be NULL.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_handle->read_write_lock,
@@ -1331,43 +5518,9 @@ ssize_t libbfio_handle_read_buffer_at_offset(
 		return( -1 );
 	}
 #endif
-	if( libbfio_internal_handle_seek_offset(
-	     internal_handle,
-	     offset,
-	     SEEK_SET,
-	     error ) == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ") in handle.",
-		 function,
-		 offset,
-		 offset );
-
-		read_count = -1;
-	}
-	else
-	{
-		read_count = libbfio_internal_handle_read_buffer(
-		              internal_handle,
-		              buffer,
-		              size,
-		              error );
-
-		if( read_count < 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read buffer.",
-			 function );
+	internal_handle->get_data_pointer     = get_data_pointer;
+	internal_handle->release_data_pointer = release_data_pointer;
 
-			read_count = -1;
-		}
-	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_handle->read_write_lock,
@@ -1383,23 +5536,30 @@ ssize_t libbfio_handle_read_buffer_at_offset(
 		return( -1 );
 	}
 #endif
-	return( read_count );
+	return( 1 );
 }
 
-/* Writes data at the current offset from the buffer
- * This function is not multi-thread safe acquire write lock before call
- * Returns the number of bytes written if successful, or -1 on error
+/* Retrieves a pointer to size bytes of data at a specific offset
+ * without copying the data, the current offset is not changed
+ * The data remains valid until it is released with libbfio_handle_release_data_pointer
+ * which must be done before the handle is closed
+ * Returns 1 if successful, 0 if the data is not available as a pointer or -1 on error
+ * If 0 is returned the data should be read with libbfio_handle_read_buffer_at_offset instead,
+ * for example if the data is not in memory, if it spans multiple blocks of the IO handle,
+ * if it extends beyond the end of the data or if open on demand or tracking offsets read is enabled
  */
-ssize_t libbfio_internal_handle_write_buffer(
-         libbfio_internal_handle_t *internal_handle,
-         const uint8_t *buffer,
-         size_t size,
-         libcerror_error_t **error )
+int libbfio_handle_get_data_pointer(
+     libbfio_handle_t *handle,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error )
 {
-	static char *function = "libbfio_internal_handle_write_buffer";
-	ssize_t write_count   = 0;
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_get_data_pointer";
+	int result                                 = 0;
 
-	if( internal_handle == NULL )
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1410,24 +5570,26 @@ ssize_t libbfio_internal_handle_write_buffer(
 
 		return( -1 );
 	}
-	if( internal_handle->write == NULL )
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing write function.",
+		 "%s: invalid handle - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( buffer == NULL )
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid buffer.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
 		 function );
 
 		return( -1 );
@@ -1443,44 +5605,90 @@ ssize_t libbfio_internal_handle_write_buffer(
 
 		return( -1 );
 	}
-	write_count = internal_handle->write(
-	               internal_handle->io_handle,
-	               buffer,
-	               size,
-	               error );
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
 
-	if( write_count < 0 )
+		return( -1 );
+	}
+	*data = NULL;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write to handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	internal_handle->current_offset += (off64_t) write_count;
+#endif
+	if( ( internal_handle->get_data_pointer != NULL )
+	 && ( internal_handle->open_on_demand == 0 )
+	 && ( internal_handle->track_offsets_read == 0 ) )
+	{
+		result = internal_handle->get_data_pointer(
+		          internal_handle->io_handle,
+		          offset,
+		          size,
+		          data,
+		          error );
 
-	if( (size64_t) internal_handle->current_offset > internal_handle->size )
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data pointer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			*data = NULL;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
-		internal_handle->size = (size64_t) internal_handle->current_offset;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
 	}
-	return( write_count );
+#endif
+	return( result );
 }
 
-/* Writes data at the current offset from the buffer
- * Returns the number of bytes written if successful, or -1 on error
+/* Releases a pointer to data retrieved with libbfio_handle_get_data_pointer
+ * The offset must be the offset the data pointer was retrieved at
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libbfio_handle_write_buffer(
-         libbfio_handle_t *handle,
-         const uint8_t *buffer,
-         size_t size,
-         libcerror_error_t **error )
+int libbfio_handle_release_data_pointer(
+     libbfio_handle_t *handle,
+     off64_t offset,
+     const uint8_t *data,
+     libcerror_error_t **error )
 {
 	libbfio_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libbfio_handle_write_buffer";
-	ssize_t write_count                        = 0;
+	static char *function                      = "libbfio_handle_release_data_pointer";
+	int result                                 = 1;
 
 	if( handle == NULL )
 	{
@@ -1506,8 +5714,30 @@ ssize_t libbfio_handle_write_buffer(
 
 		return( -1 );
 	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1515,31 +5745,42 @@ ssize_t libbfio_handle_write_buffer(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	write_count = libbfio_internal_handle_write_buffer(
-	               internal_handle,
-	               buffer,
-	               size,
-	               error );
-
-	if( write_count < 0 )
+	if( internal_handle->release_data_pointer == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write to handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing release data pointer function.",
 		 function );
 
-		write_count = -1;
+		result = -1;
+	}
+	else if( internal_handle->release_data_pointer(
+	          internal_handle->io_handle,
+	          offset,
+	          data,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release data pointer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		result = -1;
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1547,28 +5788,42 @@ ssize_t libbfio_handle_write_buffer(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	return( write_count );
+	return( result );
 }
 
-/* Writes data at a specific offset from the buffer
- * Returns the number of bytes written if successful, or -1 on error
+/* Sets the descriptor functions
+ * The get descriptor function retrieves the system file descriptor of the IO handle
+ * and the offset of the data of the IO handle in the corresponding file
+ * The copy from descriptor function copies data from a system file descriptor
+ * into the IO handle, for example in the kernel with copy_file_range
+ * A value of NULL disables the corresponding function
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libbfio_handle_write_buffer_at_offset(
-         libbfio_handle_t *handle,
-         const uint8_t *buffer,
-         size_t size,
-         off64_t offset,
-         libcerror_error_t **error )
+int libbfio_handle_set_descriptor_functions(
+     libbfio_handle_t *handle,
+     int (*get_descriptor)(
+            intptr_t *io_handle,
+            int *descriptor,
+            off64_t *descriptor_offset,
+            libcerror_error_t **error ),
+     int (*copy_from_descriptor)(
+            intptr_t *io_handle,
+            off64_t offset,
+            int source_descriptor,
+            off64_t source_offset,
+            size_t size,
+            size_t *copy_size,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
 {
 	libbfio_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libbfio_handle_write_buffer_at_offset";
-	ssize_t write_count                        = 0;
+	static char *function                      = "libbfio_handle_set_descriptor_functions";
 
 	if( handle == NULL )
 	{
@@ -1583,17 +5838,6 @@ ssize_t libbfio_handle_write_buffer_at_offset(
 	}
 	internal_handle = (libbfio_internal_handle_t *) handle;
 
-	if( internal_handle->io_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
-		 function );
-
-		return( -1 );
-	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_handle->read_write_lock,
@@ -1609,43 +5853,9 @@ ssize_t libbfio_handle_write_buffer_at_offset(
 		return( -1 );
 	}
 #endif
-	if( libbfio_internal_handle_seek_offset(
-	     internal_handle,
-	     offset,
-	     SEEK_SET,
-	     error ) == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ") in handle.",
-		 function,
-		 offset,
-		 offset );
-
-		write_count = -1;
-	}
-	else
-	{
-		write_count = libbfio_internal_handle_write_buffer(
-		               internal_handle,
-		               buffer,
-		               size,
-		               error );
-
-		if( write_count < 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to write to handle.",
-			 function );
+	internal_handle->get_descriptor       = get_descriptor;
+	internal_handle->copy_from_descriptor = copy_from_descriptor;
 
-			write_count = -1;
-		}
-	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_handle->read_write_lock,
@@ -1661,20 +5871,23 @@ ssize_t libbfio_handle_write_buffer_at_offset(
 		return( -1 );
 	}
 #endif
-	return( write_count );
-}
-
-/* Seeks a certain offset within the handle
- * This function is not multi-thread safe acquire write lock before call
- * Returns the offset if the seek is successful or -1 on error
- */
-off64_t libbfio_internal_handle_seek_offset(
-         libbfio_internal_handle_t *internal_handle,
-         off64_t offset,
-         int whence,
-         libcerror_error_t **error )
+	return( 1 );
+}
+
+/* Retrieves the system file descriptor using the get descriptor function
+ * The descriptor is not available if open on demand or tracking offsets read
+ * is enabled, since the data read from the descriptor would bypass the handle
+ * This function is not multi-thread safe acquire read lock before call
+ * Returns 1 if successful, 0 if no descriptor is available or -1 on error
+ */
+int libbfio_internal_handle_get_descriptor(
+     libbfio_internal_handle_t *internal_handle,
+     int *descriptor,
+     off64_t *descriptor_offset,
+     libcerror_error_t **error )
 {
-	static char *function = "libbfio_internal_handle_seek_offset";
+	static char *function = "libbfio_internal_handle_get_descriptor";
+	int result            = 0;
 
 	if( internal_handle == NULL )
 	{
@@ -1687,65 +5900,72 @@ off64_t libbfio_internal_handle_seek_offset(
 
 		return( -1 );
 	}
-	if( internal_handle->seek_offset == NULL )
+	if( descriptor == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing seek offset function.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( whence != SEEK_CUR )
-	 && ( whence != SEEK_END )
-	 && ( whence != SEEK_SET ) )
+	if( descriptor_offset == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported whence.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor offset.",
 		 function );
 
 		return( -1 );
 	}
-	offset = internal_handle->seek_offset(
+	if( ( internal_handle->get_descriptor == NULL )
+	 || ( internal_handle->open_on_demand != 0 )
+	 || ( internal_handle->track_offsets_read != 0 ) )
+	{
+		return( 0 );
+	}
+	result = internal_handle->get_descriptor(
 	          internal_handle->io_handle,
-	          offset,
-	          whence,
+	          descriptor,
+	          descriptor_offset,
 	          error );
 
-	if( offset == -1 )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset in handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve descriptor.",
 		 function );
 
 		return( -1 );
 	}
-	internal_handle->current_offset = offset;
-
-	return( offset );
+	return( result );
 }
 
-/* Seeks a certain offset within the handle
- * Returns the offset if the seek is successful or -1 on error
+/* Copies data from a system file descriptor to a specific offset using the copy from descriptor function
+ * This function does not change the current offset
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful, 0 if the data cannot be copied from the descriptor or -1 on error
  */
-off64_t libbfio_handle_seek_offset(
-         libbfio_handle_t *handle,
-         off64_t offset,
-         int whence,
-         libcerror_error_t **error )
+int libbfio_internal_handle_copy_from_descriptor(
+     libbfio_internal_handle_t *internal_handle,
+     off64_t offset,
+     int source_descriptor,
+     off64_t source_offset,
+     size_t size,
+     size_t *copy_size,
+     libcerror_error_t **error )
 {
-	libbfio_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libbfio_handle_seek_offset";
+	static char *function = "libbfio_internal_handle_copy_from_descriptor";
+	int result            = 0;
 
-	if( handle == NULL )
+	if( internal_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1756,684 +5976,821 @@ off64_t libbfio_handle_seek_offset(
 
 		return( -1 );
 	}
-	internal_handle = (libbfio_internal_handle_t *) handle;
-
-	if( internal_handle->io_handle == NULL )
+	if( copy_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid copy size.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
-		 function );
+	*copy_size = 0;
 
-		return( -1 );
+	if( ( internal_handle->copy_from_descriptor == NULL )
+	 || ( internal_handle->open_on_demand != 0 ) )
+	{
+		return( 0 );
 	}
-#endif
-	offset = libbfio_internal_handle_seek_offset(
-	          internal_handle,
+	result = internal_handle->copy_from_descriptor(
+	          internal_handle->io_handle,
 	          offset,
-	          whence,
+	          source_descriptor,
+	          source_offset,
+	          size,
+	          copy_size,
 	          error );
 
-	if( offset == -1 )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset in handle.",
-		 function );
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to copy from descriptor to handle at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
 
-		offset = -1;
+		*copy_size = 0;
+
+		return( -1 );
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	else if( result != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
-		 function );
+		if( libbfio_internal_handle_update_written_range(
+		     internal_handle,
+		     offset,
+		     (size64_t) *copy_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update handle after copy.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
-#endif
-	return( offset );
+	return( result );
 }
 
-/* Function to determine if a file object exists
- * Returns 1 if file object exists, 0 if not or -1 on error
+/* Determines if two system file descriptors refer to the same file
+ * Returns 1 if the same file, 0 if not or -1 on error
  */
-int libbfio_handle_exists(
-     libbfio_handle_t *handle,
+int libbfio_system_descriptors_are_same_file(
+     int first_descriptor,
+     int second_descriptor,
      libcerror_error_t **error )
 {
-	libbfio_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libbfio_handle_exists";
-	int result                                 = 0;
+#if defined( HAVE_FSTAT )
+	struct stat first_file_statistics;
+	struct stat second_file_statistics;
+#endif
 
-	if( handle == NULL )
+	static char *function = "libbfio_system_descriptors_are_same_file";
+
+	if( first_descriptor < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid first descriptor value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-	internal_handle = (libbfio_internal_handle_t *) handle;
-
-	if( internal_handle->io_handle == NULL )
+	if( second_descriptor < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid second descriptor value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->exists == NULL )
+	if( first_descriptor == second_descriptor )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing exists function.",
-		 function );
-
-		return( -1 );
+		return( 1 );
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+#if defined( HAVE_FSTAT )
+	if( fstat(
+	     first_descriptor,
+	     &first_file_statistics ) != 0 )
 	{
-		libcerror_error_set(
+		libcerror_system_set_error(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 errno,
+		 "%s: unable to retrieve file statistics of first descriptor.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	result = internal_handle->exists(
-	          internal_handle->io_handle,
-	          error );
-
-	if( result == -1 )
+	if( fstat(
+	     second_descriptor,
+	     &second_file_statistics ) != 0 )
 	{
-		libcerror_error_set(
+		libcerror_system_set_error(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine if handle exists.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 errno,
+		 "%s: unable to retrieve file statistics of second descriptor.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( ( first_file_statistics.st_dev == second_file_statistics.st_dev )
+	 && ( first_file_statistics.st_ino == second_file_statistics.st_ino ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
-
-		return( -1 );
+		return( 1 );
 	}
 #endif
-	return( result );
+	return( 0 );
+}
 
-on_error:
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	libcthreads_read_write_lock_release_for_read(
-	 internal_handle->read_write_lock,
-	 NULL );
-#endif
-	return( -1 );
-}
 
-/* Check if the handle is open
- * Returns 1 if open, 0 if not or -1 on error
+/* Grabs the source read/write lock for reading and the destination read/write lock for writing
+ * The locks are grabbed in order of the address of the handles
+ * If the source and destination are the same handle its lock is grabbed for writing
+ * Returns 1 if successful or -1 on error
  */
-int libbfio_handle_is_open(
-     libbfio_handle_t *handle,
+int libbfio_internal_handle_grab_copy_locks(
+     libbfio_internal_handle_t *internal_source_handle,
+     libbfio_internal_handle_t *internal_destination_handle,
      libcerror_error_t **error )
 {
-	libbfio_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libbfio_handle_is_open";
-	int result                                 = 0;
+	static char *function = "libbfio_internal_handle_grab_copy_locks";
 
-	if( handle == NULL )
+	if( internal_source_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 "%s: invalid source handle.",
 		 function );
 
 		return( -1 );
 	}
-	internal_handle = (libbfio_internal_handle_t *) handle;
-
-	if( internal_handle->io_handle == NULL )
+	if( internal_destination_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->is_open == NULL )
+	if( ( internal_destination_handle == internal_source_handle )
+	 || ( (intptr_t) internal_destination_handle < (intptr_t) internal_source_handle ) )
+	{
+		if( libcthreads_read_write_lock_grab_for_write(
+		     internal_destination_handle->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab destination read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_destination_handle == internal_source_handle )
+		{
+			return( 1 );
+		}
+		if( libcthreads_read_write_lock_grab_for_read(
+		     internal_source_handle->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab source read/write lock for reading.",
+			 function );
+
+			libcthreads_read_write_lock_release_for_write(
+			 internal_destination_handle->read_write_lock,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( libcthreads_read_write_lock_grab_for_read(
+		     internal_source_handle->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab source read/write lock for reading.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcthreads_read_write_lock_grab_for_write(
+		     internal_destination_handle->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab destination read/write lock for writing.",
+			 function );
+
+			libcthreads_read_write_lock_release_for_read(
+			 internal_source_handle->read_write_lock,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Releases the read/write locks grabbed by libbfio_internal_handle_grab_copy_locks
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_handle_release_copy_locks(
+     libbfio_internal_handle_t *internal_source_handle,
+     libbfio_internal_handle_t *internal_destination_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_internal_handle_release_copy_locks";
+	int result            = 1;
+
+	if( internal_source_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing is open function.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source handle.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( internal_destination_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination handle.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	result = internal_handle->is_open(
-	          internal_handle->io_handle,
-	          error );
-
-	if( result == -1 )
+	if( internal_destination_handle != internal_source_handle )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine if handle is open.",
-		 function );
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_source_handle->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release source read/write lock for reading.",
+			 function );
 
-		goto on_error;
+			result = -1;
+		}
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_handle->read_write_lock,
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_destination_handle->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release destination read/write lock for writing.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
-#endif
 	return( result );
-
-on_error:
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	libcthreads_read_write_lock_release_for_read(
-	 internal_handle->read_write_lock,
-	 NULL );
-#endif
-	return( -1 );
 }
 
-/* Retrieves the IO handle
- * Returns 1 if successful or -1 on error
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO ) */
+
+/* Copies size bytes of data from the source handle to the destination handle
+ * The current offsets of the handles are not changed
+ *
+ * The data is copied, in order of preference:
+ * 1. in the kernel, if the source handle has a system file descriptor and
+ *    the destination handle can copy from it, which on file systems that
+ *    support it shares the data blocks instead of duplicating them
+ * 2. with a single write from a pointer to the source data, if the source
+ *    data is already in memory
+ * 3. by reading the source data into an intermediate buffer and writing it
+ *
+ * The source handle must not be closed while the data is copied
+ * Overlapping source and destination ranges are rejected if both are in
+ * the same handle, or if both handles have a system file descriptor that
+ * refers to the same file. Overlap between handles without a descriptor,
+ * such as handles opened on demand, is not detected
+ * Fewer bytes than requested are copied if the end of the source data
+ * is reached or if the destination handle cannot hold more data
+ * Returns the number of bytes copied if successful, or -1 on error
  */
-int libbfio_handle_get_io_handle(
-     libbfio_handle_t *handle,
-     intptr_t **io_handle,
-     libcerror_error_t **error )
+ssize_t libbfio_handle_copy_range(
+         libbfio_handle_t *source_handle,
+         off64_t source_offset,
+         libbfio_handle_t *destination_handle,
+         off64_t destination_offset,
+         size_t size,
+         libcerror_error_t **error )
 {
-	libbfio_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libbfio_handle_get_io_handle";
+	libbfio_internal_handle_t *internal_destination_handle = NULL;
+	libbfio_internal_handle_t *internal_source_handle      = NULL;
+	const uint8_t *data                                    = NULL;
+	uint8_t *copy_buffer                                   = NULL;
+	static char *function                                  = "libbfio_handle_copy_range";
+	size64_t source_size                                   = 0;
+	size_t copy_buffer_size                                = 0;
+	size_t copy_offset                                     = 0;
+	size_t copy_size                                       = 0;
+	size_t read_size                                       = 0;
+	ssize_t read_count                                     = 0;
+	ssize_t write_count                                    = 0;
+	off64_t destination_descriptor_offset                  = 0;
+	off64_t source_descriptor_offset                       = 0;
+	int destination_descriptor                             = -1;
+	int result                                             = 0;
+	int source_descriptor                                  = -1;
 
-	if( handle == NULL )
+	if( source_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 "%s: invalid source handle.",
 		 function );
 
 		return( -1 );
 	}
-	internal_handle = (libbfio_internal_handle_t *) handle;
-
-	if( io_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid IO handle.",
-		 function );
+	internal_source_handle = (libbfio_internal_handle_t *) source_handle;
 
-		return( -1 );
-	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( internal_source_handle->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid source handle - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	*io_handle = internal_handle->io_handle;
-
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( source_offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source offset value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	return( 1 );
-}
-
-/* Retrieves the access flags
- * Returns 1 if successful or -1 on error
- */
-int libbfio_handle_get_access_flags(
-     libbfio_handle_t *handle,
-     int *access_flags,
-     libcerror_error_t **error )
-{
-	libbfio_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libbfio_handle_get_access_flags";
-
-	if( handle == NULL )
+	if( destination_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 "%s: invalid destination handle.",
 		 function );
 
 		return( -1 );
 	}
-	internal_handle = (libbfio_internal_handle_t *) handle;
+	internal_destination_handle = (libbfio_internal_handle_t *) destination_handle;
 
-	if( access_flags == NULL )
+	if( internal_destination_handle->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid access flags.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid destination handle - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( destination_offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid destination offset value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	*access_flags = internal_handle->access_flags;
-
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	return( 1 );
-}
-
-/* Sets the access flags
- * Returns 1 if successful or -1 on error
- */
-int libbfio_handle_set_access_flags(
-     libbfio_handle_t *handle,
-     int access_flags,
-     libcerror_error_t **error )
-{
-	libbfio_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libbfio_handle_set_access_flags";
-
-	if( handle == NULL )
+	if( ( (size64_t) source_offset > ( (size64_t) INT64_MAX - size ) )
+	 || ( (size64_t) destination_offset > ( (size64_t) INT64_MAX - size ) ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	internal_handle = (libbfio_internal_handle_t *) handle;
-
-	if( ( ( access_flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 )
-	 && ( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) == 0 ) )
+	if( ( source_handle == destination_handle )
+	 && ( source_offset < ( destination_offset + (off64_t) size ) )
+	 && ( destination_offset < ( source_offset + (off64_t) size ) ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access flags.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source and destination ranges overlap.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_handle->read_write_lock,
+	if( libbfio_handle_get_size(
+	     source_handle,
+	     &source_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve source size.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	internal_handle->access_flags = access_flags;
-
+	if( (size64_t) source_offset >= source_size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) size > ( source_size - (size64_t) source_offset ) )
+	{
+		size = (size_t) ( source_size - (size64_t) source_offset );
+	}
+	if( size == 0 )
+	{
+		return( 0 );
+	}
+	/* Copy the data in the kernel
+	 *
+	 * The source read lock is held until the kernel has copied the data,
+	 * so that the source descriptor cannot be closed or reopened meanwhile.
+	 * The locks of both handles are taken in order of their address so that
+	 * copies in opposite directions between the same handles cannot deadlock.
+	 */
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_handle->read_write_lock,
+	if( libbfio_internal_handle_grab_copy_locks(
+	     internal_source_handle,
+	     internal_destination_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to grab source and destination read/write locks.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	return( 1 );
-}
-
-/* Retrieves the current offset
- * Returns 1 if successful or -1 on error
- */
-int libbfio_handle_get_offset(
-     libbfio_handle_t *handle,
-     off64_t *offset,
-     libcerror_error_t **error )
-{
-	libbfio_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libbfio_handle_get_offset";
+	result = libbfio_internal_handle_get_descriptor(
+	          internal_source_handle,
+	          &source_descriptor,
+	          &source_descriptor_offset,
+	          error );
 
-	if( handle == NULL )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve source descriptor.",
 		 function );
-
-		return( -1 );
 	}
-	internal_handle = (libbfio_internal_handle_t *) handle;
+	else if( ( result != 0 )
+	      && ( source_handle != destination_handle ) )
+	{
+		/* Different handles can refer to the same file, the ranges are
+		 * compared relative to the start of the file
+		 */
+		result = libbfio_internal_handle_get_descriptor(
+		          internal_destination_handle,
+		          &destination_descriptor,
+		          &destination_descriptor_offset,
+		          error );
 
-	if( offset == NULL )
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve destination descriptor.",
+			 function );
+		}
+		else if( result != 0 )
+		{
+			result = libbfio_system_descriptors_are_same_file(
+			          source_descriptor,
+			          destination_descriptor,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if source and destination are the same file.",
+				 function );
+			}
+			else if( ( result != 0 )
+			      && ( ( source_descriptor_offset + source_offset ) < ( destination_descriptor_offset + destination_offset + (off64_t) size ) )
+			      && ( ( destination_descriptor_offset + destination_offset ) < ( source_descriptor_offset + source_offset + (off64_t) size ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid source and destination ranges overlap in the same file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( result != -1 )
+		{
+			result = 1;
+		}
+	}
+	if( result == 1 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid offset.",
-		 function );
+		result = libbfio_internal_handle_copy_from_descriptor(
+		          internal_destination_handle,
+		          destination_offset,
+		          source_descriptor,
+		          source_descriptor_offset + source_offset,
+		          size,
+		          &copy_size,
+		          error );
 
-		return( -1 );
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to copy from source descriptor to destination handle.",
+			 function );
+		}
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_handle->read_write_lock,
+	if( libbfio_internal_handle_release_copy_locks(
+	     internal_source_handle,
+	     internal_destination_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to release source and destination read/write locks.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	*offset = internal_handle->current_offset;
-
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( result == -1 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
-
 		return( -1 );
 	}
-#endif
-	return( 1 );
-}
-
-/* Returns the size of the data of the handle
- * Returns 1 if successful or -1 on error
- */
-int libbfio_handle_get_size(
-     libbfio_handle_t *handle,
-     size64_t *size,
-     libcerror_error_t **error )
-{
-	libbfio_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libbfio_handle_get_size";
+	copy_offset = copy_size;
 
-	if( handle == NULL )
+	if( copy_offset >= size )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
-		 function );
-
-		return( -1 );
+		return( (ssize_t) copy_offset );
 	}
-	internal_handle = (libbfio_internal_handle_t *) handle;
+	/* Write the data directly from the source data in memory
+	 */
+	result = libbfio_handle_get_data_pointer(
+	          source_handle,
+	          source_offset + (off64_t) copy_offset,
+	          size - copy_offset,
+	          &data,
+	          error );
 
-	if( internal_handle->io_handle == NULL )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve source data pointer.",
 		 function );
 
 		return( -1 );
 	}
-	if( size == NULL )
+	else if( result != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid size",
-		 function );
+		write_count = libbfio_handle_write_buffer_at_offset(
+		               destination_handle,
+		               data,
+		               size - copy_offset,
+		               destination_offset + (off64_t) copy_offset,
+		               error );
 
-		return( -1 );
+		if( write_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write to destination handle.",
+			 function );
+		}
+		if( libbfio_handle_release_data_pointer(
+		     source_handle,
+		     source_offset + (off64_t) copy_offset,
+		     data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release source data pointer.",
+			 function );
+
+			return( -1 );
+		}
+		if( write_count < 0 )
+		{
+			return( -1 );
+		}
+		copy_offset += (size_t) write_count;
+
+		return( (ssize_t) copy_offset );
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	/* Read the data into a buffer and write it
+	 */
+	copy_buffer_size = size - copy_offset;
+
+	if( copy_buffer_size > LIBBFIO_HANDLE_COPY_BUFFER_SIZE )
+	{
+		copy_buffer_size = LIBBFIO_HANDLE_COPY_BUFFER_SIZE;
+	}
+	copy_buffer = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * copy_buffer_size );
+
+	if( copy_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create copy buffer.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	if( internal_handle->size_set == 0 )
+	while( copy_offset < size )
 	{
-		if( internal_handle->get_size == NULL )
+		read_size = size - copy_offset;
+
+		if( read_size > copy_buffer_size )
+		{
+			read_size = copy_buffer_size;
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              source_handle,
+		              copy_buffer,
+		              read_size,
+		              source_offset + (off64_t) copy_offset,
+		              error );
+
+		if( read_count < 0 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid handle - missing get size function.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from source handle at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 source_offset + (off64_t) copy_offset,
+			 source_offset + (off64_t) copy_offset );
 
 			goto on_error;
 		}
-		if( internal_handle->get_size(
-		     internal_handle->io_handle,
-		     &( internal_handle->size ),
-		     error ) != 1 )
+		else if( read_count == 0 )
+		{
+			break;
+		}
+		write_count = libbfio_handle_write_buffer_at_offset(
+		               destination_handle,
+		               copy_buffer,
+		               (size_t) read_count,
+		               destination_offset + (off64_t) copy_offset,
+		               error );
+
+		if( write_count < 0 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve size.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write to destination handle at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 destination_offset + (off64_t) copy_offset,
+			 destination_offset + (off64_t) copy_offset );
 
 			goto on_error;
 		}
-		internal_handle->size_set = 1;
-	}
-	*size = internal_handle->size;
-
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
-		 function );
+		copy_offset += (size_t) write_count;
 
-		return( -1 );
+		/* Stop if the destination handle cannot hold more data
+		 */
+		if( write_count < read_count )
+		{
+			break;
+		}
 	}
-#endif
-	return( 1 );
+	memory_free(
+	 copy_buffer );
+
+	return( (ssize_t) copy_offset );
 
 on_error:
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	libcthreads_read_write_lock_release_for_write(
-	 internal_handle->read_write_lock,
-	 NULL );
-#endif
+	if( copy_buffer != NULL )
+	{
+		memory_free(
+		 copy_buffer );
+	}
 	return( -1 );
 }
 
-/* Sets the value to have the library open and close
- * the systems file descriptor or handle on demand
- * 0 disables open on demand any other value enables it
+/* Sets the get extent function
+ * The get extent function retrieves the extent of data or of a hole at an offset
+ * of the IO handle, such as determined with SEEK_DATA and SEEK_HOLE
+ * A value of NULL disables the function
  * Returns 1 if successful or -1 on error
  */
-int libbfio_handle_set_open_on_demand(
+int libbfio_handle_set_extent_function(
      libbfio_handle_t *handle,
-     uint8_t open_on_demand,
+     int (*get_extent)(
+            intptr_t *io_handle,
+            off64_t offset,
+            size64_t size,
+            size64_t *extent_size,
+            uint32_t *extent_flags,
+            libcerror_error_t **error ),
      libcerror_error_t **error )
 {
 	libbfio_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libbfio_handle_set_open_on_demand";
+	static char *function                      = "libbfio_handle_set_extent_function";
 
 	if( handle == NULL )
 	{
@@ -2448,18 +6805,6 @@ int libbfio_handle_set_open_on_demand(
 	}
 	internal_handle = (libbfio_internal_handle_t *) handle;
 
-	if( ( ( internal_handle->access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) != 0 )
-	 && ( open_on_demand != 0 ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: open on demand cannot be used in combination with write access.",
-		 function );
-
-		return( -1 );
-	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_handle->read_write_lock,
@@ -2475,7 +6820,7 @@ int libbfio_handle_set_open_on_demand(
 		return( -1 );
 	}
 #endif
-	internal_handle->open_on_demand = open_on_demand;
+	internal_handle->get_extent = get_extent;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -2495,17 +6840,26 @@ int libbfio_handle_set_open_on_demand(
 	return( 1 );
 }
 
-/* Sets the value to have the library track the offsets read
- * 0 disables tracking any other value enables it
- * Returns 1 if successful or -1 on error
+/* Retrieves the extent at a specific offset
+ * The extent either contains data or is a hole (sparse), which reads as zero bytes,
+ * and extends from the offset to the next transition between data and a hole
+ * or to the end of the data
+ * The extents of the data can be enumerated by repeating the call at offset + extent size
+ * If the IO handle cannot determine its holes, for example a memory range, or if open
+ * on demand is enabled, the remainder of the data is returned as a single data extent
+ * Returns 1 if successful, 0 if the offset is at or beyond the end of the data or -1 on error
  */
-int libbfio_handle_set_track_offsets_read(
+int libbfio_handle_get_extent_at_offset(
      libbfio_handle_t *handle,
-     uint8_t track_offsets_read,
+     off64_t offset,
+     size64_t *extent_size,
+     uint32_t *extent_flags,
      libcerror_error_t **error )
 {
 	libbfio_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libbfio_handle_set_track_offsets_read";
+	static char *function                      = "libbfio_handle_get_extent_at_offset";
+	size64_t size                              = 0;
+	int result                                 = 0;
 
 	if( handle == NULL )
 	{
@@ -2520,8 +6874,70 @@ int libbfio_handle_set_track_offsets_read(
 	}
 	internal_handle = (libbfio_internal_handle_t *) handle;
 
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent size.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     handle,
+	     &size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) offset >= size )
+	{
+		return( 0 );
+	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2529,16 +6945,48 @@ int libbfio_handle_set_track_offsets_read(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	internal_handle->track_offsets_read = track_offsets_read;
+	if( ( internal_handle->get_extent != NULL )
+	 && ( internal_handle->open_on_demand == 0 ) )
+	{
+		result = internal_handle->get_extent(
+		          internal_handle->io_handle,
+		          offset,
+		          size - (size64_t) offset,
+		          extent_size,
+		          extent_flags,
+		          error );
 
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+		}
+		else if( ( result != 0 )
+		      && ( *extent_size == 0 ) )
+		{
+			result = 0;
+		}
+	}
+	if( result == 0 )
+	{
+		*extent_size  = size - (size64_t) offset;
+		*extent_flags = 0;
+		result        = 1;
+	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2546,13 +6994,13 @@ int libbfio_handle_set_track_offsets_read(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	return( result );
 }
 
 /* Retrieves the number of offsets read
@@ -29,6 +29,7 @@
 #include "libbfio_libcdata.h"
 #include "libbfio_libcerror.h"
 #include "libbfio_libcthreads.h"
+#include "libbfio_prefetcher.h"
 #include "libbfio_types.h"
 
 #if defined( __cplusplus )
@@ -68,9 +69,74 @@ struct libbfio_internal_handle
 	 */
 	uint8_t open_on_demand;
 
-	/* Reference to the pool last used list element
+	/* The descriptor cache used to keep the descriptor open between reads
+	 * when the handle is opened on demand
 	 */
-	libcdata_list_element_t *pool_last_used_list_element;
+	libbfio_descriptor_cache_t *descriptor_cache;
+
+	/* The previous (more recently used) handle in the descriptor cache idle list
+	 */
+	libbfio_internal_handle_t *descriptor_cache_previous_handle;
+
+	/* The next (less recently used) handle in the descriptor cache idle list
+	 */
+	libbfio_internal_handle_t *descriptor_cache_next_handle;
+
+	/* Value to indicate the handle is in the descriptor cache idle list
+	 */
+	uint8_t descriptor_cache_in_idle_list;
+
+	/* Value to indicate the descriptor is open and accounted for by the descriptor cache
+	 */
+	uint8_t descriptor_cache_is_open;
+
+	/* The time the descriptor was last used in milliseconds
+	 */
+	uint64_t descriptor_cache_last_used_time;
+
+	/* The key of the descriptor that is shared with other handles
+	 * the descriptor cache accounts for a shared descriptor once
+	 * NULL if the descriptor is not shared
+	 */
+	intptr_t *descriptor_cache_shared_key;
+
+	/* The pool the handle is in
+	 * a handle can only be in one pool since the pool last used list is linked through the handle
+	 */
+	libbfio_pool_t *pool;
+
+	/* The previous (more recently used) handle in the pool last used list
+	 */
+	libbfio_internal_handle_t *pool_last_used_previous_handle;
+
+	/* The next (less recently used) handle in the pool last used list
+	 */
+	libbfio_internal_handle_t *pool_last_used_next_handle;
+
+	/* Value to indicate the handle is in the pool last used list
+	 */
+	uint8_t pool_in_last_used_list;
+
+	/* The number of pool operations that are using the handle
+	 * a handle that is in use is not closed when the pool needs room for another open handle
+	 */
+	int pool_number_of_references;
+
+	/* The state of the handle in the pool
+	 * a handle that is being opened or closed by a pool operation cannot be used
+	 * by another pool operation until it is idle
+	 */
+	uint8_t pool_state;
+
+	/* Value to indicate a pool operation has claimed the current offset of the handle
+	 * to read at and update it, other pool operations wait until it is released
+	 */
+	uint8_t pool_offset_claimed;
+
+	/* Value to indicate the handle was evicted from the pool and is pending
+	 * to be closed by the handle closer of the pool
+	 */
+	uint8_t pool_close_pending;
 
 	/* Value to indicate to track offsets read
 	 */
@@ -80,6 +146,40 @@ struct libbfio_internal_handle
 	 */
 	libcdata_range_list_t *offsets_read;
 
+	/* The maximum readahead size
+	 * 0 disables readahead
+	 */
+	size_t maximum_readahead_size;
+
+	/* The current readahead size
+	 * the readahead size grows while the handle is read sequentially
+	 */
+	size_t readahead_size;
+
+	/* The offset at which the next read continues a sequential read
+	 */
+	off64_t readahead_next_offset;
+
+	/* The readahead buffer
+	 */
+	uint8_t *readahead_buffer;
+
+	/* The (allocated) readahead buffer size
+	 */
+	size_t readahead_buffer_size;
+
+	/* The offset of the data in the readahead buffer
+	 */
+	off64_t readahead_data_offset;
+
+	/* The size of the data in the readahead buffer
+	 */
+	size_t readahead_data_size;
+
+	/* The prefetcher that reads the data following the readahead buffer
+	 */
+	libbfio_prefetcher_t *prefetcher;
+
 	/* The narrow string codepage
 	 */
 	int narrow_string_codepage;
@@ -126,6 +226,89 @@ struct libbfio_internal_handle
 	           size_t size,
 	           libcerror_error_t **error );
 
+	/* The read at offset function
+	 */
+	ssize_t (*read_at_offset)(
+	           intptr_t *io_handle,
+	           uint8_t *buffer,
+	           size_t size,
+	           off64_t offset,
+	           libcerror_error_t **error );
+
+	/* The write at offset function
+	 */
+	ssize_t (*write_at_offset)(
+	           intptr_t *io_handle,
+	           const uint8_t *buffer,
+	           size_t size,
+	           off64_t offset,
+	           libcerror_error_t **error );
+
+	/* The read vector at offset function
+	 */
+	ssize_t (*read_vector_at_offset)(
+	           intptr_t *io_handle,
+	           uint8_t **buffers,
+	           size_t *buffer_sizes,
+	           int number_of_buffers,
+	           off64_t offset,
+	           libcerror_error_t **error );
+
+	/* The access hint function
+	 */
+	int (*access_hint)(
+	       intptr_t *io_handle,
+	       off64_t offset,
+	       size64_t size,
+	       int access_hint,
+	       libcerror_error_t **error );
+
+	/* The get data pointer function
+	 */
+	int (*get_data_pointer)(
+	       intptr_t *io_handle,
+	       off64_t offset,
+	       size_t size,
+	       const uint8_t **data,
+	       libcerror_error_t **error );
+
+	/* The release data pointer function
+	 */
+	int (*release_data_pointer)(
+	       intptr_t *io_handle,
+	       off64_t offset,
+	       const uint8_t *data,
+	       libcerror_error_t **error );
+
+	/* The get descriptor function
+	 */
+	int (*get_descriptor)(
+	       intptr_t *io_handle,
+	       int *descriptor,
+	       off64_t *descriptor_offset,
+	       libcerror_error_t **error );
+
+	/* The copy from descriptor function
+	 */
+	int (*copy_from_descriptor)(
+	       intptr_t *io_handle,
+	       off64_t offset,
+	       int source_descriptor,
+	       off64_t source_offset,
+	       size_t size,
+	       size_t *copy_size,
+	       libcerror_error_t **error );
+
+	/* The get extent function
+	 */
+	int (*get_extent)(
+	       intptr_t *io_handle,
+	       off64_t offset,
+	       size64_t size,
+	       size64_t *extent_size,
+	       uint32_t *extent_flags,
+	       libcerror_error_t **error );
+
 	/* The seek offset function
 	 */
 	off64_t (*seek_offset)(
@@ -234,6 +417,30 @@ int libbfio_handle_close(
      libbfio_handle_t *handle,
      libcerror_error_t **error );
 
+int libbfio_internal_handle_discard_readahead(
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+int libbfio_internal_handle_update_written_range(
+     libbfio_internal_handle_t *internal_handle,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+ssize_t libbfio_internal_handle_read_buffer_with_readahead(
+         libbfio_internal_handle_t *internal_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+int libbfio_internal_handle_open_on_demand(
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+int libbfio_internal_handle_close_on_demand(
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
 ssize_t libbfio_internal_handle_read_buffer(
          libbfio_internal_handle_t *internal_handle,
          uint8_t *buffer,
@@ -247,6 +454,13 @@ ssize_t libbfio_handle_read_buffer(
          size_t size,
          libcerror_error_t **error );
 
+ssize_t libbfio_internal_handle_read_buffer_at_offset(
+         libbfio_internal_handle_t *internal_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
 LIBBFIO_EXTERN \
 ssize_t libbfio_handle_read_buffer_at_offset(
          libbfio_handle_t *handle,
@@ -255,6 +469,24 @@ ssize_t libbfio_handle_read_buffer_at_offset(
          off64_t offset,
          libcerror_error_t **error );
 
+ssize_t libbfio_internal_handle_read_vector(
+         libbfio_internal_handle_t *internal_handle,
+         uint8_t **buffers,
+         size_t *buffer_sizes,
+         off64_t *offsets,
+         int number_of_buffers,
+         uint8_t read_at_offset,
+         libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+ssize_t libbfio_handle_read_vector(
+         libbfio_handle_t *handle,
+         uint8_t **buffers,
+         size_t *buffer_sizes,
+         off64_t *offsets,
+         int number_of_buffers,
+         libcerror_error_t **error );
+
 ssize_t libbfio_internal_handle_write_buffer(
          libbfio_internal_handle_t *internal_handle,
          const uint8_t *buffer,
@@ -268,6 +500,13 @@ ssize_t libbfio_handle_write_buffer(
          size_t size,
          libcerror_error_t **error );
 
+ssize_t libbfio_internal_handle_write_buffer_at_offset(
+         libbfio_internal_handle_t *internal_handle,
+         const uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
 LIBBFIO_EXTERN \
 ssize_t libbfio_handle_write_buffer_at_offset(
          libbfio_handle_t *handle,
@@ -335,12 +574,201 @@ int libbfio_handle_set_open_on_demand(
      uint8_t open_on_demand,
      libcerror_error_t **error );
 
+LIBBFIO_EXTERN \
+int libbfio_handle_set_descriptor_cache(
+     libbfio_handle_t *handle,
+     libbfio_descriptor_cache_t *descriptor_cache,
+     libcerror_error_t **error );
+
 LIBBFIO_EXTERN \
 int libbfio_handle_set_track_offsets_read(
      libbfio_handle_t *handle,
      uint8_t track_offsets_read,
      libcerror_error_t **error );
 
+LIBBFIO_EXTERN \
+int libbfio_handle_get_maximum_readahead_size(
+     libbfio_handle_t *handle,
+     size_t *maximum_readahead_size,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_handle_set_maximum_readahead_size(
+     libbfio_handle_t *handle,
+     size_t maximum_readahead_size,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_handle_set_prefetch(
+     libbfio_handle_t *handle,
+     uint8_t prefetch,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_handle_set_read_at_offset_function(
+     libbfio_handle_t *handle,
+     ssize_t (*read_at_offset)(
+                intptr_t *io_handle,
+                uint8_t *buffer,
+                size_t size,
+                off64_t offset,
+                libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_handle_set_write_at_offset_function(
+     libbfio_handle_t *handle,
+     ssize_t (*write_at_offset)(
+                intptr_t *io_handle,
+                const uint8_t *buffer,
+                size_t size,
+                off64_t offset,
+                libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_handle_set_read_vector_at_offset_function(
+     libbfio_handle_t *handle,
+     ssize_t (*read_vector_at_offset)(
+                intptr_t *io_handle,
+                uint8_t **buffers,
+                size_t *buffer_sizes,
+                int number_of_buffers,
+                off64_t offset,
+                libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_handle_set_access_hint_function(
+     libbfio_handle_t *handle,
+     int (*access_hint)(
+            intptr_t *io_handle,
+            off64_t offset,
+            size64_t size,
+            int access_hint,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_handle_set_access_hint(
+     libbfio_handle_t *handle,
+     off64_t offset,
+     size64_t size,
+     int access_hint,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_handle_set_data_pointer_functions(
+     libbfio_handle_t *handle,
+     int (*get_data_pointer)(
+            intptr_t *io_handle,
+            off64_t offset,
+            size_t size,
+            const uint8_t **data,
+            libcerror_error_t **error ),
+     int (*release_data_pointer)(
+            intptr_t *io_handle,
+            off64_t offset,
+            const uint8_t *data,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_handle_get_data_pointer(
+     libbfio_handle_t *handle,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_handle_release_data_pointer(
+     libbfio_handle_t *handle,
+     off64_t offset,
+     const uint8_t *data,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_handle_set_descriptor_functions(
+     libbfio_handle_t *handle,
+     int (*get_descriptor)(
+            intptr_t *io_handle,
+            int *descriptor,
+            off64_t *descriptor_offset,
+            libcerror_error_t **error ),
+     int (*copy_from_descriptor)(
+            intptr_t *io_handle,
+            off64_t offset,
+            int source_descriptor,
+            off64_t source_offset,
+            size_t size,
+            size_t *copy_size,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+int libbfio_internal_handle_get_descriptor(
+     libbfio_internal_handle_t *internal_handle,
+     int *descriptor,
+     off64_t *descriptor_offset,
+     libcerror_error_t **error );
+
+int libbfio_system_descriptors_are_same_file(
+     int first_descriptor,
+     int second_descriptor,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+
+int libbfio_internal_handle_grab_copy_locks(
+     libbfio_internal_handle_t *internal_source_handle,
+     libbfio_internal_handle_t *internal_destination_handle,
+     libcerror_error_t **error );
+
+int libbfio_internal_handle_release_copy_locks(
+     libbfio_internal_handle_t *internal_source_handle,
+     libbfio_internal_handle_t *internal_destination_handle,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO ) */
+
+int libbfio_internal_handle_copy_from_descriptor(
+     libbfio_internal_handle_t *internal_handle,
+     off64_t offset,
+     int source_descriptor,
+     off64_t source_offset,
+     size_t size,
+     size_t *copy_size,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+ssize_t libbfio_handle_copy_range(
+         libbfio_handle_t *source_handle,
+         off64_t source_offset,
+         libbfio_handle_t *destination_handle,
+         off64_t destination_offset,
+         size_t size,
+         libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_handle_set_extent_function(
+     libbfio_handle_t *handle,
+     int (*get_extent)(
+            intptr_t *io_handle,
+            off64_t offset,
+            size64_t size,
+            size64_t *extent_size,
+            uint32_t *extent_flags,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_handle_get_extent_at_offset(
+     libbfio_handle_t *handle,
+     off64_t offset,
+     size64_t *extent_size,
+     uint32_t *extent_flags,
+     libcerror_error_t **error );
+
 LIBBFIO_EXTERN \
 int libbfio_handle_get_number_of_offsets_read(
      libbfio_handle_t *handle,
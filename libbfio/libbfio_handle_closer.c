@@ -0,0 +1,777 @@
+/*
+ * The handle closer functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libbfio_definitions.h"
+#include "libbfio_handle.h"
+#include "libbfio_handle_closer.h"
+#include "libbfio_libcerror.h"
+#include "libbfio_libcthreads.h"
+
+/* Creates a handle closer
+ * The handle closer closes handles that were evicted from a pool,
+ * if multi-threading is supported the handles are closed by a background thread
+ * Make sure the value handle_closer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_closer_initialize(
+     libbfio_handle_closer_t **handle_closer,
+     int maximum_number_of_pending_closes,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_handle_closer_initialize";
+
+	if( handle_closer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle closer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *handle_closer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle closer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_pending_closes <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of pending closes value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	*handle_closer = memory_allocate_structure(
+	                  libbfio_handle_closer_t );
+
+	if( *handle_closer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create handle closer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *handle_closer,
+	     0,
+	     sizeof( libbfio_handle_closer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear handle closer.",
+		 function );
+
+		memory_free(
+		 *handle_closer );
+
+		*handle_closer = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_initialize(
+	     &( ( *handle_closer )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *handle_closer )->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize condition.",
+		 function );
+
+		goto on_error;
+	}
+	/* A single thread is used since closing handles is not time critical
+	 */
+	if( libcthreads_thread_pool_create(
+	     &( ( *handle_closer )->thread_pool ),
+	     NULL,
+	     1,
+	     maximum_number_of_pending_closes,
+	     (int (*)(intptr_t *, void *)) &libbfio_handle_closer_process,
+	     (void *) *handle_closer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *handle_closer )->maximum_number_of_pending_closes = maximum_number_of_pending_closes;
+
+	return( 1 );
+
+on_error:
+	if( *handle_closer != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+		if( ( *handle_closer )->condition != NULL )
+		{
+			libcthreads_condition_free(
+			 &( ( *handle_closer )->condition ),
+			 NULL );
+		}
+		if( ( *handle_closer )->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *handle_closer )->mutex ),
+			 NULL );
+		}
+#endif
+		memory_free(
+		 *handle_closer );
+
+		*handle_closer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a handle closer
+ * Waits until the pending closes have completed
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_closer_free(
+     libbfio_handle_closer_t **handle_closer,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_handle_closer_free";
+	int result            = 1;
+
+	if( handle_closer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle closer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *handle_closer != NULL )
+	{
+		if( libbfio_handle_closer_wait(
+		     *handle_closer,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for pending closes.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+		if( libcthreads_thread_pool_join(
+		     &( ( *handle_closer )->thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_condition_free(
+		     &( ( *handle_closer )->condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *handle_closer )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *handle_closer );
+
+		*handle_closer = NULL;
+	}
+	return( result );
+}
+
+/* Pushes a handle to be closed
+ * The handle remains pending to be closed until the close has completed
+ * If multi-threading is supported the handle is closed by the thread pool,
+ * otherwise the handle is closed before this function returns
+ * Returns 1 if successful, 0 if the maximum number of pending closes was reached or -1 on error
+ */
+int libbfio_handle_closer_push(
+     libbfio_handle_closer_t *handle_closer,
+     libbfio_handle_t *handle,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_closer_push";
+	int result                                 = 0;
+
+	if( handle_closer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle closer.",
+		 function );
+
+		return( -1 );
+	}
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     handle_closer->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( handle_closer->number_of_pending_closes < handle_closer->maximum_number_of_pending_closes )
+	{
+		internal_handle->pool_close_pending = 1;
+
+		handle_closer->number_of_pending_closes += 1;
+
+		result = 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     handle_closer->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* The caller closes the handle if the maximum number of pending closes was reached
+	 */
+	if( result == 0 )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_thread_pool_push(
+	     handle_closer->thread_pool,
+	     (intptr_t *) handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push handle onto thread pool queue.",
+		 function );
+
+		/* Close the handle directly so that it does not remain pending to be closed
+		 */
+		libbfio_handle_closer_process(
+		 handle,
+		 handle_closer );
+
+		return( -1 );
+	}
+#else
+	if( libbfio_handle_closer_process(
+	     handle,
+	     handle_closer ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to close handle.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Closes a handle that is pending to be closed
+ * This function is used as the thread pool callback function
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_closer_process(
+     libbfio_handle_t *handle,
+     libbfio_handle_closer_t *handle_closer )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	libcerror_error_t *error                   = NULL;
+	int result                                 = 1;
+
+	if( ( handle == NULL )
+	 || ( handle_closer == NULL ) )
+	{
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( libbfio_handle_close(
+	     handle,
+	     &error ) != 0 )
+	{
+		/* There is no caller to report the error to, the handle was
+		 * already evicted from the pool and is reopened when needed
+		 */
+		libcerror_error_free(
+		 &error );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     handle_closer->mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+#endif
+	internal_handle->pool_close_pending = 0;
+
+	handle_closer->number_of_pending_closes -= 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_condition_broadcast(
+	     handle_closer->condition,
+	     NULL ) != 1 )
+	{
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     handle_closer->mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of pending closes
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_closer_get_number_of_pending_closes(
+     libbfio_handle_closer_t *handle_closer,
+     int *number_of_pending_closes,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_handle_closer_get_number_of_pending_closes";
+
+	if( handle_closer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle closer.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_pending_closes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of pending closes.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     handle_closer->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_pending_closes = handle_closer->number_of_pending_closes;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     handle_closer->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Determines if a specific handle is pending to be closed
+ * Returns 1 if pending, 0 if not or -1 on error
+ */
+int libbfio_handle_closer_is_pending(
+     libbfio_handle_closer_t *handle_closer,
+     libbfio_handle_t *handle,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_closer_is_pending";
+	int result                                 = 0;
+
+	if( handle_closer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle closer.",
+		 function );
+
+		return( -1 );
+	}
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     handle_closer->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_handle->pool_close_pending != 0 )
+	{
+		result = 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     handle_closer->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Waits until the number of pending closes is less than or equal to the maximum
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_closer_wait(
+     libbfio_handle_closer_t *handle_closer,
+     int maximum_number_of_pending_closes,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_handle_closer_wait";
+	int result            = 1;
+
+	if( handle_closer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle closer.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_pending_closes < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of pending closes value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     handle_closer->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( handle_closer->number_of_pending_closes > maximum_number_of_pending_closes )
+	{
+		if( libcthreads_condition_wait(
+		     handle_closer->condition,
+		     handle_closer->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to wait for condition.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     handle_closer->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Waits until a specific handle is no longer pending to be closed
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_closer_wait_for_handle(
+     libbfio_handle_closer_t *handle_closer,
+     libbfio_handle_t *handle,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_closer_wait_for_handle";
+	int result                                 = 1;
+
+	if( handle_closer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle closer.",
+		 function );
+
+		return( -1 );
+	}
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     handle_closer->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( internal_handle->pool_close_pending != 0 )
+	{
+		if( libcthreads_condition_wait(
+		     handle_closer->condition,
+		     handle_closer->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to wait for condition.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     handle_closer->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( internal_handle->pool_close_pending != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid handle - close pending.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	return( result );
+}
+
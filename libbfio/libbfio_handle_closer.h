@@ -0,0 +1,107 @@
+/*
+ * The handle closer functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBBFIO_HANDLE_CLOSER_H )
+#define _LIBBFIO_HANDLE_CLOSER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libbfio_libcerror.h"
+#include "libbfio_libcthreads.h"
+#include "libbfio_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libbfio_handle_closer libbfio_handle_closer_t;
+
+struct libbfio_handle_closer
+{
+	/* The maximum number of pending closes
+	 */
+	int maximum_number_of_pending_closes;
+
+	/* The number of pending closes
+	 */
+	int number_of_pending_closes;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	/* The thread pool that closes the handles
+	 */
+	libcthreads_thread_pool_t *thread_pool;
+
+	/* The mutex that protects the number of pending closes
+	 * and the pending close value of the handles
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that is signalled when a pending close has completed
+	 */
+	libcthreads_condition_t *condition;
+#endif
+};
+
+int libbfio_handle_closer_initialize(
+     libbfio_handle_closer_t **handle_closer,
+     int maximum_number_of_pending_closes,
+     libcerror_error_t **error );
+
+int libbfio_handle_closer_free(
+     libbfio_handle_closer_t **handle_closer,
+     libcerror_error_t **error );
+
+int libbfio_handle_closer_push(
+     libbfio_handle_closer_t *handle_closer,
+     libbfio_handle_t *handle,
+     libcerror_error_t **error );
+
+int libbfio_handle_closer_process(
+     libbfio_handle_t *handle,
+     libbfio_handle_closer_t *handle_closer );
+
+int libbfio_handle_closer_get_number_of_pending_closes(
+     libbfio_handle_closer_t *handle_closer,
+     int *number_of_pending_closes,
+     libcerror_error_t **error );
+
+int libbfio_handle_closer_is_pending(
+     libbfio_handle_closer_t *handle_closer,
+     libbfio_handle_t *handle,
+     libcerror_error_t **error );
+
+int libbfio_handle_closer_wait(
+     libbfio_handle_closer_t *handle_closer,
+     int maximum_number_of_pending_closes,
+     libcerror_error_t **error );
+
+int libbfio_handle_closer_wait_for_handle(
+     libbfio_handle_closer_t *handle_closer,
+     libbfio_handle_t *handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBBFIO_HANDLE_CLOSER_H ) */
+
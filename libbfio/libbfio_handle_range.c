@@ -0,0 +1,164 @@
+/*
+ * The handle range functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libbfio_definitions.h"
+#include "libbfio_handle.h"
+#include "libbfio_handle_range.h"
+#include "libbfio_handle_range_io_handle.h"
+#include "libbfio_libcerror.h"
+#include "libbfio_types.h"
+
+/* Creates a handle range
+ * The handle range provides access to a range of the data of the parent handle
+ * A range size of 0 represents that the range continues until the end of the parent handle
+ * If the parent handle is a handle range the range is translated to the parent handle
+ * of that handle range, so that nested ranges only require a single offset translation
+ * Data is read and written using the read and write at offset functions of the parent handle
+ * The parent handle is not managed by the handle range and must remain available
+ * while the handle range is used
+ * Make sure the value handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_range_initialize(
+     libbfio_handle_t **handle,
+     libbfio_handle_t *parent_handle,
+     off64_t range_offset,
+     size64_t range_size,
+     libcerror_error_t **error )
+{
+	libbfio_handle_range_io_handle_t *handle_range_io_handle = NULL;
+	static char *function                                    = "libbfio_handle_range_initialize";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_range_io_handle_initialize(
+	     &handle_range_io_handle,
+	     parent_handle,
+	     range_offset,
+	     range_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create handle range IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_initialize(
+	     handle,
+	     (intptr_t *) handle_range_io_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) libbfio_handle_range_io_handle_free,
+	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) libbfio_handle_range_io_handle_clone,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) libbfio_handle_range_io_handle_open,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libbfio_handle_range_io_handle_close,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) libbfio_handle_range_io_handle_read_buffer,
+	     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) libbfio_handle_range_io_handle_write_buffer,
+	     (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) libbfio_handle_range_io_handle_seek_offset,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libbfio_handle_range_io_handle_exists,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libbfio_handle_range_io_handle_is_open,
+	     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libbfio_handle_range_io_handle_get_size,
+	     LIBBFIO_FLAG_IO_HANDLE_MANAGED | LIBBFIO_FLAG_IO_HANDLE_CLONE_BY_FUNCTION,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_set_read_at_offset_function(
+	     *handle,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, off64_t, libcerror_error_t **)) libbfio_handle_range_io_handle_read_buffer_at_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set read at offset function.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libbfio_handle_set_write_at_offset_function(
+	     *handle,
+	     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, off64_t, libcerror_error_t **)) libbfio_handle_range_io_handle_write_buffer_at_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set write at offset function.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( handle_range_io_handle != NULL )
+	{
+		libbfio_handle_range_io_handle_free(
+		 &handle_range_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,1039 @@
+/*
+ * The handle range IO handle functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libbfio_definitions.h"
+#include "libbfio_handle.h"
+#include "libbfio_handle_range_io_handle.h"
+#include "libbfio_libcerror.h"
+#include "libbfio_types.h"
+
+/* Creates a handle range IO handle
+ * A range size of 0 represents that the range continues until the end of the parent handle
+ * If the parent handle is a handle range itself the range is translated to its parent handle
+ * so that nested ranges only require a single offset translation
+ * The parent handle is not managed by the handle range IO handle and must remain
+ * available while the handle range IO handle is used
+ * Make sure the value handle_range_io_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_range_io_handle_initialize(
+     libbfio_handle_range_io_handle_t **handle_range_io_handle,
+     libbfio_handle_t *parent_handle,
+     off64_t range_offset,
+     size64_t range_size,
+     libcerror_error_t **error )
+{
+	libbfio_handle_range_io_handle_t *parent_handle_range_io_handle = NULL;
+	libbfio_internal_handle_t *internal_parent_handle               = NULL;
+	static char *function                                           = "libbfio_handle_range_io_handle_initialize";
+
+	if( handle_range_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle range IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *handle_range_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle range IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( parent_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parent handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid range offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid range size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parent_handle = (libbfio_internal_handle_t *) parent_handle;
+
+	if( internal_parent_handle->free_io_handle == (int (*)(intptr_t **, libcerror_error_t **)) libbfio_handle_range_io_handle_free )
+	{
+		parent_handle_range_io_handle = (libbfio_handle_range_io_handle_t *) internal_parent_handle->io_handle;
+
+		if( parent_handle_range_io_handle == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid parent handle - missing IO handle.",
+			 function );
+
+			return( -1 );
+		}
+		if( parent_handle_range_io_handle->range_size != 0 )
+		{
+			if( (size64_t) range_offset >= parent_handle_range_io_handle->range_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid range offset value exceeds parent range size.",
+				 function );
+
+				return( -1 );
+			}
+			if( range_size == 0 )
+			{
+				range_size = parent_handle_range_io_handle->range_size - (size64_t) range_offset;
+			}
+			else if( range_size > ( parent_handle_range_io_handle->range_size - (size64_t) range_offset ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid range size value exceeds parent range size.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( range_offset > ( (off64_t) INT64_MAX - parent_handle_range_io_handle->range_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid range offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		/* The parent handle of a handle range is never a handle range itself
+		 */
+		range_offset  += parent_handle_range_io_handle->range_offset;
+		parent_handle  = parent_handle_range_io_handle->parent_handle;
+	}
+	*handle_range_io_handle = memory_allocate_structure(
+	                           libbfio_handle_range_io_handle_t );
+
+	if( *handle_range_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create handle range IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *handle_range_io_handle,
+	     0,
+	     sizeof( libbfio_handle_range_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear handle range IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *handle_range_io_handle )->parent_handle = parent_handle;
+	( *handle_range_io_handle )->range_offset  = range_offset;
+	( *handle_range_io_handle )->range_size    = range_size;
+
+	return( 1 );
+
+on_error:
+	if( *handle_range_io_handle != NULL )
+	{
+		memory_free(
+		 *handle_range_io_handle );
+
+		*handle_range_io_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a handle range IO handle
+ * Returns 1 if succesful or -1 on error
+ */
+int libbfio_handle_range_io_handle_free(
+     libbfio_handle_range_io_handle_t **handle_range_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_handle_range_io_handle_free";
+
+	if( handle_range_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle range IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *handle_range_io_handle != NULL )
+	{
+		memory_free(
+		 *handle_range_io_handle );
+
+		*handle_range_io_handle = NULL;
+	}
+	return( 1 );
+}
+
+/* Clones (duplicates) the handle range IO handle and its attributes
+ * The destination handle range IO handle uses the same parent handle
+ * Returns 1 if succesful or -1 on error
+ */
+int libbfio_handle_range_io_handle_clone(
+     libbfio_handle_range_io_handle_t **destination_handle_range_io_handle,
+     libbfio_handle_range_io_handle_t *source_handle_range_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_handle_range_io_handle_clone";
+
+	if( destination_handle_range_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination handle range IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_handle_range_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: destination handle range IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_handle_range_io_handle == NULL )
+	{
+		*destination_handle_range_io_handle = NULL;
+
+		return( 1 );
+	}
+	if( libbfio_handle_range_io_handle_initialize(
+	     destination_handle_range_io_handle,
+	     source_handle_range_io_handle->parent_handle,
+	     source_handle_range_io_handle->range_offset,
+	     source_handle_range_io_handle->range_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create handle range IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_handle_range_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing destination handle range IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	( *destination_handle_range_io_handle )->current_offset = source_handle_range_io_handle->current_offset;
+	( *destination_handle_range_io_handle )->access_flags   = source_handle_range_io_handle->access_flags;
+
+	return( 1 );
+}
+
+/* Opens the handle range IO handle
+ * The parent handle is opened if it is not open
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_range_io_handle_open(
+     libbfio_handle_range_io_handle_t *handle_range_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_handle_range_io_handle_open";
+	size64_t parent_size  = 0;
+	int result            = 0;
+
+	if( handle_range_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle range IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( handle_range_io_handle->is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle range IO handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	/* Either read or write flag should be set
+	 */
+	if( ( ( access_flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags: 0x%02x.",
+		 function,
+		 access_flags );
+
+		return( -1 );
+	}
+	/* The range cannot be truncated without truncating the parent handle
+	 */
+	if( ( access_flags & LIBBFIO_ACCESS_FLAG_TRUNCATE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags: 0x%02x.",
+		 function,
+		 access_flags );
+
+		return( -1 );
+	}
+	result = libbfio_handle_is_open(
+	          handle_range_io_handle->parent_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if parent handle is open.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		if( libbfio_handle_open(
+		     handle_range_io_handle->parent_handle,
+		     access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open parent handle.",
+			 function );
+
+			return( -1 );
+		}
+		handle_range_io_handle->close_parent_handle = 1;
+	}
+	if( libbfio_handle_get_size(
+	     handle_range_io_handle->parent_handle,
+	     &parent_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve parent handle size.",
+		 function );
+
+		goto on_error;
+	}
+	if( (size64_t) handle_range_io_handle->range_offset > parent_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid range offset value exceeds parent handle size.",
+		 function );
+
+		goto on_error;
+	}
+	parent_size -= (size64_t) handle_range_io_handle->range_offset;
+
+	if( handle_range_io_handle->range_size > parent_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid range size value exceeds parent handle size.",
+		 function );
+
+		goto on_error;
+	}
+	if( handle_range_io_handle->range_size != 0 )
+	{
+		handle_range_io_handle->size = handle_range_io_handle->range_size;
+	}
+	else
+	{
+		handle_range_io_handle->size = parent_size;
+	}
+	handle_range_io_handle->current_offset = 0;
+	handle_range_io_handle->access_flags   = access_flags;
+	handle_range_io_handle->is_open        = 1;
+
+	return( 1 );
+
+on_error:
+	if( handle_range_io_handle->close_parent_handle != 0 )
+	{
+		libbfio_handle_close(
+		 handle_range_io_handle->parent_handle,
+		 NULL );
+
+		handle_range_io_handle->close_parent_handle = 0;
+	}
+	return( -1 );
+}
+
+/* Closes the handle range IO handle
+ * The parent handle is closed if it was opened by the handle range IO handle
+ * Returns 0 if successful or -1 on error
+ */
+int libbfio_handle_range_io_handle_close(
+     libbfio_handle_range_io_handle_t *handle_range_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_handle_range_io_handle_close";
+	int result            = 0;
+
+	if( handle_range_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle range IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( handle_range_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle range IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( handle_range_io_handle->close_parent_handle != 0 )
+	{
+		if( libbfio_handle_close(
+		     handle_range_io_handle->parent_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close parent handle.",
+			 function );
+
+			result = -1;
+		}
+		handle_range_io_handle->close_parent_handle = 0;
+	}
+	handle_range_io_handle->is_open = 0;
+
+	return( result );
+}
+
+/* Reads a buffer from the handle range IO handle
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libbfio_handle_range_io_handle_read_buffer(
+         libbfio_handle_range_io_handle_t *handle_range_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function = "libbfio_handle_range_io_handle_read_buffer";
+	ssize_t read_count    = 0;
+
+	if( handle_range_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle range IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_range_io_handle_read_buffer_at_offset(
+	              handle_range_io_handle,
+	              buffer,
+	              size,
+	              handle_range_io_handle->current_offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer.",
+		 function );
+
+		return( -1 );
+	}
+	handle_range_io_handle->current_offset += (off64_t) read_count;
+
+	return( read_count );
+}
+
+/* Reads a buffer at a specific offset from the handle range IO handle
+ * The offset is relative to the start of the range
+ * The data is read using the read at offset function of the parent handle if available
+ * This function does not change the current offset of the handle range IO handle
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libbfio_handle_range_io_handle_read_buffer_at_offset(
+         libbfio_handle_range_io_handle_t *handle_range_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libbfio_handle_range_io_handle_read_buffer_at_offset";
+	ssize_t read_count    = 0;
+
+	if( handle_range_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle range IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( handle_range_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle range IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( handle_range_io_handle->access_flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle range IO handle - no read access.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) offset >= handle_range_io_handle->size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) size > ( handle_range_io_handle->size - (size64_t) offset ) )
+	{
+		size = (size_t) ( handle_range_io_handle->size - (size64_t) offset );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle_range_io_handle->parent_handle,
+	              buffer,
+	              size,
+	              handle_range_io_handle->range_offset + offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ") from parent handle.",
+		 function,
+		 handle_range_io_handle->range_offset + offset,
+		 handle_range_io_handle->range_offset + offset );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Writes a buffer to the handle range IO handle
+ * Returns the number of bytes written if successful, or -1 on error
+ */
+ssize_t libbfio_handle_range_io_handle_write_buffer(
+         libbfio_handle_range_io_handle_t *handle_range_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function = "libbfio_handle_range_io_handle_write_buffer";
+	ssize_t write_count   = 0;
+
+	if( handle_range_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle range IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	write_count = libbfio_handle_range_io_handle_write_buffer_at_offset(
+	               handle_range_io_handle,
+	               buffer,
+	               size,
+	               handle_range_io_handle->current_offset,
+	               error );
+
+	if( write_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write buffer.",
+		 function );
+
+		return( -1 );
+	}
+	handle_range_io_handle->current_offset += (off64_t) write_count;
+
+	return( write_count );
+}
+
+/* Writes a buffer at a specific offset to the handle range IO handle
+ * The offset is relative to the start of the range
+ * The data is not written beyond the end of the range
+ * This function does not change the current offset of the handle range IO handle
+ * Returns the number of bytes written if successful, or -1 on error
+ */
+ssize_t libbfio_handle_range_io_handle_write_buffer_at_offset(
+         libbfio_handle_range_io_handle_t *handle_range_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libbfio_handle_range_io_handle_write_buffer_at_offset";
+	ssize_t write_count   = 0;
+
+	if( handle_range_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle range IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( handle_range_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle range IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( handle_range_io_handle->access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle range IO handle - no write access.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) offset >= handle_range_io_handle->size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) size > ( handle_range_io_handle->size - (size64_t) offset ) )
+	{
+		size = (size_t) ( handle_range_io_handle->size - (size64_t) offset );
+	}
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               handle_range_io_handle->parent_handle,
+	               buffer,
+	               size,
+	               handle_range_io_handle->range_offset + offset,
+	               error );
+
+	if( write_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write buffer at offset: %" PRIi64 " (0x%08" PRIx64 ") to parent handle.",
+		 function,
+		 handle_range_io_handle->range_offset + offset,
+		 handle_range_io_handle->range_offset + offset );
+
+		return( -1 );
+	}
+	return( write_count );
+}
+
+/* Seeks a certain offset within the handle range IO handle
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t libbfio_handle_range_io_handle_seek_offset(
+         libbfio_handle_range_io_handle_t *handle_range_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libbfio_handle_range_io_handle_seek_offset";
+
+	if( handle_range_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle range IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( handle_range_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle range IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += handle_range_io_handle->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) handle_range_io_handle->size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset.",
+		 function );
+
+		return( -1 );
+	}
+	handle_range_io_handle->current_offset = offset;
+
+	return( offset );
+}
+
+/* Function to determine if the parent handle exists
+ * Returns 1 if the parent handle exists, 0 if not or -1 on error
+ */
+int libbfio_handle_range_io_handle_exists(
+     libbfio_handle_range_io_handle_t *handle_range_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_handle_range_io_handle_exists";
+	int result            = 0;
+
+	if( handle_range_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle range IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libbfio_handle_exists(
+	          handle_range_io_handle->parent_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if parent handle exists.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Check if the handle range IO handle is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int libbfio_handle_range_io_handle_is_open(
+     libbfio_handle_range_io_handle_t *handle_range_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_handle_range_io_handle_is_open";
+
+	if( handle_range_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle range IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( handle_range_io_handle->is_open == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the range
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_range_io_handle_get_size(
+     libbfio_handle_range_io_handle_t *handle_range_io_handle,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_handle_range_io_handle_get_size";
+
+	if( handle_range_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle range IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( handle_range_io_handle->is_open != 0 )
+	{
+		*size = handle_range_io_handle->size;
+	}
+	else if( handle_range_io_handle->range_size != 0 )
+	{
+		*size = handle_range_io_handle->range_size;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle range IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,1609 @@
+/*
+ * The IO queue functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libbfio_definitions.h"
+#include "libbfio_handle.h"
+#include "libbfio_io_queue.h"
+#include "libbfio_io_request.h"
+#include "libbfio_io_uring.h"
+#include "libbfio_libcerror.h"
+#include "libbfio_libcthreads.h"
+#include "libbfio_types.h"
+
+/* Creates an IO queue
+ * The IO queue processes submitted requests asynchronously using a pool of
+ * number of threads, at most maximum number of requests are queued for processing
+ * If io_uring is supported, requests on handles with a system file descriptor are
+ * submitted to an io_uring of at least 64 entries instead
+ * Make sure the value io_queue is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_io_queue_initialize(
+     libbfio_io_queue_t **io_queue,
+     int number_of_threads,
+     int maximum_number_of_requests,
+     libcerror_error_t **error )
+{
+	libbfio_internal_io_queue_t *internal_io_queue = NULL;
+	static char *function                          = "libbfio_io_queue_initialize";
+
+#if defined( LIBBFIO_IO_QUEUE_HAVE_IO_URING )
+	libcerror_error_t *io_uring_error              = NULL;
+	int number_of_io_uring_entries                 = 0;
+#endif
+
+	if( io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_queue != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO queue value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of threads value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_requests <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of requests value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	internal_io_queue = memory_allocate_structure(
+	                     libbfio_internal_io_queue_t );
+
+	if( internal_io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create IO queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_io_queue,
+	     0,
+	     sizeof( libbfio_internal_io_queue_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear IO queue.",
+		 function );
+
+		memory_free(
+		 internal_io_queue );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_initialize(
+	     &( internal_io_queue->completion_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize completion mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( internal_io_queue->completion_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize completion condition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_thread_pool_create(
+	     &( internal_io_queue->thread_pool ),
+	     NULL,
+	     number_of_threads,
+	     maximum_number_of_requests,
+	     (int (*)(intptr_t *, void *)) &libbfio_internal_io_queue_process_request,
+	     (void *) internal_io_queue,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+#if defined( LIBBFIO_IO_QUEUE_HAVE_IO_URING )
+	if( libcthreads_mutex_initialize(
+	     &( internal_io_queue->io_uring_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize io_uring mutex.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_io_uring_entries = maximum_number_of_requests;
+
+	if( number_of_io_uring_entries < LIBBFIO_IO_QUEUE_MINIMUM_NUMBER_OF_IO_URING_ENTRIES )
+	{
+		number_of_io_uring_entries = LIBBFIO_IO_QUEUE_MINIMUM_NUMBER_OF_IO_URING_ENTRIES;
+	}
+	else if( number_of_io_uring_entries > LIBBFIO_IO_QUEUE_MAXIMUM_NUMBER_OF_IO_URING_ENTRIES )
+	{
+		number_of_io_uring_entries = LIBBFIO_IO_QUEUE_MAXIMUM_NUMBER_OF_IO_URING_ENTRIES;
+	}
+	/* The io_uring is not available before Linux 5.1 or if it was disabled,
+	 * in which case all requests are processed by the thread pool
+	 */
+	if( libbfio_io_uring_initialize(
+	     &( internal_io_queue->io_uring ),
+	     (uint32_t) number_of_io_uring_entries,
+	     &io_uring_error ) != 1 )
+	{
+		libcerror_error_free(
+		 &io_uring_error );
+	}
+	else if( libcthreads_thread_create(
+	          &( internal_io_queue->io_uring_completion_thread ),
+	          NULL,
+	          (int (*)(void *)) &libbfio_internal_io_queue_complete_io_uring_requests,
+	          (void *) internal_io_queue,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create io_uring completion thread.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	*io_queue = (libbfio_io_queue_t *) internal_io_queue;
+
+	return( 1 );
+
+on_error:
+	if( internal_io_queue != NULL )
+	{
+#if defined( LIBBFIO_IO_QUEUE_HAVE_IO_URING )
+		if( internal_io_queue->io_uring != NULL )
+		{
+			libbfio_io_uring_free(
+			 &( internal_io_queue->io_uring ),
+			 NULL );
+		}
+		if( internal_io_queue->io_uring_mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( internal_io_queue->io_uring_mutex ),
+			 NULL );
+		}
+#endif
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+		if( internal_io_queue->thread_pool != NULL )
+		{
+			libcthreads_thread_pool_join(
+			 &( internal_io_queue->thread_pool ),
+			 NULL );
+		}
+		if( internal_io_queue->completion_condition != NULL )
+		{
+			libcthreads_condition_free(
+			 &( internal_io_queue->completion_condition ),
+			 NULL );
+		}
+		if( internal_io_queue->completion_mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( internal_io_queue->completion_mutex ),
+			 NULL );
+		}
+#endif
+		memory_free(
+		 internal_io_queue );
+	}
+	return( -1 );
+}
+
+/* Frees an IO queue
+ * Waits until all submitted requests have been processed
+ * Requests that were completed but not retrieved are discarded
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_io_queue_free(
+     libbfio_io_queue_t **io_queue,
+     libcerror_error_t **error )
+{
+	libbfio_internal_io_queue_t *internal_io_queue = NULL;
+	libbfio_io_request_t *io_request               = NULL;
+	static char *function                          = "libbfio_io_queue_free";
+	int result                                     = 1;
+
+	if( io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_queue != NULL )
+	{
+		internal_io_queue = (libbfio_internal_io_queue_t *) *io_queue;
+		*io_queue         = NULL;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+		if( libcthreads_mutex_grab(
+		     internal_io_queue->completion_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab completion mutex.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			while( internal_io_queue->number_of_pending_requests > 0 )
+			{
+				if( libcthreads_condition_wait(
+				     internal_io_queue->completion_condition,
+				     internal_io_queue->completion_mutex,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to wait for completion condition.",
+					 function );
+
+					result = -1;
+
+					break;
+				}
+			}
+			if( libcthreads_mutex_release(
+			     internal_io_queue->completion_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release completion mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#if defined( LIBBFIO_IO_QUEUE_HAVE_IO_URING )
+		if( internal_io_queue->io_uring_completion_thread != NULL )
+		{
+			if( libbfio_internal_io_queue_stop_io_uring_completion_thread(
+			     internal_io_queue,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to stop io_uring completion thread.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_io_queue->io_uring != NULL )
+		{
+			if( libbfio_io_uring_free(
+			     &( internal_io_queue->io_uring ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free io_uring.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libcthreads_mutex_free(
+		     &( internal_io_queue->io_uring_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free io_uring mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( libcthreads_thread_pool_join(
+		     &( internal_io_queue->thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		while( internal_io_queue->first_completed_request != NULL )
+		{
+			io_request = internal_io_queue->first_completed_request;
+
+			internal_io_queue->first_completed_request = io_request->next_request;
+
+			if( libbfio_io_request_free(
+			     &io_request,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free completed request.",
+				 function );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+		if( libcthreads_condition_free(
+		     &( internal_io_queue->completion_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free completion condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( internal_io_queue->completion_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free completion mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 internal_io_queue );
+	}
+	return( result );
+}
+
+/* Submits an IO request
+ * If multi-threading is supported the request is submitted to the io_uring
+ * or processed by the thread pool, otherwise the request is processed before
+ * this function returns
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_io_queue_submit_request(
+     libbfio_internal_io_queue_t *internal_io_queue,
+     libbfio_io_request_t *io_request,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_internal_io_queue_submit_request";
+	int result            = 1;
+
+	if( internal_io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO request.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     internal_io_queue->completion_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab completion mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_io_queue->number_of_submitted_requests += 1;
+	internal_io_queue->number_of_pending_requests   += 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     internal_io_queue->completion_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release completion mutex.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBBFIO_IO_QUEUE_HAVE_IO_URING )
+	result = libbfio_internal_io_queue_submit_io_uring_request(
+	          internal_io_queue,
+	          io_request,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to submit request to io_uring.",
+		 function );
+	}
+#else
+	result = 0;
+#endif
+	if( result == 0 )
+	{
+		/* The push blocks while the maximum number of requests are queued
+		 */
+		if( libcthreads_thread_pool_push(
+		     internal_io_queue->thread_pool,
+		     (intptr_t *) io_request,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push request onto thread pool queue.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			result = 1;
+		}
+	}
+	if( result != 1 )
+	{
+		if( libcthreads_mutex_grab(
+		     internal_io_queue->completion_mutex,
+		     NULL ) == 1 )
+		{
+			internal_io_queue->number_of_submitted_requests -= 1;
+			internal_io_queue->number_of_pending_requests   -= 1;
+
+			libcthreads_mutex_release(
+			 internal_io_queue->completion_mutex,
+			 NULL );
+		}
+	}
+#else
+	if( libbfio_internal_io_queue_process_request(
+	     io_request,
+	     internal_io_queue ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to process request.",
+		 function );
+
+		internal_io_queue->number_of_submitted_requests -= 1;
+		internal_io_queue->number_of_pending_requests   -= 1;
+
+		result = -1;
+	}
+#endif
+	return( result );
+}
+
+#if defined( LIBBFIO_IO_QUEUE_HAVE_IO_URING )
+
+/* Submits an IO request to the io_uring
+ * The request is only submitted if the handle provides a system file descriptor,
+ * a read is limited to the size of the handle and a write must be within the size
+ * of the handle, since the descriptor of a range handle cannot be extended
+ * Returns 1 if successful, 0 if the request was not submitted or -1 on error
+ */
+int libbfio_internal_io_queue_submit_io_uring_request(
+     libbfio_internal_io_queue_t *internal_io_queue,
+     libbfio_io_request_t *io_request,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	libcerror_error_t *io_uring_error          = NULL;
+	static char *function                      = "libbfio_internal_io_queue_submit_io_uring_request";
+	size64_t handle_size                       = 0;
+	size_t request_size                        = 0;
+	off64_t descriptor_offset                  = 0;
+	uint8_t opcode                             = 0;
+	int descriptor                             = -1;
+	int result                                 = 0;
+
+	if( internal_io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO request.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_io_queue->io_uring == NULL )
+	 || ( io_request->handle == NULL )
+	 || ( io_request->size == 0 ) )
+	{
+		return( 0 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) io_request->handle;
+
+	/* Make sure the size of the handle was determined, if it cannot be determined
+	 * the thread pool reports the error with the completion of the request
+	 */
+	if( libbfio_handle_get_size(
+	     io_request->handle,
+	     &handle_size,
+	     &io_uring_error ) != 1 )
+	{
+		libcerror_error_free(
+		 &io_uring_error );
+
+		return( 0 );
+	}
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	result = libbfio_internal_handle_get_descriptor(
+	          internal_handle,
+	          &descriptor,
+	          &descriptor_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve descriptor.",
+		 function );
+	}
+	else if( result != 0 )
+	{
+		handle_size = internal_handle->size;
+
+		if( ( io_request->offset < 0 )
+		 || ( (size64_t) io_request->offset >= handle_size ) )
+		{
+			result = 0;
+		}
+		else if( io_request->type == LIBBFIO_IO_REQUEST_TYPE_READ )
+		{
+			request_size = io_request->size;
+
+			if( (size64_t) request_size > ( handle_size - io_request->offset ) )
+			{
+				request_size = (size_t) ( handle_size - io_request->offset );
+			}
+			opcode = IORING_OP_READV;
+		}
+		else if( io_request->type == LIBBFIO_IO_REQUEST_TYPE_WRITE )
+		{
+			if( (size64_t) io_request->size > ( handle_size - io_request->offset ) )
+			{
+				result = 0;
+			}
+			request_size = io_request->size;
+			opcode       = IORING_OP_WRITEV;
+		}
+		else
+		{
+			result = 0;
+		}
+	}
+	if( result == 1 )
+	{
+		io_request->vector.iov_base = (void *) io_request->buffer;
+		io_request->vector.iov_len  = request_size;
+
+		if( libcthreads_mutex_grab(
+		     internal_io_queue->io_uring_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab io_uring mutex.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			/* The number of requests in flight is limited to the number of entries,
+			 * so that the completion queue cannot overflow
+			 */
+			if( internal_io_queue->number_of_io_uring_requests >= (int) internal_io_queue->io_uring->number_of_entries )
+			{
+				result = 0;
+			}
+			else if( libbfio_io_uring_submit(
+			          internal_io_queue->io_uring,
+			          opcode,
+			          descriptor,
+			          &( io_request->vector ),
+			          descriptor_offset + io_request->offset,
+			          (uint64_t) (intptr_t) io_request,
+			          &io_uring_error ) != 1 )
+			{
+				/* The request is processed by the thread pool instead
+				 */
+				libcerror_error_free(
+				 &io_uring_error );
+
+				result = 0;
+			}
+			else
+			{
+				internal_io_queue->number_of_io_uring_requests += 1;
+			}
+			if( libcthreads_mutex_release(
+			     internal_io_queue->io_uring_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release io_uring mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the io_uring completions and appends the requests to the completed requests
+ * A request that failed is completed with an IO count of -1
+ * This function is used as the io_uring completion thread callback function and
+ * returns when it retrieves a completion without a request
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_io_queue_complete_io_uring_requests(
+     libbfio_internal_io_queue_t *internal_io_queue )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	libbfio_io_request_t *io_request           = NULL;
+	libcerror_error_t *error                   = NULL;
+	uint64_t user_data                         = 0;
+	int32_t completion_result                  = 0;
+
+	if( internal_io_queue == NULL )
+	{
+		return( -1 );
+	}
+	for( ;; )
+	{
+		if( libbfio_io_uring_wait_completion(
+		     internal_io_queue->io_uring,
+		     &user_data,
+		     &completion_result,
+		     &error ) != 1 )
+		{
+			libcerror_error_free(
+			 &error );
+
+			return( -1 );
+		}
+		if( user_data == LIBBFIO_IO_URING_USER_DATA_NONE )
+		{
+			break;
+		}
+		io_request = (libbfio_io_request_t *) (intptr_t) user_data;
+
+		if( libcthreads_mutex_grab(
+		     internal_io_queue->io_uring_mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_free(
+			 &error );
+
+			return( -1 );
+		}
+		internal_io_queue->number_of_io_uring_requests -= 1;
+
+		if( libcthreads_mutex_release(
+		     internal_io_queue->io_uring_mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_free(
+			 &error );
+
+			return( -1 );
+		}
+		if( completion_result < 0 )
+		{
+			io_request->io_count = -1;
+		}
+		else
+		{
+			io_request->io_count = (ssize_t) completion_result;
+		}
+		/* The data written bypassed the handle, hence the size, the readahead buffer
+		 * and the prefetcher are updated as by libbfio_handle_write_buffer_at_offset
+		 */
+		if( ( io_request->type == LIBBFIO_IO_REQUEST_TYPE_WRITE )
+		 && ( io_request->io_count > 0 ) )
+		{
+			internal_handle = (libbfio_internal_handle_t *) io_request->handle;
+
+			if( libcthreads_read_write_lock_grab_for_write(
+			     internal_handle->read_write_lock,
+			     &error ) != 1 )
+			{
+				libcerror_error_free(
+				 &error );
+
+				io_request->io_count = -1;
+			}
+			else
+			{
+				if( libbfio_internal_handle_update_written_range(
+				     internal_handle,
+				     io_request->offset,
+				     (size64_t) io_request->io_count,
+				     &error ) != 1 )
+				{
+					libcerror_error_free(
+					 &error );
+
+					io_request->io_count = -1;
+				}
+				if( libcthreads_read_write_lock_release_for_write(
+				     internal_handle->read_write_lock,
+				     &error ) != 1 )
+				{
+					libcerror_error_free(
+					 &error );
+
+					io_request->io_count = -1;
+				}
+			}
+		}
+		if( libbfio_internal_io_queue_append_completed_request(
+		     internal_io_queue,
+		     io_request,
+		     &error ) != 1 )
+		{
+			libcerror_error_free(
+			 &error );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Stops the io_uring completion thread
+ * A no-operation without a request is submitted, after which the thread is joined
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_io_queue_stop_io_uring_completion_thread(
+     libbfio_internal_io_queue_t *internal_io_queue,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_internal_io_queue_stop_io_uring_completion_thread";
+	int result            = 1;
+
+	if( internal_io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     internal_io_queue->io_uring_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab io_uring mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_io_uring_submit(
+	     internal_io_queue->io_uring,
+	     IORING_OP_NOP,
+	     -1,
+	     NULL,
+	     0,
+	     LIBBFIO_IO_URING_USER_DATA_NONE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to submit no-operation to io_uring.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     internal_io_queue->io_uring_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release io_uring mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( result != 1 )
+	{
+		return( -1 );
+	}
+	if( libcthreads_thread_join(
+	     &( internal_io_queue->io_uring_completion_thread ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join io_uring completion thread.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( LIBBFIO_IO_QUEUE_HAVE_IO_URING ) */
+
+/* Processes an IO request and appends it to the completed requests
+ * A request that failed is completed with an IO count of -1
+ * This function is used as the thread pool callback function
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_io_queue_process_request(
+     libbfio_io_request_t *io_request,
+     libbfio_internal_io_queue_t *internal_io_queue )
+{
+	libcerror_error_t *error = NULL;
+
+	if( io_request == NULL )
+	{
+		return( -1 );
+	}
+	if( internal_io_queue == NULL )
+	{
+		return( -1 );
+	}
+	if( libbfio_io_request_process(
+	     io_request,
+	     &error ) != 1 )
+	{
+		/* The error is reported to the caller by the IO count of the completed request
+		 */
+		libcerror_error_free(
+		 &error );
+	}
+	if( libbfio_internal_io_queue_append_completed_request(
+	     internal_io_queue,
+	     io_request,
+	     &error ) != 1 )
+	{
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a processed IO request to the completed requests
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_io_queue_append_completed_request(
+     libbfio_internal_io_queue_t *internal_io_queue,
+     libbfio_io_request_t *io_request,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_internal_io_queue_append_completed_request";
+	int result            = 1;
+
+	if( internal_io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO request.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     internal_io_queue->completion_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab completion mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	io_request->next_request = NULL;
+
+	if( internal_io_queue->last_completed_request == NULL )
+	{
+		internal_io_queue->first_completed_request = io_request;
+	}
+	else
+	{
+		internal_io_queue->last_completed_request->next_request = io_request;
+	}
+	internal_io_queue->last_completed_request = io_request;
+
+	internal_io_queue->number_of_pending_requests -= 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_condition_broadcast(
+	     internal_io_queue->completion_condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast completion condition.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     internal_io_queue->completion_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release completion mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Submits a request to read data at a specific offset into the buffer
+ * The handle and buffer must remain valid until the completion of the request
+ * has been retrieved, the request data is returned with the completion
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_io_queue_submit_read_buffer_at_offset(
+     libbfio_io_queue_t *io_queue,
+     libbfio_handle_t *handle,
+     uint8_t *buffer,
+     size_t size,
+     off64_t offset,
+     intptr_t *request_data,
+     libcerror_error_t **error )
+{
+	libbfio_io_request_t *io_request = NULL;
+	static char *function            = "libbfio_io_queue_submit_read_buffer_at_offset";
+
+	if( io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_io_request_initialize(
+	     &io_request,
+	     LIBBFIO_IO_REQUEST_TYPE_READ,
+	     handle,
+	     buffer,
+	     size,
+	     offset,
+	     request_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read request.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_internal_io_queue_submit_request(
+	     (libbfio_internal_io_queue_t *) io_queue,
+	     io_request,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to submit read request.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( io_request != NULL )
+	{
+		libbfio_io_request_free(
+		 &io_request,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Submits a request to write data at a specific offset from the buffer
+ * The handle and buffer must remain valid until the completion of the request
+ * has been retrieved, the request data is returned with the completion
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_io_queue_submit_write_buffer_at_offset(
+     libbfio_io_queue_t *io_queue,
+     libbfio_handle_t *handle,
+     const uint8_t *buffer,
+     size_t size,
+     off64_t offset,
+     intptr_t *request_data,
+     libcerror_error_t **error )
+{
+	libbfio_io_request_t *io_request = NULL;
+	static char *function            = "libbfio_io_queue_submit_write_buffer_at_offset";
+
+	if( io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_io_request_initialize(
+	     &io_request,
+	     LIBBFIO_IO_REQUEST_TYPE_WRITE,
+	     handle,
+	     (uint8_t *) buffer,
+	     size,
+	     offset,
+	     request_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create write request.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_internal_io_queue_submit_request(
+	     (libbfio_internal_io_queue_t *) io_queue,
+	     io_request,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to submit write request.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( io_request != NULL )
+	{
+		libbfio_io_request_free(
+		 &io_request,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the completion of a submitted request
+ * Completions are retrieved in the order the requests completed
+ * If wait for completion is set, waits until a submitted request has completed
+ * Returns 1 if successful, 0 if no completion is available or -1 on error
+ */
+int libbfio_internal_io_queue_get_completion(
+     libbfio_internal_io_queue_t *internal_io_queue,
+     intptr_t **request_data,
+     ssize_t *io_count,
+     uint8_t wait_for_completion,
+     libcerror_error_t **error )
+{
+	libbfio_io_request_t *io_request = NULL;
+	static char *function            = "libbfio_internal_io_queue_get_completion";
+	int result                       = 0;
+
+	if( internal_io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( request_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid request data.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_count == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO count.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     internal_io_queue->completion_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab completion mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( wait_for_completion != 0 )
+	{
+		while( ( internal_io_queue->first_completed_request == NULL )
+		    && ( internal_io_queue->number_of_submitted_requests > 0 ) )
+		{
+			if( libcthreads_condition_wait(
+			     internal_io_queue->completion_condition,
+			     internal_io_queue->completion_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to wait for completion condition.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+		}
+	}
+#endif
+	if( ( result == 0 )
+	 && ( internal_io_queue->first_completed_request != NULL ) )
+	{
+		io_request = internal_io_queue->first_completed_request;
+
+		internal_io_queue->first_completed_request = io_request->next_request;
+
+		if( internal_io_queue->first_completed_request == NULL )
+		{
+			internal_io_queue->last_completed_request = NULL;
+		}
+		internal_io_queue->number_of_submitted_requests -= 1;
+
+		result = 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     internal_io_queue->completion_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release completion mutex.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	if( io_request != NULL )
+	{
+		*request_data = io_request->request_data;
+		*io_count     = io_request->io_count;
+
+		if( libbfio_io_request_free(
+		     &io_request,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free completed request.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the completion of a submitted request
+ * Waits until a submitted request has completed
+ * The IO count contains the number of bytes read or written or -1 if the request failed
+ * Returns 1 if successful, 0 if there are no submitted requests or -1 on error
+ */
+int libbfio_io_queue_get_completion(
+     libbfio_io_queue_t *io_queue,
+     intptr_t **request_data,
+     ssize_t *io_count,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_io_queue_get_completion";
+	int result            = 0;
+
+	if( io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO queue.",
+		 function );
+
+		return( -1 );
+	}
+	result = libbfio_internal_io_queue_get_completion(
+	          (libbfio_internal_io_queue_t *) io_queue,
+	          request_data,
+	          io_count,
+	          1,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve completion.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the completion of a submitted request without waiting
+ * The IO count contains the number of bytes read or written or -1 if the request failed
+ * Returns 1 if successful, 0 if no submitted request has completed or -1 on error
+ */
+int libbfio_io_queue_poll_completion(
+     libbfio_io_queue_t *io_queue,
+     intptr_t **request_data,
+     ssize_t *io_count,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_io_queue_poll_completion";
+	int result            = 0;
+
+	if( io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO queue.",
+		 function );
+
+		return( -1 );
+	}
+	result = libbfio_internal_io_queue_get_completion(
+	          (libbfio_internal_io_queue_t *) io_queue,
+	          request_data,
+	          io_count,
+	          0,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve completion.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the number of submitted requests
+ * This includes the requests that have completed but of which the completion was not retrieved
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_io_queue_get_number_of_submitted_requests(
+     libbfio_io_queue_t *io_queue,
+     int *number_of_submitted_requests,
+     libcerror_error_t **error )
+{
+	libbfio_internal_io_queue_t *internal_io_queue = NULL;
+	static char *function                          = "libbfio_io_queue_get_number_of_submitted_requests";
+
+	if( io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO queue.",
+		 function );
+
+		return( -1 );
+	}
+	internal_io_queue = (libbfio_internal_io_queue_t *) io_queue;
+
+	if( number_of_submitted_requests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of submitted requests.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     internal_io_queue->completion_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab completion mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_submitted_requests = internal_io_queue->number_of_submitted_requests;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     internal_io_queue->completion_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release completion mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
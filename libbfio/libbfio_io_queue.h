@@ -0,0 +1,200 @@
+/*
+ * The IO queue functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBBFIO_IO_QUEUE_H )
+#define _LIBBFIO_IO_QUEUE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libbfio_extern.h"
+#include "libbfio_io_request.h"
+#include "libbfio_io_uring.h"
+#include "libbfio_libcerror.h"
+#include "libbfio_libcthreads.h"
+#include "libbfio_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The io_uring is only used if the thread pool is available as fallback
+ */
+#if defined( LIBBFIO_HAVE_IO_URING ) && defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+#define LIBBFIO_IO_QUEUE_HAVE_IO_URING		1
+#endif
+
+/* The minimum number of io_uring entries
+ */
+#define LIBBFIO_IO_QUEUE_MINIMUM_NUMBER_OF_IO_URING_ENTRIES	64
+
+/* The maximum number of io_uring entries
+ */
+#define LIBBFIO_IO_QUEUE_MAXIMUM_NUMBER_OF_IO_URING_ENTRIES	4096
+
+typedef struct libbfio_internal_io_queue libbfio_internal_io_queue_t;
+
+struct libbfio_internal_io_queue
+{
+	/* The number of requests that were submitted and not yet retrieved
+	 */
+	int number_of_submitted_requests;
+
+	/* The number of requests that were submitted and not yet completed
+	 */
+	int number_of_pending_requests;
+
+	/* The first completed request
+	 */
+	libbfio_io_request_t *first_completed_request;
+
+	/* The last completed request
+	 */
+	libbfio_io_request_t *last_completed_request;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	/* The thread pool that processes the submitted requests
+	 */
+	libcthreads_thread_pool_t *thread_pool;
+
+	/* The mutex that protects the completed requests and the number of requests
+	 */
+	libcthreads_mutex_t *completion_mutex;
+
+	/* The condition that is signalled when a request has completed
+	 */
+	libcthreads_condition_t *completion_condition;
+#endif
+
+#if defined( LIBBFIO_IO_QUEUE_HAVE_IO_URING )
+	/* The io_uring that processes the requests on handles with a system file descriptor
+	 */
+	libbfio_io_uring_t *io_uring;
+
+	/* The mutex that serializes the io_uring submissions and protects the number of io_uring requests
+	 */
+	libcthreads_mutex_t *io_uring_mutex;
+
+	/* The thread that retrieves the io_uring completions
+	 */
+	libcthreads_thread_t *io_uring_completion_thread;
+
+	/* The number of requests submitted to the io_uring and not yet completed
+	 */
+	int number_of_io_uring_requests;
+#endif
+};
+
+LIBBFIO_EXTERN \
+int libbfio_io_queue_initialize(
+     libbfio_io_queue_t **io_queue,
+     int number_of_threads,
+     int maximum_number_of_requests,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_io_queue_free(
+     libbfio_io_queue_t **io_queue,
+     libcerror_error_t **error );
+
+int libbfio_internal_io_queue_submit_request(
+     libbfio_internal_io_queue_t *internal_io_queue,
+     libbfio_io_request_t *io_request,
+     libcerror_error_t **error );
+
+#if defined( LIBBFIO_IO_QUEUE_HAVE_IO_URING )
+
+int libbfio_internal_io_queue_submit_io_uring_request(
+     libbfio_internal_io_queue_t *internal_io_queue,
+     libbfio_io_request_t *io_request,
+     libcerror_error_t **error );
+
+int libbfio_internal_io_queue_complete_io_uring_requests(
+     libbfio_internal_io_queue_t *internal_io_queue );
+
+int libbfio_internal_io_queue_stop_io_uring_completion_thread(
+     libbfio_internal_io_queue_t *internal_io_queue,
+     libcerror_error_t **error );
+
+#endif /* defined( LIBBFIO_IO_QUEUE_HAVE_IO_URING ) */
+
+int libbfio_internal_io_queue_process_request(
+     libbfio_io_request_t *io_request,
+     libbfio_internal_io_queue_t *internal_io_queue );
+
+int libbfio_internal_io_queue_append_completed_request(
+     libbfio_internal_io_queue_t *internal_io_queue,
+     libbfio_io_request_t *io_request,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_io_queue_submit_read_buffer_at_offset(
+     libbfio_io_queue_t *io_queue,
+     libbfio_handle_t *handle,
+     uint8_t *buffer,
+     size_t size,
+     off64_t offset,
+     intptr_t *request_data,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_io_queue_submit_write_buffer_at_offset(
+     libbfio_io_queue_t *io_queue,
+     libbfio_handle_t *handle,
+     const uint8_t *buffer,
+     size_t size,
+     off64_t offset,
+     intptr_t *request_data,
+     libcerror_error_t **error );
+
+int libbfio_internal_io_queue_get_completion(
+     libbfio_internal_io_queue_t *internal_io_queue,
+     intptr_t **request_data,
+     ssize_t *io_count,
+     uint8_t wait_for_completion,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_io_queue_get_completion(
+     libbfio_io_queue_t *io_queue,
+     intptr_t **request_data,
+     ssize_t *io_count,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_io_queue_poll_completion(
+     libbfio_io_queue_t *io_queue,
+     intptr_t **request_data,
+     ssize_t *io_count,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_io_queue_get_number_of_submitted_requests(
+     libbfio_io_queue_t *io_queue,
+     int *number_of_submitted_requests,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBBFIO_IO_QUEUE_H ) */
+
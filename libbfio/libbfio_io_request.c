@@ -0,0 +1,293 @@
+/*
+ * The IO request functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libbfio_definitions.h"
+#include "libbfio_handle.h"
+#include "libbfio_io_request.h"
+#include "libbfio_libcerror.h"
+#include "libbfio_types.h"
+
+/* Creates an IO request
+ * Make sure the value io_request is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_io_request_initialize(
+     libbfio_io_request_t **io_request,
+     uint8_t type,
+     libbfio_handle_t *handle,
+     uint8_t *buffer,
+     size_t size,
+     off64_t offset,
+     intptr_t *request_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_io_request_initialize";
+
+	if( io_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO request.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_request != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO request value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( type != LIBBFIO_IO_REQUEST_TYPE_READ )
+	 && ( type != LIBBFIO_IO_REQUEST_TYPE_WRITE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported type.",
+		 function );
+
+		return( -1 );
+	}
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*io_request = memory_allocate_structure(
+	               libbfio_io_request_t );
+
+	if( *io_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create IO request.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *io_request,
+	     0,
+	     sizeof( libbfio_io_request_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear IO request.",
+		 function );
+
+		goto on_error;
+	}
+	( *io_request )->type         = type;
+	( *io_request )->handle       = handle;
+	( *io_request )->buffer       = buffer;
+	( *io_request )->size         = size;
+	( *io_request )->offset       = offset;
+	( *io_request )->request_data = request_data;
+
+	return( 1 );
+
+on_error:
+	if( *io_request != NULL )
+	{
+		memory_free(
+		 *io_request );
+
+		*io_request = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an IO request
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_io_request_free(
+     libbfio_io_request_t **io_request,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_io_request_free";
+
+	if( io_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO request.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_request != NULL )
+	{
+		/* The handle, buffer and request data are not managed by the IO request
+		 */
+		memory_free(
+		 *io_request );
+
+		*io_request = NULL;
+	}
+	return( 1 );
+}
+
+/* Processes an IO request
+ * Reads or writes the buffer at the offset of the request and
+ * sets the IO count to the number of bytes read or written
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_io_request_process(
+     libbfio_io_request_t *io_request,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_io_request_process";
+
+	if( io_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO request.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_request->type == LIBBFIO_IO_REQUEST_TYPE_READ )
+	{
+		io_request->io_count = libbfio_handle_read_buffer_at_offset(
+		                        io_request->handle,
+		                        io_request->buffer,
+		                        io_request->size,
+		                        io_request->offset,
+		                        error );
+
+		if( io_request->io_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 io_request->offset,
+			 io_request->offset );
+
+			io_request->io_count = -1;
+
+			return( -1 );
+		}
+	}
+	else if( io_request->type == LIBBFIO_IO_REQUEST_TYPE_WRITE )
+	{
+		io_request->io_count = libbfio_handle_write_buffer_at_offset(
+		                        io_request->handle,
+		                        (const uint8_t *) io_request->buffer,
+		                        io_request->size,
+		                        io_request->offset,
+		                        error );
+
+		if( io_request->io_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 io_request->offset,
+			 io_request->offset );
+
+			io_request->io_count = -1;
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid IO request - unsupported type.",
+		 function );
+
+		io_request->io_count = -1;
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
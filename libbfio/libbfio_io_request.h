@@ -0,0 +1,102 @@
+/*
+ * The IO request functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBBFIO_IO_REQUEST_H )
+#define _LIBBFIO_IO_REQUEST_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libbfio_io_uring.h"
+#include "libbfio_libcerror.h"
+#include "libbfio_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libbfio_io_request libbfio_io_request_t;
+
+struct libbfio_io_request
+{
+	/* The request type
+	 */
+	uint8_t type;
+
+	/* The handle
+	 */
+	libbfio_handle_t *handle;
+
+	/* The buffer
+	 */
+	uint8_t *buffer;
+
+	/* The size
+	 */
+	size_t size;
+
+	/* The offset
+	 */
+	off64_t offset;
+
+	/* The request data
+	 */
+	intptr_t *request_data;
+
+	/* The number of bytes read or written or -1 on error
+	 */
+	ssize_t io_count;
+
+	/* The next request in the completed requests list
+	 */
+	libbfio_io_request_t *next_request;
+
+#if defined( LIBBFIO_HAVE_IO_URING )
+	/* The IO vector of a request submitted to the io_uring
+	 */
+	struct iovec vector;
+#endif
+};
+
+int libbfio_io_request_initialize(
+     libbfio_io_request_t **io_request,
+     uint8_t type,
+     libbfio_handle_t *handle,
+     uint8_t *buffer,
+     size_t size,
+     off64_t offset,
+     intptr_t *request_data,
+     libcerror_error_t **error );
+
+int libbfio_io_request_free(
+     libbfio_io_request_t **io_request,
+     libcerror_error_t **error );
+
+int libbfio_io_request_process(
+     libbfio_io_request_t *io_request,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBBFIO_IO_REQUEST_H ) */
+
@@ -0,0 +1,624 @@
+/*
+ * The io_uring functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libbfio_io_uring.h"
+
+#if defined( LIBBFIO_HAVE_IO_URING )
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libbfio_libcerror.h"
+
+/* The maximum number of entries supported by the kernel
+ */
+#define LIBBFIO_IO_URING_MAXIMUM_NUMBER_OF_ENTRIES	32768
+
+/* Creates an io_uring
+ * The ring is set up with the io_uring_setup system call and its submission
+ * and completion queues are memory-mapped
+ * Make sure the value io_uring is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_io_uring_initialize(
+     libbfio_io_uring_t **io_uring,
+     uint32_t number_of_entries,
+     libcerror_error_t **error )
+{
+	struct io_uring_params parameters;
+
+	libbfio_io_uring_t *safe_io_uring = NULL;
+	static char *function             = "libbfio_io_uring_initialize";
+	void *mapped_data                 = NULL;
+
+	if( io_uring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid io_uring.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_uring != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid io_uring value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries == 0 )
+	 || ( number_of_entries > LIBBFIO_IO_URING_MAXIMUM_NUMBER_OF_ENTRIES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_io_uring = memory_allocate_structure(
+	                 libbfio_io_uring_t );
+
+	if( safe_io_uring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create io_uring.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     safe_io_uring,
+	     0,
+	     sizeof( libbfio_io_uring_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear io_uring.",
+		 function );
+
+		memory_free(
+		 safe_io_uring );
+
+		return( -1 );
+	}
+	safe_io_uring->descriptor = -1;
+
+	if( memory_set(
+	     &parameters,
+	     0,
+	     sizeof( struct io_uring_params ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear parameters.",
+		 function );
+
+		goto on_error;
+	}
+	safe_io_uring->descriptor = (int) syscall(
+	                                   __NR_io_uring_setup,
+	                                   number_of_entries,
+	                                   &parameters );
+
+	if( safe_io_uring->descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to set up io_uring.",
+		 function );
+
+		goto on_error;
+	}
+	/* The kernel rounds the number of entries up to a power of 2
+	 */
+	safe_io_uring->number_of_entries    = parameters.sq_entries;
+	safe_io_uring->submission_ring_size = (size_t) parameters.sq_off.array + ( parameters.sq_entries * sizeof( uint32_t ) );
+	safe_io_uring->completion_ring_size = (size_t) parameters.cq_off.cqes + ( parameters.cq_entries * sizeof( struct io_uring_cqe ) );
+
+#if defined( IORING_FEAT_SINGLE_MMAP )
+	/* Since Linux 5.4 the submission and completion queue rings are mapped at once
+	 */
+	if( ( parameters.features & IORING_FEAT_SINGLE_MMAP ) != 0 )
+	{
+		if( safe_io_uring->completion_ring_size > safe_io_uring->submission_ring_size )
+		{
+			safe_io_uring->submission_ring_size = safe_io_uring->completion_ring_size;
+		}
+		safe_io_uring->completion_ring_size = 0;
+	}
+#endif
+	mapped_data = mmap(
+	               NULL,
+	               safe_io_uring->submission_ring_size,
+	               PROT_READ | PROT_WRITE,
+	               MAP_SHARED,
+	               safe_io_uring->descriptor,
+	               (off_t) IORING_OFF_SQ_RING );
+
+	if( mapped_data == MAP_FAILED )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 errno,
+		 "%s: unable to map submission queue ring.",
+		 function );
+
+		goto on_error;
+	}
+	safe_io_uring->submission_ring = (uint8_t *) mapped_data;
+
+	if( safe_io_uring->completion_ring_size == 0 )
+	{
+		safe_io_uring->completion_ring = safe_io_uring->submission_ring;
+	}
+	else
+	{
+		mapped_data = mmap(
+		               NULL,
+		               safe_io_uring->completion_ring_size,
+		               PROT_READ | PROT_WRITE,
+		               MAP_SHARED,
+		               safe_io_uring->descriptor,
+		               (off_t) IORING_OFF_CQ_RING );
+
+		if( mapped_data == MAP_FAILED )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 errno,
+			 "%s: unable to map completion queue ring.",
+			 function );
+
+			goto on_error;
+		}
+		safe_io_uring->completion_ring = (uint8_t *) mapped_data;
+	}
+	safe_io_uring->submission_entries_size = parameters.sq_entries * sizeof( struct io_uring_sqe );
+
+	mapped_data = mmap(
+	               NULL,
+	               safe_io_uring->submission_entries_size,
+	               PROT_READ | PROT_WRITE,
+	               MAP_SHARED,
+	               safe_io_uring->descriptor,
+	               (off_t) IORING_OFF_SQES );
+
+	if( mapped_data == MAP_FAILED )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 errno,
+		 "%s: unable to map submission queue entries.",
+		 function );
+
+		goto on_error;
+	}
+	safe_io_uring->submission_entries = (struct io_uring_sqe *) mapped_data;
+
+	safe_io_uring->submission_head      = (uint32_t *) &( safe_io_uring->submission_ring[ parameters.sq_off.head ] );
+	safe_io_uring->submission_tail      = (uint32_t *) &( safe_io_uring->submission_ring[ parameters.sq_off.tail ] );
+	safe_io_uring->submission_ring_mask = (uint32_t *) &( safe_io_uring->submission_ring[ parameters.sq_off.ring_mask ] );
+	safe_io_uring->submission_array     = (uint32_t *) &( safe_io_uring->submission_ring[ parameters.sq_off.array ] );
+
+	safe_io_uring->completion_head      = (uint32_t *) &( safe_io_uring->completion_ring[ parameters.cq_off.head ] );
+	safe_io_uring->completion_tail      = (uint32_t *) &( safe_io_uring->completion_ring[ parameters.cq_off.tail ] );
+	safe_io_uring->completion_ring_mask = (uint32_t *) &( safe_io_uring->completion_ring[ parameters.cq_off.ring_mask ] );
+	safe_io_uring->completion_entries   = (struct io_uring_cqe *) &( safe_io_uring->completion_ring[ parameters.cq_off.cqes ] );
+
+	*io_uring = safe_io_uring;
+
+	return( 1 );
+
+on_error:
+	if( safe_io_uring != NULL )
+	{
+		libbfio_io_uring_free(
+		 &safe_io_uring,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees an io_uring
+ * The requests that were submitted must have completed
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_io_uring_free(
+     libbfio_io_uring_t **io_uring,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_io_uring_free";
+	int result            = 1;
+
+	if( io_uring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid io_uring.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_uring != NULL )
+	{
+		if( ( *io_uring )->submission_entries != NULL )
+		{
+			if( munmap(
+			     ( *io_uring )->submission_entries,
+			     ( *io_uring )->submission_entries_size ) != 0 )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 errno,
+				 "%s: unable to unmap submission queue entries.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( ( *io_uring )->completion_ring != NULL )
+		 && ( ( *io_uring )->completion_ring != ( *io_uring )->submission_ring ) )
+		{
+			if( munmap(
+			     ( *io_uring )->completion_ring,
+			     ( *io_uring )->completion_ring_size ) != 0 )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 errno,
+				 "%s: unable to unmap completion queue ring.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *io_uring )->submission_ring != NULL )
+		{
+			if( munmap(
+			     ( *io_uring )->submission_ring,
+			     ( *io_uring )->submission_ring_size ) != 0 )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 errno,
+				 "%s: unable to unmap submission queue ring.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *io_uring )->descriptor != -1 )
+		{
+			if( close(
+			     ( *io_uring )->descriptor ) != 0 )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 errno,
+				 "%s: unable to close io_uring.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *io_uring );
+
+		*io_uring = NULL;
+	}
+	return( result );
+}
+
+/* Submits an operation with a single IO vector
+ * The IO vector and the data it refers to must remain valid until the
+ * completion of the operation has been retrieved
+ * This function is not multi-thread safe, only one thread can submit at a time,
+ * it can be called while another thread waits for a completion
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_io_uring_submit(
+     libbfio_io_uring_t *io_uring,
+     uint8_t opcode,
+     int descriptor,
+     const struct iovec *vector,
+     off64_t offset,
+     uint64_t user_data,
+     libcerror_error_t **error )
+{
+	struct io_uring_sqe *submission_entry = NULL;
+	static char *function                 = "libbfio_io_uring_submit";
+	uint32_t submission_head              = 0;
+	uint32_t submission_index             = 0;
+	uint32_t submission_tail              = 0;
+	int number_of_submitted_entries       = 0;
+
+	if( io_uring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid io_uring.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	/* The tail is only changed by the submitting thread, the head is changed
+	 * by the kernel when it consumes an entry
+	 */
+	submission_tail = *( io_uring->submission_tail );
+	submission_head = __atomic_load_n(
+	                   io_uring->submission_head,
+	                   __ATOMIC_ACQUIRE );
+
+	if( ( submission_tail - submission_head ) >= io_uring->number_of_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: submission queue is full.",
+		 function );
+
+		return( -1 );
+	}
+	submission_index = submission_tail & *( io_uring->submission_ring_mask );
+	submission_entry = &( io_uring->submission_entries[ submission_index ] );
+
+	if( memory_set(
+	     submission_entry,
+	     0,
+	     sizeof( struct io_uring_sqe ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear submission queue entry.",
+		 function );
+
+		return( -1 );
+	}
+	submission_entry->opcode    = opcode;
+	submission_entry->fd        = descriptor;
+	submission_entry->off       = (uint64_t) offset;
+	submission_entry->addr      = (uint64_t) (uintptr_t) vector;
+	submission_entry->len       = ( vector != NULL ) ? 1 : 0;
+	submission_entry->user_data = user_data;
+
+	io_uring->submission_array[ submission_index ] = submission_index;
+
+	__atomic_store_n(
+	 io_uring->submission_tail,
+	 submission_tail + 1,
+	 __ATOMIC_RELEASE );
+
+	do
+	{
+		number_of_submitted_entries = (int) syscall(
+		                                     __NR_io_uring_enter,
+		                                     io_uring->descriptor,
+		                                     1,
+		                                     0,
+		                                     0,
+		                                     NULL,
+		                                     0 );
+	}
+	while( ( number_of_submitted_entries == -1 )
+	    && ( errno == EINTR ) );
+
+	if( number_of_submitted_entries != 1 )
+	{
+		/* The kernel only consumes entries in io_uring_enter, hence an entry
+		 * that was not submitted can be taken back
+		 */
+		__atomic_store_n(
+		 io_uring->submission_tail,
+		 submission_tail,
+		 __ATOMIC_RELEASE );
+
+		if( number_of_submitted_entries == -1 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 errno,
+			 "%s: unable to submit entry.",
+			 function );
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to submit entry.",
+			 function );
+		}
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Waits for the completion of a submitted operation
+ * The completion result contains the return value of the operation,
+ * which is a negative errno value if the operation failed
+ * This function is not multi-thread safe, only one thread can wait at a time
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_io_uring_wait_completion(
+     libbfio_io_uring_t *io_uring,
+     uint64_t *user_data,
+     int32_t *completion_result,
+     libcerror_error_t **error )
+{
+	struct io_uring_cqe *completion_entry = NULL;
+	static char *function                 = "libbfio_io_uring_wait_completion";
+	uint32_t completion_head              = 0;
+	uint32_t completion_tail              = 0;
+	int enter_result                      = 0;
+
+	if( io_uring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid io_uring.",
+		 function );
+
+		return( -1 );
+	}
+	if( user_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid user data.",
+		 function );
+
+		return( -1 );
+	}
+	if( completion_result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid completion result.",
+		 function );
+
+		return( -1 );
+	}
+	/* The head is only changed by the waiting thread, the tail is changed
+	 * by the kernel when it adds a completion
+	 */
+	completion_head = *( io_uring->completion_head );
+
+	for( ;; )
+	{
+		completion_tail = __atomic_load_n(
+		                   io_uring->completion_tail,
+		                   __ATOMIC_ACQUIRE );
+
+		if( completion_head != completion_tail )
+		{
+			break;
+		}
+		enter_result = (int) syscall(
+		                      __NR_io_uring_enter,
+		                      io_uring->descriptor,
+		                      0,
+		                      1,
+		                      IORING_ENTER_GETEVENTS,
+		                      NULL,
+		                      0 );
+
+		if( ( enter_result == -1 )
+		 && ( errno != EINTR ) )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 errno,
+			 "%s: unable to wait for completion.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	completion_entry = &( io_uring->completion_entries[ completion_head & *( io_uring->completion_ring_mask ) ] );
+
+	*user_data         = (uint64_t) completion_entry->user_data;
+	*completion_result = (int32_t) completion_entry->res;
+
+	__atomic_store_n(
+	 io_uring->completion_head,
+	 completion_head + 1,
+	 __ATOMIC_RELEASE );
+
+	return( 1 );
+}
+
+#endif /* defined( LIBBFIO_HAVE_IO_URING ) */
+
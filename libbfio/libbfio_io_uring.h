@@ -0,0 +1,134 @@
+/*
+ * The io_uring functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBBFIO_IO_URING_H )
+#define _LIBBFIO_IO_URING_H
+
+#include <common.h>
+#include <types.h>
+
+/* The io_uring system calls are used directly, without liburing
+ */
+#if defined( HAVE_LINUX_IO_URING_H ) && defined( HAVE_SYS_SYSCALL_H ) && defined( HAVE_SYS_MMAN_H ) && defined( HAVE_SYS_UIO_H ) && defined( HAVE_MMAP ) && defined( HAVE_MUNMAP ) && defined( HAVE_DECL___NR_IO_URING_SETUP ) && ( HAVE_DECL___NR_IO_URING_SETUP == 1 ) && defined( HAVE_DECL___NR_IO_URING_ENTER ) && ( HAVE_DECL___NR_IO_URING_ENTER == 1 )
+#define LIBBFIO_HAVE_IO_URING		1
+#endif
+
+#if defined( LIBBFIO_HAVE_IO_URING )
+
+#include <linux/io_uring.h>
+#include <sys/uio.h>
+
+#include "libbfio_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The user data of a completion that is not associated with a request
+ */
+#define LIBBFIO_IO_URING_USER_DATA_NONE		0
+
+typedef struct libbfio_io_uring libbfio_io_uring_t;
+
+struct libbfio_io_uring
+{
+	/* The ring file descriptor
+	 */
+	int descriptor;
+
+	/* The number of submission queue entries
+	 */
+	uint32_t number_of_entries;
+
+	/* The submission queue ring
+	 */
+	uint8_t *submission_ring;
+
+	/* The submission queue ring size
+	 */
+	size_t submission_ring_size;
+
+	/* The completion queue ring, which can be the same mapping as the submission queue ring
+	 */
+	uint8_t *completion_ring;
+
+	/* The completion queue ring size
+	 */
+	size_t completion_ring_size;
+
+	/* The submission queue entries
+	 */
+	struct io_uring_sqe *submission_entries;
+
+	/* The submission queue entries size
+	 */
+	size_t submission_entries_size;
+
+	/* The submission queue head, tail, ring mask and index array
+	 */
+	uint32_t *submission_head;
+	uint32_t *submission_tail;
+	uint32_t *submission_ring_mask;
+	uint32_t *submission_array;
+
+	/* The completion queue head, tail and ring mask
+	 */
+	uint32_t *completion_head;
+	uint32_t *completion_tail;
+	uint32_t *completion_ring_mask;
+
+	/* The completion queue entries
+	 */
+	struct io_uring_cqe *completion_entries;
+};
+
+int libbfio_io_uring_initialize(
+     libbfio_io_uring_t **io_uring,
+     uint32_t number_of_entries,
+     libcerror_error_t **error );
+
+int libbfio_io_uring_free(
+     libbfio_io_uring_t **io_uring,
+     libcerror_error_t **error );
+
+int libbfio_io_uring_submit(
+     libbfio_io_uring_t *io_uring,
+     uint8_t opcode,
+     int descriptor,
+     const struct iovec *vector,
+     off64_t offset,
+     uint64_t user_data,
+     libcerror_error_t **error );
+
+int libbfio_io_uring_wait_completion(
+     libbfio_io_uring_t *io_uring,
+     uint64_t *user_data,
+     int32_t *completion_result,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* defined( LIBBFIO_HAVE_IO_URING ) */
+
+#endif /* !defined( _LIBBFIO_IO_URING_H ) */
+
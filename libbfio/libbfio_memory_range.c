@@ -105,6 +105,82 @@ int libbfio_memory_range_initialize(
 
 		goto on_error;
 	}
+	if( libbfio_handle_set_read_at_offset_function(
+	     *handle,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, off64_t, libcerror_error_t **)) libbfio_memory_range_io_handle_read_buffer_at_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set read at offset function.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libbfio_handle_set_write_at_offset_function(
+	     *handle,
+	     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, off64_t, libcerror_error_t **)) libbfio_memory_range_io_handle_write_buffer_at_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set write at offset function.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libbfio_handle_set_data_pointer_functions(
+	     *handle,
+	     (int (*)(intptr_t *, off64_t, size_t, const uint8_t **, libcerror_error_t **)) libbfio_memory_range_io_handle_get_data_pointer,
+	     (int (*)(intptr_t *, off64_t, const uint8_t *, libcerror_error_t **)) libbfio_memory_range_io_handle_release_data_pointer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set data pointer functions.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+#if defined( LIBBFIO_MEMORY_RANGE_IO_HANDLE_HAVE_COPY_FROM_DESCRIPTOR )
+	if( libbfio_handle_set_descriptor_functions(
+	     *handle,
+	     NULL,
+	     (int (*)(intptr_t *, off64_t, int, off64_t, size_t, size_t *, libcerror_error_t **)) libbfio_memory_range_io_handle_copy_from_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set descriptor functions.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
 	return( 1 );
 
 on_error:
@@ -23,6 +23,10 @@
 #include <memory.h>
 #include <types.h>
 
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
 #if defined( HAVE_UNISTD_H )
 #include <unistd.h>
 #endif
@@ -539,6 +543,281 @@ ssize_t libbfio_memory_range_io_handle_read_buffer(
 	return( (ssize_t) read_size );
 }
 
+/* Reads a buffer at a specific offset from the memory range IO handle
+ * This function does not change the current offset in the memory range
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libbfio_memory_range_io_handle_read_buffer_at_offset(
+         libbfio_memory_range_io_handle_t *memory_range_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libbfio_memory_range_io_handle_read_buffer_at_offset";
+	size_t read_size      = 0;
+
+	if( memory_range_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory range IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_range_io_handle->range_start == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid memory range IO handle - invalid range start.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_range_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid memory range IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( memory_range_io_handle->access_flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid memory range IO handle - no read access.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check if the end of the data was reached
+	 */
+	if( (size64_t) offset >= (size64_t) memory_range_io_handle->range_size )
+	{
+		return( 0 );
+	}
+	/* Check the amount of data available
+	 */
+	read_size = memory_range_io_handle->range_size - (size_t) offset;
+
+	/* Cannot read more data than available
+	 */
+	if( read_size > size )
+	{
+		read_size = size;
+	}
+	if( memory_copy(
+	     buffer,
+	     &( memory_range_io_handle->range_start[ offset ] ),
+	     read_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to read buffer from memory range.",
+		 function );
+
+		return( -1 );
+	}
+	return( (ssize_t) read_size );
+}
+
+/* Retrieves a pointer to size bytes of the memory range at a specific offset
+ * Returns 1 if successful, 0 if the data is not available or -1 on error
+ */
+int libbfio_memory_range_io_handle_get_data_pointer(
+     libbfio_memory_range_io_handle_t *memory_range_io_handle,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_memory_range_io_handle_get_data_pointer";
+
+	if( memory_range_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory range IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_range_io_handle->range_start == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid memory range IO handle - invalid range start.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_range_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid memory range IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( memory_range_io_handle->access_flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid memory range IO handle - no read access.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	*data = NULL;
+
+	/* Only data that is available in its entirety is provided as a pointer
+	 */
+	if( ( (size64_t) offset >= (size64_t) memory_range_io_handle->range_size )
+	 || ( size > ( memory_range_io_handle->range_size - (size_t) offset ) ) )
+	{
+		return( 0 );
+	}
+	*data = &( memory_range_io_handle->range_start[ offset ] );
+
+	return( 1 );
+}
+
+/* Releases a pointer to the memory range retrieved with libbfio_memory_range_io_handle_get_data_pointer
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_memory_range_io_handle_release_data_pointer(
+     libbfio_memory_range_io_handle_t *memory_range_io_handle,
+     off64_t offset,
+     const uint8_t *data,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_memory_range_io_handle_release_data_pointer";
+
+	if( memory_range_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory range IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset < 0 )
+	 || ( (size64_t) offset >= (size64_t) memory_range_io_handle->range_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data != &( memory_range_io_handle->range_start[ offset ] ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Writes a buffer to the memory range IO handle
  * Returns the number of bytes written if successful, or -1 on error
  */
@@ -663,6 +942,295 @@ ssize_t libbfio_memory_range_io_handle_write_buffer(
 	return( (ssize_t) write_size );
 }
 
+/* Writes a buffer at a specific offset to the memory range IO handle
+ * This function does not change the current offset in the memory range
+ * Returns the number of bytes written if successful, or -1 on error
+ */
+ssize_t libbfio_memory_range_io_handle_write_buffer_at_offset(
+         libbfio_memory_range_io_handle_t *memory_range_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libbfio_memory_range_io_handle_write_buffer_at_offset";
+	size_t write_size     = 0;
+
+	if( memory_range_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory range IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_range_io_handle->range_start == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid memory range IO handle - invalid range start.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_range_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid memory range IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( memory_range_io_handle->access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid memory range IO handle - no write access.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check if the end of the data was reached
+	 */
+	if( (size64_t) offset >= (size64_t) memory_range_io_handle->range_size )
+	{
+		return( 0 );
+	}
+	/* Check the amount of data available
+	 */
+	write_size = memory_range_io_handle->range_size - (size_t) offset;
+
+	/* Cannot write more data than available
+	 */
+	if( write_size > size )
+	{
+		write_size = size;
+	}
+	if( memory_copy(
+	     &( memory_range_io_handle->range_start[ offset ] ),
+	     buffer,
+	     write_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to write buffer to memory range.",
+		 function );
+
+		return( -1 );
+	}
+	return( (ssize_t) write_size );
+}
+
+#if defined( LIBBFIO_MEMORY_RANGE_IO_HANDLE_HAVE_COPY_FROM_DESCRIPTOR )
+
+/* Copies data from a source system file descriptor to a specific offset in the memory range
+ * This function does not change the current offset in the memory range
+ * Returns 1 if successful, 0 if the data cannot be read from the descriptor or -1 on error
+ */
+int libbfio_memory_range_io_handle_copy_from_descriptor(
+     libbfio_memory_range_io_handle_t *memory_range_io_handle,
+     off64_t offset,
+     int source_descriptor,
+     off64_t source_offset,
+     size_t size,
+     size_t *copy_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_memory_range_io_handle_copy_from_descriptor";
+	size_t copy_offset    = 0;
+	ssize_t read_count    = 0;
+
+	if( memory_range_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory range IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_range_io_handle->range_start == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid memory range IO handle - invalid range start.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_range_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid memory range IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( memory_range_io_handle->access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid memory range IO handle - no write access.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_descriptor < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source descriptor value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( copy_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid copy size.",
+		 function );
+
+		return( -1 );
+	}
+	*copy_size = 0;
+
+	if( (size64_t) offset >= (size64_t) memory_range_io_handle->range_size )
+	{
+		return( 1 );
+	}
+	/* Cannot copy more data than available
+	 */
+	if( size > ( memory_range_io_handle->range_size - (size_t) offset ) )
+	{
+		size = memory_range_io_handle->range_size - (size_t) offset;
+	}
+	/* Read the data directly into the memory range
+	 */
+	while( copy_offset < size )
+	{
+		read_count = pread(
+		              source_descriptor,
+		              &( memory_range_io_handle->range_start[ (size_t) offset + copy_offset ] ),
+		              size - copy_offset,
+		              source_offset + (off64_t) copy_offset );
+
+		if( read_count < 0 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			if( copy_offset == 0 )
+			{
+				return( 0 );
+			}
+			break;
+		}
+		else if( read_count == 0 )
+		{
+			break;
+		}
+		copy_offset += (size_t) read_count;
+	}
+	*copy_size = copy_offset;
+
+	return( 1 );
+}
+
+#endif /* defined( LIBBFIO_MEMORY_RANGE_IO_HANDLE_HAVE_COPY_FROM_DESCRIPTOR ) */
+
 /* Seeks a certain offset within the memory range IO handle
  * Returns the offset if the seek is successful or -1 on error
  */
@@ -31,6 +31,12 @@
 extern "C" {
 #endif
 
+/* Copying data from a system file descriptor requires pread
+ */
+#if !defined( WINAPI ) && defined( HAVE_PREAD )
+#define LIBBFIO_MEMORY_RANGE_IO_HANDLE_HAVE_COPY_FROM_DESCRIPTOR	1
+#endif
+
 typedef struct libbfio_memory_range_io_handle libbfio_memory_range_io_handle_t;
 
 struct libbfio_memory_range_io_handle
@@ -96,12 +102,52 @@ ssize_t libbfio_memory_range_io_handle_read_buffer(
          size_t size,
          libcerror_error_t **error );
 
+ssize_t libbfio_memory_range_io_handle_read_buffer_at_offset(
+         libbfio_memory_range_io_handle_t *memory_range_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+int libbfio_memory_range_io_handle_get_data_pointer(
+     libbfio_memory_range_io_handle_t *memory_range_io_handle,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error );
+
+int libbfio_memory_range_io_handle_release_data_pointer(
+     libbfio_memory_range_io_handle_t *memory_range_io_handle,
+     off64_t offset,
+     const uint8_t *data,
+     libcerror_error_t **error );
+
 ssize_t libbfio_memory_range_io_handle_write_buffer(
          libbfio_memory_range_io_handle_t *memory_range_io_handle,
          const uint8_t *buffer,
          size_t size,
          libcerror_error_t **error );
 
+ssize_t libbfio_memory_range_io_handle_write_buffer_at_offset(
+         libbfio_memory_range_io_handle_t *memory_range_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+#if defined( LIBBFIO_MEMORY_RANGE_IO_HANDLE_HAVE_COPY_FROM_DESCRIPTOR )
+
+int libbfio_memory_range_io_handle_copy_from_descriptor(
+     libbfio_memory_range_io_handle_t *memory_range_io_handle,
+     off64_t offset,
+     int source_descriptor,
+     off64_t source_offset,
+     size_t size,
+     size_t *copy_size,
+     libcerror_error_t **error );
+
+#endif /* defined( LIBBFIO_MEMORY_RANGE_IO_HANDLE_HAVE_COPY_FROM_DESCRIPTOR ) */
+
 off64_t libbfio_memory_range_io_handle_seek_offset(
          libbfio_memory_range_io_handle_t *memory_range_io_handle,
          off64_t offset,
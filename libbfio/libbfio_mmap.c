@@ -0,0 +1,522 @@
+/*
+ * Memory-mapped file functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libbfio_definitions.h"
+#include "libbfio_handle.h"
+#include "libbfio_libcerror.h"
+#include "libbfio_mmap.h"
+#include "libbfio_mmap_io_handle.h"
+#include "libbfio_types.h"
+
+/* Creates a memory-mapped file handle
+ * The file is mapped read-only when the handle is opened
+ * Make sure the value handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_mmap_initialize(
+     libbfio_handle_t **handle,
+     libcerror_error_t **error )
+{
+	libbfio_mmap_io_handle_t *mmap_io_handle = NULL;
+	static char *function                    = "libbfio_mmap_initialize";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_mmap_io_handle_initialize(
+	     &mmap_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mmap IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_initialize(
+	     handle,
+	     (intptr_t *) mmap_io_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) libbfio_mmap_io_handle_free,
+	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) libbfio_mmap_io_handle_clone,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) libbfio_mmap_io_handle_open,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libbfio_mmap_io_handle_close,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) libbfio_mmap_io_handle_read_buffer,
+	     NULL,
+	     (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) libbfio_mmap_io_handle_seek_offset,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libbfio_mmap_io_handle_exists,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libbfio_mmap_io_handle_is_open,
+	     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libbfio_mmap_io_handle_get_size,
+	     LIBBFIO_FLAG_IO_HANDLE_MANAGED | LIBBFIO_FLAG_IO_HANDLE_CLONE_BY_FUNCTION,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_set_read_at_offset_function(
+	     *handle,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, off64_t, libcerror_error_t **)) libbfio_mmap_io_handle_read_buffer_at_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set read at offset function.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libbfio_handle_set_data_pointer_functions(
+	     *handle,
+	     (int (*)(intptr_t *, off64_t, size_t, const uint8_t **, libcerror_error_t **)) libbfio_mmap_io_handle_get_data_pointer,
+	     (int (*)(intptr_t *, off64_t, const uint8_t *, libcerror_error_t **)) libbfio_mmap_io_handle_release_data_pointer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set data pointer functions.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+#if defined( LIBBFIO_MMAP_IO_HANDLE_HAVE_ACCESS_HINT )
+	if( libbfio_handle_set_access_hint_function(
+	     *handle,
+	     (int (*)(intptr_t *, off64_t, size64_t, int, libcerror_error_t **)) libbfio_mmap_io_handle_set_access_hint,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set access hint function.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( mmap_io_handle != NULL )
+	{
+		libbfio_mmap_io_handle_free(
+		 &mmap_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the name size of the mmap handle
+ * The name size includes the end of string character
+ * Returns 1 if succesful or -1 on error
+ */
+int libbfio_mmap_get_name_size(
+     libbfio_handle_t *handle,
+     size_t *name_size,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_mmap_get_name_size";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( libbfio_mmap_io_handle_get_name_size(
+	     (libbfio_mmap_io_handle_t *) internal_handle->io_handle,
+	     name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name size from mmap IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the name of the mmap handle
+ * The name size should include the end of string character
+ * Returns 1 if succesful or -1 on error
+ */
+int libbfio_mmap_get_name(
+     libbfio_handle_t *handle,
+     char *name,
+     size_t name_size,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_mmap_get_name";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( libbfio_mmap_io_handle_get_name(
+	     (libbfio_mmap_io_handle_t *) internal_handle->io_handle,
+	     name,
+	     name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name from mmap IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the name for the mmap handle
+ * Returns 1 if succesful or -1 on error
+ */
+int libbfio_mmap_set_name(
+     libbfio_handle_t *handle,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_mmap_set_name";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( libbfio_mmap_io_handle_set_name(
+	     (libbfio_mmap_io_handle_t *) internal_handle->io_handle,
+	     name,
+	     name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set name in mmap IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Retrieves the name size of the mmap handle
+ * The name size includes the end of string character
+ * Returns 1 if succesful or -1 on error
+ */
+int libbfio_mmap_get_name_size_wide(
+     libbfio_handle_t *handle,
+     size_t *name_size,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_mmap_get_name_size_wide";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( libbfio_mmap_io_handle_get_name_size_wide(
+	     (libbfio_mmap_io_handle_t *) internal_handle->io_handle,
+	     name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name size from mmap IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the name of the mmap handle
+ * The name size should include the end of string character
+ * Returns 1 if succesful or -1 on error
+ */
+int libbfio_mmap_get_name_wide(
+     libbfio_handle_t *handle,
+     wchar_t *name,
+     size_t name_size,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_mmap_get_name_wide";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( libbfio_mmap_io_handle_get_name_wide(
+	     (libbfio_mmap_io_handle_t *) internal_handle->io_handle,
+	     name,
+	     name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name from mmap IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the name for the mmap handle
+ * Returns 1 if succesful or -1 on error
+ */
+int libbfio_mmap_set_name_wide(
+     libbfio_handle_t *handle,
+     const wchar_t *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_mmap_set_name_wide";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( libbfio_mmap_io_handle_set_name_wide(
+	     (libbfio_mmap_io_handle_t *) internal_handle->io_handle,
+	     name,
+	     name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set name in mmap IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Retrieves the mapping flags of the mmap handle
+ * Returns 1 if succesful or -1 on error
+ */
+int libbfio_mmap_get_mapping_flags(
+     libbfio_handle_t *handle,
+     uint8_t *mapping_flags,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_mmap_get_mapping_flags";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( libbfio_mmap_io_handle_get_mapping_flags(
+	     (libbfio_mmap_io_handle_t *) internal_handle->io_handle,
+	     mapping_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve mapping flags from mmap IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the mapping flags of the mmap handle
+ * The mapping flags are applied the next time the handle is opened
+ * Returns 1 if succesful or -1 on error
+ */
+int libbfio_mmap_set_mapping_flags(
+     libbfio_handle_t *handle,
+     uint8_t mapping_flags,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_mmap_set_mapping_flags";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( libbfio_mmap_io_handle_set_mapping_flags(
+	     (libbfio_mmap_io_handle_t *) internal_handle->io_handle,
+	     mapping_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set mapping flags in mmap IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,1453 @@
+/*
+ * Memory-mapped file IO handle functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libbfio_definitions.h"
+#include "libbfio_file_io_handle.h"
+#include "libbfio_libcerror.h"
+#include "libbfio_mmap_io_handle.h"
+
+
+/* Creates a mmap IO handle
+ * Make sure the value mmap_io_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_mmap_io_handle_initialize(
+     libbfio_mmap_io_handle_t **mmap_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_mmap_io_handle_initialize";
+
+	if( mmap_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mmap IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *mmap_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid mmap IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*mmap_io_handle = memory_allocate_structure(
+	                         libbfio_mmap_io_handle_t );
+
+	if( *mmap_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create mmap IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *mmap_io_handle,
+	     0,
+	     sizeof( libbfio_mmap_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear mmap IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_io_handle_initialize(
+	     &( ( *mmap_io_handle )->file_io_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *mmap_io_handle != NULL )
+	{
+		memory_free(
+		 *mmap_io_handle );
+
+		*mmap_io_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a mmap IO handle
+ * Returns 1 if succesful or -1 on error
+ */
+int libbfio_mmap_io_handle_free(
+     libbfio_mmap_io_handle_t **mmap_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_mmap_io_handle_free";
+	int result            = 1;
+
+	if( mmap_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mmap IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *mmap_io_handle != NULL )
+	{
+#if defined( LIBBFIO_MMAP_IO_HANDLE_HAVE_MMAP )
+		if( ( *mmap_io_handle )->data != NULL )
+		{
+			if( munmap(
+			     ( *mmap_io_handle )->data,
+			     ( *mmap_io_handle )->data_size ) != 0 )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 errno,
+				 "%s: unable to unmap data.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		if( libbfio_file_io_handle_free(
+		     &( ( *mmap_io_handle )->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *mmap_io_handle );
+
+		*mmap_io_handle = NULL;
+	}
+	return( result );
+}
+
+/* Clones (duplicates) the mmap IO handle and its attributes
+ * Returns 1 if succesful or -1 on error
+ */
+int libbfio_mmap_io_handle_clone(
+     libbfio_mmap_io_handle_t **destination_mmap_io_handle,
+     libbfio_mmap_io_handle_t *source_mmap_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_mmap_io_handle_clone";
+
+	if( destination_mmap_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination mmap IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_mmap_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: destination mmap IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_mmap_io_handle == NULL )
+	{
+		*destination_mmap_io_handle = NULL;
+
+		return( 1 );
+	}
+	*destination_mmap_io_handle = memory_allocate_structure(
+	                                     libbfio_mmap_io_handle_t );
+
+	if( *destination_mmap_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create destination mmap IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *destination_mmap_io_handle,
+	     0,
+	     sizeof( libbfio_mmap_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear destination mmap IO handle.",
+		 function );
+
+		memory_free(
+		 *destination_mmap_io_handle );
+
+		*destination_mmap_io_handle = NULL;
+
+		return( -1 );
+	}
+	if( libbfio_file_io_handle_clone(
+	     &( ( *destination_mmap_io_handle )->file_io_handle ),
+	     source_mmap_io_handle->file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *destination_mmap_io_handle )->mapping_flags = source_mmap_io_handle->mapping_flags;
+
+	return( 1 );
+
+on_error:
+	if( *destination_mmap_io_handle != NULL )
+	{
+		libbfio_mmap_io_handle_free(
+		 destination_mmap_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the name size of the mmap IO handle
+ * The name size includes the end of string character
+ * Returns 1 if succesful or -1 on error
+ */
+int libbfio_mmap_io_handle_get_name_size(
+     libbfio_mmap_io_handle_t *mmap_io_handle,
+     size_t *name_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_mmap_io_handle_get_name_size";
+
+	if( mmap_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mmap IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_io_handle_get_name_size(
+	     mmap_io_handle->file_io_handle,
+	     name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name size from file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the name of the mmap IO handle
+ * The name size should include the end of string character
+ * Returns 1 if succesful or -1 on error
+ */
+int libbfio_mmap_io_handle_get_name(
+     libbfio_mmap_io_handle_t *mmap_io_handle,
+     char *name,
+     size_t name_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_mmap_io_handle_get_name";
+
+	if( mmap_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mmap IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_io_handle_get_name(
+	     mmap_io_handle->file_io_handle,
+	     name,
+	     name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name from file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the name for the mmap IO handle
+ * Returns 1 if succesful or -1 on error
+ */
+int libbfio_mmap_io_handle_set_name(
+     libbfio_mmap_io_handle_t *mmap_io_handle,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_mmap_io_handle_set_name";
+
+	if( mmap_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mmap IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_io_handle_set_name(
+	     mmap_io_handle->file_io_handle,
+	     name,
+	     name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set name in file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Retrieves the name size of the mmap IO handle
+ * The name size includes the end of string character
+ * Returns 1 if succesful or -1 on error
+ */
+int libbfio_mmap_io_handle_get_name_size_wide(
+     libbfio_mmap_io_handle_t *mmap_io_handle,
+     size_t *name_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_mmap_io_handle_get_name_size_wide";
+
+	if( mmap_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mmap IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_io_handle_get_name_size_wide(
+	     mmap_io_handle->file_io_handle,
+	     name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name size from file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the name of the mmap IO handle
+ * The name size should include the end of string character
+ * Returns 1 if succesful or -1 on error
+ */
+int libbfio_mmap_io_handle_get_name_wide(
+     libbfio_mmap_io_handle_t *mmap_io_handle,
+     wchar_t *name,
+     size_t name_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_mmap_io_handle_get_name_wide";
+
+	if( mmap_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mmap IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_io_handle_get_name_wide(
+	     mmap_io_handle->file_io_handle,
+	     name,
+	     name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name from file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the name for the mmap IO handle
+ * Returns 1 if succesful or -1 on error
+ */
+int libbfio_mmap_io_handle_set_name_wide(
+     libbfio_mmap_io_handle_t *mmap_io_handle,
+     const wchar_t *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_mmap_io_handle_set_name_wide";
+
+	if( mmap_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mmap IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_io_handle_set_name_wide(
+	     mmap_io_handle->file_io_handle,
+	     name,
+	     name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set name in file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Retrieves the mapping flags of the mmap IO handle
+ * Returns 1 if succesful or -1 on error
+ */
+int libbfio_mmap_io_handle_get_mapping_flags(
+     libbfio_mmap_io_handle_t *mmap_io_handle,
+     uint8_t *mapping_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_mmap_io_handle_get_mapping_flags";
+
+	if( mmap_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mmap IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( mapping_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapping flags.",
+		 function );
+
+		return( -1 );
+	}
+	*mapping_flags = mmap_io_handle->mapping_flags;
+
+	return( 1 );
+}
+
+/* Sets the mapping flags of the mmap IO handle
+ * The mapping flags are applied the next time the mmap IO handle is opened
+ * Returns 1 if succesful or -1 on error
+ */
+int libbfio_mmap_io_handle_set_mapping_flags(
+     libbfio_mmap_io_handle_t *mmap_io_handle,
+     uint8_t mapping_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_mmap_io_handle_set_mapping_flags";
+
+	if( mmap_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mmap IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( mapping_flags & ~( LIBBFIO_MMAP_FLAG_POPULATE | LIBBFIO_MMAP_FLAG_HUGE_PAGES ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported mapping flags: 0x%02" PRIx8 ".",
+		 function,
+		 mapping_flags );
+
+		return( -1 );
+	}
+	mmap_io_handle->mapping_flags = mapping_flags;
+
+	return( 1 );
+}
+
+/* Opens the mmap IO handle
+ * The file is mapped read-only, write access is not supported
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_mmap_io_handle_open(
+     libbfio_mmap_io_handle_t *mmap_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_mmap_io_handle_open";
+
+#if defined( LIBBFIO_MMAP_IO_HANDLE_HAVE_MMAP )
+	void *data            = NULL;
+	size64_t file_size    = 0;
+	int mmap_flags        = 0;
+#endif
+
+	if( mmap_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mmap IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( mmap_io_handle->is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid mmap IO handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 )
+	 || ( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags: 0x%02x.",
+		 function,
+		 access_flags );
+
+		return( -1 );
+	}
+#if defined( LIBBFIO_MMAP_IO_HANDLE_HAVE_MMAP )
+	if( libbfio_file_io_handle_open(
+	     mmap_io_handle->file_io_handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_io_handle_get_size(
+	     mmap_io_handle->file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size from file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_size > (size64_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid file size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	/* An empty file cannot be mapped
+	 */
+	if( file_size > 0 )
+	{
+		mmap_flags = MAP_PRIVATE;
+
+#if defined( MAP_POPULATE )
+		if( ( mmap_io_handle->mapping_flags & LIBBFIO_MMAP_FLAG_POPULATE ) != 0 )
+		{
+			mmap_flags |= MAP_POPULATE;
+		}
+#endif
+		data = mmap(
+		        NULL,
+		        (size_t) file_size,
+		        PROT_READ,
+		        mmap_flags,
+		        mmap_io_handle->file_io_handle->descriptor,
+		        0 );
+
+		if( data == MAP_FAILED )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 errno,
+			 "%s: unable to map file.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_MADVISE ) && defined( MADV_HUGEPAGE )
+		if( ( mmap_io_handle->mapping_flags & LIBBFIO_MMAP_FLAG_HUGE_PAGES ) != 0 )
+		{
+			/* Huge pages are a best effort optimization, hence failure is ignored
+			 */
+			madvise(
+			 data,
+			 (size_t) file_size,
+			 MADV_HUGEPAGE );
+		}
+#endif
+	}
+	/* The mapping remains valid after the file is closed
+	 */
+	if( libbfio_file_io_handle_close(
+	     mmap_io_handle->file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle.",
+		 function );
+
+		if( data != NULL )
+		{
+			munmap(
+			 data,
+			 (size_t) file_size );
+		}
+		return( -1 );
+	}
+	mmap_io_handle->data           = (uint8_t *) data;
+	mmap_io_handle->data_size      = (size_t) file_size;
+	mmap_io_handle->current_offset = 0;
+	mmap_io_handle->is_open        = 1;
+
+	return( 1 );
+
+on_error:
+	libbfio_file_io_handle_close(
+	 mmap_io_handle->file_io_handle,
+	 NULL );
+
+	return( -1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: memory-mapped files are not supported.",
+	 function );
+
+	return( -1 );
+#endif /* defined( LIBBFIO_MMAP_IO_HANDLE_HAVE_MMAP ) */
+}
+
+/* Closes the mmap IO handle
+ * Returns 0 if successful or -1 on error
+ */
+int libbfio_mmap_io_handle_close(
+     libbfio_mmap_io_handle_t *mmap_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_mmap_io_handle_close";
+
+	if( mmap_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mmap IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( mmap_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid mmap IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBBFIO_MMAP_IO_HANDLE_HAVE_MMAP )
+	if( mmap_io_handle->data != NULL )
+	{
+		if( munmap(
+		     mmap_io_handle->data,
+		     mmap_io_handle->data_size ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 errno,
+			 "%s: unable to unmap data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	mmap_io_handle->data           = NULL;
+	mmap_io_handle->data_size      = 0;
+	mmap_io_handle->current_offset = 0;
+	mmap_io_handle->is_open        = 0;
+
+	return( 0 );
+}
+
+/* Reads a buffer from the mmap IO handle
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libbfio_mmap_io_handle_read_buffer(
+         libbfio_mmap_io_handle_t *mmap_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function = "libbfio_mmap_io_handle_read_buffer";
+	ssize_t read_count    = 0;
+
+	if( mmap_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mmap IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_mmap_io_handle_read_buffer_at_offset(
+	              mmap_io_handle,
+	              buffer,
+	              size,
+	              (off64_t) mmap_io_handle->current_offset,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer from mapped data.",
+		 function );
+
+		return( -1 );
+	}
+	mmap_io_handle->current_offset += (size_t) read_count;
+
+	return( read_count );
+}
+
+/* Reads a buffer at a specific offset from the mmap IO handle
+ * This function does not change the current offset in the mapped data
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libbfio_mmap_io_handle_read_buffer_at_offset(
+         libbfio_mmap_io_handle_t *mmap_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libbfio_mmap_io_handle_read_buffer_at_offset";
+	size_t read_size      = 0;
+
+	if( mmap_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mmap IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( mmap_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid mmap IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check if the end of the data was reached
+	 */
+	if( (size64_t) offset >= (size64_t) mmap_io_handle->data_size )
+	{
+		return( 0 );
+	}
+	/* Check the amount of data available
+	 */
+	read_size = mmap_io_handle->data_size - (size_t) offset;
+
+	/* Cannot read more data than available
+	 */
+	if( read_size > size )
+	{
+		read_size = size;
+	}
+	if( memory_copy(
+	     buffer,
+	     &( mmap_io_handle->data[ offset ] ),
+	     read_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to read buffer from mapped data.",
+		 function );
+
+		return( -1 );
+	}
+	return( (ssize_t) read_size );
+}
+
+/* Retrieves a pointer to size bytes of the mapped data at a specific offset
+ * Returns 1 if successful, 0 if the data is not available or -1 on error
+ */
+int libbfio_mmap_io_handle_get_data_pointer(
+     libbfio_mmap_io_handle_t *mmap_io_handle,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_mmap_io_handle_get_data_pointer";
+
+	if( mmap_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mmap IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( mmap_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid mmap IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	*data = NULL;
+
+	/* Only data that is available in its entirety is provided as a pointer
+	 */
+	if( ( (size64_t) offset >= (size64_t) mmap_io_handle->data_size )
+	 || ( size > ( mmap_io_handle->data_size - (size_t) offset ) ) )
+	{
+		return( 0 );
+	}
+	*data = &( mmap_io_handle->data[ offset ] );
+
+	return( 1 );
+}
+
+/* Releases a pointer to the mapped data retrieved with libbfio_mmap_io_handle_get_data_pointer
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_mmap_io_handle_release_data_pointer(
+     libbfio_mmap_io_handle_t *mmap_io_handle,
+     off64_t offset,
+     const uint8_t *data,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_mmap_io_handle_release_data_pointer";
+
+	if( mmap_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mmap IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset < 0 )
+	 || ( (size64_t) offset >= (size64_t) mmap_io_handle->data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data != &( mmap_io_handle->data[ offset ] ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( LIBBFIO_MMAP_IO_HANDLE_HAVE_ACCESS_HINT )
+
+/* Passes an access pattern hint for a range of the mapped data to the system
+ * The hint applies from offset to the end of the data if size is 0
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_mmap_io_handle_set_access_hint(
+     libbfio_mmap_io_handle_t *mmap_io_handle,
+     off64_t offset,
+     size64_t size,
+     int access_hint,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_mmap_io_handle_set_access_hint";
+	size_t page_offset    = 0;
+	long page_size        = 0;
+	int advice            = 0;
+	int result            = 0;
+
+	if( mmap_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mmap IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( mmap_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid mmap IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	switch( access_hint )
+	{
+		case LIBBFIO_ACCESS_HINT_NORMAL:
+			advice = POSIX_MADV_NORMAL;
+			break;
+
+		case LIBBFIO_ACCESS_HINT_SEQUENTIAL:
+			advice = POSIX_MADV_SEQUENTIAL;
+			break;
+
+		case LIBBFIO_ACCESS_HINT_RANDOM:
+			advice = POSIX_MADV_RANDOM;
+			break;
+
+		case LIBBFIO_ACCESS_HINT_WILLNEED:
+			advice = POSIX_MADV_WILLNEED;
+			break;
+
+		case LIBBFIO_ACCESS_HINT_DONTNEED:
+			advice = POSIX_MADV_DONTNEED;
+			break;
+
+		/* There is no memory advice equivalent of no reuse
+		 */
+		case LIBBFIO_ACCESS_HINT_NOREUSE:
+			return( 1 );
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported access hint: %d.",
+			 function,
+			 access_hint );
+
+			return( -1 );
+	}
+	if( (size64_t) offset >= (size64_t) mmap_io_handle->data_size )
+	{
+		return( 1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size64_t) ( mmap_io_handle->data_size - (size_t) offset ) ) )
+	{
+		size = (size64_t) ( mmap_io_handle->data_size - (size_t) offset );
+	}
+	/* The address passed to posix_madvise must be page aligned
+	 */
+	page_size = sysconf(
+	             _SC_PAGESIZE );
+
+	if( page_size > 0 )
+	{
+		page_offset = (size_t) offset % (size_t) page_size;
+	}
+	result = posix_madvise(
+	          &( mmap_io_handle->data[ (size_t) offset - page_offset ] ),
+	          (size_t) size + page_offset,
+	          advice );
+
+	if( result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 result,
+		 "%s: unable to set access hint for mapped data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( LIBBFIO_MMAP_IO_HANDLE_HAVE_ACCESS_HINT ) */
+
+/* Seeks a certain offset within the mmap IO handle
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t libbfio_mmap_io_handle_seek_offset(
+         libbfio_mmap_io_handle_t *mmap_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libbfio_mmap_io_handle_seek_offset";
+
+	if( mmap_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mmap IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( mmap_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid mmap IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += (off64_t) mmap_io_handle->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) mmap_io_handle->data_size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset > (off64_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid offset value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	mmap_io_handle->current_offset = (size_t) offset;
+
+	return( offset );
+}
+
+/* Function to determine if a file exists
+ * Returns 1 if file exists, 0 if not or -1 on error
+ */
+int libbfio_mmap_io_handle_exists(
+     libbfio_mmap_io_handle_t *mmap_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_mmap_io_handle_exists";
+	int result            = 0;
+
+	if( mmap_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mmap IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libbfio_file_io_handle_exists(
+	          mmap_io_handle->file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine if file exists.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Check if the mmap IO handle is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int libbfio_mmap_io_handle_is_open(
+     libbfio_mmap_io_handle_t *mmap_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_mmap_io_handle_is_open";
+
+	if( mmap_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mmap IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( mmap_io_handle->is_open == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the mapped data
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_mmap_io_handle_get_size(
+     libbfio_mmap_io_handle_t *mmap_io_handle,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_mmap_io_handle_get_size";
+
+	if( mmap_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mmap IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( mmap_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid mmap IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	*size = (size64_t) mmap_io_handle->data_size;
+
+	return( 1 );
+}
+
@@ -0,0 +1,205 @@
+/*
+ * Memory-mapped file IO handle functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBBFIO_MMAP_IO_HANDLE_H )
+#define _LIBBFIO_MMAP_IO_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libbfio_file_io_handle.h"
+#include "libbfio_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* Memory-mapping the file requires the system file descriptor
+ */
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ ) && defined( HAVE_SYS_MMAN_H ) && defined( HAVE_MMAP ) && defined( HAVE_MUNMAP )
+#define LIBBFIO_MMAP_IO_HANDLE_HAVE_MMAP		1
+#endif
+
+#if defined( LIBBFIO_MMAP_IO_HANDLE_HAVE_MMAP ) && defined( HAVE_POSIX_MADVISE )
+#define LIBBFIO_MMAP_IO_HANDLE_HAVE_ACCESS_HINT		1
+#endif
+
+typedef struct libbfio_mmap_io_handle libbfio_mmap_io_handle_t;
+
+struct libbfio_mmap_io_handle
+{
+	/* The file IO handle
+	 */
+	libbfio_file_io_handle_t *file_io_handle;
+
+	/* The mapping flags
+	 */
+	uint8_t mapping_flags;
+
+	/* The mapped data
+	 */
+	uint8_t *data;
+
+	/* The size of the mapped data
+	 */
+	size_t data_size;
+
+	/* The current offset in the mapped data
+	 */
+	size_t current_offset;
+
+	/* Value to indicate the mmap IO handle is open
+	 */
+	uint8_t is_open;
+};
+
+int libbfio_mmap_io_handle_initialize(
+     libbfio_mmap_io_handle_t **mmap_io_handle,
+     libcerror_error_t **error );
+
+int libbfio_mmap_io_handle_free(
+     libbfio_mmap_io_handle_t **mmap_io_handle,
+     libcerror_error_t **error );
+
+int libbfio_mmap_io_handle_clone(
+     libbfio_mmap_io_handle_t **destination_mmap_io_handle,
+     libbfio_mmap_io_handle_t *source_mmap_io_handle,
+     libcerror_error_t **error );
+
+int libbfio_mmap_io_handle_get_name_size(
+     libbfio_mmap_io_handle_t *mmap_io_handle,
+     size_t *name_size,
+     libcerror_error_t **error );
+
+int libbfio_mmap_io_handle_get_name(
+     libbfio_mmap_io_handle_t *mmap_io_handle,
+     char *name,
+     size_t name_size,
+     libcerror_error_t **error );
+
+int libbfio_mmap_io_handle_set_name(
+     libbfio_mmap_io_handle_t *mmap_io_handle,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+int libbfio_mmap_io_handle_get_name_size_wide(
+     libbfio_mmap_io_handle_t *mmap_io_handle,
+     size_t *name_size,
+     libcerror_error_t **error );
+
+int libbfio_mmap_io_handle_get_name_wide(
+     libbfio_mmap_io_handle_t *mmap_io_handle,
+     wchar_t *name,
+     size_t name_size,
+     libcerror_error_t **error );
+
+int libbfio_mmap_io_handle_set_name_wide(
+     libbfio_mmap_io_handle_t *mmap_io_handle,
+     const wchar_t *name,
+     size_t name_length,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+int libbfio_mmap_io_handle_get_mapping_flags(
+     libbfio_mmap_io_handle_t *mmap_io_handle,
+     uint8_t *mapping_flags,
+     libcerror_error_t **error );
+
+int libbfio_mmap_io_handle_set_mapping_flags(
+     libbfio_mmap_io_handle_t *mmap_io_handle,
+     uint8_t mapping_flags,
+     libcerror_error_t **error );
+
+int libbfio_mmap_io_handle_open(
+     libbfio_mmap_io_handle_t *mmap_io_handle,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libbfio_mmap_io_handle_close(
+     libbfio_mmap_io_handle_t *mmap_io_handle,
+     libcerror_error_t **error );
+
+ssize_t libbfio_mmap_io_handle_read_buffer(
+         libbfio_mmap_io_handle_t *mmap_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+ssize_t libbfio_mmap_io_handle_read_buffer_at_offset(
+         libbfio_mmap_io_handle_t *mmap_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+int libbfio_mmap_io_handle_get_data_pointer(
+     libbfio_mmap_io_handle_t *mmap_io_handle,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error );
+
+int libbfio_mmap_io_handle_release_data_pointer(
+     libbfio_mmap_io_handle_t *mmap_io_handle,
+     off64_t offset,
+     const uint8_t *data,
+     libcerror_error_t **error );
+
+#if defined( LIBBFIO_MMAP_IO_HANDLE_HAVE_ACCESS_HINT )
+
+int libbfio_mmap_io_handle_set_access_hint(
+     libbfio_mmap_io_handle_t *mmap_io_handle,
+     off64_t offset,
+     size64_t size,
+     int access_hint,
+     libcerror_error_t **error );
+
+#endif /* defined( LIBBFIO_MMAP_IO_HANDLE_HAVE_ACCESS_HINT ) */
+
+off64_t libbfio_mmap_io_handle_seek_offset(
+         libbfio_mmap_io_handle_t *mmap_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+int libbfio_mmap_io_handle_exists(
+     libbfio_mmap_io_handle_t *mmap_io_handle,
+     libcerror_error_t **error );
+
+int libbfio_mmap_io_handle_is_open(
+     libbfio_mmap_io_handle_t *mmap_io_handle,
+     libcerror_error_t **error );
+
+int libbfio_mmap_io_handle_get_size(
+     libbfio_mmap_io_handle_t *mmap_io_handle,
+     size64_t *size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBBFIO_MMAP_IO_HANDLE_H ) */
+
@@ -27,8 +27,11 @@
 #include <unistd.h>
 #endif
 
+#include "libbfio_block_cache.h"
 #include "libbfio_definitions.h"
+#include "libbfio_descriptor_cache.h"
 #include "libbfio_handle.h"
+#include "libbfio_handle_closer.h"
 #include "libbfio_libcdata.h"
 #include "libbfio_libcerror.h"
 #include "libbfio_pool.h"
@@ -136,36 +139,48 @@ int libbfio_pool_initialize(
 
 		goto on_error;
 	}
-	if( libcdata_list_initialize(
-	     &( internal_pool->last_used_list ),
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_pool->read_write_lock ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create last used list.",
+		 "%s: unable to initialize read/write lock.",
 		 function );
 
 		goto on_error;
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_initialize(
-	     &( internal_pool->read_write_lock ),
+	if( libcthreads_mutex_initialize(
+	     &( internal_pool->last_used_list_mutex ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to initialize read/write lock.",
+		 "%s: unable to initialize last used list mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( internal_pool->last_used_list_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize last used list condition.",
 		 function );
 
 		goto on_error;
 	}
 #endif
 	internal_pool->maximum_number_of_open_handles = maximum_number_of_open_handles;
-	internal_pool->current_entry                  = -1;
 
 	*pool = (libbfio_pool_t *) internal_pool;
 
@@ -174,13 +189,26 @@ int libbfio_pool_initialize(
 on_error:
 	if( internal_pool != NULL )
 	{
-		if( internal_pool->last_used_list != NULL )
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+		if( internal_pool->last_used_list_condition != NULL )
+		{
+			libcthreads_condition_free(
+			 &( internal_pool->last_used_list_condition ),
+			 NULL );
+		}
+		if( internal_pool->last_used_list_mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( internal_pool->last_used_list_mutex ),
+			 NULL );
+		}
+		if( internal_pool->read_write_lock != NULL )
 		{
-			libcdata_list_free(
-			 &( internal_pool->last_used_list ),
-			 NULL,
+			libcthreads_read_write_lock_free(
+			 &( internal_pool->read_write_lock ),
 			 NULL );
 		}
+#endif
 		if( internal_pool->handles_array != NULL )
 		{
 			libcdata_array_free(
@@ -235,35 +263,81 @@ int libbfio_pool_free(
 
 			result = -1;
 		}
-#endif
-		if( libcdata_array_free(
-		     &( internal_pool->handles_array ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libbfio_handle_free,
+		if( libcthreads_mutex_free(
+		     &( internal_pool->last_used_list_mutex ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free handles array.",
+			 "%s: unable to free last used list mutex.",
 			 function );
 
 			result = -1;
 		}
-		if( libcdata_list_free(
-		     &( internal_pool->last_used_list ),
-		     NULL,
+		if( libcthreads_condition_free(
+		     &( internal_pool->last_used_list_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free last used list condition.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		/* The handle closer is freed first since it waits for the pending closes
+		 */
+		if( internal_pool->handle_closer != NULL )
+		{
+			if( libbfio_handle_closer_free(
+			     &( internal_pool->handle_closer ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free handle closer.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libcdata_array_free(
+		     &( internal_pool->handles_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libbfio_handle_free,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free last used list.",
+			 "%s: unable to free handles array.",
 			 function );
 
 			result = -1;
 		}
+		if( internal_pool->block_cache != NULL )
+		{
+			if( libbfio_block_cache_free(
+			     &( internal_pool->block_cache ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free block cache.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 internal_pool );
 	}
@@ -279,9 +353,12 @@ int libbfio_pool_clone(
      libbfio_pool_t *source_pool,
      libcerror_error_t **error )
 {
+	libbfio_handle_t *handle                           = NULL;
 	libbfio_internal_pool_t *internal_destination_pool = NULL;
 	libbfio_internal_pool_t *internal_source_pool      = NULL;
 	static char *function                              = "libbfio_pool_clone";
+	int entry                                          = 0;
+	int number_of_handles                              = 0;
 
 	if( destination_pool == NULL )
 	{
@@ -361,9 +438,6 @@ int libbfio_pool_clone(
 
 		goto on_error;
 	}
-	internal_destination_pool->current_entry  = -1;
-	internal_destination_pool->current_handle = NULL;
-
 	if( libcdata_array_clone(
 	     &( internal_destination_pool->handles_array ),
 	     internal_source_pool->handles_array,
@@ -380,19 +454,46 @@ int libbfio_pool_clone(
 
 		goto on_error;
 	}
-	if( libcdata_list_initialize(
-	     &( internal_destination_pool->last_used_list ),
+	if( libcdata_array_get_number_of_entries(
+	     internal_destination_pool->handles_array,
+	     &number_of_handles,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create last used list.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of handles.",
 		 function );
 
 		goto on_error;
 	}
+	for( entry = 0;
+	     entry < number_of_handles;
+	     entry++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_destination_pool->handles_array,
+		     entry,
+		     (intptr_t **) &handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve handle: %d.",
+			 function,
+			 entry );
+
+			goto on_error;
+		}
+		if( handle == NULL )
+		{
+			continue;
+		}
+		( (libbfio_internal_handle_t *) handle )->pool = (libbfio_pool_t *) internal_destination_pool;
+	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
 	if( libcthreads_read_write_lock_initialize(
 	     &( internal_destination_pool->read_write_lock ),
@@ -407,9 +508,91 @@ int libbfio_pool_clone(
 
 		goto on_error;
 	}
+	if( libcthreads_mutex_initialize(
+	     &( internal_destination_pool->last_used_list_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize last used list mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( internal_destination_pool->last_used_list_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize last used list condition.",
+		 function );
+
+		goto on_error;
+	}
 #endif
+	if( internal_source_pool->block_cache != NULL )
+	{
+		if( libbfio_block_cache_initialize(
+		     &( internal_destination_pool->block_cache ),
+		     internal_source_pool->block_cache->block_size,
+		     (size64_t) internal_source_pool->block_cache->maximum_number_of_blocks * internal_source_pool->block_cache->block_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create block cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( internal_source_pool->handle_closer != NULL )
+	{
+		if( libbfio_handle_closer_initialize(
+		     &( internal_destination_pool->handle_closer ),
+		     internal_source_pool->handle_closer->maximum_number_of_pending_closes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create handle closer.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	internal_destination_pool->maximum_number_of_open_handles = internal_source_pool->maximum_number_of_open_handles;
 
+	/* The descriptor cache is shared with the source pool
+	 */
+	internal_destination_pool->descriptor_cache = internal_source_pool->descriptor_cache;
+
+	if( internal_destination_pool->descriptor_cache != NULL )
+	{
+		if( libbfio_internal_pool_set_descriptor_cache_in_handles(
+		     internal_destination_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set descriptor cache in handles.",
+			 function );
+
+			goto on_error;
+		}
+	}
+
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_source_pool->read_write_lock,
@@ -436,7 +619,31 @@ int libbfio_pool_clone(
 on_error:
 	if( internal_destination_pool != NULL )
 	{
+		if( internal_destination_pool->handle_closer != NULL )
+		{
+			libbfio_handle_closer_free(
+			 &( internal_destination_pool->handle_closer ),
+			 NULL );
+		}
+		if( internal_destination_pool->block_cache != NULL )
+		{
+			libbfio_block_cache_free(
+			 &( internal_destination_pool->block_cache ),
+			 NULL );
+		}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+		if( internal_destination_pool->last_used_list_condition != NULL )
+		{
+			libcthreads_condition_free(
+			 &( internal_destination_pool->last_used_list_condition ),
+			 NULL );
+		}
+		if( internal_destination_pool->last_used_list_mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( internal_destination_pool->last_used_list_mutex ),
+			 NULL );
+		}
 		if( internal_destination_pool->read_write_lock != NULL )
 		{
 			libcthreads_read_write_lock_free(
@@ -444,13 +651,6 @@ on_error:
 			 NULL );
 		}
 #endif
-		if( internal_destination_pool->last_used_list != NULL )
-		{
-			libcdata_list_free(
-			 &( internal_destination_pool->last_used_list ),
-			 NULL,
-			 NULL );
-		}
 		if( internal_destination_pool->handles_array != NULL )
 		{
 			libcdata_array_free(
@@ -479,6 +679,7 @@ int libbfio_pool_resize(
 {
 	libbfio_internal_pool_t *internal_pool = NULL;
 	static char *function                  = "libbfio_pool_resize";
+	int number_of_entries                  = 0;
 	int result                             = 1;
 
 	if( pool == NULL )
@@ -509,11 +710,25 @@ int libbfio_pool_resize(
 		return( -1 );
 	}
 #endif
-	if( libcdata_array_resize(
+	if( libcdata_array_get_number_of_entries(
 	     internal_pool->handles_array,
-	     number_of_handles,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libbfio_handle_free,
+	     &number_of_entries,
 	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of handles.",
+		 function );
+
+		result = -1;
+	}
+	else if( libcdata_array_resize(
+	          internal_pool->handles_array,
+	          number_of_handles,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libbfio_handle_free,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -524,6 +739,34 @@ int libbfio_pool_resize(
 
 		result = -1;
 	}
+	/* Make sure the cached data of the removed handles is not reused by handles appended later
+	 */
+	else if( ( internal_pool->block_cache != NULL )
+	      && ( number_of_handles < number_of_entries ) )
+	{
+		while( number_of_entries > number_of_handles )
+		{
+			number_of_entries--;
+
+			if( libbfio_block_cache_invalidate_entry(
+			     internal_pool->block_cache,
+			     number_of_entries,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to invalidate block cache entry: %d.",
+				 function,
+				 number_of_entries );
+
+				result = -1;
+
+				break;
+			}
+		}
+	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_pool->read_write_lock,
@@ -543,6 +786,9 @@ int libbfio_pool_resize(
 }
 
 /* Opens the handle
+ * The handle is appended to the last used list and a handle that is evicted
+ * to make room for it is closed
+ * This function is not multi-thread safe acquire the pool read/write lock for writing before call
  * Returns 1 if successful or -1 on error
  */
 int libbfio_internal_pool_open_handle(
@@ -551,9 +797,9 @@ int libbfio_internal_pool_open_handle(
      int access_flags,
      libcerror_error_t **error )
 {
-	libbfio_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libbfio_internal_pool_open_handle";
-	int is_open                                = 0;
+	libbfio_handle_t *evicted_handle = NULL;
+	static char *function            = "libbfio_internal_pool_open_handle";
+	int is_open                      = 0;
 
 	if( internal_pool == NULL )
 	{
@@ -566,17 +812,6 @@ int libbfio_internal_pool_open_handle(
 
 		return( -1 );
 	}
-	if( internal_pool->last_used_list == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid pool - missing last used list.",
-		 function );
-
-		return( -1 );
-	}
 	if( handle == NULL )
 	{
 		libcerror_error_set(
@@ -612,6 +847,7 @@ int libbfio_internal_pool_open_handle(
 		if( libbfio_internal_pool_append_handle_to_last_used_list(
 		     internal_pool,
 		     handle,
+		     &evicted_handle,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -623,8 +859,26 @@ int libbfio_internal_pool_open_handle(
 
 			return( -1 );
 		}
+		if( evicted_handle != NULL )
+		{
+			if( libbfio_internal_pool_close_evicted_handle(
+			     internal_pool,
+			     evicted_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close evicted handle.",
+				 function );
+
+				return( -1 );
+			}
+		}
 	}
-	if( libbfio_handle_open(
+	if( libbfio_internal_pool_open_handle_at_current_offset(
+	     internal_pool,
 	     handle,
 	     access_flags,
 	     error ) != 1 )
@@ -638,39 +892,22 @@ int libbfio_internal_pool_open_handle(
 
 		return( -1 );
 	}
-	internal_handle = (libbfio_internal_handle_t *) handle;
-
-	if( libbfio_handle_seek_offset(
-	     handle,
-	     internal_handle->current_offset,
-	     SEEK_SET,
-	     error ) == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset.",
-		 function );
-
-		return( -1 );
-	}
 	return( 1 );
 }
 
-/* Appends the handle to the last used list
- * Closes the less frequently used handle if necessary
+/* Opens the handle and seeks the offset the handle was at before it was closed
+ * This function does not change the last used list, hence it can be called
+ * without holding the last used list mutex
  * Returns 1 if successful or -1 on error
  */
-int libbfio_internal_pool_append_handle_to_last_used_list(
+int libbfio_internal_pool_open_handle_at_current_offset(
      libbfio_internal_pool_t *internal_pool,
-     const libbfio_handle_t *handle,
+     libbfio_handle_t *handle,
+     int access_flags,
      libcerror_error_t **error )
 {
-	libbfio_internal_handle_t *internal_handle           = NULL;
-	libcdata_list_element_t *last_used_list_element      = NULL;
-	libcdata_list_element_t *safe_last_used_list_element = NULL;
-	static char *function                                = "libbfio_internal_pool_append_handle_to_last_used_list";
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_internal_pool_open_handle_at_current_offset";
 
 	if( internal_pool == NULL )
 	{
@@ -683,18 +920,7 @@ int libbfio_internal_pool_append_handle_to_last_used_list(
 
 		return( -1 );
 	}
-	if( internal_pool->last_used_list == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid pool - missing last used list.",
-		 function );
-
-		return( -1 );
-	}
-	if( handle == NULL )
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -705,158 +931,218 @@ int libbfio_internal_pool_append_handle_to_last_used_list(
 
 		return( -1 );
 	}
-	/* Check if there is room in the pool for another open handle
-	 */
-	if( ( internal_pool->maximum_number_of_open_handles != LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES )
-	 && ( ( internal_pool->number_of_open_handles + 1 ) >= internal_pool->maximum_number_of_open_handles ) )
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_pool->descriptor_cache != NULL )
 	{
-		if( libcdata_list_get_last_element(
-		     internal_pool->last_used_list,
-		     &last_used_list_element,
+		/* Setting the access flags first allows a handle that was opened
+		 * with write access before to be opened on demand
+		 */
+		if( libbfio_handle_set_access_flags(
+		     handle,
+		     access_flags,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve last list element from last used list.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set access flags.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-	}
-	if( last_used_list_element == NULL )
-	{
-		if( libcdata_list_element_initialize(
-		     &safe_last_used_list_element,
+		if( libbfio_internal_pool_set_handle_descriptor_cache(
+		     internal_pool,
+		     handle,
+		     access_flags,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create last used list element.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set descriptor cache in handle.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		internal_pool->number_of_open_handles++;
+	}
+	if( libbfio_handle_open(
+	     handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open handle.",
+		 function );
 
-		last_used_list_element = safe_last_used_list_element;
+		return( -1 );
 	}
-	else
+	if( libbfio_handle_seek_offset(
+	     handle,
+	     internal_handle->current_offset,
+	     SEEK_SET,
+	     error ) == -1 )
 	{
-		/* The last used list element is reused to contain the new last used entry
-		 */
-		if( libcdata_list_element_get_value(
-		     last_used_list_element,
-		     (intptr_t **) &internal_handle,
-		     error ) != 1 )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Closes a handle that was evicted from the last used list
+ * The handle was marked as closing when it was evicted and is marked as idle
+ * after the close, other pool operations that want to use the handle wait until then
+ * If the pool has a handle closer the handle is pushed onto it instead and remains
+ * pending to be closed after this function returns
+ * This function must be called without holding the last used list mutex
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_pool_close_evicted_handle(
+     libbfio_internal_pool_t *internal_pool,
+     libbfio_handle_t *handle,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_internal_pool_close_evicted_handle";
+	int result                                 = 0;
+
+	if( internal_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	/* The handle closer closes the handle in the background, unless
+	 * the maximum number of pending closes was reached
+	 */
+	if( internal_pool->handle_closer != NULL )
+	{
+		result = libbfio_handle_closer_push(
+		          internal_pool->handle_closer,
+		          handle,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value from last used list element.",
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push handle onto handle closer.",
 			 function );
-
-			goto on_error;
 		}
-		if( libcdata_list_remove_element(
-		     internal_pool->last_used_list,
-		     last_used_list_element,
-		     error ) != 1 )
+	}
+	if( result == 0 )
+	{
+		result = 1;
+
+		if( libbfio_handle_close(
+		     handle,
+		     error ) != 0 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
-			 "%s: unable to remove last list element from last used list.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close handle.",
 			 function );
 
-			goto on_error;
-		}
-		safe_last_used_list_element = last_used_list_element;
-
-		internal_handle->pool_last_used_list_element = NULL;
-
-		if( internal_handle != NULL )
-		{
-			if( libbfio_handle_close(
-			     (libbfio_handle_t *) internal_handle,
-			     error ) != 0 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-				 "%s: unable to close handle.",
-				 function );
-
-				goto on_error;
-			}
-			/* Make sure the truncate flag is removed from the handle
-			 */
-			internal_handle->access_flags &= ~( LIBBFIO_ACCESS_FLAG_TRUNCATE );
+			result = -1;
 		}
 	}
-	internal_handle = (libbfio_internal_handle_t *) handle;
-
-	if( libcdata_list_element_set_value(
-	     last_used_list_element,
-	     (intptr_t *) handle,
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     internal_pool->last_used_list_mutex,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set value in last used list element.",
+		 "%s: unable to grab last used list mutex.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libcdata_list_prepend_element(
-	     internal_pool->last_used_list,
-	     last_used_list_element,
+#endif
+	internal_handle->pool_state = LIBBFIO_POOL_HANDLE_STATE_IDLE;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_condition_broadcast(
+	     internal_pool->last_used_list_condition,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to prepend last used list element to list.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast last used list condition.",
 		 function );
 
-		goto on_error;
+		result = -1;
 	}
-	internal_handle->pool_last_used_list_element = last_used_list_element;
-
-	return( 1 );
-
-on_error:
-	if( safe_last_used_list_element != NULL )
+	if( libcthreads_mutex_release(
+	     internal_pool->last_used_list_mutex,
+	     error ) != 1 )
 	{
-		libcdata_list_element_free(
-		 &safe_last_used_list_element,
-		 NULL,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release last used list mutex.",
+		 function );
+
+		return( -1 );
 	}
-	return( -1 );
+#endif
+	return( result );
 }
 
-/* Moves the handle to the front of the last used list
+/* Appends the handle to the front of the last used list
+ * If there is no room for another open handle the least recently used handle
+ * that is not in use is removed from the last used list, marked as closing and
+ * returned as the evicted handle, which the caller must close with
+ * libbfio_internal_pool_close_evicted_handle after releasing the last used list mutex
  * Returns 1 if successful or -1 on error
  */
-int libbfio_internal_pool_move_handle_to_front_of_last_used_list(
+int libbfio_internal_pool_append_handle_to_last_used_list(
      libbfio_internal_pool_t *internal_pool,
-     libbfio_handle_t *handle,
+     const libbfio_handle_t *handle,
+     libbfio_handle_t **evicted_handle,
      libcerror_error_t **error )
 {
-	libbfio_internal_handle_t *internal_handle      = NULL;
-	libcdata_list_element_t *first_list_element     = NULL;
-	libcdata_list_element_t *last_used_list_element = NULL;
-	static char *function                           = "libbfio_internal_pool_move_handle_to_front_of_last_used_list";
+	libbfio_internal_handle_t *internal_handle  = NULL;
+	libbfio_internal_handle_t *last_used_handle = NULL;
+	static char *function                       = "libbfio_internal_pool_append_handle_to_last_used_list";
 
 	if( internal_pool == NULL )
 	{
@@ -869,113 +1155,117 @@ int libbfio_internal_pool_move_handle_to_front_of_last_used_list(
 
 		return( -1 );
 	}
-	if( internal_pool->last_used_list == NULL )
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid pool - missing last used list.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( handle == NULL )
+	if( evicted_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 "%s: invalid evicted handle.",
 		 function );
 
 		return( -1 );
 	}
 	internal_handle = (libbfio_internal_handle_t *) handle;
 
-	if( libcdata_list_get_first_element(
-	     internal_pool->last_used_list,
-	     &first_list_element,
+	*evicted_handle = NULL;
+
+	/* A handle that already is in the last used list is moved to the front
+	 */
+	if( libbfio_internal_pool_remove_handle_from_last_used_list(
+	     internal_pool,
+	     handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first list element from last used list.",
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove handle from last used list.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( internal_handle->pool_last_used_list_element == NULL )
+	/* Check if there is room in the pool for another open handle
+	 * handles that are in use by another pool operation are not closed,
+	 * hence the pool can temporarily exceed the maximum number of open handles
+	 * handles that are pending to be closed by the handle closer do not count
+	 * as open handles, their number is limited by the handle closer
+	 */
+	if( ( internal_pool->maximum_number_of_open_handles != LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES )
+	 && ( internal_pool->number_of_open_handles >= internal_pool->maximum_number_of_open_handles ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing last used list element.",
-		 function );
+		last_used_handle = internal_pool->last_used_list_last_handle;
 
-		goto on_error;
-	}
-	if( internal_handle->pool_last_used_list_element != first_list_element )
-	{
-		if( libcdata_list_remove_element(
-		     internal_pool->last_used_list,
-		     last_used_list_element,
-		     error ) != 1 )
+		while( ( last_used_handle != NULL )
+		    && ( last_used_handle->pool_number_of_references > 0 ) )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
-			 "%s: unable to remove last used list element from list.",
-			 function );
-
-			goto on_error;
+			last_used_handle = last_used_handle->pool_last_used_previous_handle;
 		}
-		internal_handle->pool_last_used_list_element = NULL;
-
-		if( libcdata_list_prepend_element(
-		     internal_pool->last_used_list,
-		     last_used_list_element,
-		     error ) != 1 )
+		if( last_used_handle != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to prepend last used list element to list.",
-			 function );
+			if( libbfio_internal_pool_remove_handle_from_last_used_list(
+			     internal_pool,
+			     (libbfio_handle_t *) last_used_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove last used handle from last used list.",
+				 function );
 
-			goto on_error;
+				return( -1 );
+			}
+			/* Make sure the truncate flag is removed from the handle
+			 */
+			last_used_handle->access_flags &= ~( LIBBFIO_ACCESS_FLAG_TRUNCATE );
+			last_used_handle->pool_state    = LIBBFIO_POOL_HANDLE_STATE_CLOSING;
+
+			*evicted_handle = (libbfio_handle_t *) last_used_handle;
 		}
-		internal_handle->pool_last_used_list_element = last_used_list_element;
 	}
-	return( 1 );
+	internal_handle->pool_last_used_previous_handle = NULL;
+	internal_handle->pool_last_used_next_handle     = internal_pool->last_used_list_first_handle;
 
-on_error:
-	if( last_used_list_element != NULL )
+	if( internal_pool->last_used_list_first_handle != NULL )
 	{
-		libcdata_list_element_free(
-		 &last_used_list_element,
-		 NULL,
-		 NULL );
+		internal_pool->last_used_list_first_handle->pool_last_used_previous_handle = internal_handle;
 	}
-	return( -1 );
+	else
+	{
+		internal_pool->last_used_list_last_handle = internal_handle;
+	}
+	internal_pool->last_used_list_first_handle = internal_handle;
+	internal_handle->pool_in_last_used_list    = 1;
+
+	internal_pool->number_of_open_handles += 1;
+
+	return( 1 );
 }
 
-/* Removes a handle from the last used list
+/* Moves the handle to the front of the last used list
  * Returns 1 if successful or -1 on error
  */
-int libbfio_internal_pool_remove_handle_from_last_used_list(
+int libbfio_internal_pool_move_handle_to_front_of_last_used_list(
      libbfio_internal_pool_t *internal_pool,
-     const libbfio_handle_t *handle,
+     libbfio_handle_t *handle,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *last_used_handle              = NULL;
-	libcdata_list_element_t *last_used_list_element = NULL;
-	static char *function                           = "libbfio_internal_pool_remove_handle_from_last_used_list";
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_internal_pool_move_handle_to_front_of_last_used_list";
 
 	if( internal_pool == NULL )
 	{
@@ -999,89 +1289,241 @@ int libbfio_internal_pool_remove_handle_from_last_used_list(
 
 		return( -1 );
 	}
-	if( libcdata_list_get_first_element(
-	     internal_pool->last_used_list,
-	     &last_used_list_element,
-	     error ) != 1 )
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->pool_in_last_used_list == 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first list element from last used list.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing from last used list.",
 		 function );
 
 		return( -1 );
 	}
-	while( last_used_list_element != NULL )
+	if( internal_pool->last_used_list_first_handle != internal_handle )
 	{
-		if( libcdata_list_element_get_value(
-		     last_used_list_element,
-		     (intptr_t **) &last_used_handle,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve last used handle.",
-			 function );
+		/* The handle is not the first handle hence it has a previous handle
+		 */
+		internal_handle->pool_last_used_previous_handle->pool_last_used_next_handle = internal_handle->pool_last_used_next_handle;
 
-			return( -1 );
-		}
-		if( last_used_handle == handle )
+		if( internal_handle->pool_last_used_next_handle != NULL )
 		{
-			break;
+			internal_handle->pool_last_used_next_handle->pool_last_used_previous_handle = internal_handle->pool_last_used_previous_handle;
 		}
-		if( libcdata_list_element_get_next_element(
-		     last_used_list_element,
-		     &last_used_list_element,
-		     error ) != 1 )
+		else
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next last used list element.",
-			 function );
-
-			return( -1 );
+			internal_pool->last_used_list_last_handle = internal_handle->pool_last_used_previous_handle;
 		}
+		internal_handle->pool_last_used_previous_handle = NULL;
+		internal_handle->pool_last_used_next_handle     = internal_pool->last_used_list_first_handle;
+
+		internal_pool->last_used_list_first_handle->pool_last_used_previous_handle = internal_handle;
+		internal_pool->last_used_list_first_handle                                 = internal_handle;
 	}
-	if( last_used_list_element != NULL )
+	return( 1 );
+}
+
+/* Removes a handle from the last used list
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_pool_remove_handle_from_last_used_list(
+     libbfio_internal_pool_t *internal_pool,
+     const libbfio_handle_t *handle,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_internal_pool_remove_handle_from_last_used_list";
+
+	if( internal_pool == NULL )
 	{
-		if( libcdata_list_remove_element(
-		     internal_pool->last_used_list,
-		     last_used_list_element,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
-			 "%s: unable to remove last list element from last used list.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
 
-			return( -1 );
-		}
-		if( libcdata_list_element_free(
-		     &last_used_list_element,
-		     NULL,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free last used list element.",
-			 function );
+		return( -1 );
+	}
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->pool_in_last_used_list == 0 )
+	{
+		return( 1 );
+	}
+	if( internal_handle->pool_last_used_previous_handle != NULL )
+	{
+		internal_handle->pool_last_used_previous_handle->pool_last_used_next_handle = internal_handle->pool_last_used_next_handle;
+	}
+	else
+	{
+		internal_pool->last_used_list_first_handle = internal_handle->pool_last_used_next_handle;
+	}
+	if( internal_handle->pool_last_used_next_handle != NULL )
+	{
+		internal_handle->pool_last_used_next_handle->pool_last_used_previous_handle = internal_handle->pool_last_used_previous_handle;
+	}
+	else
+	{
+		internal_pool->last_used_list_last_handle = internal_handle->pool_last_used_previous_handle;
+	}
+	internal_handle->pool_last_used_previous_handle = NULL;
+	internal_handle->pool_last_used_next_handle     = NULL;
+	internal_handle->pool_in_last_used_list         = 0;
+
+	internal_pool->number_of_open_handles -= 1;
+
+	return( 1 );
+}
+
+/* Waits until a handle is no longer pending to be closed by the handle closer
+ * A handle that was evicted from the last used list is pending to be closed
+ * until the handle closer has closed it, hence it cannot be used before then
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_pool_wait_for_pending_close(
+     libbfio_internal_pool_t *internal_pool,
+     libbfio_handle_t *handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_internal_pool_wait_for_pending_close";
+
+	if( internal_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_pool->handle_closer == NULL )
+	{
+		return( 1 );
+	}
+	if( libbfio_handle_closer_wait_for_handle(
+	     internal_pool->handle_closer,
+	     handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to wait for pending close of handle.",
+		 function );
+
+		return( -1 );
 	}
 	return( 1 );
 }
 
+/* Sets or clears the pool of a handle
+ * A handle can only be in one pool since the pool last used list is linked through the handle
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_pool_set_handle_pool(
+     libbfio_internal_pool_t *internal_pool,
+     libbfio_handle_t *handle,
+     uint8_t is_in_pool,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_internal_pool_set_handle_pool";
+	int result                                 = 1;
+
+	if( internal_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( is_in_pool != 0 )
+	 && ( internal_handle->pool != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle - already in a pool.",
+		 function );
+
+		result = -1;
+	}
+	else if( is_in_pool != 0 )
+	{
+		internal_handle->pool = (libbfio_pool_t *) internal_pool;
+	}
+	else
+	{
+		internal_handle->pool = NULL;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
 /* Retrieves the number of handles in the pool
  * Returns 1 if successful or -1 on error
  */
@@ -1231,6 +1673,7 @@ int libbfio_pool_get_handle(
 
 /* Appends a handle to the pool
  * Sets the entry
+ * A handle can only be in one pool
  * Returns 1 if successful or -1 on error
  */
 int libbfio_pool_append_handle(
@@ -1240,12 +1683,14 @@ int libbfio_pool_append_handle(
      int access_flags,
      libcerror_error_t **error )
 {
+	libbfio_handle_t *evicted_handle       = NULL;
 	libbfio_internal_pool_t *internal_pool = NULL;
 	static char *function                  = "libbfio_pool_append_handle";
 	int is_open                            = 0;
 	int number_of_handles                  = 0;
 	int result                             = 1;
 	int safe_entry                         = -1;
+	uint8_t handle_is_in_pool              = 0;
 
 	if( pool == NULL )
 	{
@@ -1260,17 +1705,6 @@ int libbfio_pool_append_handle(
 	}
 	internal_pool = (libbfio_internal_pool_t *) pool;
 
-	if( internal_pool->last_used_list == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid pool - missing last used list.",
-		 function );
-
-		return( -1 );
-	}
 	if( entry == NULL )
 	{
 		libcerror_error_set(
@@ -1333,55 +1767,96 @@ int libbfio_pool_append_handle(
 		return( -1 );
 	}
 #endif
-	if( libcdata_array_get_number_of_entries(
-	     internal_pool->handles_array,
-	     &number_of_handles,
+	if( libbfio_internal_pool_set_handle_pool(
+	     internal_pool,
+	     handle,
+	     1,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of handles.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set pool in handle.",
 		 function );
 
 		result = -1;
 	}
-	else if( ( internal_pool->number_of_used_handles + 1 ) >= number_of_handles )
+	else
+	{
+		handle_is_in_pool = 1;
+	}
+	if( result == 1 )
 	{
-		if( libcdata_array_append_entry(
+		if( libcdata_array_get_number_of_entries(
 		     internal_pool->handles_array,
-		     &safe_entry,
-		     (intptr_t *) handle,
+		     &number_of_handles,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append handle.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of handles.",
 			 function );
 
 			result = -1;
 		}
+		else if( ( internal_pool->number_of_used_handles + 1 ) >= number_of_handles )
+		{
+			if( libcdata_array_append_entry(
+			     internal_pool->handles_array,
+			     &safe_entry,
+			     (intptr_t *) handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		else
+		{
+			safe_entry = internal_pool->number_of_used_handles;
+
+			if( libcdata_array_set_entry_by_index(
+			     internal_pool->handles_array,
+			     safe_entry,
+			     (intptr_t *) handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to set handle: %d.",
+				 function,
+				 safe_entry );
+
+				result = -1;
+			}
+		}
 	}
-	else
+	if( ( result == 1 )
+	 && ( internal_pool->descriptor_cache != NULL ) )
 	{
-		safe_entry = internal_pool->number_of_used_handles;
-
-		if( libcdata_array_set_entry_by_index(
-		     internal_pool->handles_array,
-		     safe_entry,
-		     (intptr_t *) handle,
+		if( libbfio_internal_pool_set_handle_descriptor_cache(
+		     internal_pool,
+		     handle,
+		     ( (libbfio_internal_handle_t *) handle )->access_flags,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to set handle: %d.",
-			 function,
-			 safe_entry );
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set descriptor cache in handle.",
+			 function );
 
 			result = -1;
 		}
@@ -1397,6 +1872,7 @@ int libbfio_pool_append_handle(
 				if( libbfio_internal_pool_append_handle_to_last_used_list(
 				     internal_pool,
 				     handle,
+				     &evicted_handle,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
@@ -1408,6 +1884,23 @@ int libbfio_pool_append_handle(
 
 					result = -1;
 				}
+				else if( evicted_handle != NULL )
+				{
+					if( libbfio_internal_pool_close_evicted_handle(
+					     internal_pool,
+					     evicted_handle,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+						 "%s: unable to close evicted handle.",
+						 function );
+
+						result = -1;
+					}
+				}
 			}
 		}
 	}
@@ -1445,10 +1938,19 @@ on_error:
 
 		internal_pool->number_of_used_handles -= 1;
 	}
+	if( handle_is_in_pool != 0 )
+	{
+		libbfio_internal_pool_set_handle_pool(
+		 internal_pool,
+		 handle,
+		 0,
+		 NULL );
+	}
 	return( -1 );
 }
 
 /* Sets a specific handle in the pool
+ * A handle can only be in one pool
  * Returns 1 if successful or -1 on error
  */
 int libbfio_pool_set_handle(
@@ -1459,10 +1961,12 @@ int libbfio_pool_set_handle(
      libcerror_error_t **error )
 {
 	libbfio_internal_handle_t *backup_handle = NULL;
+	libbfio_handle_t *evicted_handle         = NULL;
 	libbfio_internal_pool_t *internal_pool   = NULL;
 	static char *function                    = "libbfio_pool_set_handle";
 	int is_open                              = 0;
 	int result                               = 1;
+	uint8_t handle_is_in_pool                = 0;
 
 	if( pool == NULL )
 	{
@@ -1477,17 +1981,6 @@ int libbfio_pool_set_handle(
 	}
 	internal_pool = (libbfio_internal_pool_t *) pool;
 
-	if( internal_pool->last_used_list == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid pool - missing last used list.",
-		 function );
-
-		return( -1 );
-	}
 	/* Check if the handle is open
 	 */
 	is_open = libbfio_handle_is_open(
@@ -1568,6 +2061,21 @@ int libbfio_pool_set_handle(
 
 		result = -1;
 	}
+	else if( libbfio_internal_pool_set_handle_pool(
+	          internal_pool,
+	          handle,
+	          1,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set pool in handle.",
+		 function );
+
+		result = -1;
+	}
 	else if( libcdata_array_set_entry_by_index(
 	          internal_pool->handles_array,
 	          entry,
@@ -1582,8 +2090,33 @@ int libbfio_pool_set_handle(
 		 function,
 		 entry );
 
+		handle_is_in_pool = 1;
+
 		result = -1;
 	}
+	else
+	{
+		handle_is_in_pool = 1;
+	}
+	if( ( result == 1 )
+	 && ( internal_pool->descriptor_cache != NULL ) )
+	{
+		if( libbfio_internal_pool_set_handle_descriptor_cache(
+		     internal_pool,
+		     handle,
+		     ( (libbfio_internal_handle_t *) handle )->access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set descriptor cache in handle.",
+			 function );
+
+			result = -1;
+		}
+	}
 	if( result == 1 )
 	{
 		if( is_open != 0 )
@@ -1593,6 +2126,7 @@ int libbfio_pool_set_handle(
 				if( libbfio_internal_pool_append_handle_to_last_used_list(
 				     internal_pool,
 				     handle,
+				     &evicted_handle,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
@@ -1604,13 +2138,25 @@ int libbfio_pool_set_handle(
 
 					result = -1;
 				}
+				else if( evicted_handle != NULL )
+				{
+					if( libbfio_internal_pool_close_evicted_handle(
+					     internal_pool,
+					     evicted_handle,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+						 "%s: unable to close evicted handle.",
+						 function );
+
+						result = -1;
+					}
+				}
 			}
 		}
-		if( entry == internal_pool->current_entry )
-		{
-			internal_pool->current_entry  = -1;
-			internal_pool->current_handle = NULL;
-		}
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -1640,6 +2186,14 @@ on_error:
 	 (intptr_t *) backup_handle,
 	 NULL );
 
+	if( handle_is_in_pool != 0 )
+	{
+		libbfio_internal_pool_set_handle_pool(
+		 internal_pool,
+		 handle,
+		 0,
+		 NULL );
+	}
 	return( -1 );
 }
 
@@ -1653,6 +2207,7 @@ int libbfio_pool_remove_handle(
      libcerror_error_t **error )
 {
 	libbfio_handle_t *backup_handle        = NULL;
+	libbfio_handle_t *evicted_handle       = NULL;
 	libbfio_internal_pool_t *internal_pool = NULL;
 	static char *function                  = "libbfio_pool_remove_handle";
 	int result                             = 1;
@@ -1670,17 +2225,6 @@ int libbfio_pool_remove_handle(
 	}
 	internal_pool = (libbfio_internal_pool_t *) pool;
 
-	if( internal_pool->last_used_list == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid pool - missing last used list.",
-		 function );
-
-		return( -1 );
-	}
 	if( handle == NULL )
 	{
 		libcerror_error_set(
@@ -1725,6 +2269,70 @@ int libbfio_pool_remove_handle(
 
 		result = -1;
 	}
+	/* The cached data is removed first so that the handle is not removed if this fails
+	 */
+	if( ( result == 1 )
+	 && ( internal_pool->block_cache != NULL ) )
+	{
+		if( libbfio_block_cache_invalidate_entry(
+		     internal_pool->block_cache,
+		     entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to invalidate block cache entry: %d.",
+			 function,
+			 entry );
+
+			result = -1;
+		}
+	}
+	if( ( result == 1 )
+	 && ( backup_handle != NULL ) )
+	{
+		if( libbfio_internal_pool_wait_for_pending_close(
+		     internal_pool,
+		     backup_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for pending close of handle: %d.",
+			 function,
+			 entry );
+
+			result = -1;
+		}
+	}
+	/* The handle is detached from the descriptor cache of the pool since the pool
+	 * no longer manages the lifetime of the handle
+	 */
+	if( ( result == 1 )
+	 && ( backup_handle != NULL )
+	 && ( internal_pool->descriptor_cache != NULL )
+	 && ( ( (libbfio_internal_handle_t *) backup_handle )->descriptor_cache == internal_pool->descriptor_cache ) )
+	{
+		if( libbfio_handle_set_descriptor_cache(
+		     backup_handle,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to remove descriptor cache from handle: %d.",
+			 function,
+			 entry );
+
+			result = -1;
+		}
+	}
 	if( result == 1 )
 	{
 		if( libbfio_internal_pool_remove_handle_from_last_used_list(
@@ -1743,13 +2351,28 @@ int libbfio_pool_remove_handle(
 			result = -1;
 		}
 	}
-	if( result == 1 )
+	if( ( result == 1 )
+	 && ( backup_handle != NULL ) )
 	{
-		if( entry == internal_pool->current_entry )
+		if( libbfio_internal_pool_set_handle_pool(
+		     internal_pool,
+		     backup_handle,
+		     0,
+		     error ) != 1 )
 		{
-			internal_pool->current_entry  = -1;
-			internal_pool->current_handle = NULL;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to clear pool in handle: %d.",
+			 function,
+			 entry );
+
+			result = -1;
 		}
+	}
+	if( result == 1 )
+	{
 		if( libcdata_array_set_entry_by_index(
 		     internal_pool->handles_array,
 		     entry,
@@ -1764,10 +2387,28 @@ int libbfio_pool_remove_handle(
 			 function,
 			 entry );
 
-			libbfio_internal_pool_append_handle_to_last_used_list(
-			 internal_pool,
-			 backup_handle,
-			 NULL );
+			if( backup_handle != NULL )
+			{
+				libbfio_internal_pool_set_handle_pool(
+				 internal_pool,
+				 backup_handle,
+				 1,
+				 NULL );
+			}
+			if( libbfio_internal_pool_append_handle_to_last_used_list(
+			     internal_pool,
+			     backup_handle,
+			     &evicted_handle,
+			     NULL ) == 1 )
+			{
+				if( evicted_handle != NULL )
+				{
+					libbfio_internal_pool_close_evicted_handle(
+					 internal_pool,
+					 evicted_handle,
+					 NULL );
+				}
+			}
 
 			result = -1;
 		}
@@ -1807,10 +2448,28 @@ on_error:
 		  (intptr_t *) backup_handle,
 		  NULL );
 
-		libbfio_internal_pool_append_handle_to_last_used_list(
-		 internal_pool,
-		 backup_handle,
-		 NULL );
+		if( backup_handle != NULL )
+		{
+			libbfio_internal_pool_set_handle_pool(
+			 internal_pool,
+			 backup_handle,
+			 1,
+			 NULL );
+		}
+		if( libbfio_internal_pool_append_handle_to_last_used_list(
+		     internal_pool,
+		     backup_handle,
+		     &evicted_handle,
+		     NULL ) == 1 )
+		{
+			if( evicted_handle != NULL )
+			{
+				libbfio_internal_pool_close_evicted_handle(
+				 internal_pool,
+				 evicted_handle,
+				 NULL );
+			}
+		}
 
 		internal_pool->number_of_used_handles += 1;
 	}
@@ -1896,11 +2555,9 @@ int libbfio_pool_set_maximum_number_of_open_handles(
      int maximum_number_of_open_handles,
      libcerror_error_t **error )
 {
-	libbfio_internal_handle_t *internal_handle           = NULL;
-	libbfio_internal_pool_t *internal_pool               = NULL;
-	libcdata_list_element_t *last_used_list_element      = NULL;
-	libcdata_list_element_t *safe_last_used_list_element = NULL;
-	static char *function                                = "libbfio_pool_set_maximum_number_of_open_handles";
+	libbfio_internal_handle_t *internal_handle = NULL;
+	libbfio_internal_pool_t *internal_pool     = NULL;
+	static char *function                      = "libbfio_pool_set_maximum_number_of_open_handles";
 
 	if( pool == NULL )
 	{
@@ -1946,63 +2603,33 @@ int libbfio_pool_set_maximum_number_of_open_handles(
 	while( ( internal_pool->maximum_number_of_open_handles != LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES )
 	    && ( internal_pool->number_of_open_handles > internal_pool->maximum_number_of_open_handles ) )
 	{
-		if( libcdata_list_get_last_element(
-		     internal_pool->last_used_list,
-		     &last_used_list_element,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve last list element from last used list.",
-			 function );
-
-			goto on_error;
-		}
-		if( libcdata_list_element_get_value(
-		     last_used_list_element,
-		     (intptr_t **) &internal_handle,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value from last used list element.",
-			 function );
+		internal_handle = internal_pool->last_used_list_last_handle;
 
-			goto on_error;
-		}
 		if( internal_handle == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing last used list element value.",
+			 "%s: invalid pool - missing last used list last handle.",
 			 function );
 
 			goto on_error;
 		}
-		if( libcdata_list_remove_element(
-		     internal_pool->last_used_list,
-		     last_used_list_element,
+		if( libbfio_internal_pool_remove_handle_from_last_used_list(
+		     internal_pool,
+		     (libbfio_handle_t *) internal_handle,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
-			 "%s: unable to remove last used list element from list.",
+			 "%s: unable to remove last used handle from last used list.",
 			 function );
 
 			goto on_error;
 		}
-		safe_last_used_list_element = last_used_list_element;
-
-		internal_handle->pool_last_used_list_element = NULL;
-
 		if( libbfio_handle_close(
 		     (libbfio_handle_t *) internal_handle,
 		     error ) != 0 )
@@ -2016,26 +2643,9 @@ int libbfio_pool_set_maximum_number_of_open_handles(
 
 			goto on_error;
 		}
-		internal_pool->number_of_open_handles--;
-
 		/* Make sure the truncate flag is removed from the handle
 		 */
 		internal_handle->access_flags &= ~( LIBBFIO_ACCESS_FLAG_TRUNCATE );
-
-		if( libcdata_list_element_free(
-		     &safe_last_used_list_element,
-		     NULL,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free last used list element.",
-			 function );
-
-			goto on_error;
-		}
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -2055,13 +2665,6 @@ int libbfio_pool_set_maximum_number_of_open_handles(
 	return( 1 );
 
 on_error:
-	if( safe_last_used_list_element != NULL )
-	{
-		libcdata_list_element_free(
-		 &safe_last_used_list_element,
-		 NULL,
-		 NULL );
-	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
 	libcthreads_read_write_lock_release_for_write(
 	 internal_pool->read_write_lock,
@@ -2070,20 +2673,18 @@ on_error:
 	return( -1 );
 }
 
-/* Opens a handle in the pool
+/* Retrieves the maximum number of pending closes in the pool
  * Returns 1 if successful or -1 on error
  */
-int libbfio_internal_pool_open(
-     libbfio_internal_pool_t *internal_pool,
-     int entry,
-     int access_flags,
+int libbfio_pool_get_maximum_number_of_pending_closes(
+     libbfio_pool_t *pool,
+     int *maximum_number_of_pending_closes,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *handle = NULL;
-	static char *function    = "libbfio_internal_pool_open";
-	int is_open              = 0;
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_pool_get_maximum_number_of_pending_closes";
 
-	if( internal_pool == NULL )
+	if( pool == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -2094,85 +2695,78 @@ int libbfio_internal_pool_open(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_pool->handles_array,
-	     entry,
-	     (intptr_t **) &handle,
-	     error ) != 1 )
+	internal_pool = (libbfio_internal_pool_t *) pool;
+
+	if( maximum_number_of_pending_closes == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve handle: %d.",
-		 function,
-		 entry );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum number of pending closes.",
+		 function );
 
 		return( -1 );
 	}
-	/* Make sure the handle is not already open
-	 */
-	is_open = libbfio_handle_is_open(
-	           handle,
-	           error );
-
-	if( is_open == -1 )
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine if entry: %d is open.",
-		 function,
-	         entry );
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
 
 		return( -1 );
 	}
-	else if( is_open == 1 )
+#endif
+	if( internal_pool->handle_closer == NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: entry: %d is already open.",
-		 function,
-	         entry );
-
-		return( -1 );
+		*maximum_number_of_pending_closes = 0;
 	}
-	if( libbfio_internal_pool_open_handle(
-	     internal_pool,
-	     handle,
-	     access_flags,
+	else
+	{
+		*maximum_number_of_pending_closes = internal_pool->handle_closer->maximum_number_of_pending_closes;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open entry: %d.",
-		 function,
-		 entry );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
 
 		return( -1 );
 	}
-	internal_pool->current_entry  = entry;
-	internal_pool->current_handle = handle;
-
+#endif
 	return( 1 );
 }
 
-/* Opens a handle in the pool
+/* Sets the maximum number of pending closes in the pool
+ * If the maximum is not 0 a handle that is evicted from the pool to make room for
+ * another open handle is closed by a background thread, so that the read that
+ * triggered the eviction does not wait for the close, otherwise the handle is
+ * closed when it is evicted
+ * The handles that are pending to be closed do not count as open handles, hence
+ * at most the maximum number of open handles plus the maximum number of pending
+ * closes handles are open at the same time, if the maximum number of pending closes
+ * is reached an evicted handle is closed when it is evicted
  * Returns 1 if successful or -1 on error
  */
-int libbfio_pool_open(
+int libbfio_pool_set_maximum_number_of_pending_closes(
      libbfio_pool_t *pool,
-     int entry,
-     int access_flags,
+     int maximum_number_of_pending_closes,
      libcerror_error_t **error )
 {
 	libbfio_internal_pool_t *internal_pool = NULL;
-	static char *function                  = "libbfio_pool_open";
+	static char *function                  = "libbfio_pool_set_maximum_number_of_pending_closes";
 	int result                             = 1;
 
 	if( pool == NULL )
@@ -2188,8 +2782,19 @@ int libbfio_pool_open(
 	}
 	internal_pool = (libbfio_internal_pool_t *) pool;
 
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( maximum_number_of_pending_closes < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of pending closes value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2203,21 +2808,41 @@ int libbfio_pool_open(
 		return( -1 );
 	}
 #endif
-	if( libbfio_internal_pool_open(
-	     internal_pool,
-	     entry,
-	     access_flags,
-	     error ) != 1 )
+	/* Freeing the handle closer waits for the pending closes
+	 */
+	if( internal_pool->handle_closer != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open entry: %d.",
-		 function,
-		 entry );
+		if( libbfio_handle_closer_free(
+		     &( internal_pool->handle_closer ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free handle closer.",
+			 function );
 
-		result = -1;
+			result = -1;
+		}
+	}
+	if( ( result == 1 )
+	 && ( maximum_number_of_pending_closes > 0 ) )
+	{
+		if( libbfio_handle_closer_initialize(
+		     &( internal_pool->handle_closer ),
+		     maximum_number_of_pending_closes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create handle closer.",
+			 function );
+
+			result = -1;
+		}
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -2237,18 +2862,23 @@ int libbfio_pool_open(
 	return( result );
 }
 
-/* Reopens a handle in the pool
+/* Sets the block cache of the pool
+ * The block cache is shared by the handles in the pool and contains at most
+ * maximum cache size bytes of data, in blocks of block size
+ * The cached data of a handle remains valid when the pool closes the handle
+ * A maximum cache size of 0 removes the block cache
  * Returns 1 if successful or -1 on error
  */
-int libbfio_pool_reopen(
+int libbfio_pool_set_block_cache(
      libbfio_pool_t *pool,
-     int entry,
-     int access_flags,
+     size_t block_size,
+     size64_t maximum_cache_size,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *handle               = NULL;
-	libbfio_internal_pool_t *internal_pool = NULL;
-	static char *function                  = "libbfio_pool_reopen";
+	libbfio_block_cache_t *backup_block_cache = NULL;
+	libbfio_block_cache_t *block_cache        = NULL;
+	libbfio_internal_pool_t *internal_pool    = NULL;
+	static char *function                     = "libbfio_pool_set_block_cache";
 
 	if( pool == NULL )
 	{
@@ -2263,6 +2893,24 @@ int libbfio_pool_reopen(
 	}
 	internal_pool = (libbfio_internal_pool_t *) pool;
 
+	if( maximum_cache_size > 0 )
+	{
+		if( libbfio_block_cache_initialize(
+		     &block_cache,
+		     block_size,
+		     maximum_cache_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create block cache.",
+			 function );
+
+			return( -1 );
+		}
+	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_pool->read_write_lock,
@@ -2275,42 +2923,14 @@ int libbfio_pool_reopen(
 		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
-		return( -1 );
-	}
-#endif
-	if( libcdata_array_get_entry_by_index(
-	     internal_pool->handles_array,
-	     entry,
-	     (intptr_t **) &handle,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve handle: %d.",
-		 function,
-		 entry );
-
-		goto on_error;
-	}
-	if( libbfio_handle_reopen(
-	     handle,
-	     access_flags,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to reopen handle for entry: %d.",
-		 function,
-		 entry );
-
 		goto on_error;
 	}
-	internal_pool->current_entry  = entry;
-	internal_pool->current_handle = handle;
+#endif
+	/* The previous block cache is freed after the read/write lock is released
+	 */
+	backup_block_cache         = internal_pool->block_cache;
+	internal_pool->block_cache = block_cache;
+	block_cache                = backup_block_cache;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -2324,180 +2944,52 @@ int libbfio_pool_reopen(
 		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		return( -1 );
-	}
-#endif
-	return( 1 );
-
-on_error:
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	libcthreads_read_write_lock_release_for_write(
-	 internal_pool->read_write_lock,
-	 NULL );
-#endif
-	return( -1 );
-}
-
-/* Closes a handle in the pool
- * Returns 0 if successful or -1 on error
- */
-int libbfio_internal_pool_close(
-     libbfio_internal_pool_t *internal_pool,
-     int entry,
-     libcerror_error_t **error )
-{
-	libbfio_handle_t *handle                             = NULL;
-	libbfio_internal_handle_t *internal_handle           = NULL;
-	libcdata_list_element_t *last_used_list_element      = NULL;
-	libcdata_list_element_t *safe_last_used_list_element = NULL;
-	static char *function                                = "libbfio_internal_pool_close";
-
-	if( internal_pool == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid pool.",
-		 function );
-
-		return( -1 );
-	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_pool->handles_array,
-	     entry,
-	     (intptr_t **) &handle,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve handle: %d.",
-		 function,
-		 entry );
-
-		goto on_error;
-	}
-	if( handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid pool - missing handle for entry: %d.",
-		 function,
-		 entry );
-
 		goto on_error;
 	}
-	if( internal_pool->maximum_number_of_open_handles != LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES )
+#endif
+	if( block_cache != NULL )
 	{
-/* TODO move into get function */
-		internal_handle = (libbfio_internal_handle_t *) handle;
-
-		last_used_list_element = internal_handle->pool_last_used_list_element;
-
-		if( libcdata_list_element_get_value(
-		     last_used_list_element,
-		     (intptr_t **) &internal_handle,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value from last used list element.",
-			 function );
-
-			goto on_error;
-		}
-		if( internal_handle == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing last used list element value.",
-			 function );
-
-			goto on_error;
-		}
-		if( libcdata_list_remove_element(
-		     internal_pool->last_used_list,
-		     last_used_list_element,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
-			 "%s: unable to remove last used list element from list.",
-			 function );
-
-			goto on_error;
-		}
-		safe_last_used_list_element = last_used_list_element;
-
-		internal_handle->pool_last_used_list_element = NULL;
-
-		if( libcdata_list_element_free(
-		     &safe_last_used_list_element,
-		     NULL,
+		if( libbfio_block_cache_free(
+		     &block_cache,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free last used list element.",
+			 "%s: unable to free block cache.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
-	if( libbfio_handle_close(
-	     handle,
-	     error ) != 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-		 "%s: unable to close handle for entry: %d.",
-		 function,
-		 entry );
-
-		goto on_error;
-	}
-	if( entry == internal_pool->current_entry )
-	{
-		internal_pool->current_entry  = -1;
-		internal_pool->current_handle = NULL;
-	}
-	return( 0 );
+	return( 1 );
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
 on_error:
-	if( safe_last_used_list_element != NULL )
+	if( block_cache != NULL )
 	{
-		libcdata_list_element_free(
-		 &safe_last_used_list_element,
-		 NULL,
+		libbfio_block_cache_free(
+		 &block_cache,
 		 NULL );
 	}
 	return( -1 );
+#endif
 }
 
-/* Closes a handle in the pool
- * Returns 0 if successful or -1 on error
+/* Retrieves the cache statistics of the block cache of the pool
+ * The number of hits and misses are counted per block
+ * Returns 1 if successful, 0 if the pool has no block cache or -1 on error
  */
-int libbfio_pool_close(
+int libbfio_pool_get_cache_statistics(
      libbfio_pool_t *pool,
-     int entry,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     uint64_t *number_of_evictions,
      libcerror_error_t **error )
 {
 	libbfio_internal_pool_t *internal_pool = NULL;
-	static char *function                  = "libbfio_pool_close";
+	static char *function                  = "libbfio_pool_get_cache_statistics";
 	int result                             = 0;
 
 	if( pool == NULL )
@@ -2514,7 +3006,7 @@ int libbfio_pool_close(
 	internal_pool = (libbfio_internal_pool_t *) pool;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2522,29 +3014,35 @@ int libbfio_pool_close(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( libbfio_internal_pool_close(
-	     internal_pool,
-	     entry,
-	     error ) != 0 )
+	if( internal_pool->block_cache != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-		 "%s: unable to close handle: %d.",
-		 function,
-		 entry );
+		result = libbfio_block_cache_get_statistics(
+		          internal_pool->block_cache,
+		          number_of_hits,
+		          number_of_misses,
+		          number_of_evictions,
+		          error );
 
-		result = -1;
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve block cache statistics.",
+			 function );
+
+			result = -1;
+		}
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2552,7 +3050,7 @@ int libbfio_pool_close(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -2561,21 +3059,22 @@ int libbfio_pool_close(
 	return( result );
 }
 
-/* Closes all the files in the pool
- * Returns 0 if successful or -1 on error
+/* Sets the descriptor cache of the pool in a handle
+ * A handle that is read-only is opened on demand so that its descriptor is managed by
+ * the descriptor cache, a handle with write access cannot be opened on demand
+ * and is removed from the descriptor cache
+ * Returns 1 if successful or -1 on error
  */
-int libbfio_pool_close_all(
-     libbfio_pool_t *pool,
+int libbfio_internal_pool_set_handle_descriptor_cache(
+     libbfio_internal_pool_t *internal_pool,
+     libbfio_handle_t *handle,
+     int access_flags,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *handle               = NULL;
-	libbfio_internal_pool_t *internal_pool = NULL;
-	static char *function                  = "libbfio_pool_close_all";
-	int entry                              = 0;
-	int is_open                            = 0;
-	int number_of_handles                  = 0;
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_internal_pool_set_handle_descriptor_cache";
 
-	if( pool == NULL )
+	if( internal_pool == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -2586,23 +3085,117 @@ int libbfio_pool_close_all(
 
 		return( -1 );
 	}
-	internal_pool = (libbfio_internal_pool_t *) pool;
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
 
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_pool->read_write_lock,
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( ( internal_pool->descriptor_cache == NULL )
+	 || ( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) != 0 ) )
+	{
+		if( internal_handle->descriptor_cache == NULL )
+		{
+			return( 1 );
+		}
+		/* The handle remains opened on demand when the descriptor cache is removed
+		 * since the descriptor cache could have closed its descriptor
+		 */
+		if( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) != 0 )
+		{
+			if( libbfio_handle_set_open_on_demand(
+			     handle,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set open on demand in handle.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( libbfio_handle_set_descriptor_cache(
+		     handle,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to remove descriptor cache from handle.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( libbfio_handle_set_open_on_demand(
+	     handle,
+	     1,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to set open on demand in handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_set_descriptor_cache(
+	     handle,
+	     internal_pool->descriptor_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set descriptor cache in handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the descriptor cache of the pool in all the handles in the pool
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_pool_set_descriptor_cache_in_handles(
+     libbfio_internal_pool_t *internal_pool,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *handle = NULL;
+	static char *function    = "libbfio_internal_pool_set_descriptor_cache_in_handles";
+	int entry                = 0;
+	int number_of_handles    = 0;
+
+	if( internal_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
 		 function );
 
 		return( -1 );
 	}
-#endif
 	if( libcdata_array_get_number_of_entries(
 	     internal_pool->handles_array,
 	     &number_of_handles,
@@ -2615,7 +3208,7 @@ int libbfio_pool_close_all(
 		 "%s: unable to retrieve number of handles.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	for( entry = 0;
 	     entry < number_of_handles;
@@ -2635,52 +3228,65 @@ int libbfio_pool_close_all(
 			 function,
 			 entry );
 
-			goto on_error;
+			return( -1 );
 		}
 		if( handle == NULL )
 		{
 			continue;
 		}
-		/* Make sure the handle is open
-		 */
-		is_open = libbfio_handle_is_open(
-			   handle,
-			   error );
-
-		if( is_open == -1 )
+		if( libbfio_internal_pool_set_handle_descriptor_cache(
+		     internal_pool,
+		     handle,
+		     ( (libbfio_internal_handle_t *) handle )->access_flags,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine if handle: %d is open.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set descriptor cache in handle: %d.",
 			 function,
 			 entry );
 
-			goto on_error;
-		}
-		else if( is_open == 0 )
-		{
-			continue;
+			return( -1 );
 		}
-		if( libbfio_internal_pool_close(
-		     internal_pool,
-		     entry,
-		     error ) != 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close handle: %d.",
-			 function,
-			 entry );
+	}
+	return( 1 );
+}
 
-			goto on_error;
-		}
+/* Sets the descriptor cache of the pool
+ * The descriptor cache limits the number of open descriptors of the read-only handles
+ * in the pool, together with other pools and handles that use the same descriptor cache,
+ * by closing the least recently used descriptor, the read-only handles in the pool are
+ * opened on demand
+ * The descriptor cache must remain available until the pool is freed or
+ * another descriptor cache is set, NULL removes the descriptor cache
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_pool_set_descriptor_cache(
+     libbfio_pool_t *pool,
+     libbfio_descriptor_cache_t *descriptor_cache,
+     libcerror_error_t **error )
+{
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_pool_set_descriptor_cache";
+	int result                             = 1;
+
+	if( pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
 	}
+	internal_pool = (libbfio_internal_pool_t *) pool;
+
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2688,36 +3294,57 @@ int libbfio_pool_close_all(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	return( 0 );
+	internal_pool->descriptor_cache = descriptor_cache;
 
-on_error:
+	if( libbfio_internal_pool_set_descriptor_cache_in_handles(
+	     internal_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set descriptor cache in handles.",
+		 function );
+
+		result = -1;
+	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	libcthreads_read_write_lock_release_for_write(
-	 internal_pool->read_write_lock,
-	 NULL );
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
 #endif
-	return( -1 );
+	return( result );
 }
 
-/* Retrieves a specific handle from the pool and opens it if needed
+/* Opens a handle in the pool
  * Returns 1 if successful or -1 on error
  */
-int libbfio_internal_pool_get_open_handle(
+int libbfio_internal_pool_open(
      libbfio_internal_pool_t *internal_pool,
      int entry,
-     libbfio_handle_t **handle,
+     int access_flags,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *safe_handle = NULL;
-	static char *function         = "libbfio_internal_pool_get_open_handle";
-	int access_flags              = 0;
-	int is_open                   = 0;
+	libbfio_handle_t *handle = NULL;
+	static char *function    = "libbfio_internal_pool_open";
+	int is_open              = 0;
 
 	if( internal_pool == NULL )
 	{
@@ -2730,124 +3357,1874 @@ int libbfio_internal_pool_get_open_handle(
 
 		return( -1 );
 	}
-	if( handle == NULL )
+	if( libcdata_array_get_entry_by_index(
+	     internal_pool->handles_array,
+	     entry,
+	     (intptr_t **) &handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve handle: %d.",
+		 function,
+		 entry );
 
 		return( -1 );
 	}
-	if( entry != internal_pool->current_entry )
+	/* Make sure the handle is not already open
+	 */
+	is_open = libbfio_handle_is_open(
+	           handle,
+	           error );
+
+	if( is_open == -1 )
 	{
-		if( libcdata_array_get_entry_by_index(
-		     internal_pool->handles_array,
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if entry: %d is open.",
+		 function,
+	         entry );
+
+		return( -1 );
+	}
+	else if( is_open == 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: entry: %d is already open.",
+		 function,
+	         entry );
+
+		return( -1 );
+	}
+	/* The data could have changed while the handle was not opened by the pool
+	 */
+	if( internal_pool->block_cache != NULL )
+	{
+		if( libbfio_block_cache_invalidate_entry(
+		     internal_pool->block_cache,
 		     entry,
-		     (intptr_t **) &safe_handle,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve handle: %d.",
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to invalidate block cache entry: %d.",
 			 function,
 			 entry );
 
 			return( -1 );
 		}
-		/* Make sure the handle is open
-		 */
-		is_open = libbfio_handle_is_open(
-		           safe_handle,
-		           error );
+	}
+	if( libbfio_internal_pool_open_handle(
+	     internal_pool,
+	     handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open entry: %d.",
+		 function,
+		 entry );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens a handle in the pool
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_pool_open(
+     libbfio_pool_t *pool,
+     int entry,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_pool_open";
+	int result                             = 1;
+
+	if( pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pool = (libbfio_internal_pool_t *) pool;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libbfio_internal_pool_open(
+	     internal_pool,
+	     entry,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open entry: %d.",
+		 function,
+		 entry );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reopens a handle in the pool
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_pool_reopen(
+     libbfio_pool_t *pool,
+     int entry,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *handle               = NULL;
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_pool_reopen";
+
+	if( pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pool = (libbfio_internal_pool_t *) pool;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_get_entry_by_index(
+	     internal_pool->handles_array,
+	     entry,
+	     (intptr_t **) &handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve handle: %d.",
+		 function,
+		 entry );
+
+		goto on_error;
+	}
+	if( libbfio_internal_pool_wait_for_pending_close(
+	     internal_pool,
+	     handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to wait for pending close of entry: %d.",
+		 function,
+		 entry );
+
+		goto on_error;
+	}
+	/* Reopening the handle with the truncate flag changes the data
+	 */
+	if( internal_pool->block_cache != NULL )
+	{
+		if( libbfio_block_cache_invalidate_entry(
+		     internal_pool->block_cache,
+		     entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to invalidate block cache entry: %d.",
+			 function,
+			 entry );
+
+			goto on_error;
+		}
+	}
+	/* A handle that is reopened with write access can no longer be opened on demand
+	 * and is removed from the descriptor cache before it is reopened, a handle that is
+	 * reopened read-only is added to the descriptor cache after it is reopened
+	 */
+	if( ( internal_pool->descriptor_cache != NULL )
+	 && ( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) != 0 ) )
+	{
+		if( libbfio_internal_pool_set_handle_descriptor_cache(
+		     internal_pool,
+		     handle,
+		     access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set descriptor cache in handle for entry: %d.",
+			 function,
+			 entry );
+
+			goto on_error;
+		}
+	}
+	if( libbfio_handle_reopen(
+	     handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to reopen handle for entry: %d.",
+		 function,
+		 entry );
+
+		goto on_error;
+	}
+	if( ( internal_pool->descriptor_cache != NULL )
+	 && ( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		if( libbfio_internal_pool_set_handle_descriptor_cache(
+		     internal_pool,
+		     handle,
+		     access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set descriptor cache in handle for entry: %d.",
+			 function,
+			 entry );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_pool->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Closes a handle in the pool
+ * Returns 0 if successful or -1 on error
+ */
+int libbfio_internal_pool_close(
+     libbfio_internal_pool_t *internal_pool,
+     int entry,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *handle = NULL;
+	static char *function    = "libbfio_internal_pool_close";
+
+	if( internal_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_pool->handles_array,
+	     entry,
+	     (intptr_t **) &handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve handle: %d.",
+		 function,
+		 entry );
+
+		return( -1 );
+	}
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pool - missing handle for entry: %d.",
+		 function,
+		 entry );
+
+		return( -1 );
+	}
+	if( libbfio_internal_pool_wait_for_pending_close(
+	     internal_pool,
+	     handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to wait for pending close of handle: %d.",
+		 function,
+		 entry );
+
+		return( -1 );
+	}
+	if( libbfio_internal_pool_remove_handle_from_last_used_list(
+	     internal_pool,
+	     handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove handle: %d from last used list.",
+		 function,
+		 entry );
+
+		return( -1 );
+	}
+	if( libbfio_handle_close(
+	     handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close handle for entry: %d.",
+		 function,
+		 entry );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Closes a handle in the pool
+ * Returns 0 if successful or -1 on error
+ */
+int libbfio_pool_close(
+     libbfio_pool_t *pool,
+     int entry,
+     libcerror_error_t **error )
+{
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_pool_close";
+	int result                             = 0;
+
+	if( pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pool = (libbfio_internal_pool_t *) pool;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libbfio_internal_pool_close(
+	     internal_pool,
+	     entry,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close handle: %d.",
+		 function,
+		 entry );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Closes all the files in the pool
+ * Returns 0 if successful or -1 on error
+ */
+int libbfio_pool_close_all(
+     libbfio_pool_t *pool,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *handle               = NULL;
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_pool_close_all";
+	int entry                              = 0;
+	int is_open                            = 0;
+	int number_of_handles                  = 0;
+
+	if( pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pool = (libbfio_internal_pool_t *) pool;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_pool->handle_closer != NULL )
+	{
+		if( libbfio_handle_closer_wait(
+		     internal_pool->handle_closer,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for pending closes.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_pool->handles_array,
+	     &number_of_handles,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of handles.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry = 0;
+	     entry < number_of_handles;
+	     entry++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_pool->handles_array,
+		     entry,
+		     (intptr_t **) &handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve handle: %d.",
+			 function,
+			 entry );
+
+			goto on_error;
+		}
+		if( handle == NULL )
+		{
+			continue;
+		}
+		/* Make sure the handle is open
+		 */
+		is_open = libbfio_handle_is_open(
+			   handle,
+			   error );
+
+		if( is_open == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if handle: %d is open.",
+			 function,
+			 entry );
+
+			goto on_error;
+		}
+		else if( is_open == 0 )
+		{
+			continue;
+		}
+		if( libbfio_internal_pool_close(
+		     internal_pool,
+		     entry,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close handle: %d.",
+			 function,
+			 entry );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 0 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_pool->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves a specific handle from the pool and opens it if needed
+ * The handle is marked as in use and must be released with libbfio_internal_pool_release_open_handle
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_pool_get_open_handle(
+     libbfio_internal_pool_t *internal_pool,
+     int entry,
+     libbfio_handle_t **handle,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *evicted_handle           = NULL;
+	libbfio_handle_t *safe_handle              = NULL;
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_internal_pool_get_open_handle";
+	int access_flags                           = 0;
+	int is_close_pending                       = 0;
+	int is_open                                = 0;
+	int result                                 = 1;
+
+	if( internal_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The handles array is only changed while the read/write lock is held for writing
+	 */
+	if( libcdata_array_get_entry_by_index(
+	     internal_pool->handles_array,
+	     entry,
+	     (intptr_t **) &safe_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve handle: %d.",
+		 function,
+		 entry );
+
+		return( -1 );
+	}
+	if( safe_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pool - missing handle for entry: %d.",
+		 function,
+		 entry );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) safe_handle;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     internal_pool->last_used_list_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab last used list mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	do
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+		/* A handle that is being opened or closed by another pool operation
+		 * is used after that operation has completed
+		 */
+		while( internal_handle->pool_state != LIBBFIO_POOL_HANDLE_STATE_IDLE )
+		{
+			if( libcthreads_condition_wait(
+			     internal_pool->last_used_list_condition,
+			     internal_pool->last_used_list_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to wait for last used list condition.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#endif
+		/* A handle that was evicted from the last used list can be pending to be
+		 * closed by the handle closer, it is reopened after the close has completed
+		 */
+		is_close_pending = 0;
+
+		if( ( internal_pool->handle_closer != NULL )
+		 && ( internal_handle->pool_in_last_used_list == 0 ) )
+		{
+			is_close_pending = libbfio_handle_closer_is_pending(
+			                    internal_pool->handle_closer,
+			                    safe_handle,
+			                    error );
+
+			if( is_close_pending == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if entry: %d is pending to be closed.",
+				 function,
+				 entry );
+
+				goto on_error;
+			}
+		}
+		/* The pending close is waited for without holding the last used list mutex,
+		 * after which the state of the handle is checked again since another pool
+		 * operation could have used the handle in the meantime
+		 */
+		if( is_close_pending != 0 )
+		{
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+			if( libcthreads_mutex_release(
+			     internal_pool->last_used_list_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release last used list mutex.",
+				 function );
+
+				return( -1 );
+			}
+#endif
+			if( libbfio_internal_pool_wait_for_pending_close(
+			     internal_pool,
+			     safe_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for pending close of entry: %d.",
+				 function,
+				 entry );
+
+				return( -1 );
+			}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+			if( libcthreads_mutex_grab(
+			     internal_pool->last_used_list_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab last used list mutex.",
+				 function );
+
+				return( -1 );
+			}
+#endif
+		}
+	}
+	while( is_close_pending != 0 );
+
+	/* If the number of open handles is limited the handle is open
+	 * if it is in the last used list, otherwise check if the handle is open
+	 */
+	if( ( internal_pool->maximum_number_of_open_handles != LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES )
+	 && ( internal_handle->pool_in_last_used_list != 0 ) )
+	{
+		is_open = 1;
+	}
+	else
+	{
+		is_open = libbfio_handle_is_open(
+		           safe_handle,
+		           error );
+
+		if( is_open == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if entry: %d is open.",
+			 function,
+			 entry );
+
+			goto on_error;
+		}
+	}
+	if( is_open == 0 )
+	{
+		if( libbfio_handle_get_access_flags(
+		     safe_handle,
+		     &access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve access flags.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The last used list only reserves the room for the handle, the handle is
+	 * opened and the evicted handle is closed after the last used list mutex
+	 * has been released
+	 */
+	if( ( is_open == 0 )
+	 || ( internal_handle->pool_in_last_used_list == 0 ) )
+	{
+		if( internal_pool->maximum_number_of_open_handles != LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES )
+		{
+			if( libbfio_internal_pool_append_handle_to_last_used_list(
+			     internal_pool,
+			     safe_handle,
+			     &evicted_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append handle to last used list.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	else if( libbfio_internal_pool_move_handle_to_front_of_last_used_list(
+	          internal_pool,
+	          safe_handle,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to move handle to front of last used list.",
+		 function );
+
+		goto on_error;
+	}
+	if( is_open == 0 )
+	{
+		internal_handle->pool_state = LIBBFIO_POOL_HANDLE_STATE_OPENING;
+	}
+	internal_handle->pool_number_of_references += 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     internal_pool->last_used_list_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release last used list mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( evicted_handle != NULL )
+	{
+		if( libbfio_internal_pool_close_evicted_handle(
+		     internal_pool,
+		     evicted_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close evicted handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( is_open == 0 )
+	{
+		if( result == 1 )
+		{
+			result = libbfio_internal_pool_open_handle_at_current_offset(
+			          internal_pool,
+			          safe_handle,
+			          access_flags,
+			          error );
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open entry: %d.",
+				 function,
+				 entry );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+		if( libcthreads_mutex_grab(
+		     internal_pool->last_used_list_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab last used list mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		/* A handle that could not be opened gives up the room it reserved
+		 */
+		if( result != 1 )
+		{
+			libbfio_internal_pool_remove_handle_from_last_used_list(
+			 internal_pool,
+			 safe_handle,
+			 NULL );
+		}
+		internal_handle->pool_state = LIBBFIO_POOL_HANDLE_STATE_IDLE;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+		if( libcthreads_condition_broadcast(
+		     internal_pool->last_used_list_condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast last used list condition.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( result != 1 )
+		{
+			internal_handle->pool_number_of_references -= 1;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+		if( libcthreads_mutex_release(
+		     internal_pool->last_used_list_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release last used list mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+	}
+	else if( result != 1 )
+	{
+		libbfio_internal_pool_release_open_handle(
+		 internal_pool,
+		 safe_handle,
+		 NULL );
+	}
+	if( result != 1 )
+	{
+		return( -1 );
+	}
+	*handle = safe_handle;
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	libcthreads_mutex_release(
+	 internal_pool->last_used_list_mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Releases a handle retrieved with libbfio_internal_pool_get_open_handle
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_pool_release_open_handle(
+     libbfio_internal_pool_t *internal_pool,
+     libbfio_handle_t *handle,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_internal_pool_release_open_handle";
+	int result                                 = 1;
+
+	if( internal_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     internal_pool->last_used_list_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab last used list mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_handle->pool_number_of_references <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid handle - number of pool references value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		internal_handle->pool_number_of_references -= 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     internal_pool->last_used_list_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release last used list mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads data at a specific offset of a handle in the pool
+ * This function is used by the block cache to read the data that is not cached
+ * and opens the handle only when it is needed
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libbfio_internal_pool_read_block_at_offset(
+         libbfio_internal_pool_t *internal_pool,
+         int entry,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libbfio_handle_t *handle = NULL;
+	static char *function    = "libbfio_internal_pool_read_block_at_offset";
+	ssize_t read_count       = 0;
+
+	if( libbfio_internal_pool_get_open_handle(
+	     internal_pool,
+	     entry,
+	     &handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve handle: %d.",
+		 function,
+		 entry );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              size,
+	              offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from entry: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 entry,
+		 offset,
+		 offset );
+
+		read_count = -1;
+	}
+	if( libbfio_internal_pool_release_open_handle(
+	     internal_pool,
+	     handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release handle: %d.",
+		 function,
+		 entry );
+
+		read_count = -1;
+	}
+	return( read_count );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+
+/* Claims the current offset of a handle in the pool
+ * Waits until the current offset is no longer claimed by another pool operation
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_pool_claim_handle_offset(
+     libbfio_internal_pool_t *internal_pool,
+     libbfio_handle_t *handle,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_internal_pool_claim_handle_offset";
+	int result                                 = 1;
+
+	if( internal_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( libcthreads_mutex_grab(
+	     internal_pool->last_used_list_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab last used list mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( internal_handle->pool_offset_claimed != 0 )
+	{
+		if( libcthreads_condition_wait(
+		     internal_pool->last_used_list_condition,
+		     internal_pool->last_used_list_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to wait for last used list condition.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+	}
+	if( result == 1 )
+	{
+		internal_handle->pool_offset_claimed = 1;
+	}
+	if( libcthreads_mutex_release(
+	     internal_pool->last_used_list_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release last used list mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Releases the current offset of a handle in the pool claimed by libbfio_internal_pool_claim_handle_offset
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_pool_release_handle_offset(
+     libbfio_internal_pool_t *internal_pool,
+     libbfio_handle_t *handle,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_internal_pool_release_handle_offset";
+	int result                                 = 1;
+
+	if( internal_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( libcthreads_mutex_grab(
+	     internal_pool->last_used_list_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab last used list mutex.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle->pool_offset_claimed = 0;
+
+	if( libcthreads_condition_broadcast(
+	     internal_pool->last_used_list_condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast last used list condition.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     internal_pool->last_used_list_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release last used list mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO ) */
+
+/* Sets the current offset of a handle in the pool that is not necessarily open
+ * An open handle is seeked, otherwise the offset is stored in the handle and
+ * the handle is seeked to it when the pool opens the handle
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_pool_set_handle_offset(
+     libbfio_internal_pool_t *internal_pool,
+     libbfio_handle_t *handle,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_internal_pool_set_handle_offset";
+	int result                                 = 1;
+
+	if( internal_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->is_open == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing is open function.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* A handle that is opened on demand is seeked as if it were open
+	 */
+	if( internal_handle->open_on_demand == 0 )
+	{
+		result = internal_handle->is_open(
+		          internal_handle->io_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if handle is open.",
+			 function );
+		}
+	}
+	if( result == 1 )
+	{
+		if( libbfio_internal_handle_seek_offset(
+		     internal_handle,
+		     offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			result = -1;
+		}
+	}
+	else if( result == 0 )
+	{
+		internal_handle->current_offset = offset;
+
+		result = 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads data at the current offset of a handle in the pool using the block cache
+ * The handle is only opened when the data is not cached and retrieving and
+ * updating the current offset is a single critical section per handle,
+ * hence reads of different handles, including the data that is not cached,
+ * are not serialized
+ * This function is not multi-thread safe acquire the pool read/write lock for reading before call
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libbfio_internal_pool_read_buffer_using_block_cache(
+         libbfio_internal_pool_t *internal_pool,
+         int entry,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	libbfio_handle_t *handle = NULL;
+	static char *function    = "libbfio_internal_pool_read_buffer_using_block_cache";
+	ssize_t read_count       = 0;
+	off64_t offset           = 0;
+
+	if( internal_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
 
-		if( is_open == -1 )
+		return( -1 );
+	}
+	if( internal_pool->block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pool - missing block cache.",
+		 function );
+
+		return( -1 );
+	}
+	/* The handles array is only changed while the read/write lock is held for writing
+	 */
+	if( libcdata_array_get_entry_by_index(
+	     internal_pool->handles_array,
+	     entry,
+	     (intptr_t **) &handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve handle: %d.",
+		 function,
+		 entry );
+
+		return( -1 );
+	}
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pool - missing handle for entry: %d.",
+		 function,
+		 entry );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_internal_pool_claim_handle_offset(
+	     internal_pool,
+	     handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to claim current offset of entry: %d.",
+		 function,
+		 entry );
+
+		return( -1 );
+	}
+#endif
+	if( libbfio_handle_get_offset(
+	     handle,
+	     &offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current offset of entry: %d.",
+		 function,
+		 entry );
+
+		read_count = -1;
+	}
+	else
+	{
+		/* The block cache only opens the handle to read the data that is not cached
+		 */
+		read_count = libbfio_block_cache_read_buffer_at_offset(
+		              internal_pool->block_cache,
+		              entry,
+		              (intptr_t *) internal_pool,
+		              (ssize_t (*)(intptr_t *, int, uint8_t *, size_t, off64_t, libcerror_error_t **)) libbfio_internal_pool_read_block_at_offset,
+		              buffer,
+		              size,
+		              offset,
+		              error );
+
+		if( read_count < 0 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine if entry: %d is open.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from entry: %d at offset: %" PRIi64 " (0x%08" PRIx64 ") using block cache.",
 			 function,
-			 entry );
+			 entry,
+			 offset,
+			 offset );
 
-			return( -1 );
+			read_count = -1;
 		}
-		else if( is_open == 0 )
+		else if( read_count > 0 )
 		{
-			if( libbfio_handle_get_access_flags(
-			     safe_handle,
-			     &access_flags,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve access flags.",
-				 function );
-
-				return( -1 );
-			}
-			if( libbfio_internal_pool_open_handle(
+			if( libbfio_internal_pool_set_handle_offset(
 			     internal_pool,
-			     safe_handle,
-			     access_flags,
+			     handle,
+			     offset + read_count,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_OPEN_FAILED,
-				 "%s: unable to open entry: %d.",
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set current offset of entry: %d.",
 				 function,
 				 entry );
 
-				return( -1 );
+				read_count = -1;
 			}
 		}
-		if( internal_pool->maximum_number_of_open_handles != LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES )
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_internal_pool_release_handle_offset(
+	     internal_pool,
+	     handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release current offset of entry: %d.",
+		 function,
+		 entry );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
+/* Reads data at the current offset into the buffer
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libbfio_pool_read_buffer(
+         libbfio_pool_t *pool,
+         int entry,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	libbfio_handle_t *handle               = NULL;
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_pool_read_buffer";
+	ssize_t read_count                     = 0;
+
+	if( pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pool = (libbfio_internal_pool_t *) pool;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_pool->block_cache != NULL )
+	{
+		read_count = libbfio_internal_pool_read_buffer_using_block_cache(
+		              internal_pool,
+		              entry,
+		              buffer,
+		              size,
+		              error );
+
+		if( read_count < 0 )
 		{
-			if( libbfio_internal_pool_move_handle_to_front_of_last_used_list(
-			     internal_pool,
-			     safe_handle,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to move handle to front of last used list.",
-				 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from entry: %d using block cache.",
+			 function,
+			 entry );
+
+			read_count = -1;
+		}
+	}
+	else if( libbfio_internal_pool_get_open_handle(
+	          internal_pool,
+	          entry,
+	          &handle,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve handle: %d.",
+		 function,
+		 entry );
+
+		read_count = -1;
+	}
+	else
+	{
+		read_count = libbfio_handle_read_buffer(
+		              handle,
+		              buffer,
+		              size,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from entry: %d.",
+			 function,
+			 entry );
+
+			read_count = -1;
+		}
+		if( libbfio_internal_pool_release_open_handle(
+		     internal_pool,
+		     handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release handle: %d.",
+			 function,
+			 entry );
+
+			read_count = -1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
 
-				return( -1 );
-			}
-		}
-		internal_pool->current_entry  = entry;
-		internal_pool->current_handle = safe_handle;
+		return( -1 );
 	}
-	*handle = internal_pool->current_handle;
-
-	return( 1 );
+#endif
+	return( read_count );
 }
 
-/* Reads data at the current offset into the buffer
+/* Reads data at a specific offset into the buffer
  * Returns the number of bytes read or -1 on error
  */
-ssize_t libbfio_pool_read_buffer(
+ssize_t libbfio_pool_read_buffer_at_offset(
          libbfio_pool_t *pool,
          int entry,
          uint8_t *buffer,
          size_t size,
+         off64_t offset,
          libcerror_error_t **error )
 {
 	libbfio_handle_t *handle               = NULL;
 	libbfio_internal_pool_t *internal_pool = NULL;
-	static char *function                  = "libbfio_pool_read_buffer";
+	static char *function                  = "libbfio_pool_read_buffer_at_offset";
 	ssize_t read_count                     = 0;
 
 	if( pool == NULL )
@@ -2864,7 +5241,7 @@ ssize_t libbfio_pool_read_buffer(
 	internal_pool = (libbfio_internal_pool_t *) pool;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2872,17 +5249,44 @@ ssize_t libbfio_pool_read_buffer(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( libbfio_internal_pool_get_open_handle(
-	     internal_pool,
-	     entry,
-	     &handle,
-	     error ) != 1 )
+	if( internal_pool->block_cache != NULL )
+	{
+		read_count = libbfio_block_cache_read_buffer_at_offset(
+		              internal_pool->block_cache,
+		              entry,
+		              (intptr_t *) internal_pool,
+		              (ssize_t (*)(intptr_t *, int, uint8_t *, size_t, off64_t, libcerror_error_t **)) libbfio_internal_pool_read_block_at_offset,
+		              buffer,
+		              size,
+		              offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from entry: %d at offset: %" PRIi64 " (0x%08" PRIx64 ") using block cache.",
+			 function,
+			 entry,
+			 offset,
+			 offset );
+
+			read_count = -1;
+		}
+	}
+	else if( libbfio_internal_pool_get_open_handle(
+	          internal_pool,
+	          entry,
+	          &handle,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -2896,10 +5300,11 @@ ssize_t libbfio_pool_read_buffer(
 	}
 	else
 	{
-		read_count = libbfio_handle_read_buffer(
+		read_count = libbfio_handle_read_buffer_at_offset(
 		              handle,
 		              buffer,
 		              size,
+		              offset,
 		              error );
 
 		if( read_count < 0 )
@@ -2908,7 +5313,24 @@ ssize_t libbfio_pool_read_buffer(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read from entry: %d.",
+			 "%s: unable to read from entry: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 entry,
+			 offset,
+			 offset );
+
+			read_count = -1;
+		}
+		if( libbfio_internal_pool_release_open_handle(
+		     internal_pool,
+		     handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release handle: %d.",
 			 function,
 			 entry );
 
@@ -2916,7 +5338,7 @@ ssize_t libbfio_pool_read_buffer(
 		}
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2924,7 +5346,7 @@ ssize_t libbfio_pool_read_buffer(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -2933,20 +5355,25 @@ ssize_t libbfio_pool_read_buffer(
 	return( read_count );
 }
 
-/* Reads data at a specific offset into the buffer
- * Returns the number of bytes read or -1 on error
+/* Reads data at multiple offsets into the buffers
+ * Buffer sizes and offsets contain the size and offset of each buffer
+ * Reading stops at the first buffer that cannot be filled completely
+ * Returns the number of bytes read into the buffers, in the order provided,
+ * up to and including the first buffer that was not filled completely
+ * or -1 on error
  */
-ssize_t libbfio_pool_read_buffer_at_offset(
+ssize_t libbfio_pool_read_vector(
          libbfio_pool_t *pool,
          int entry,
-         uint8_t *buffer,
-         size_t size,
-         off64_t offset,
+         uint8_t **buffers,
+         size_t *buffer_sizes,
+         off64_t *offsets,
+         int number_of_buffers,
          libcerror_error_t **error )
 {
 	libbfio_handle_t *handle               = NULL;
 	libbfio_internal_pool_t *internal_pool = NULL;
-	static char *function                  = "libbfio_pool_read_buffer_at_offset";
+	static char *function                  = "libbfio_pool_read_vector";
 	ssize_t read_count                     = 0;
 
 	if( pool == NULL )
@@ -2963,7 +5390,7 @@ ssize_t libbfio_pool_read_buffer_at_offset(
 	internal_pool = (libbfio_internal_pool_t *) pool;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2971,7 +5398,7 @@ ssize_t libbfio_pool_read_buffer_at_offset(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -2995,11 +5422,12 @@ ssize_t libbfio_pool_read_buffer_at_offset(
 	}
 	else
 	{
-		read_count = libbfio_handle_read_buffer_at_offset(
+		read_count = libbfio_handle_read_vector(
 		              handle,
-		              buffer,
-		              size,
-		              offset,
+		              buffers,
+		              buffer_sizes,
+		              offsets,
+		              number_of_buffers,
 		              error );
 
 		if( read_count < 0 )
@@ -3008,17 +5436,30 @@ ssize_t libbfio_pool_read_buffer_at_offset(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read from entry: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 "%s: unable to read vector from entry: %d.",
 			 function,
-			 entry,
-			 offset,
-			 offset );
+			 entry );
+
+			read_count = -1;
+		}
+		if( libbfio_internal_pool_release_open_handle(
+		     internal_pool,
+		     handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release handle: %d.",
+			 function,
+			 entry );
 
 			read_count = -1;
 		}
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3026,7 +5467,7 @@ ssize_t libbfio_pool_read_buffer_at_offset(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -3049,6 +5490,7 @@ ssize_t libbfio_pool_write_buffer(
 	libbfio_internal_pool_t *internal_pool = NULL;
 	static char *function                  = "libbfio_pool_write_buffer";
 	ssize_t write_count                    = 0;
+	off64_t offset                         = 0;
 
 	if( pool == NULL )
 	{
@@ -3064,7 +5506,7 @@ ssize_t libbfio_pool_write_buffer(
 	internal_pool = (libbfio_internal_pool_t *) pool;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3072,7 +5514,7 @@ ssize_t libbfio_pool_write_buffer(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -3096,19 +5538,72 @@ ssize_t libbfio_pool_write_buffer(
 	}
 	else
 	{
-		write_count = libbfio_handle_write_buffer(
-		               handle,
-		               buffer,
-		               size,
-		               error );
+		if( libbfio_handle_get_offset(
+		     handle,
+		     &offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve current offset of entry: %d.",
+			 function,
+			 entry );
 
-		if( write_count < 0 )
+			write_count = -1;
+		}
+		else
+		{
+			write_count = libbfio_handle_write_buffer(
+			               handle,
+			               buffer,
+			               size,
+			               error );
+
+			if( write_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write to entry: %d.",
+				 function,
+				 entry );
+
+				write_count = -1;
+			}
+			else if( internal_pool->block_cache != NULL )
+			{
+				if( libbfio_block_cache_invalidate_range(
+				     internal_pool->block_cache,
+				     entry,
+				     offset,
+				     (size64_t) write_count,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+					 "%s: unable to invalidate block cache range of entry: %d.",
+					 function,
+					 entry );
+
+					write_count = -1;
+				}
+			}
+		}
+		if( libbfio_internal_pool_release_open_handle(
+		     internal_pool,
+		     handle,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to write to entry: %d.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release handle: %d.",
 			 function,
 			 entry );
 
@@ -3116,7 +5611,7 @@ ssize_t libbfio_pool_write_buffer(
 		}
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3124,7 +5619,7 @@ ssize_t libbfio_pool_write_buffer(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -3163,7 +5658,7 @@ ssize_t libbfio_pool_write_buffer_at_offset(
 	internal_pool = (libbfio_internal_pool_t *) pool;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3171,7 +5666,7 @@ ssize_t libbfio_pool_write_buffer_at_offset(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -3216,9 +5711,44 @@ ssize_t libbfio_pool_write_buffer_at_offset(
 
 			write_count = -1;
 		}
+		else if( internal_pool->block_cache != NULL )
+		{
+			if( libbfio_block_cache_invalidate_range(
+			     internal_pool->block_cache,
+			     entry,
+			     offset,
+			     (size64_t) write_count,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to invalidate block cache range of entry: %d.",
+				 function,
+				 entry );
+
+				write_count = -1;
+			}
+		}
+		if( libbfio_internal_pool_release_open_handle(
+		     internal_pool,
+		     handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release handle: %d.",
+			 function,
+			 entry );
+
+			write_count = -1;
+		}
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3226,7 +5756,7 @@ ssize_t libbfio_pool_write_buffer_at_offset(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -3263,7 +5793,7 @@ off64_t libbfio_pool_seek_offset(
 	internal_pool = (libbfio_internal_pool_t *) pool;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3271,7 +5801,7 @@ off64_t libbfio_pool_seek_offset(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -3313,9 +5843,24 @@ off64_t libbfio_pool_seek_offset(
 
 			offset = -1;
 		}
+		if( libbfio_internal_pool_release_open_handle(
+		     internal_pool,
+		     handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release handle: %d.",
+			 function,
+			 entry );
+
+			offset = -1;
+		}
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3323,7 +5868,7 @@ off64_t libbfio_pool_seek_offset(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -3360,7 +5905,7 @@ int libbfio_pool_get_offset(
 	internal_pool = (libbfio_internal_pool_t *) pool;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3368,7 +5913,7 @@ int libbfio_pool_get_offset(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -3406,9 +5951,24 @@ int libbfio_pool_get_offset(
 
 			result = -1;
 		}
+		if( libbfio_internal_pool_release_open_handle(
+		     internal_pool,
+		     handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release handle: %d.",
+			 function,
+			 entry );
+
+			result = -1;
+		}
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3416,7 +5976,7 @@ int libbfio_pool_get_offset(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -3453,7 +6013,7 @@ int libbfio_pool_get_size(
 	internal_pool = (libbfio_internal_pool_t *) pool;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3461,7 +6021,7 @@ int libbfio_pool_get_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -3500,9 +6060,24 @@ int libbfio_pool_get_size(
 
 			result = -1;
 		}
+		if( libbfio_internal_pool_release_open_handle(
+		     internal_pool,
+		     handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release handle: %d.",
+			 function,
+			 entry );
+
+			result = -1;
+		}
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3510,7 +6085,7 @@ int libbfio_pool_get_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -25,7 +25,11 @@
 #include <common.h>
 #include <types.h>
 
+#include "libbfio_block_cache.h"
+#include "libbfio_descriptor_cache.h"
 #include "libbfio_extern.h"
+#include "libbfio_handle.h"
+#include "libbfio_handle_closer.h"
 #include "libbfio_libcdata.h"
 #include "libbfio_libcerror.h"
 #include "libbfio_libcthreads.h"
@@ -55,24 +59,42 @@ struct libbfio_internal_pool
 	 */
 	libcdata_array_t *handles_array;
 
-	/* The current entry
+	/* The first (most recently used) handle in the last used list
+	 * the last used list is linked through the handles themselves
 	 */
-	int current_entry;
+	libbfio_internal_handle_t *last_used_list_first_handle;
 
-	/* The current file IO handle
+	/* The last (least recently used) handle in the last used list
 	 */
-	libbfio_handle_t *current_handle;
+	libbfio_internal_handle_t *last_used_list_last_handle;
 
-	/* A list containing the file IO handles in order of the last use
-	 * it starts with the last used at the beginning of the list
-	 * the value of the list element refers to the corresponding file IO handle
+	/* The block cache that is shared by the handles in the pool
 	 */
-	libcdata_list_t *last_used_list;
+	libbfio_block_cache_t *block_cache;
+
+	/* The descriptor cache that limits the number of open descriptors of the handles
+	 * in the pool together with other pools and handles that use the same descriptor cache
+	 */
+	libbfio_descriptor_cache_t *descriptor_cache;
+
+	/* The handle closer that closes the handles evicted from the last used list
+	 * in the background, NULL if the handles are closed when evicted
+	 */
+	libbfio_handle_closer_t *handle_closer;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
 	/* The read/write lock
 	 */
 	libcthreads_read_write_lock_t *read_write_lock;
+
+	/* The mutex that protects the last used list and the number of open handles
+	 * when the handles are accessed under the read/write lock for reading
+	 */
+	libcthreads_mutex_t *last_used_list_mutex;
+
+	/* The condition that is signalled when a handle in the pool becomes idle
+	 */
+	libcthreads_condition_t *last_used_list_condition;
 #endif
 };
 
@@ -106,9 +128,21 @@ int libbfio_internal_pool_open_handle(
      int access_flags,
      libcerror_error_t **error );
 
+int libbfio_internal_pool_open_handle_at_current_offset(
+     libbfio_internal_pool_t *internal_pool,
+     libbfio_handle_t *handle,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libbfio_internal_pool_close_evicted_handle(
+     libbfio_internal_pool_t *internal_pool,
+     libbfio_handle_t *handle,
+     libcerror_error_t **error );
+
 int libbfio_internal_pool_append_handle_to_last_used_list(
      libbfio_internal_pool_t *internal_pool,
      const libbfio_handle_t *handle,
+     libbfio_handle_t **evicted_handle,
      libcerror_error_t **error );
 
 int libbfio_internal_pool_move_handle_to_front_of_last_used_list(
@@ -121,6 +155,17 @@ int libbfio_internal_pool_remove_handle_from_last_used_list(
      const libbfio_handle_t *handle,
      libcerror_error_t **error );
 
+int libbfio_internal_pool_wait_for_pending_close(
+     libbfio_internal_pool_t *internal_pool,
+     libbfio_handle_t *handle,
+     libcerror_error_t **error );
+
+int libbfio_internal_pool_set_handle_pool(
+     libbfio_internal_pool_t *internal_pool,
+     libbfio_handle_t *handle,
+     uint8_t is_in_pool,
+     libcerror_error_t **error );
+
 LIBBFIO_EXTERN \
 int libbfio_pool_get_number_of_handles(
      libbfio_pool_t *pool,
@@ -169,6 +214,49 @@ int libbfio_pool_set_maximum_number_of_open_handles(
      int maximum_number_of_open_handles,
      libcerror_error_t **error );
 
+LIBBFIO_EXTERN \
+int libbfio_pool_get_maximum_number_of_pending_closes(
+     libbfio_pool_t *pool,
+     int *maximum_number_of_pending_closes,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_pool_set_maximum_number_of_pending_closes(
+     libbfio_pool_t *pool,
+     int maximum_number_of_pending_closes,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_pool_set_block_cache(
+     libbfio_pool_t *pool,
+     size_t block_size,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_pool_get_cache_statistics(
+     libbfio_pool_t *pool,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     uint64_t *number_of_evictions,
+     libcerror_error_t **error );
+
+int libbfio_internal_pool_set_handle_descriptor_cache(
+     libbfio_internal_pool_t *internal_pool,
+     libbfio_handle_t *handle,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libbfio_internal_pool_set_descriptor_cache_in_handles(
+     libbfio_internal_pool_t *internal_pool,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_pool_set_descriptor_cache(
+     libbfio_pool_t *pool,
+     libbfio_descriptor_cache_t *descriptor_cache,
+     libcerror_error_t **error );
+
 int libbfio_internal_pool_open(
      libbfio_internal_pool_t *internal_pool,
      int entry,
@@ -211,6 +299,46 @@ int libbfio_internal_pool_get_open_handle(
      libbfio_handle_t **handle,
      libcerror_error_t **error );
 
+int libbfio_internal_pool_release_open_handle(
+     libbfio_internal_pool_t *internal_pool,
+     libbfio_handle_t *handle,
+     libcerror_error_t **error );
+
+ssize_t libbfio_internal_pool_read_block_at_offset(
+         libbfio_internal_pool_t *internal_pool,
+         int entry,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+
+int libbfio_internal_pool_claim_handle_offset(
+     libbfio_internal_pool_t *internal_pool,
+     libbfio_handle_t *handle,
+     libcerror_error_t **error );
+
+int libbfio_internal_pool_release_handle_offset(
+     libbfio_internal_pool_t *internal_pool,
+     libbfio_handle_t *handle,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO ) */
+
+int libbfio_internal_pool_set_handle_offset(
+     libbfio_internal_pool_t *internal_pool,
+     libbfio_handle_t *handle,
+     off64_t offset,
+     libcerror_error_t **error );
+
+ssize_t libbfio_internal_pool_read_buffer_using_block_cache(
+         libbfio_internal_pool_t *internal_pool,
+         int entry,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
 LIBBFIO_EXTERN \
 ssize_t libbfio_pool_read_buffer(
          libbfio_pool_t *pool,
@@ -228,6 +356,16 @@ ssize_t libbfio_pool_read_buffer_at_offset(
          off64_t offset,
          libcerror_error_t **error );
 
+LIBBFIO_EXTERN \
+ssize_t libbfio_pool_read_vector(
+         libbfio_pool_t *pool,
+         int entry,
+         uint8_t **buffers,
+         size_t *buffer_sizes,
+         off64_t *offsets,
+         int number_of_buffers,
+         libcerror_error_t **error );
+
 LIBBFIO_EXTERN \
 ssize_t libbfio_pool_write_buffer(
          libbfio_pool_t *pool,
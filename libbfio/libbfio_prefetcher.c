@@ -0,0 +1,853 @@
+/*
+ * The prefetcher functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libbfio_definitions.h"
+#include "libbfio_libcerror.h"
+#include "libbfio_libcthreads.h"
+#include "libbfio_prefetcher.h"
+#include "libbfio_unused.h"
+
+/* Creates a prefetcher
+ * The prefetcher reads data ahead using the read at offset function of the IO handle,
+ * if multi-threading is supported the data is read by a background thread
+ * Make sure the value prefetcher is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_prefetcher_initialize(
+     libbfio_prefetcher_t **prefetcher,
+     intptr_t *io_handle,
+     ssize_t (*read_at_offset)(
+                intptr_t *io_handle,
+                uint8_t *buffer,
+                size_t size,
+                off64_t offset,
+                libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_prefetcher_initialize";
+
+	if( prefetcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefetcher.",
+		 function );
+
+		return( -1 );
+	}
+	if( *prefetcher != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid prefetcher value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_at_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read at offset function.",
+		 function );
+
+		return( -1 );
+	}
+	*prefetcher = memory_allocate_structure(
+	               libbfio_prefetcher_t );
+
+	if( *prefetcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create prefetcher.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *prefetcher,
+	     0,
+	     sizeof( libbfio_prefetcher_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear prefetcher.",
+		 function );
+
+		memory_free(
+		 *prefetcher );
+
+		*prefetcher = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_initialize(
+	     &( ( *prefetcher )->completion_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize completion mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *prefetcher )->completion_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize completion condition.",
+		 function );
+
+		goto on_error;
+	}
+	/* A single thread is used since at most one prefetch is submitted at a time
+	 */
+	if( libcthreads_thread_pool_create(
+	     &( ( *prefetcher )->thread_pool ),
+	     NULL,
+	     1,
+	     1,
+	     (int (*)(intptr_t *, void *)) &libbfio_prefetcher_process,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *prefetcher )->io_handle      = io_handle;
+	( *prefetcher )->read_at_offset = read_at_offset;
+
+	return( 1 );
+
+on_error:
+	if( *prefetcher != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+		if( ( *prefetcher )->completion_condition != NULL )
+		{
+			libcthreads_condition_free(
+			 &( ( *prefetcher )->completion_condition ),
+			 NULL );
+		}
+		if( ( *prefetcher )->completion_mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *prefetcher )->completion_mutex ),
+			 NULL );
+		}
+#endif
+		memory_free(
+		 *prefetcher );
+
+		*prefetcher = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a prefetcher
+ * Waits until the submitted prefetch has completed
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_prefetcher_free(
+     libbfio_prefetcher_t **prefetcher,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_prefetcher_free";
+	int result            = 1;
+
+	if( prefetcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefetcher.",
+		 function );
+
+		return( -1 );
+	}
+	if( *prefetcher != NULL )
+	{
+		if( libbfio_prefetcher_cancel(
+		     *prefetcher,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to cancel prefetch.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+		if( libcthreads_thread_pool_join(
+		     &( ( *prefetcher )->thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_condition_free(
+		     &( ( *prefetcher )->completion_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free completion condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *prefetcher )->completion_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free completion mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( ( *prefetcher )->buffer != NULL )
+		{
+			memory_free(
+			 ( *prefetcher )->buffer );
+		}
+		memory_free(
+		 *prefetcher );
+
+		*prefetcher = NULL;
+	}
+	return( result );
+}
+
+/* Submits a prefetch of the data at a specific offset
+ * If multi-threading is supported the data is read by the thread pool,
+ * otherwise the data is read before this function returns
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_prefetcher_submit(
+     libbfio_prefetcher_t *prefetcher,
+     off64_t offset,
+     size_t size,
+     libcerror_error_t **error )
+{
+	uint8_t *buffer       = NULL;
+	static char *function = "libbfio_prefetcher_submit";
+
+	if( prefetcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefetcher.",
+		 function );
+
+		return( -1 );
+	}
+	if( prefetcher->is_submitted != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid prefetcher - prefetch already submitted.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( prefetcher->buffer_size < size )
+	{
+		buffer = (uint8_t *) memory_reallocate(
+		                      prefetcher->buffer,
+		                      sizeof( uint8_t ) * size );
+
+		if( buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize buffer.",
+			 function );
+
+			return( -1 );
+		}
+		prefetcher->buffer      = buffer;
+		prefetcher->buffer_size = size;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     prefetcher->completion_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab completion mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	prefetcher->offset       = offset;
+	prefetcher->size         = size;
+	prefetcher->read_count   = 0;
+	prefetcher->is_completed = 0;
+	prefetcher->is_submitted = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     prefetcher->completion_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release completion mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_thread_pool_push(
+	     prefetcher->thread_pool,
+	     (intptr_t *) prefetcher,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push prefetch onto thread pool queue.",
+		 function );
+
+		prefetcher->is_submitted = 0;
+
+		return( -1 );
+	}
+#else
+	if( libbfio_prefetcher_process(
+	     prefetcher,
+	     NULL ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to process prefetch.",
+		 function );
+
+		prefetcher->is_submitted = 0;
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Reads the data of the submitted prefetch
+ * A prefetch that failed is completed with a read count of -1
+ * This function is used as the thread pool callback function
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_prefetcher_process(
+     libbfio_prefetcher_t *prefetcher,
+     void *arguments LIBBFIO_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	ssize_t read_count       = 0;
+	int result               = 1;
+
+	LIBBFIO_UNREFERENCED_PARAMETER( arguments )
+
+	if( prefetcher == NULL )
+	{
+		return( -1 );
+	}
+	read_count = prefetcher->read_at_offset(
+	              prefetcher->io_handle,
+	              prefetcher->buffer,
+	              prefetcher->size,
+	              prefetcher->offset,
+	              &error );
+
+	if( read_count < 0 )
+	{
+		/* The error is reported to the caller by the read count of the completed prefetch
+		 */
+		libcerror_error_free(
+		 &error );
+
+		read_count = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     prefetcher->completion_mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+#endif
+	prefetcher->read_count   = read_count;
+	prefetcher->is_completed = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_condition_broadcast(
+	     prefetcher->completion_condition,
+	     NULL ) != 1 )
+	{
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     prefetcher->completion_mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Waits until the submitted prefetch has completed
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_prefetcher_wait(
+     libbfio_prefetcher_t *prefetcher,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_prefetcher_wait";
+	int result            = 1;
+
+	if( prefetcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefetcher.",
+		 function );
+
+		return( -1 );
+	}
+	if( prefetcher->is_submitted == 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     prefetcher->completion_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab completion mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( prefetcher->is_completed == 0 )
+	{
+		if( libcthreads_condition_wait(
+		     prefetcher->completion_condition,
+		     prefetcher->completion_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to wait for completion condition.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     prefetcher->completion_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release completion mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Exchanges the buffer with the buffer of the submitted prefetch
+ * Waits until the submitted prefetch has completed, the prefetched data is
+ * only used if it was read successfully at the offset, otherwise it is discarded
+ * Returns 1 if the buffers were exchanged, 0 if not or -1 on error
+ */
+int libbfio_prefetcher_exchange_buffer(
+     libbfio_prefetcher_t *prefetcher,
+     off64_t offset,
+     uint8_t **buffer,
+     size_t *buffer_size,
+     ssize_t *read_count,
+     libcerror_error_t **error )
+{
+	uint8_t *prefetch_buffer    = NULL;
+	static char *function       = "libbfio_prefetcher_exchange_buffer";
+	size_t prefetch_buffer_size = 0;
+
+	if( prefetcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefetcher.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer size.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_count == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read count.",
+		 function );
+
+		return( -1 );
+	}
+	if( prefetcher->is_submitted == 0 )
+	{
+		return( 0 );
+	}
+	if( libbfio_prefetcher_wait(
+	     prefetcher,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to wait for prefetch.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     prefetcher->completion_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab completion mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	prefetcher->is_submitted = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     prefetcher->completion_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release completion mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+
+	if( ( prefetcher->offset != offset )
+	 || ( prefetcher->read_count < 0 ) )
+	{
+		return( 0 );
+	}
+	prefetch_buffer      = prefetcher->buffer;
+	prefetch_buffer_size = prefetcher->buffer_size;
+
+	prefetcher->buffer      = *buffer;
+	prefetcher->buffer_size = *buffer_size;
+
+	*buffer      = prefetch_buffer;
+	*buffer_size = prefetch_buffer_size;
+	*read_count  = prefetcher->read_count;
+
+	return( 1 );
+}
+
+/* Cancels the submitted prefetch
+ * Waits until the submitted prefetch has completed and discards the prefetched data
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_prefetcher_cancel(
+     libbfio_prefetcher_t *prefetcher,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_prefetcher_cancel";
+
+	if( prefetcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefetcher.",
+		 function );
+
+		return( -1 );
+	}
+	if( prefetcher->is_submitted == 0 )
+	{
+		return( 1 );
+	}
+	if( libbfio_prefetcher_wait(
+	     prefetcher,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to wait for prefetch.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     prefetcher->completion_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab completion mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	prefetcher->is_submitted = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     prefetcher->completion_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release completion mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+
+	return( 1 );
+}
+
+/* Determines if the data of the submitted prefetch overlaps with a specific range
+ * Returns 1 if the data overlaps, 0 if not or -1 on error
+ */
+int libbfio_prefetcher_overlaps(
+     libbfio_prefetcher_t *prefetcher,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_prefetcher_overlaps";
+	int result            = 0;
+
+	if( prefetcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefetcher.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     prefetcher->completion_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab completion mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( prefetcher->is_submitted != 0 )
+	 && ( size > 0 )
+	 && ( offset < ( prefetcher->offset + (off64_t) prefetcher->size ) )
+	 && ( ( offset + (off64_t) size ) > prefetcher->offset ) )
+	{
+		result = 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     prefetcher->completion_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release completion mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
@@ -0,0 +1,147 @@
+/*
+ * The prefetcher functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBBFIO_PREFETCHER_H )
+#define _LIBBFIO_PREFETCHER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libbfio_libcerror.h"
+#include "libbfio_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libbfio_prefetcher libbfio_prefetcher_t;
+
+struct libbfio_prefetcher
+{
+	/* The IO handle
+	 */
+	intptr_t *io_handle;
+
+	/* The read at offset function
+	 */
+	ssize_t (*read_at_offset)(
+	           intptr_t *io_handle,
+	           uint8_t *buffer,
+	           size_t size,
+	           off64_t offset,
+	           libcerror_error_t **error );
+
+	/* The buffer
+	 */
+	uint8_t *buffer;
+
+	/* The (allocated) buffer size
+	 */
+	size_t buffer_size;
+
+	/* The offset of the data to prefetch
+	 */
+	off64_t offset;
+
+	/* The size of the data to prefetch
+	 */
+	size_t size;
+
+	/* The number of bytes prefetched or -1 on error
+	 */
+	ssize_t read_count;
+
+	/* Value to indicate a prefetch was submitted and not yet retrieved
+	 */
+	uint8_t is_submitted;
+
+	/* Value to indicate the submitted prefetch has completed
+	 */
+	uint8_t is_completed;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	/* The thread pool that processes the submitted prefetch
+	 */
+	libcthreads_thread_pool_t *thread_pool;
+
+	/* The mutex that protects the completion of the submitted prefetch
+	 */
+	libcthreads_mutex_t *completion_mutex;
+
+	/* The condition that is signalled when the submitted prefetch has completed
+	 */
+	libcthreads_condition_t *completion_condition;
+#endif
+};
+
+int libbfio_prefetcher_initialize(
+     libbfio_prefetcher_t **prefetcher,
+     intptr_t *io_handle,
+     ssize_t (*read_at_offset)(
+                intptr_t *io_handle,
+                uint8_t *buffer,
+                size_t size,
+                off64_t offset,
+                libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+int libbfio_prefetcher_free(
+     libbfio_prefetcher_t **prefetcher,
+     libcerror_error_t **error );
+
+int libbfio_prefetcher_submit(
+     libbfio_prefetcher_t *prefetcher,
+     off64_t offset,
+     size_t size,
+     libcerror_error_t **error );
+
+int libbfio_prefetcher_process(
+     libbfio_prefetcher_t *prefetcher,
+     void *arguments );
+
+int libbfio_prefetcher_wait(
+     libbfio_prefetcher_t *prefetcher,
+     libcerror_error_t **error );
+
+int libbfio_prefetcher_exchange_buffer(
+     libbfio_prefetcher_t *prefetcher,
+     off64_t offset,
+     uint8_t **buffer,
+     size_t *buffer_size,
+     ssize_t *read_count,
+     libcerror_error_t **error );
+
+int libbfio_prefetcher_cancel(
+     libbfio_prefetcher_t *prefetcher,
+     libcerror_error_t **error );
+
+int libbfio_prefetcher_overlaps(
+     libbfio_prefetcher_t *prefetcher,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBBFIO_PREFETCHER_H ) */
+
@@ -0,0 +1,395 @@
+/*
+ * The segmented file functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libbfio_definitions.h"
+#include "libbfio_file_pool.h"
+#include "libbfio_handle.h"
+#include "libbfio_libcerror.h"
+#include "libbfio_segmented_file.h"
+#include "libbfio_segmented_file_io_handle.h"
+#include "libbfio_types.h"
+
+/* Creates a segmented file handle
+ * The segmented file handle presents the data of an ordered list of segments,
+ * such as the files of a split image, as one contiguous range of data
+ * The segments are opened on demand and at most maximum number of open handles
+ * segments are kept open at the same time, where 0 represents no limit
+ * The segmented file handle only supports read access
+ * Make sure the value handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_segmented_file_initialize(
+     libbfio_handle_t **handle,
+     int maximum_number_of_open_handles,
+     libcerror_error_t **error )
+{
+	libbfio_segmented_file_io_handle_t *segmented_file_io_handle = NULL;
+	static char *function                                        = "libbfio_segmented_file_initialize";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_segmented_file_io_handle_initialize(
+	     &segmented_file_io_handle,
+	     maximum_number_of_open_handles,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create segmented file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_initialize(
+	     handle,
+	     (intptr_t *) segmented_file_io_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) libbfio_segmented_file_io_handle_free,
+	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) libbfio_segmented_file_io_handle_clone,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) libbfio_segmented_file_io_handle_open,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libbfio_segmented_file_io_handle_close,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) libbfio_segmented_file_io_handle_read_buffer,
+	     NULL,
+	     (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) libbfio_segmented_file_io_handle_seek_offset,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libbfio_segmented_file_io_handle_exists,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libbfio_segmented_file_io_handle_is_open,
+	     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libbfio_segmented_file_io_handle_get_size,
+	     LIBBFIO_FLAG_IO_HANDLE_MANAGED | LIBBFIO_FLAG_IO_HANDLE_CLONE_BY_FUNCTION,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_set_read_at_offset_function(
+	     *handle,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, off64_t, libcerror_error_t **)) libbfio_segmented_file_io_handle_read_buffer_at_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set read at offset function.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( segmented_file_io_handle != NULL )
+	{
+		libbfio_segmented_file_io_handle_free(
+		 &segmented_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of segments of the segmented file handle
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_segmented_file_get_number_of_segments(
+     libbfio_handle_t *handle,
+     int *number_of_segments,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_segmented_file_get_number_of_segments";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_segmented_file_io_handle_get_number_of_segments(
+	     (libbfio_segmented_file_io_handle_t *) internal_handle->io_handle,
+	     number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of segments from segmented file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a segment to the segmented file handle
+ * The segment handle is managed by the segmented file handle
+ * Segments can only be appended while the segmented file handle is not open
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_segmented_file_append_segment(
+     libbfio_handle_t *handle,
+     int *segment_index,
+     libbfio_handle_t *segment_handle,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_segmented_file_append_segment";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_segmented_file_io_handle_append_segment(
+	     (libbfio_segmented_file_io_handle_t *) internal_handle->io_handle,
+	     segment_index,
+	     segment_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append segment to segmented file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a file segment for every name to the segmented file handle
+ * The segments are appended in the order of the names
+ * Segments can only be appended while the segmented file handle is not open
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_segmented_file_append_segments_for_names(
+     libbfio_handle_t *handle,
+     char * const names[],
+     int number_of_names,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle                   = NULL;
+	libbfio_segmented_file_io_handle_t *segmented_file_io_handle = NULL;
+	static char *function                                        = "libbfio_segmented_file_append_segments_for_names";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	segmented_file_io_handle = (libbfio_segmented_file_io_handle_t *) internal_handle->io_handle;
+
+	if( segmented_file_io_handle->is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_pool_append_handles_for_names(
+	     segmented_file_io_handle->segments_pool,
+	     names,
+	     number_of_names,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append segments to segments pool.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Appends a file segment for every name to the segmented file handle
+ * The segments are appended in the order of the names
+ * Segments can only be appended while the segmented file handle is not open
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_segmented_file_append_segments_for_names_wide(
+     libbfio_handle_t *handle,
+     wchar_t * const names[],
+     int number_of_names,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle                   = NULL;
+	libbfio_segmented_file_io_handle_t *segmented_file_io_handle = NULL;
+	static char *function                                        = "libbfio_segmented_file_append_segments_for_names_wide";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	segmented_file_io_handle = (libbfio_segmented_file_io_handle_t *) internal_handle->io_handle;
+
+	if( segmented_file_io_handle->is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_pool_append_handles_for_names_wide(
+	     segmented_file_io_handle->segments_pool,
+	     names,
+	     number_of_names,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append segments to segments pool.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
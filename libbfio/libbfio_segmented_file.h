@@ -0,0 +1,78 @@
+/*
+ * The segmented file functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBBFIO_SEGMENTED_FILE_H )
+#define _LIBBFIO_SEGMENTED_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libbfio_extern.h"
+#include "libbfio_libcerror.h"
+#include "libbfio_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+LIBBFIO_EXTERN \
+int libbfio_segmented_file_initialize(
+     libbfio_handle_t **handle,
+     int maximum_number_of_open_handles,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_segmented_file_get_number_of_segments(
+     libbfio_handle_t *handle,
+     int *number_of_segments,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_segmented_file_append_segment(
+     libbfio_handle_t *handle,
+     int *segment_index,
+     libbfio_handle_t *segment_handle,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_segmented_file_append_segments_for_names(
+     libbfio_handle_t *handle,
+     char * const names[],
+     int number_of_names,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBBFIO_EXTERN \
+int libbfio_segmented_file_append_segments_for_names_wide(
+     libbfio_handle_t *handle,
+     wchar_t * const names[],
+     int number_of_names,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBBFIO_SEGMENTED_FILE_H ) */
+
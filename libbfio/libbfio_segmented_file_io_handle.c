@@ -0,0 +1,1135 @@
+/*
+ * The segmented file IO handle functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libbfio_definitions.h"
+#include "libbfio_handle.h"
+#include "libbfio_libcerror.h"
+#include "libbfio_pool.h"
+#include "libbfio_segmented_file_io_handle.h"
+#include "libbfio_types.h"
+
+/* Creates a segmented file IO handle
+ * The segments are opened on demand in a pool that keeps at most
+ * maximum number of open handles open at the same time
+ * Make sure the value segmented_file_io_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_segmented_file_io_handle_initialize(
+     libbfio_segmented_file_io_handle_t **segmented_file_io_handle,
+     int maximum_number_of_open_handles,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_segmented_file_io_handle_initialize";
+
+	if( segmented_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segmented file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *segmented_file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid segmented file IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_open_handles < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of open handles value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	*segmented_file_io_handle = memory_allocate_structure(
+	                             libbfio_segmented_file_io_handle_t );
+
+	if( *segmented_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segmented file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *segmented_file_io_handle,
+	     0,
+	     sizeof( libbfio_segmented_file_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear segmented file IO handle.",
+		 function );
+
+		memory_free(
+		 *segmented_file_io_handle );
+
+		*segmented_file_io_handle = NULL;
+
+		return( -1 );
+	}
+	if( libbfio_pool_initialize(
+	     &( ( *segmented_file_io_handle )->segments_pool ),
+	     0,
+	     maximum_number_of_open_handles,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create segments pool.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *segmented_file_io_handle != NULL )
+	{
+		memory_free(
+		 *segmented_file_io_handle );
+
+		*segmented_file_io_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a segmented file IO handle
+ * Returns 1 if succesful or -1 on error
+ */
+int libbfio_segmented_file_io_handle_free(
+     libbfio_segmented_file_io_handle_t **segmented_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_segmented_file_io_handle_free";
+	int result            = 1;
+
+	if( segmented_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segmented file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *segmented_file_io_handle != NULL )
+	{
+		if( ( *segmented_file_io_handle )->segment_offsets != NULL )
+		{
+			memory_free(
+			 ( *segmented_file_io_handle )->segment_offsets );
+		}
+		if( libbfio_pool_free(
+		     &( ( *segmented_file_io_handle )->segments_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free segments pool.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *segmented_file_io_handle );
+
+		*segmented_file_io_handle = NULL;
+	}
+	return( result );
+}
+
+/* Clones (duplicates) the segmented file IO handle and its attributes
+ * The segment handles are cloned into a new segments pool
+ * Returns 1 if succesful or -1 on error
+ */
+int libbfio_segmented_file_io_handle_clone(
+     libbfio_segmented_file_io_handle_t **destination_segmented_file_io_handle,
+     libbfio_segmented_file_io_handle_t *source_segmented_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_segmented_file_io_handle_clone";
+
+	if( destination_segmented_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination segmented file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_segmented_file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: destination segmented file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_segmented_file_io_handle == NULL )
+	{
+		*destination_segmented_file_io_handle = NULL;
+
+		return( 1 );
+	}
+	*destination_segmented_file_io_handle = memory_allocate_structure(
+	                                         libbfio_segmented_file_io_handle_t );
+
+	if( *destination_segmented_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create destination segmented file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *destination_segmented_file_io_handle,
+	     0,
+	     sizeof( libbfio_segmented_file_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear destination segmented file IO handle.",
+		 function );
+
+		memory_free(
+		 *destination_segmented_file_io_handle );
+
+		*destination_segmented_file_io_handle = NULL;
+
+		return( -1 );
+	}
+	if( libbfio_pool_clone(
+	     &( ( *destination_segmented_file_io_handle )->segments_pool ),
+	     source_segmented_file_io_handle->segments_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination segments pool.",
+		 function );
+
+		goto on_error;
+	}
+	( *destination_segmented_file_io_handle )->current_offset = source_segmented_file_io_handle->current_offset;
+	( *destination_segmented_file_io_handle )->access_flags   = source_segmented_file_io_handle->access_flags;
+
+	return( 1 );
+
+on_error:
+	if( *destination_segmented_file_io_handle != NULL )
+	{
+		memory_free(
+		 *destination_segmented_file_io_handle );
+
+		*destination_segmented_file_io_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of segments
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_segmented_file_io_handle_get_number_of_segments(
+     libbfio_segmented_file_io_handle_t *segmented_file_io_handle,
+     int *number_of_segments,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_segmented_file_io_handle_get_number_of_segments";
+
+	if( segmented_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segmented file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_pool_get_number_of_handles(
+	     segmented_file_io_handle->segments_pool,
+	     number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of handles in segments pool.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a segment
+ * The segment handle is managed by the segments pool and freed together
+ * with the segmented file IO handle
+ * Segments can only be appended while the segmented file IO handle is not open
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_segmented_file_io_handle_append_segment(
+     libbfio_segmented_file_io_handle_t *segmented_file_io_handle,
+     int *segment_index,
+     libbfio_handle_t *segment_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_segmented_file_io_handle_append_segment";
+
+	if( segmented_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segmented file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( segmented_file_io_handle->is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid segmented file IO handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_pool_append_handle(
+	     segmented_file_io_handle->segments_pool,
+	     segment_index,
+	     segment_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append segment handle to segments pool.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the segment that contains a specific offset
+ * The segment is looked up with a binary search of the segment offsets
+ * Returns 1 if successful, 0 if the offset is beyond the end of the data or -1 on error
+ */
+int libbfio_segmented_file_io_handle_get_segment_at_offset(
+     libbfio_segmented_file_io_handle_t *segmented_file_io_handle,
+     off64_t offset,
+     int *segment_index,
+     off64_t *segment_data_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_segmented_file_io_handle_get_segment_at_offset";
+	int lower_index       = 0;
+	int middle_index      = 0;
+	int upper_index       = 0;
+
+	if( segmented_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segmented file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( segmented_file_io_handle->segment_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid segmented file IO handle - missing segment offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment index.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) offset >= segmented_file_io_handle->size )
+	{
+		return( 0 );
+	}
+	/* Find the last segment that starts at or before the offset
+	 * empty segments are skipped since the next segment starts at the same offset
+	 */
+	upper_index = segmented_file_io_handle->number_of_segments - 1;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index + 1 ) / 2 );
+
+		if( segmented_file_io_handle->segment_offsets[ middle_index ] <= offset )
+		{
+			lower_index = middle_index;
+		}
+		else
+		{
+			upper_index = middle_index - 1;
+		}
+	}
+	*segment_index       = lower_index;
+	*segment_data_offset = offset - segmented_file_io_handle->segment_offsets[ lower_index ];
+
+	return( 1 );
+}
+
+/* Opens the segmented file IO handle
+ * The size of every segment is determined and the segment offsets are calculated
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_segmented_file_io_handle_open(
+     libbfio_segmented_file_io_handle_t *segmented_file_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function  = "libbfio_segmented_file_io_handle_open";
+	size64_t segment_size  = 0;
+	off64_t segment_offset = 0;
+	int number_of_segments = 0;
+	int segment_index      = 0;
+
+	if( segmented_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segmented file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( segmented_file_io_handle->is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid segmented file IO handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( segmented_file_io_handle->segment_offsets != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid segmented file IO handle - segment offsets value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* The segmented file IO handle only supports reading
+	 */
+	if( ( ( access_flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 )
+	 || ( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags: 0x%02x.",
+		 function,
+		 access_flags );
+
+		return( -1 );
+	}
+	if( libbfio_pool_get_number_of_handles(
+	     segmented_file_io_handle->segments_pool,
+	     &number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of handles in segments pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_segments <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid segmented file IO handle - missing segments.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_segments > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( off64_t ) ) - 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of segments value exceeds maximum allocation size.",
+		 function );
+
+		return( -1 );
+	}
+	segmented_file_io_handle->segment_offsets = (off64_t *) memory_allocate(
+	                                                         sizeof( off64_t ) * ( number_of_segments + 1 ) );
+
+	if( segmented_file_io_handle->segment_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segment offsets.",
+		 function );
+
+		goto on_error;
+	}
+	/* The size of the segments is retrieved via the segments pool, which opens
+	 * the segments on demand and closes them when the maximum number of open
+	 * handles is exceeded
+	 */
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		if( libbfio_pool_get_size(
+		     segmented_file_io_handle->segments_pool,
+		     segment_index,
+		     &segment_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size of segment: %d.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+		if( segment_size > (size64_t) ( INT64_MAX - segment_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid segment: %d size value out of bounds.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+		segmented_file_io_handle->segment_offsets[ segment_index ] = segment_offset;
+
+		segment_offset += (off64_t) segment_size;
+	}
+	segmented_file_io_handle->segment_offsets[ number_of_segments ] = segment_offset;
+
+	segmented_file_io_handle->number_of_segments = number_of_segments;
+	segmented_file_io_handle->size               = (size64_t) segment_offset;
+	segmented_file_io_handle->current_offset     = 0;
+	segmented_file_io_handle->access_flags       = access_flags;
+	segmented_file_io_handle->is_open            = 1;
+
+	return( 1 );
+
+on_error:
+	if( segmented_file_io_handle->segment_offsets != NULL )
+	{
+		memory_free(
+		 segmented_file_io_handle->segment_offsets );
+
+		segmented_file_io_handle->segment_offsets = NULL;
+	}
+	libbfio_pool_close_all(
+	 segmented_file_io_handle->segments_pool,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Closes the segmented file IO handle
+ * The open segments are closed
+ * Returns 0 if successful or -1 on error
+ */
+int libbfio_segmented_file_io_handle_close(
+     libbfio_segmented_file_io_handle_t *segmented_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_segmented_file_io_handle_close";
+	int result            = 0;
+
+	if( segmented_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segmented file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( segmented_file_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid segmented file IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_pool_close_all(
+	     segmented_file_io_handle->segments_pool,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close segments pool.",
+		 function );
+
+		result = -1;
+	}
+	if( segmented_file_io_handle->segment_offsets != NULL )
+	{
+		memory_free(
+		 segmented_file_io_handle->segment_offsets );
+
+		segmented_file_io_handle->segment_offsets = NULL;
+	}
+	segmented_file_io_handle->number_of_segments = 0;
+	segmented_file_io_handle->size               = 0;
+	segmented_file_io_handle->is_open            = 0;
+
+	return( result );
+}
+
+/* Reads a buffer from the segmented file IO handle
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libbfio_segmented_file_io_handle_read_buffer(
+         libbfio_segmented_file_io_handle_t *segmented_file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function = "libbfio_segmented_file_io_handle_read_buffer";
+	ssize_t read_count    = 0;
+
+	if( segmented_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segmented file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_segmented_file_io_handle_read_buffer_at_offset(
+	              segmented_file_io_handle,
+	              buffer,
+	              size,
+	              segmented_file_io_handle->current_offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer.",
+		 function );
+
+		return( -1 );
+	}
+	segmented_file_io_handle->current_offset += (off64_t) read_count;
+
+	return( read_count );
+}
+
+/* Reads a buffer at a specific offset from the segmented file IO handle
+ * A read that crosses the end of a segment continues in the next segment
+ * This function does not change the current offset of the segmented file IO handle
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libbfio_segmented_file_io_handle_read_buffer_at_offset(
+         libbfio_segmented_file_io_handle_t *segmented_file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function       = "libbfio_segmented_file_io_handle_read_buffer_at_offset";
+	size_t buffer_offset        = 0;
+	size_t read_size            = 0;
+	ssize_t read_count          = 0;
+	off64_t segment_data_offset = 0;
+	int segment_index           = 0;
+	int result                  = 0;
+
+	if( segmented_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segmented file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( segmented_file_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid segmented file IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	result = libbfio_segmented_file_io_handle_get_segment_at_offset(
+	          segmented_file_io_handle,
+	          offset,
+	          &segment_index,
+	          &segment_data_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve segment at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	while( ( buffer_offset < size )
+	    && ( segment_index < segmented_file_io_handle->number_of_segments ) )
+	{
+		read_size = size - buffer_offset;
+
+		if( (size64_t) read_size > (size64_t) ( segmented_file_io_handle->segment_offsets[ segment_index + 1 ] - offset ) )
+		{
+			read_size = (size_t) ( segmented_file_io_handle->segment_offsets[ segment_index + 1 ] - offset );
+		}
+		if( read_size > 0 )
+		{
+			read_count = libbfio_pool_read_buffer_at_offset(
+			              segmented_file_io_handle->segments_pool,
+			              segment_index,
+			              &( buffer[ buffer_offset ] ),
+			              read_size,
+			              segment_data_offset,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ") from segment: %d.",
+				 function,
+				 segment_data_offset,
+				 segment_data_offset,
+				 segment_index );
+
+				return( -1 );
+			}
+			buffer_offset += (size_t) read_count;
+			offset        += (off64_t) read_count;
+
+			/* Stop at a short read, the segment was truncated after it was opened
+			 */
+			if( (size_t) read_count != read_size )
+			{
+				break;
+			}
+		}
+		segment_index       += 1;
+		segment_data_offset  = 0;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Seeks a certain offset within the segmented file IO handle
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t libbfio_segmented_file_io_handle_seek_offset(
+         libbfio_segmented_file_io_handle_t *segmented_file_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libbfio_segmented_file_io_handle_seek_offset";
+
+	if( segmented_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segmented file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( segmented_file_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid segmented file IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += segmented_file_io_handle->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) segmented_file_io_handle->size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset.",
+		 function );
+
+		return( -1 );
+	}
+	segmented_file_io_handle->current_offset = offset;
+
+	return( offset );
+}
+
+/* Function to determine if the segments exist
+ * Returns 1 if all the segments exist, 0 if not or -1 on error
+ */
+int libbfio_segmented_file_io_handle_exists(
+     libbfio_segmented_file_io_handle_t *segmented_file_io_handle,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *segment_handle = NULL;
+	static char *function            = "libbfio_segmented_file_io_handle_exists";
+	int number_of_segments           = 0;
+	int result                       = 0;
+	int segment_index                = 0;
+
+	if( segmented_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segmented file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_pool_get_number_of_handles(
+	     segmented_file_io_handle->segments_pool,
+	     &number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of handles in segments pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_segments == 0 )
+	{
+		return( 0 );
+	}
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		if( libbfio_pool_get_handle(
+		     segmented_file_io_handle->segments_pool,
+		     segment_index,
+		     &segment_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve handle of segment: %d.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+		result = libbfio_handle_exists(
+		          segment_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if segment: %d exists.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+	}
+	return( result );
+}
+
+/* Check if the segmented file IO handle is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int libbfio_segmented_file_io_handle_is_open(
+     libbfio_segmented_file_io_handle_t *segmented_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_segmented_file_io_handle_is_open";
+
+	if( segmented_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segmented file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( segmented_file_io_handle->is_open == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the segmented file IO handle
+ * The size is the sum of the sizes of the segments
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_segmented_file_io_handle_get_size(
+     libbfio_segmented_file_io_handle_t *segmented_file_io_handle,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_segmented_file_io_handle_get_size";
+
+	if( segmented_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segmented file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( segmented_file_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid segmented file IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	*size = segmented_file_io_handle->size;
+
+	return( 1 );
+}
+
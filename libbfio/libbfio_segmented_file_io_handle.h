@@ -0,0 +1,147 @@
+/*
+ * The segmented file IO handle functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBBFIO_SEGMENTED_FILE_IO_HANDLE_H )
+#define _LIBBFIO_SEGMENTED_FILE_IO_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libbfio_libcerror.h"
+#include "libbfio_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libbfio_segmented_file_io_handle libbfio_segmented_file_io_handle_t;
+
+struct libbfio_segmented_file_io_handle
+{
+	/* The segments pool
+	 */
+	libbfio_pool_t *segments_pool;
+
+	/* The number of segments
+	 */
+	int number_of_segments;
+
+	/* The segment offsets
+	 * contains the start offset of every segment followed by the size
+	 */
+	off64_t *segment_offsets;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* Value to indicate the segmented file IO handle is open
+	 */
+	uint8_t is_open;
+
+	/* The current access flags
+	 */
+	int access_flags;
+};
+
+int libbfio_segmented_file_io_handle_initialize(
+     libbfio_segmented_file_io_handle_t **segmented_file_io_handle,
+     int maximum_number_of_open_handles,
+     libcerror_error_t **error );
+
+int libbfio_segmented_file_io_handle_free(
+     libbfio_segmented_file_io_handle_t **segmented_file_io_handle,
+     libcerror_error_t **error );
+
+int libbfio_segmented_file_io_handle_clone(
+     libbfio_segmented_file_io_handle_t **destination_segmented_file_io_handle,
+     libbfio_segmented_file_io_handle_t *source_segmented_file_io_handle,
+     libcerror_error_t **error );
+
+int libbfio_segmented_file_io_handle_get_number_of_segments(
+     libbfio_segmented_file_io_handle_t *segmented_file_io_handle,
+     int *number_of_segments,
+     libcerror_error_t **error );
+
+int libbfio_segmented_file_io_handle_append_segment(
+     libbfio_segmented_file_io_handle_t *segmented_file_io_handle,
+     int *segment_index,
+     libbfio_handle_t *segment_handle,
+     libcerror_error_t **error );
+
+int libbfio_segmented_file_io_handle_get_segment_at_offset(
+     libbfio_segmented_file_io_handle_t *segmented_file_io_handle,
+     off64_t offset,
+     int *segment_index,
+     off64_t *segment_data_offset,
+     libcerror_error_t **error );
+
+int libbfio_segmented_file_io_handle_open(
+     libbfio_segmented_file_io_handle_t *segmented_file_io_handle,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libbfio_segmented_file_io_handle_close(
+     libbfio_segmented_file_io_handle_t *segmented_file_io_handle,
+     libcerror_error_t **error );
+
+ssize_t libbfio_segmented_file_io_handle_read_buffer(
+         libbfio_segmented_file_io_handle_t *segmented_file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+ssize_t libbfio_segmented_file_io_handle_read_buffer_at_offset(
+         libbfio_segmented_file_io_handle_t *segmented_file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+off64_t libbfio_segmented_file_io_handle_seek_offset(
+         libbfio_segmented_file_io_handle_t *segmented_file_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+int libbfio_segmented_file_io_handle_exists(
+     libbfio_segmented_file_io_handle_t *segmented_file_io_handle,
+     libcerror_error_t **error );
+
+int libbfio_segmented_file_io_handle_is_open(
+     libbfio_segmented_file_io_handle_t *segmented_file_io_handle,
+     libcerror_error_t **error );
+
+int libbfio_segmented_file_io_handle_get_size(
+     libbfio_segmented_file_io_handle_t *segmented_file_io_handle,
+     size64_t *size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBBFIO_SEGMENTED_FILE_IO_HANDLE_H ) */
+
@@ -0,0 +1,473 @@
+/*
+ * The shared file IO handle functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libbfio_file_io_handle.h"
+#include "libbfio_libcerror.h"
+#include "libbfio_libcthreads.h"
+#include "libbfio_shared_file_io_handle.h"
+
+/* Creates a shared file IO handle
+ * The shared file IO handle takes over the management of the file IO handle
+ * and starts with a single reference
+ * Make sure the value shared_file_io_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_shared_file_io_handle_initialize(
+     libbfio_shared_file_io_handle_t **shared_file_io_handle,
+     libbfio_file_io_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_shared_file_io_handle_initialize";
+
+	if( shared_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *shared_file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid shared file IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	*shared_file_io_handle = memory_allocate_structure(
+	                          libbfio_shared_file_io_handle_t );
+
+	if( *shared_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create shared file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *shared_file_io_handle,
+	     0,
+	     sizeof( libbfio_shared_file_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear shared file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_initialize(
+	     &( ( *shared_file_io_handle )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *shared_file_io_handle )->file_io_handle       = file_io_handle;
+	( *shared_file_io_handle )->number_of_references = 1;
+
+	return( 1 );
+
+on_error:
+	if( *shared_file_io_handle != NULL )
+	{
+		memory_free(
+		 *shared_file_io_handle );
+
+		*shared_file_io_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a reference to a shared file IO handle
+ * The shared file IO handle is freed when the last reference is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_shared_file_io_handle_free(
+     libbfio_shared_file_io_handle_t **shared_file_io_handle,
+     libcerror_error_t **error )
+{
+	libbfio_shared_file_io_handle_t *safe_shared_file_io_handle = NULL;
+	static char *function                                       = "libbfio_shared_file_io_handle_free";
+	int number_of_references                                    = 0;
+	int result                                                  = 1;
+
+	if( shared_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *shared_file_io_handle == NULL )
+	{
+		return( 1 );
+	}
+	safe_shared_file_io_handle = *shared_file_io_handle;
+	*shared_file_io_handle     = NULL;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     safe_shared_file_io_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	safe_shared_file_io_handle->number_of_references -= 1;
+
+	number_of_references = safe_shared_file_io_handle->number_of_references;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     safe_shared_file_io_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( number_of_references > 0 )
+	{
+		return( 1 );
+	}
+	/* The file IO handle closes the file if it is still open
+	 */
+	if( libbfio_file_io_handle_free(
+	     &( safe_shared_file_io_handle->file_io_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_free(
+	     &( safe_shared_file_io_handle->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free mutex.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	memory_free(
+	 safe_shared_file_io_handle );
+
+	return( result );
+}
+
+/* Adds a reference to a shared file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_shared_file_io_handle_add_reference(
+     libbfio_shared_file_io_handle_t *shared_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_shared_file_io_handle_add_reference";
+	int result            = 1;
+
+	if( shared_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     shared_file_io_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( shared_file_io_handle->number_of_references == INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid shared file IO handle - number of references value exceeds maximum.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		shared_file_io_handle->number_of_references += 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     shared_file_io_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Opens a shared file IO handle
+ * The file is only opened by the first reference that opens the shared file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_shared_file_io_handle_open(
+     libbfio_shared_file_io_handle_t *shared_file_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_shared_file_io_handle_open";
+	int result            = 1;
+
+	if( shared_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     shared_file_io_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( shared_file_io_handle->number_of_open_references == 0 )
+	{
+		if( libbfio_file_io_handle_open(
+		     shared_file_io_handle->file_io_handle,
+		     access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		shared_file_io_handle->number_of_open_references += 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     shared_file_io_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Closes a shared file IO handle
+ * The file is only closed by the last reference that closes the shared file IO handle
+ * Returns 0 if successful or -1 on error
+ */
+int libbfio_shared_file_io_handle_close(
+     libbfio_shared_file_io_handle_t *shared_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_shared_file_io_handle_close";
+	int result            = 0;
+
+	if( shared_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     shared_file_io_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( shared_file_io_handle->number_of_open_references <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid shared file IO handle - number of open references value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		shared_file_io_handle->number_of_open_references -= 1;
+
+		if( shared_file_io_handle->number_of_open_references == 0 )
+		{
+			if( libbfio_file_io_handle_close(
+			     shared_file_io_handle->file_io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     shared_file_io_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
@@ -0,0 +1,87 @@
+/*
+ * The shared file IO handle functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBBFIO_SHARED_FILE_IO_HANDLE_H )
+#define _LIBBFIO_SHARED_FILE_IO_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libbfio_file_io_handle.h"
+#include "libbfio_libcerror.h"
+#include "libbfio_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libbfio_shared_file_io_handle libbfio_shared_file_io_handle_t;
+
+struct libbfio_shared_file_io_handle
+{
+	/* The file IO handle
+	 */
+	libbfio_file_io_handle_t *file_io_handle;
+
+	/* The number of references
+	 */
+	int number_of_references;
+
+	/* The number of references that opened the file
+	 */
+	int number_of_open_references;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	/* The mutex that protects the number of references
+	 * and the number of open references
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libbfio_shared_file_io_handle_initialize(
+     libbfio_shared_file_io_handle_t **shared_file_io_handle,
+     libbfio_file_io_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libbfio_shared_file_io_handle_free(
+     libbfio_shared_file_io_handle_t **shared_file_io_handle,
+     libcerror_error_t **error );
+
+int libbfio_shared_file_io_handle_add_reference(
+     libbfio_shared_file_io_handle_t *shared_file_io_handle,
+     libcerror_error_t **error );
+
+int libbfio_shared_file_io_handle_open(
+     libbfio_shared_file_io_handle_t *shared_file_io_handle,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libbfio_shared_file_io_handle_close(
+     libbfio_shared_file_io_handle_t *shared_file_io_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBBFIO_SHARED_FILE_IO_HANDLE_H ) */
+
@@ -34,11 +34,17 @@
 /* The following type definitions hide internal data structures
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
+typedef struct libbfio_buffer_pool {}	libbfio_buffer_pool_t;
+typedef struct libbfio_descriptor_cache {}	libbfio_descriptor_cache_t;
 typedef struct libbfio_handle {}	libbfio_handle_t;
+typedef struct libbfio_io_queue {}	libbfio_io_queue_t;
 typedef struct libbfio_pool {}		libbfio_pool_t;
 
 #else
+typedef intptr_t libbfio_buffer_pool_t;
+typedef intptr_t libbfio_descriptor_cache_t;
 typedef intptr_t libbfio_handle_t;
+typedef intptr_t libbfio_io_queue_t;
 typedef intptr_t libbfio_pool_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
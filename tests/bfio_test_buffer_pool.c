@@ -0,0 +1,981 @@
+/*
+ * Library buffer_pool type test program
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "bfio_test_libbfio.h"
+#include "bfio_test_libcerror.h"
+#include "bfio_test_macros.h"
+#include "bfio_test_memory.h"
+#include "bfio_test_unused.h"
+
+#include "../libbfio/libbfio_buffer_pool.h"
+
+/* Define to make bfio_test_buffer_pool generate verbose output
+#define BFIO_TEST_BUFFER_POOL_VERBOSE
+ */
+
+#define BFIO_TEST_BUFFER_POOL_NUMBER_OF_BUFFERS	64
+
+/* Tests the libbfio_buffer_pool_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_buffer_pool_initialize(
+     void )
+{
+	libbfio_buffer_pool_t *buffer_pool = NULL;
+	libcerror_error_t *error           = NULL;
+	int result                         = 0;
+
+#if defined( HAVE_BFIO_TEST_MEMORY )
+	int number_of_malloc_fail_tests    = 3;
+	int number_of_memset_fail_tests    = 1;
+	int test_number                    = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libbfio_buffer_pool_initialize(
+	          &buffer_pool,
+	          1000,
+	          4,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer_pool",
+	 buffer_pool );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_buffer_pool_free(
+	          &buffer_pool,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "buffer_pool",
+	 buffer_pool );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_buffer_pool_initialize(
+	          NULL,
+	          1000,
+	          4,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	buffer_pool = (libbfio_buffer_pool_t *) 0x12345678UL;
+
+	result = libbfio_buffer_pool_initialize(
+	          &buffer_pool,
+	          1000,
+	          4,
+	          &error );
+
+	buffer_pool = NULL;
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_buffer_pool_initialize(
+	          &buffer_pool,
+	          0,
+	          4,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "buffer_pool",
+	 buffer_pool );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_buffer_pool_initialize(
+	          &buffer_pool,
+	          1000,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "buffer_pool",
+	 buffer_pool );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_buffer_pool_initialize(
+	          &buffer_pool,
+	          (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE,
+	          4,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "buffer_pool",
+	 buffer_pool );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_buffer_pool_initialize(
+	          &buffer_pool,
+	          (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 4,
+	          8,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "buffer_pool",
+	 buffer_pool );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_BFIO_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libbfio_buffer_pool_initialize with malloc failing
+		 */
+		bfio_test_malloc_attempts_before_fail = test_number;
+
+		result = libbfio_buffer_pool_initialize(
+		          &buffer_pool,
+		          1000,
+		          4,
+		          &error );
+
+		if( bfio_test_malloc_attempts_before_fail != -1 )
+		{
+			bfio_test_malloc_attempts_before_fail = -1;
+
+			if( buffer_pool != NULL )
+			{
+				libbfio_buffer_pool_free(
+				 &buffer_pool,
+				 NULL );
+			}
+		}
+		else
+		{
+			BFIO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			BFIO_TEST_ASSERT_IS_NULL(
+			 "buffer_pool",
+			 buffer_pool );
+
+			BFIO_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libbfio_buffer_pool_initialize with memset failing
+		 */
+		bfio_test_memset_attempts_before_fail = test_number;
+
+		result = libbfio_buffer_pool_initialize(
+		          &buffer_pool,
+		          1000,
+		          4,
+		          &error );
+
+		if( bfio_test_memset_attempts_before_fail != -1 )
+		{
+			bfio_test_memset_attempts_before_fail = -1;
+
+			if( buffer_pool != NULL )
+			{
+				libbfio_buffer_pool_free(
+				 &buffer_pool,
+				 NULL );
+			}
+		}
+		else
+		{
+			BFIO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			BFIO_TEST_ASSERT_IS_NULL(
+			 "buffer_pool",
+			 buffer_pool );
+
+			BFIO_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_BFIO_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( buffer_pool != NULL )
+	{
+		libbfio_buffer_pool_free(
+		 &buffer_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_buffer_pool_free function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_buffer_pool_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libbfio_buffer_pool_free(
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_buffer_pool_get_buffer_size function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_buffer_pool_get_buffer_size(
+     libbfio_buffer_pool_t *buffer_pool )
+{
+	libcerror_error_t *error = NULL;
+	size_t buffer_size       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libbfio_buffer_pool_get_buffer_size(
+	          buffer_pool,
+	          &buffer_size,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_SIZE(
+	 "buffer_size",
+	 buffer_size,
+	 (size_t) 4096 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_buffer_pool_get_buffer_size(
+	          NULL,
+	          &buffer_size,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_buffer_pool_get_buffer_size(
+	          buffer_pool,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_buffer_pool_get_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_buffer_pool_get_buffer(
+     libbfio_buffer_pool_t *buffer_pool )
+{
+	uint8_t *buffers[ 3 ]    = { NULL, NULL, NULL };
+	libcerror_error_t *error = NULL;
+	uint8_t *buffer          = NULL;
+	int buffer_index         = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	for( buffer_index = 0;
+	     buffer_index < 3;
+	     buffer_index++ )
+	{
+		result = libbfio_buffer_pool_get_buffer(
+		          buffer_pool,
+		          &( buffers[ buffer_index ] ),
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "buffers[ buffer_index ]",
+		 buffers[ buffer_index ] );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "alignment",
+		 (int) ( (intptr_t) buffers[ buffer_index ] % LIBBFIO_BUFFER_POOL_ALIGNMENT ),
+		 0 );
+
+		/* The entire buffer must be usable
+		 */
+		result = ( memory_set(
+		            buffers[ buffer_index ],
+		            buffer_index,
+		            4096 ) != NULL );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	/* The buffers must not overlap, the third buffer is allocated outside the arena
+	 */
+	BFIO_TEST_ASSERT_NOT_EQUAL_INTPTR(
+	 "buffers[ 0 ]",
+	 (intptr_t) buffers[ 0 ],
+	 (intptr_t) buffers[ 1 ] );
+
+	BFIO_TEST_ASSERT_NOT_EQUAL_INTPTR(
+	 "buffers[ 1 ]",
+	 (intptr_t) buffers[ 1 ],
+	 (intptr_t) buffers[ 2 ] );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT8(
+	 "buffers[ 0 ][ 4095 ]",
+	 buffers[ 0 ][ 4095 ],
+	 (uint8_t) 0 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT8(
+	 "buffers[ 1 ][ 4095 ]",
+	 buffers[ 1 ][ 4095 ],
+	 (uint8_t) 1 );
+
+	for( buffer_index = 0;
+	     buffer_index < 3;
+	     buffer_index++ )
+	{
+		result = libbfio_buffer_pool_release_buffer(
+		          buffer_pool,
+		          buffers[ buffer_index ],
+		          &error );
+
+		buffers[ buffer_index ] = NULL;
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libbfio_buffer_pool_get_buffer(
+	          NULL,
+	          &buffer,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_buffer_pool_get_buffer(
+	          buffer_pool,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( buffer_index = 0;
+	     buffer_index < 3;
+	     buffer_index++ )
+	{
+		if( buffers[ buffer_index ] != NULL )
+		{
+			libbfio_buffer_pool_release_buffer(
+			 buffer_pool,
+			 buffers[ buffer_index ],
+			 NULL );
+		}
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_buffer_pool_release_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_buffer_pool_release_buffer(
+     libbfio_buffer_pool_t *buffer_pool )
+{
+	libcerror_error_t *error = NULL;
+	uint8_t *buffer          = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_buffer_pool_get_buffer(
+	          buffer_pool,
+	          &buffer,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_buffer_pool_release_buffer(
+	          NULL,
+	          buffer,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_buffer_pool_release_buffer(
+	          buffer_pool,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* A pointer inside a buffer of the arena is not a buffer
+	 */
+	result = libbfio_buffer_pool_release_buffer(
+	          buffer_pool,
+	          &( buffer[ 1 ] ),
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_buffer_pool_release_buffer(
+	          buffer_pool,
+	          buffer,
+	          &error );
+
+	buffer = NULL;
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( buffer != NULL )
+	{
+		libbfio_buffer_pool_release_buffer(
+		 buffer_pool,
+		 buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests retrieving and releasing buffers repeatedly
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_buffer_pool_reuse(
+     void )
+{
+	uint8_t *buffers[ 8 ]                                = { NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL };
+	libbfio_buffer_pool_t *buffer_pool                   = NULL;
+	libbfio_internal_buffer_pool_t *internal_buffer_pool = NULL;
+	libcerror_error_t *error                             = NULL;
+	int buffer_index                                     = 0;
+	int iteration                                        = 0;
+	int result                                           = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_buffer_pool_initialize(
+	          &buffer_pool,
+	          4096,
+	          BFIO_TEST_BUFFER_POOL_NUMBER_OF_BUFFERS,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer_pool",
+	 buffer_pool );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_buffer_pool = (libbfio_internal_buffer_pool_t *) buffer_pool;
+
+	/* Test regular cases
+	 * The released buffers are reused and no buffers outside the arena are allocated
+	 */
+	for( iteration = 0;
+	     iteration < 4;
+	     iteration++ )
+	{
+		for( buffer_index = 0;
+		     buffer_index < 8;
+		     buffer_index++ )
+		{
+			result = libbfio_buffer_pool_get_buffer(
+			          buffer_pool,
+			          &( buffers[ buffer_index ] ),
+			          &error );
+
+			BFIO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			BFIO_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = ( buffers[ buffer_index ] >= internal_buffer_pool->arena )
+			      && ( buffers[ buffer_index ] < &( internal_buffer_pool->arena[ BFIO_TEST_BUFFER_POOL_NUMBER_OF_BUFFERS * 4096 ] ) );
+
+			BFIO_TEST_ASSERT_EQUAL_INT(
+			 "buffer in arena",
+			 result,
+			 1 );
+		}
+		for( buffer_index = 0;
+		     buffer_index < 8;
+		     buffer_index++ )
+		{
+			result = libbfio_buffer_pool_release_buffer(
+			          buffer_pool,
+			          buffers[ buffer_index ],
+			          &error );
+
+			buffers[ buffer_index ] = NULL;
+
+			BFIO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			BFIO_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	/* Clean up
+	 */
+	result = libbfio_buffer_pool_free(
+	          &buffer_pool,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "buffer_pool",
+	 buffer_pool );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( buffer_pool != NULL )
+	{
+		for( buffer_index = 0;
+		     buffer_index < 8;
+		     buffer_index++ )
+		{
+			if( buffers[ buffer_index ] != NULL )
+			{
+				libbfio_buffer_pool_release_buffer(
+				 buffer_pool,
+				 buffers[ buffer_index ],
+				 NULL );
+			}
+		}
+		libbfio_buffer_pool_free(
+		 &buffer_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc BFIO_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] BFIO_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc BFIO_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] BFIO_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libbfio_buffer_pool_t *buffer_pool = NULL;
+	libcerror_error_t *error           = NULL;
+	int result                         = 0;
+
+	BFIO_TEST_UNREFERENCED_PARAMETER( argc )
+	BFIO_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( BFIO_TEST_BUFFER_POOL_VERBOSE )
+	libbfio_notify_set_verbose(
+	 1 );
+	libbfio_notify_set_stream(
+	 stderr,
+	 NULL );
+#endif
+	BFIO_TEST_RUN(
+	 "libbfio_buffer_pool_initialize",
+	 bfio_test_buffer_pool_initialize );
+
+	BFIO_TEST_RUN(
+	 "libbfio_buffer_pool_free",
+	 bfio_test_buffer_pool_free );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize test
+	 */
+	result = libbfio_buffer_pool_initialize(
+	          &buffer_pool,
+	          1000,
+	          2,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer_pool",
+	 buffer_pool );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_RUN_WITH_ARGS(
+	 "libbfio_buffer_pool_get_buffer_size",
+	 bfio_test_buffer_pool_get_buffer_size,
+	 buffer_pool );
+
+	BFIO_TEST_RUN_WITH_ARGS(
+	 "libbfio_buffer_pool_get_buffer",
+	 bfio_test_buffer_pool_get_buffer,
+	 buffer_pool );
+
+	BFIO_TEST_RUN_WITH_ARGS(
+	 "libbfio_buffer_pool_release_buffer",
+	 bfio_test_buffer_pool_release_buffer,
+	 buffer_pool );
+
+	/* Clean up
+	 */
+	result = libbfio_buffer_pool_free(
+	          &buffer_pool,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "buffer_pool",
+	 buffer_pool );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_RUN(
+	 "libbfio_buffer_pool_reuse",
+	 bfio_test_buffer_pool_reuse );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( buffer_pool != NULL )
+	{
+		libbfio_buffer_pool_free(
+		 &buffer_pool,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1603 @@
+/*
+ * Library cached_handle type test program
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "bfio_test_libbfio.h"
+#include "bfio_test_libcerror.h"
+#include "bfio_test_macros.h"
+#include "bfio_test_memory.h"
+#include "bfio_test_unused.h"
+
+#include "../libbfio/libbfio_cached_handle.h"
+
+/* Define to make bfio_test_cached_handle generate verbose output
+#define BFIO_TEST_CACHED_HANDLE_VERBOSE
+ */
+
+#define BFIO_TEST_CACHED_HANDLE_BLOCK_SIZE		512
+#define BFIO_TEST_CACHED_HANDLE_MAXIMUM_CACHE_SIZE	4 * BFIO_TEST_CACHED_HANDLE_BLOCK_SIZE
+
+uint8_t bfio_test_cached_handle_data[ 4096 ];
+
+/* Tests the libbfio_cached_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_cached_handle_initialize(
+     libbfio_handle_t *parent_handle )
+{
+	libbfio_handle_t *handle        = NULL;
+	libcerror_error_t *error        = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_BFIO_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 3;
+	int number_of_memset_fail_tests = 3;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libbfio_cached_handle_initialize(
+	          &handle,
+	          parent_handle,
+	          BFIO_TEST_CACHED_HANDLE_BLOCK_SIZE,
+	          BFIO_TEST_CACHED_HANDLE_MAXIMUM_CACHE_SIZE,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_cached_handle_initialize(
+	          NULL,
+	          parent_handle,
+	          BFIO_TEST_CACHED_HANDLE_BLOCK_SIZE,
+	          BFIO_TEST_CACHED_HANDLE_MAXIMUM_CACHE_SIZE,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	handle = (libbfio_handle_t *) 0x12345678UL;
+
+	result = libbfio_cached_handle_initialize(
+	          &handle,
+	          parent_handle,
+	          BFIO_TEST_CACHED_HANDLE_BLOCK_SIZE,
+	          BFIO_TEST_CACHED_HANDLE_MAXIMUM_CACHE_SIZE,
+	          &error );
+
+	handle = NULL;
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_cached_handle_initialize(
+	          &handle,
+	          NULL,
+	          BFIO_TEST_CACHED_HANDLE_BLOCK_SIZE,
+	          BFIO_TEST_CACHED_HANDLE_MAXIMUM_CACHE_SIZE,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_cached_handle_initialize(
+	          &handle,
+	          parent_handle,
+	          0,
+	          BFIO_TEST_CACHED_HANDLE_MAXIMUM_CACHE_SIZE,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_cached_handle_initialize(
+	          &handle,
+	          parent_handle,
+	          BFIO_TEST_CACHED_HANDLE_BLOCK_SIZE,
+	          BFIO_TEST_CACHED_HANDLE_BLOCK_SIZE - 1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_BFIO_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libbfio_cached_handle_initialize with malloc failing
+		 */
+		bfio_test_malloc_attempts_before_fail = test_number;
+
+		result = libbfio_cached_handle_initialize(
+		          &handle,
+		          parent_handle,
+		          BFIO_TEST_CACHED_HANDLE_BLOCK_SIZE,
+		          BFIO_TEST_CACHED_HANDLE_MAXIMUM_CACHE_SIZE,
+		          &error );
+
+		if( bfio_test_malloc_attempts_before_fail != -1 )
+		{
+			bfio_test_malloc_attempts_before_fail = -1;
+
+			if( handle != NULL )
+			{
+				libbfio_handle_free(
+				 &handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			BFIO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			BFIO_TEST_ASSERT_IS_NULL(
+			 "handle",
+			 handle );
+
+			BFIO_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libbfio_cached_handle_initialize with memset failing
+		 */
+		bfio_test_memset_attempts_before_fail = test_number;
+
+		result = libbfio_cached_handle_initialize(
+		          &handle,
+		          parent_handle,
+		          BFIO_TEST_CACHED_HANDLE_BLOCK_SIZE,
+		          BFIO_TEST_CACHED_HANDLE_MAXIMUM_CACHE_SIZE,
+		          &error );
+
+		if( bfio_test_memset_attempts_before_fail != -1 )
+		{
+			bfio_test_memset_attempts_before_fail = -1;
+
+			if( handle != NULL )
+			{
+				libbfio_handle_free(
+				 &handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			BFIO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			BFIO_TEST_ASSERT_IS_NULL(
+			 "handle",
+			 handle );
+
+			BFIO_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_BFIO_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_handle_read_buffer_at_offset function on a cached handle
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_cached_handle_read_buffer_at_offset(
+     libbfio_handle_t *parent_handle )
+{
+	uint8_t buffer[ 1024 ];
+
+	libbfio_handle_t *handle     = NULL;
+	libcerror_error_t *error     = NULL;
+	uint64_t number_of_evictions = 0;
+	uint64_t number_of_hits      = 0;
+	uint64_t number_of_misses    = 0;
+	ssize_t read_count           = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_cached_handle_initialize(
+	          &handle,
+	          parent_handle,
+	          BFIO_TEST_CACHED_HANDLE_BLOCK_SIZE,
+	          BFIO_TEST_CACHED_HANDLE_MAXIMUM_CACHE_SIZE,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a read of the first block that is not cached
+	 */
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              100,
+	              0,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 100 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          bfio_test_cached_handle_data,
+	          100 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a read of the first block that is cached
+	 */
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              100,
+	              100,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 100 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( bfio_test_cached_handle_data[ 100 ] ),
+	          100 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a read that spans the first and second block
+	 */
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              200,
+	              400,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 200 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( bfio_test_cached_handle_data[ 400 ] ),
+	          200 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libbfio_cached_handle_get_cache_statistics(
+	          handle,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &number_of_evictions,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 number_of_hits,
+	 (uint64_t) 2 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 (uint64_t) 2 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_evictions",
+	 number_of_evictions,
+	 (uint64_t) 0 );
+
+	/* Test a read that is larger than the block size and bypasses the cache
+	 */
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              1024,
+	              1024,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 1024 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( bfio_test_cached_handle_data[ 1024 ] ),
+	          1024 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test reads of the remaining blocks that evict the least recently used blocks
+	 */
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              512,
+	              1024,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              512,
+	              1536,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              512,
+	              2048,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( bfio_test_cached_handle_data[ 2048 ] ),
+	          512 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libbfio_cached_handle_get_cache_statistics(
+	          handle,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &number_of_evictions,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 number_of_hits,
+	 (uint64_t) 2 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 (uint64_t) 5 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_evictions",
+	 number_of_evictions,
+	 (uint64_t) 1 );
+
+	/* Test a read of the first block that was evicted
+	 */
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              100,
+	              0,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 100 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          bfio_test_cached_handle_data,
+	          100 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a read at the end of the data
+	 */
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              200,
+	              4000,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 96 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( bfio_test_cached_handle_data[ 4000 ] ),
+	          96 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a read beyond the end of the data
+	 */
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              100,
+	              8192,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_close(
+	          handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_handle_get_data_pointer function on a cached handle
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_cached_handle_get_data_pointer(
+     libbfio_handle_t *parent_handle )
+{
+	uint8_t buffer[ 512 ];
+
+	const uint8_t *data          = NULL;
+	libbfio_handle_t *handle     = NULL;
+	libcerror_error_t *error     = NULL;
+	uint64_t number_of_evictions = 0;
+	uint64_t number_of_hits      = 0;
+	uint64_t number_of_misses    = 0;
+	ssize_t read_count           = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_cached_handle_initialize(
+	          &handle,
+	          parent_handle,
+	          BFIO_TEST_CACHED_HANDLE_BLOCK_SIZE,
+	          BFIO_TEST_CACHED_HANDLE_MAXIMUM_CACHE_SIZE,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a data pointer within the first block
+	 */
+	result = libbfio_handle_get_data_pointer(
+	          handle,
+	          100,
+	          100,
+	          &data,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	result = memory_compare(
+	          data,
+	          &( bfio_test_cached_handle_data[ 100 ] ),
+	          100 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libbfio_handle_release_data_pointer(
+	          handle,
+	          100,
+	          data,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a data pointer that spans the first and second block
+	 */
+	result = libbfio_handle_get_data_pointer(
+	          handle,
+	          400,
+	          200,
+	          &data,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "data",
+	 data );
+
+	/* Test that a referenced block is not evicted
+	 */
+	result = libbfio_handle_get_data_pointer(
+	          handle,
+	          100,
+	          100,
+	          &data,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              512,
+	              512,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              512,
+	              1024,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              512,
+	              1536,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              512,
+	              2048,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              512,
+	              2560,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_cached_handle_get_cache_statistics(
+	          handle,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &number_of_evictions,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_evictions",
+	 number_of_evictions,
+	 (uint64_t) 2 );
+
+	result = memory_compare(
+	          data,
+	          &( bfio_test_cached_handle_data[ 100 ] ),
+	          100 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libbfio_handle_release_data_pointer(
+	          handle,
+	          100,
+	          data,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a referenced block remains available after close
+	 */
+	result = libbfio_handle_get_data_pointer(
+	          handle,
+	          1024,
+	          16,
+	          &data,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_close(
+	          handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          &( bfio_test_cached_handle_data[ 1024 ] ),
+	          16 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libbfio_handle_release_data_pointer(
+	          handle,
+	          1024,
+	          data,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_handle_release_data_pointer(
+	          handle,
+	          1024,
+	          data,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_handle_write_buffer_at_offset function on a cached handle
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_cached_handle_write_buffer_at_offset(
+     libbfio_handle_t *parent_handle )
+{
+	uint8_t buffer[ 256 ];
+	uint8_t write_buffer[ 64 ];
+
+	libbfio_handle_t *handle = NULL;
+	libcerror_error_t *error = NULL;
+	size_t buffer_index      = 0;
+	ssize_t read_count       = 0;
+	ssize_t write_count      = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_cached_handle_initialize(
+	          &handle,
+	          parent_handle,
+	          BFIO_TEST_CACHED_HANDLE_BLOCK_SIZE,
+	          BFIO_TEST_CACHED_HANDLE_MAXIMUM_CACHE_SIZE,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          handle,
+	          LIBBFIO_OPEN_READ_WRITE,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              256,
+	              512,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 256 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a write to a cached block
+	 */
+	for( buffer_index = 0;
+	     buffer_index < 64;
+	     buffer_index++ )
+	{
+		write_buffer[ buffer_index ] = 0xaa;
+	}
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               handle,
+	               write_buffer,
+	               64,
+	               576,
+	               &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) 64 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the read returns the written data
+	 */
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              256,
+	              512,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 256 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          &( buffer[ 64 ] ),
+	          write_buffer,
+	          64 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          buffer,
+	          &( bfio_test_cached_handle_data[ 512 ] ),
+	          256 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_close(
+	          handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_cached_handle_get_cache_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_cached_handle_get_cache_statistics(
+     libbfio_handle_t *parent_handle )
+{
+	libbfio_handle_t *handle     = NULL;
+	libcerror_error_t *error     = NULL;
+	uint64_t number_of_evictions = 0;
+	uint64_t number_of_hits      = 0;
+	uint64_t number_of_misses    = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_cached_handle_initialize(
+	          &handle,
+	          parent_handle,
+	          BFIO_TEST_CACHED_HANDLE_BLOCK_SIZE,
+	          BFIO_TEST_CACHED_HANDLE_MAXIMUM_CACHE_SIZE,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbfio_cached_handle_get_cache_statistics(
+	          handle,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &number_of_evictions,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 number_of_hits,
+	 (uint64_t) 0 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 (uint64_t) 0 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_evictions",
+	 number_of_evictions,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libbfio_cached_handle_get_cache_statistics(
+	          NULL,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &number_of_evictions,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_cached_handle_get_cache_statistics(
+	          handle,
+	          NULL,
+	          &number_of_misses,
+	          &number_of_evictions,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_cached_handle_get_cache_statistics(
+	          handle,
+	          &number_of_hits,
+	          NULL,
+	          &number_of_evictions,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_cached_handle_get_cache_statistics(
+	          handle,
+	          &number_of_hits,
+	          &number_of_misses,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc BFIO_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] BFIO_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc BFIO_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] BFIO_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libbfio_handle_t *parent_handle = NULL;
+	libcerror_error_t *error        = NULL;
+	size_t data_index               = 0;
+	int result                      = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( BFIO_TEST_CACHED_HANDLE_VERBOSE )
+	libbfio_notify_set_verbose(
+	 1 );
+	libbfio_notify_set_stream(
+	 stderr,
+	 NULL );
+#endif
+
+	for( data_index = 0;
+	     data_index < 4096;
+	     data_index++ )
+	{
+		bfio_test_cached_handle_data[ data_index ] = (uint8_t) ( data_index % 251 );
+	}
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize test
+	 */
+	result = libbfio_memory_range_initialize(
+	          &parent_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "parent_handle",
+	 parent_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          parent_handle,
+	          bfio_test_cached_handle_data,
+	          4096,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_RUN_WITH_ARGS(
+	 "libbfio_cached_handle_initialize",
+	 bfio_test_cached_handle_initialize,
+	 parent_handle );
+
+	BFIO_TEST_RUN_WITH_ARGS(
+	 "libbfio_cached_handle_get_cache_statistics",
+	 bfio_test_cached_handle_get_cache_statistics,
+	 parent_handle );
+
+	BFIO_TEST_RUN_WITH_ARGS(
+	 "libbfio_handle_read_buffer_at_offset",
+	 bfio_test_cached_handle_read_buffer_at_offset,
+	 parent_handle );
+
+	BFIO_TEST_RUN_WITH_ARGS(
+	 "libbfio_handle_get_data_pointer",
+	 bfio_test_cached_handle_get_data_pointer,
+	 parent_handle );
+
+	BFIO_TEST_RUN_WITH_ARGS(
+	 "libbfio_handle_write_buffer_at_offset",
+	 bfio_test_cached_handle_write_buffer_at_offset,
+	 parent_handle );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &parent_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "parent_handle",
+	 parent_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parent_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &parent_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
@@ -0,0 +1,1802 @@
+/*
+ * Library descriptor_cache type test program
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "bfio_test_libbfio.h"
+#include "bfio_test_libcerror.h"
+#include "bfio_test_macros.h"
+#include "bfio_test_memory.h"
+#include "bfio_test_unused.h"
+
+#include "../libbfio/libbfio_descriptor_cache.h"
+
+/* Define to make bfio_test_descriptor_cache generate verbose output
+#define BFIO_TEST_DESCRIPTOR_CACHE_VERBOSE
+ */
+
+#define BFIO_TEST_DESCRIPTOR_CACHE_NUMBER_OF_HANDLES	3
+
+uint8_t bfio_test_descriptor_cache_data[ 4096 ];
+
+/* Tests the libbfio_descriptor_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_descriptor_cache_initialize(
+     void )
+{
+	libbfio_descriptor_cache_t *descriptor_cache = NULL;
+	libcerror_error_t *error                     = NULL;
+	int result                                   = 0;
+
+#if defined( HAVE_BFIO_TEST_MEMORY )
+	int number_of_malloc_fail_tests              = 1;
+	int number_of_memset_fail_tests              = 1;
+	int test_number                              = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libbfio_descriptor_cache_initialize(
+	          &descriptor_cache,
+	          2,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "descriptor_cache",
+	 descriptor_cache );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_descriptor_cache_free(
+	          &descriptor_cache,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "descriptor_cache",
+	 descriptor_cache );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_descriptor_cache_initialize(
+	          NULL,
+	          2,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	descriptor_cache = (libbfio_descriptor_cache_t *) 0x12345678UL;
+
+	result = libbfio_descriptor_cache_initialize(
+	          &descriptor_cache,
+	          2,
+	          0,
+	          &error );
+
+	descriptor_cache = NULL;
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_descriptor_cache_initialize(
+	          &descriptor_cache,
+	          0,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "descriptor_cache",
+	 descriptor_cache );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_BFIO_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libbfio_descriptor_cache_initialize with malloc failing
+		 */
+		bfio_test_malloc_attempts_before_fail = test_number;
+
+		result = libbfio_descriptor_cache_initialize(
+		          &descriptor_cache,
+		          2,
+		          0,
+		          &error );
+
+		if( bfio_test_malloc_attempts_before_fail != -1 )
+		{
+			bfio_test_malloc_attempts_before_fail = -1;
+
+			if( descriptor_cache != NULL )
+			{
+				libbfio_descriptor_cache_free(
+				 &descriptor_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			BFIO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			BFIO_TEST_ASSERT_IS_NULL(
+			 "descriptor_cache",
+			 descriptor_cache );
+
+			BFIO_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libbfio_descriptor_cache_initialize with memset failing
+		 */
+		bfio_test_memset_attempts_before_fail = test_number;
+
+		result = libbfio_descriptor_cache_initialize(
+		          &descriptor_cache,
+		          2,
+		          0,
+		          &error );
+
+		if( bfio_test_memset_attempts_before_fail != -1 )
+		{
+			bfio_test_memset_attempts_before_fail = -1;
+
+			if( descriptor_cache != NULL )
+			{
+				libbfio_descriptor_cache_free(
+				 &descriptor_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			BFIO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			BFIO_TEST_ASSERT_IS_NULL(
+			 "descriptor_cache",
+			 descriptor_cache );
+
+			BFIO_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_BFIO_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( descriptor_cache != NULL )
+	{
+		libbfio_descriptor_cache_free(
+		 &descriptor_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_descriptor_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_descriptor_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libbfio_descriptor_cache_free(
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_descriptor_cache_close_idle_descriptors function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_descriptor_cache_close_idle_descriptors(
+     void )
+{
+	libbfio_descriptor_cache_t *descriptor_cache = NULL;
+	libcerror_error_t *error                     = NULL;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_descriptor_cache_initialize(
+	          &descriptor_cache,
+	          2,
+	          1000,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "descriptor_cache",
+	 descriptor_cache );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbfio_descriptor_cache_close_idle_descriptors(
+	          descriptor_cache,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_descriptor_cache_close_idle_descriptors(
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_descriptor_cache_free(
+	          &descriptor_cache,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( descriptor_cache != NULL )
+	{
+		libbfio_descriptor_cache_free(
+		 &descriptor_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) && defined( LIBBFIO_DESCRIPTOR_CACHE_HAVE_EXPIRY_THREAD )
+
+/* Tests the libbfio_internal_descriptor_cache_expire_idle_handles function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_internal_descriptor_cache_expire_idle_handles(
+     void )
+{
+	uint8_t buffer[ 256 ];
+
+	libbfio_descriptor_cache_t *descriptor_cache = NULL;
+	libbfio_handle_t *handle                     = NULL;
+	libcerror_error_t *error                     = NULL;
+	uint64_t number_of_evictions                 = 0;
+	uint64_t number_of_expirations               = 0;
+	ssize_t read_count                           = 0;
+	int number_of_open_descriptors               = 0;
+	int peak_number_of_open_descriptors          = 0;
+	int result                                   = 0;
+	int wait_index                               = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_descriptor_cache_initialize(
+	          &descriptor_cache,
+	          2,
+	          100,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "descriptor_cache",
+	 descriptor_cache );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "descriptor_cache->expiry_thread",
+	 ( (libbfio_internal_descriptor_cache_t *) descriptor_cache )->expiry_thread );
+
+	result = libbfio_memory_range_initialize(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          handle,
+	          bfio_test_descriptor_cache_data,
+	          4096,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_set_open_on_demand(
+	          handle,
+	          1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_set_descriptor_cache(
+	          handle,
+	          descriptor_cache,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_handle_read_buffer(
+	              handle,
+	              buffer,
+	              256,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 256 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the idle descriptor is closed without the descriptor cache being used
+	 */
+	for( wait_index = 0;
+	     wait_index < 40;
+	     wait_index++ )
+	{
+		result = libbfio_internal_descriptor_cache_sleep(
+		          50,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_descriptor_cache_get_statistics(
+		          descriptor_cache,
+		          &number_of_open_descriptors,
+		          &peak_number_of_open_descriptors,
+		          &number_of_evictions,
+		          &number_of_expirations,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( number_of_open_descriptors == 0 )
+		{
+			break;
+		}
+	}
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "number_of_open_descriptors",
+	 number_of_open_descriptors,
+	 0 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_evictions",
+	 number_of_evictions,
+	 (uint64_t) 0 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_expirations",
+	 number_of_expirations,
+	 (uint64_t) 1 );
+
+	/* Test that the handle continues at the current offset
+	 */
+	read_count = libbfio_handle_read_buffer(
+	              handle,
+	              buffer,
+	              256,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 256 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( bfio_test_descriptor_cache_data[ 256 ] ),
+	          256 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_descriptor_cache_free(
+	          &descriptor_cache,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( descriptor_cache != NULL )
+	{
+		libbfio_descriptor_cache_free(
+		 &descriptor_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) && defined( LIBBFIO_DESCRIPTOR_CACHE_HAVE_EXPIRY_THREAD ) */
+
+/* Tests the libbfio_descriptor_cache_get_maximum_number_of_open_descriptors function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_descriptor_cache_get_maximum_number_of_open_descriptors(
+     void )
+{
+	libbfio_descriptor_cache_t *descriptor_cache = NULL;
+	libcerror_error_t *error                     = NULL;
+	int maximum_number_of_open_descriptors       = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_descriptor_cache_initialize(
+	          &descriptor_cache,
+	          2,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "descriptor_cache",
+	 descriptor_cache );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbfio_descriptor_cache_get_maximum_number_of_open_descriptors(
+	          descriptor_cache,
+	          &maximum_number_of_open_descriptors,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "maximum_number_of_open_descriptors",
+	 maximum_number_of_open_descriptors,
+	 2 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_descriptor_cache_get_maximum_number_of_open_descriptors(
+	          NULL,
+	          &maximum_number_of_open_descriptors,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_descriptor_cache_get_maximum_number_of_open_descriptors(
+	          descriptor_cache,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_descriptor_cache_free(
+	          &descriptor_cache,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the maximum number of open descriptors is determined automatically
+	 */
+	result = libbfio_descriptor_cache_initialize(
+	          &descriptor_cache,
+	          LIBBFIO_DESCRIPTOR_CACHE_AUTOMATIC_NUMBER_OF_OPEN_DESCRIPTORS,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "descriptor_cache",
+	 descriptor_cache );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_descriptor_cache_get_maximum_number_of_open_descriptors(
+	          descriptor_cache,
+	          &maximum_number_of_open_descriptors,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_GREATER_THAN_INT(
+	 "maximum_number_of_open_descriptors",
+	 maximum_number_of_open_descriptors,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libbfio_descriptor_cache_free(
+	          &descriptor_cache,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( descriptor_cache != NULL )
+	{
+		libbfio_descriptor_cache_free(
+		 &descriptor_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_descriptor_cache_get_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_descriptor_cache_get_statistics(
+     void )
+{
+	libbfio_descriptor_cache_t *descriptor_cache = NULL;
+	libcerror_error_t *error                     = NULL;
+	uint64_t number_of_evictions                 = 0;
+	uint64_t number_of_expirations               = 0;
+	int number_of_open_descriptors               = 0;
+	int peak_number_of_open_descriptors          = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_descriptor_cache_initialize(
+	          &descriptor_cache,
+	          2,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "descriptor_cache",
+	 descriptor_cache );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbfio_descriptor_cache_get_statistics(
+	          descriptor_cache,
+	          &number_of_open_descriptors,
+	          &peak_number_of_open_descriptors,
+	          &number_of_evictions,
+	          &number_of_expirations,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "number_of_open_descriptors",
+	 number_of_open_descriptors,
+	 0 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "peak_number_of_open_descriptors",
+	 peak_number_of_open_descriptors,
+	 0 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_evictions",
+	 number_of_evictions,
+	 (uint64_t) 0 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_expirations",
+	 number_of_expirations,
+	 (uint64_t) 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_descriptor_cache_get_statistics(
+	          NULL,
+	          &number_of_open_descriptors,
+	          &peak_number_of_open_descriptors,
+	          &number_of_evictions,
+	          &number_of_expirations,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_descriptor_cache_get_statistics(
+	          descriptor_cache,
+	          NULL,
+	          &peak_number_of_open_descriptors,
+	          &number_of_evictions,
+	          &number_of_expirations,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_descriptor_cache_get_statistics(
+	          descriptor_cache,
+	          &number_of_open_descriptors,
+	          &peak_number_of_open_descriptors,
+	          NULL,
+	          &number_of_expirations,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_descriptor_cache_free(
+	          &descriptor_cache,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( descriptor_cache != NULL )
+	{
+		libbfio_descriptor_cache_free(
+		 &descriptor_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests reading handles that are opened on demand with a descriptor cache
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_descriptor_cache_read_buffer(
+     void )
+{
+	uint8_t buffer[ 256 ];
+
+	libbfio_handle_t *handles[ BFIO_TEST_DESCRIPTOR_CACHE_NUMBER_OF_HANDLES ];
+
+	libbfio_descriptor_cache_t *descriptor_cache = NULL;
+	libcerror_error_t *error                     = NULL;
+	uint64_t number_of_evictions                 = 0;
+	uint64_t number_of_expirations               = 0;
+	ssize_t read_count                           = 0;
+	off64_t offset                               = 0;
+	int handle_index                             = 0;
+	int number_of_open_descriptors               = 0;
+	int peak_number_of_open_descriptors          = 0;
+	int result                                   = 0;
+
+	for( handle_index = 0;
+	     handle_index < BFIO_TEST_DESCRIPTOR_CACHE_NUMBER_OF_HANDLES;
+	     handle_index++ )
+	{
+		handles[ handle_index ] = NULL;
+	}
+	/* Initialize test
+	 */
+	result = libbfio_descriptor_cache_initialize(
+	          &descriptor_cache,
+	          2,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "descriptor_cache",
+	 descriptor_cache );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( handle_index = 0;
+	     handle_index < BFIO_TEST_DESCRIPTOR_CACHE_NUMBER_OF_HANDLES;
+	     handle_index++ )
+	{
+		result = libbfio_memory_range_initialize(
+		          &( handles[ handle_index ] ),
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_memory_range_set(
+		          handles[ handle_index ],
+		          bfio_test_descriptor_cache_data,
+		          4096,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_handle_set_open_on_demand(
+		          handles[ handle_index ],
+		          1,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_handle_set_descriptor_cache(
+		          handles[ handle_index ],
+		          descriptor_cache,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_handle_open(
+		          handles[ handle_index ],
+		          LIBBFIO_OPEN_READ,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test that the descriptor is kept open after a read and that the least recently
+	 * used descriptor is closed when the maximum number of open descriptors is exceeded
+	 */
+	for( handle_index = 0;
+	     handle_index < BFIO_TEST_DESCRIPTOR_CACHE_NUMBER_OF_HANDLES;
+	     handle_index++ )
+	{
+		read_count = libbfio_handle_read_buffer(
+		              handles[ handle_index ],
+		              buffer,
+		              256,
+		              &error );
+
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 256 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_handle_is_open(
+		          handles[ handle_index ],
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libbfio_handle_is_open(
+	          handles[ 0 ],
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_is_open(
+	          handles[ 1 ],
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_is_open(
+	          handles[ 2 ],
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a handle of which the descriptor was closed continues at the current offset
+	 */
+	read_count = libbfio_handle_read_buffer(
+	              handles[ 0 ],
+	              buffer,
+	              256,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 256 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( bfio_test_descriptor_cache_data[ 256 ] ),
+	          256 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libbfio_handle_get_offset(
+	          handles[ 0 ],
+	          &offset,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 512 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_is_open(
+	          handles[ 1 ],
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the least recently used descriptors were closed to stay within
+	 * the maximum number of open descriptors
+	 */
+	result = libbfio_descriptor_cache_get_statistics(
+	          descriptor_cache,
+	          &number_of_open_descriptors,
+	          &peak_number_of_open_descriptors,
+	          &number_of_evictions,
+	          &number_of_expirations,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "number_of_open_descriptors",
+	 number_of_open_descriptors,
+	 2 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "peak_number_of_open_descriptors",
+	 peak_number_of_open_descriptors,
+	 2 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_evictions",
+	 number_of_evictions,
+	 (uint64_t) 2 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_expirations",
+	 number_of_expirations,
+	 (uint64_t) 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the descriptor cache cannot be freed while it is used by handles
+	 */
+	result = libbfio_descriptor_cache_free(
+	          &descriptor_cache,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "descriptor_cache",
+	 descriptor_cache );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test that closing a handle closes the descriptor kept open by the descriptor cache
+	 */
+	result = libbfio_handle_close(
+	          handles[ 2 ],
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_is_open(
+	          handles[ 2 ],
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_handle_set_descriptor_cache(
+	          NULL,
+	          descriptor_cache,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_set_descriptor_cache(
+	          handles[ 0 ],
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( handle_index = 0;
+	     handle_index < BFIO_TEST_DESCRIPTOR_CACHE_NUMBER_OF_HANDLES;
+	     handle_index++ )
+	{
+		result = libbfio_handle_free(
+		          &( handles[ handle_index ] ),
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libbfio_descriptor_cache_free(
+	          &descriptor_cache,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "descriptor_cache",
+	 descriptor_cache );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( handle_index = 0;
+	     handle_index < BFIO_TEST_DESCRIPTOR_CACHE_NUMBER_OF_HANDLES;
+	     handle_index++ )
+	{
+		if( handles[ handle_index ] != NULL )
+		{
+			libbfio_handle_free(
+			 &( handles[ handle_index ] ),
+			 NULL );
+		}
+	}
+	if( descriptor_cache != NULL )
+	{
+		libbfio_descriptor_cache_free(
+		 &descriptor_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests reading handles in a pool with a descriptor cache
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_descriptor_cache_pool_read_buffer_at_offset(
+     void )
+{
+	uint8_t buffer[ 256 ];
+
+	libbfio_descriptor_cache_t *descriptor_cache = NULL;
+	libbfio_handle_t *handle                     = NULL;
+	libbfio_pool_t *pool                         = NULL;
+	libcerror_error_t *error                     = NULL;
+	uint64_t number_of_evictions                 = 0;
+	uint64_t number_of_expirations               = 0;
+	ssize_t read_count                           = 0;
+	int entry                                    = 0;
+	int handle_index                             = 0;
+	int number_of_open_descriptors               = 0;
+	int peak_number_of_open_descriptors          = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_descriptor_cache_initialize(
+	          &descriptor_cache,
+	          1,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "descriptor_cache",
+	 descriptor_cache );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_initialize(
+	          &pool,
+	          0,
+	          LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "pool",
+	 pool );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_set_descriptor_cache(
+	          pool,
+	          descriptor_cache,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( handle_index = 0;
+	     handle_index < 2;
+	     handle_index++ )
+	{
+		result = libbfio_memory_range_initialize(
+		          &handle,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_memory_range_set(
+		          handle,
+		          bfio_test_descriptor_cache_data,
+		          4096,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_pool_append_handle(
+		          pool,
+		          &entry,
+		          handle,
+		          LIBBFIO_OPEN_READ,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		handle = NULL;
+	}
+	/* Test that the pool keeps only one descriptor open
+	 */
+	for( entry = 0;
+	     entry < 2;
+	     entry++ )
+	{
+		read_count = libbfio_pool_read_buffer_at_offset(
+		              pool,
+		              entry,
+		              buffer,
+		              256,
+		              512,
+		              &error );
+
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 256 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          buffer,
+		          &( bfio_test_descriptor_cache_data[ 512 ] ),
+		          256 );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	result = libbfio_descriptor_cache_get_statistics(
+	          descriptor_cache,
+	          &number_of_open_descriptors,
+	          &peak_number_of_open_descriptors,
+	          &number_of_evictions,
+	          &number_of_expirations,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "number_of_open_descriptors",
+	 number_of_open_descriptors,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "peak_number_of_open_descriptors",
+	 peak_number_of_open_descriptors,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_evictions",
+	 number_of_evictions,
+	 (uint64_t) 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_pool_set_descriptor_cache(
+	          NULL,
+	          descriptor_cache,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_pool_free(
+	          &pool,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_descriptor_cache_free(
+	          &descriptor_cache,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( pool != NULL )
+	{
+		libbfio_pool_free(
+		 &pool,
+		 NULL );
+	}
+	if( descriptor_cache != NULL )
+	{
+		libbfio_descriptor_cache_free(
+		 &descriptor_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc BFIO_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] BFIO_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc BFIO_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] BFIO_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	size_t data_index = 0;
+
+	BFIO_TEST_UNREFERENCED_PARAMETER( argc )
+	BFIO_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( BFIO_TEST_DESCRIPTOR_CACHE_VERBOSE )
+	libbfio_notify_set_verbose(
+	 1 );
+	libbfio_notify_set_stream(
+	 stderr,
+	 NULL );
+#endif
+
+	for( data_index = 0;
+	     data_index < 4096;
+	     data_index++ )
+	{
+		bfio_test_descriptor_cache_data[ data_index ] = (uint8_t) ( data_index % 251 );
+	}
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	BFIO_TEST_RUN(
+	 "libbfio_descriptor_cache_initialize",
+	 bfio_test_descriptor_cache_initialize );
+
+	BFIO_TEST_RUN(
+	 "libbfio_descriptor_cache_free",
+	 bfio_test_descriptor_cache_free );
+
+	BFIO_TEST_RUN(
+	 "libbfio_descriptor_cache_get_maximum_number_of_open_descriptors",
+	 bfio_test_descriptor_cache_get_maximum_number_of_open_descriptors );
+
+	BFIO_TEST_RUN(
+	 "libbfio_descriptor_cache_get_statistics",
+	 bfio_test_descriptor_cache_get_statistics );
+
+	BFIO_TEST_RUN(
+	 "libbfio_descriptor_cache_close_idle_descriptors",
+	 bfio_test_descriptor_cache_close_idle_descriptors );
+
+#if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) && defined( LIBBFIO_DESCRIPTOR_CACHE_HAVE_EXPIRY_THREAD )
+
+	BFIO_TEST_RUN(
+	 "libbfio_internal_descriptor_cache_expire_idle_handles",
+	 bfio_test_internal_descriptor_cache_expire_idle_handles );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) && defined( LIBBFIO_DESCRIPTOR_CACHE_HAVE_EXPIRY_THREAD ) */
+
+	BFIO_TEST_RUN(
+	 "libbfio_handle_read_buffer_with_descriptor_cache",
+	 bfio_test_descriptor_cache_read_buffer );
+
+	BFIO_TEST_RUN(
+	 "libbfio_pool_read_buffer_at_offset_with_descriptor_cache",
+	 bfio_test_descriptor_cache_pool_read_buffer_at_offset );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -30,6 +31,14 @@
 #include <stdlib.h>
 #endif
 
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
 #include "bfio_test_functions.h"
 #include "bfio_test_getopt.h"
 #include "bfio_test_libbfio.h"
@@ -1225,7 +1234,9 @@ on_error:
 int bfio_test_file_io_handle_set_name(
      void )
 {
+#if !defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
 	libcfile_file_t *file                    = NULL;
+#endif
 	libbfio_file_io_handle_t *file_io_handle = NULL;
 	libcerror_error_t *error                 = NULL;
 	int result                               = 0;
@@ -1337,6 +1348,17 @@ int bfio_test_file_io_handle_set_name(
 	libcerror_error_free(
 	 &error );
 
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+	file_io_handle->descriptor = 0;
+
+	result = libbfio_file_io_handle_set_name(
+	          file_io_handle,
+	          "test",
+	          4,
+	          &error );
+
+	file_io_handle->descriptor = -1;
+#else
 	file = file_io_handle->file;
 
 	file_io_handle->file = NULL;
@@ -1348,6 +1370,7 @@ int bfio_test_file_io_handle_set_name(
 	          &error );
 
 	file_io_handle->file = file;
+#endif
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1638,7 +1661,9 @@ on_error:
 int bfio_test_file_io_handle_set_name_wide(
      void )
 {
+#if !defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
 	libcfile_file_t *file                    = NULL;
+#endif
 	libbfio_file_io_handle_t *file_io_handle = NULL;
 	libcerror_error_t *error                 = NULL;
 	int result                               = 0;
@@ -1750,6 +1775,17 @@ int bfio_test_file_io_handle_set_name_wide(
 	libcerror_error_free(
 	 &error );
 
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+	file_io_handle->descriptor = 0;
+
+	result = libbfio_file_io_handle_set_name_wide(
+	          file_io_handle,
+	          L"test",
+	          4,
+	          &error );
+
+	file_io_handle->descriptor = -1;
+#else
 	file = file_io_handle->file;
 
 	file_io_handle->file = NULL;
@@ -1761,6 +1797,7 @@ int bfio_test_file_io_handle_set_name_wide(
 	          &error );
 
 	file_io_handle->file = file;
+#endif
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -2075,30 +2112,29 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libbfio_file_io_handle_write_buffer function
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+
+/* Tests the libbfio_file_io_handle_read_buffer_at_offset function
  * Returns 1 if successful or 0 if not
  */
-int bfio_test_file_io_handle_write_buffer(
-     void )
+int bfio_test_file_io_handle_read_buffer_at_offset(
+     libbfio_file_io_handle_t *file_io_handle )
 {
-	char narrow_temporary_filename[ 17 ] = {
-		'b', 'f', 'i', 'o', '_', 't', 'e', 's', 't', '_', 'X', 'X', 'X', 'X', 'X', 'X', 0 };
-
-	uint8_t buffer[ 32 ] = {
-		'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
-		'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', '0', '1', '2', '3', '4', '5' };
+	uint8_t buffer[ 32 ];
+	uint8_t expected_buffer[ 32 ];
 
 	libbfio_file_io_handle_t *closed_file_io_handle = NULL;
-	libbfio_file_io_handle_t *file_io_handle        = NULL;
 	libcerror_error_t *error                        = NULL;
-	ssize_t write_count                             = 0;
+	size64_t file_size                              = 0;
+	ssize_t read_count                              = 0;
+	off64_t offset                                  = 0;
 	int result                                      = 0;
-	int with_temporary_file                         = 0;
 
 	/* Initialize test
 	 */
-	result = libbfio_file_io_handle_initialize(
-	          &file_io_handle,
+	result = libbfio_file_io_handle_get_size(
+	          file_io_handle,
+	          &file_size,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -2106,89 +2142,119 @@ int bfio_test_file_io_handle_write_buffer(
 	 result,
 	 1 );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
-	 "file_io_handle",
-	 file_io_handle );
-
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = bfio_test_get_temporary_filename(
-	          narrow_temporary_filename,
-	          17,
+	if( file_size < 32 )
+	{
+		return( 1 );
+	}
+	offset = libbfio_file_io_handle_seek_offset(
+	          file_io_handle,
+	          0,
+	          SEEK_SET,
 	          &error );
 
-	BFIO_TEST_ASSERT_NOT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	with_temporary_file = result;
+	read_count = libbfio_file_io_handle_read_buffer(
+	              file_io_handle,
+	              expected_buffer,
+	              32,
+	              &error );
 
-	if( with_temporary_file != 0 )
-	{
-		result = libbfio_file_io_handle_set_name(
-		          file_io_handle,
-		          narrow_temporary_filename,
-		          16,
-		          &error );
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 32 );
 
-		BFIO_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		BFIO_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	/* Test regular cases
+	 */
+	read_count = libbfio_file_io_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              buffer,
+	              16,
+	              16,
+	              &error );
 
-		result = libbfio_file_io_handle_open(
-		          file_io_handle,
-		          LIBBFIO_OPEN_WRITE,
-		          &error );
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
 
-		BFIO_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		BFIO_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	result = memory_compare(
+	          buffer,
+	          &( expected_buffer[ 16 ] ),
+	          16 );
 
-		/* Test regular cases
-		 */
-		write_count = libbfio_file_io_handle_write_buffer(
-		               file_io_handle,
-		               buffer,
-		               32,
-		               &error );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-		BFIO_TEST_ASSERT_EQUAL_SSIZE(
-		 "write_count",
-		 write_count,
-		 (ssize_t) 32 );
+	/* Test that the current offset was not changed
+	 */
+	offset = libbfio_file_io_handle_seek_offset(
+	          file_io_handle,
+	          0,
+	          SEEK_CUR,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 32 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read buffer at offset beyond the end of the file
+	 */
+	read_count = libbfio_file_io_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              buffer,
+	              32,
+	              (off64_t) file_size,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		BFIO_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
 	/* Test error cases
 	 */
-	write_count = libbfio_file_io_handle_write_buffer(
-	               NULL,
-	               buffer,
-	               0,
-	               &error );
+	read_count = libbfio_file_io_handle_read_buffer_at_offset(
+	              NULL,
+	              buffer,
+	              32,
+	              0,
+	              &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
-	 "write_count",
-	 write_count,
+	 "read_count",
+	 read_count,
 	 (ssize_t) -1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
@@ -2198,15 +2264,16 @@ int bfio_test_file_io_handle_write_buffer(
 	libcerror_error_free(
 	 &error );
 
-	write_count = libbfio_file_io_handle_write_buffer(
-	               file_io_handle,
-	               NULL,
-	               0,
-	               &error );
+	read_count = libbfio_file_io_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              NULL,
+	              32,
+	              0,
+	              &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
-	 "write_count",
-	 write_count,
+	 "read_count",
+	 read_count,
 	 (ssize_t) -1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
@@ -2216,15 +2283,35 @@ int bfio_test_file_io_handle_write_buffer(
 	libcerror_error_free(
 	 &error );
 
-	write_count = libbfio_file_io_handle_write_buffer(
-	               file_io_handle,
-	               buffer,
-	               (size_t) SSIZE_MAX + 1,
-	               &error );
+	read_count = libbfio_file_io_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              0,
+	              &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
-	 "write_count",
-	 write_count,
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libbfio_file_io_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              buffer,
+	              32,
+	              -1,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
 	 (ssize_t) -1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
@@ -2253,17 +2340,18 @@ int bfio_test_file_io_handle_write_buffer(
 	 "error",
 	 error );
 
-	/* Test write buffer with error code on a closed file IO handle
+	/* Test read buffer at offset on a closed file IO handle
 	 */
-	write_count = libbfio_file_io_handle_write_buffer(
-	               closed_file_io_handle,
-	               buffer,
-	               0,
-	               &error );
+	read_count = libbfio_file_io_handle_read_buffer_at_offset(
+	              closed_file_io_handle,
+	              buffer,
+	              32,
+	              0,
+	              &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
-	 "write_count",
-	 write_count,
+	 "read_count",
+	 read_count,
 	 (ssize_t) -1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
@@ -2292,23 +2380,3258 @@ int bfio_test_file_io_handle_write_buffer(
 	 "error",
 	 error );
 
-	if( with_temporary_file != 0 )
-	{
-		result = libbfio_file_io_handle_close(
-		          file_io_handle,
-		          &error );
-
-		BFIO_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 0 );
-
-		BFIO_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	return( 1 );
 
-		result = bfio_test_remove_temporary_file(
-		          narrow_temporary_filename,
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( closed_file_io_handle != NULL )
+	{
+		libbfio_file_io_handle_free(
+		 &closed_file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ ) */
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+
+/* Tests reading data from a file IO handle that requires block aligned reads
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_file_io_handle_read_block_aligned(
+     void )
+{
+	char narrow_temporary_filename[ 17 ] = {
+		'b', 'f', 'i', 'o', '_', 't', 'e', 's', 't', '_', 'X', 'X', 'X', 'X', 'X', 'X', 0 };
+
+	uint8_t data[ 2148 ];
+	uint8_t read_buffer[ 1024 ];
+
+	libbfio_file_io_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error                 = NULL;
+	size_t data_offset                       = 0;
+	ssize_t read_count                       = 0;
+	ssize_t write_count                      = 0;
+	off64_t descriptor_offset                = 0;
+	off64_t offset                           = 0;
+	int descriptor                           = 0;
+	int result                               = 0;
+	int with_temporary_file                  = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 2148;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( data_offset % 251 );
+	}
+	result = bfio_test_get_temporary_filename(
+	          narrow_temporary_filename,
+	          17,
+	          &error );
+
+	BFIO_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	with_temporary_file = result;
+
+	if( with_temporary_file == 0 )
+	{
+		return( 1 );
+	}
+	result = libbfio_file_io_handle_initialize(
+	          &file_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_file_io_handle_set_name(
+	          file_io_handle,
+	          narrow_temporary_filename,
+	          16,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_file_io_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_WRITE,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	write_count = libbfio_file_io_handle_write_buffer(
+	               file_io_handle,
+	               data,
+	               2148,
+	               &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) 2148 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_file_io_handle_close(
+	          file_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_file_io_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A regular file does not require aligned reads
+	 */
+	BFIO_TEST_ASSERT_EQUAL_SIZE(
+	 "file_io_handle->alignment",
+	 file_io_handle->alignment,
+	 (size_t) 0 );
+
+	/* Emulate a device with a block size of 512 bytes as open does for a raw disk device
+	 */
+	file_io_handle->alignment = 512;
+
+	result = libbfio_buffer_pool_initialize(
+	          &( file_io_handle->bounce_buffer_pool ),
+	          LIBBFIO_FILE_IO_HANDLE_BOUNCE_BUFFER_SIZE,
+	          LIBBFIO_FILE_IO_HANDLE_NUMBER_OF_BOUNCE_BUFFERS,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a read that starts and ends within a block
+	 */
+	read_count = libbfio_file_io_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              read_buffer,
+	              1000,
+	              13,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 1000 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          read_buffer,
+	          &( data[ 13 ] ),
+	          1000 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a read that is truncated at the end of the last partial block
+	 */
+	read_count = libbfio_file_io_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              read_buffer,
+	              512,
+	              2000,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 148 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          read_buffer,
+	          &( data[ 2000 ] ),
+	          148 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a sequential read that continues at the current offset
+	 */
+	offset = libbfio_file_io_handle_seek_offset(
+	          file_io_handle,
+	          700,
+	          SEEK_SET,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 700 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_file_io_handle_read_buffer(
+	              file_io_handle,
+	              read_buffer,
+	              300,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 300 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          read_buffer,
+	          &( data[ 700 ] ),
+	          300 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	offset = libbfio_file_io_handle_seek_offset(
+	          file_io_handle,
+	          0,
+	          SEEK_CUR,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 1000 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the descriptor is not available since reads on it would not be aligned
+	 */
+	result = libbfio_file_io_handle_get_descriptor(
+	          file_io_handle,
+	          &descriptor,
+	          &descriptor_offset,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libbfio_file_io_handle_close(
+	          file_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_ASSERT_EQUAL_SIZE(
+	 "file_io_handle->alignment",
+	 file_io_handle->alignment,
+	 (size_t) 0 );
+
+	result = bfio_test_remove_temporary_file(
+	          narrow_temporary_filename,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	with_temporary_file = 0;
+
+	result = libbfio_file_io_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_file_io_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( with_temporary_file != 0 )
+	{
+		bfio_test_remove_temporary_file(
+		 narrow_temporary_filename,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_file_io_handle_get_device_size function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_file_io_handle_get_device_size(
+     void )
+{
+	libbfio_file_io_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error                 = NULL;
+	size64_t size                            = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_file_io_handle_initialize(
+	          &file_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The null device is a character device that is not a disk device
+	 */
+	result = libbfio_file_io_handle_set_name(
+	          file_io_handle,
+	          "/dev/null",
+	          9,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_file_io_handle_get_device_size(
+	          file_io_handle,
+	          &size,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_file_io_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbfio_file_io_handle_get_device_size(
+	          file_io_handle,
+	          &size,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the size falls back to the end of the file
+	 */
+	size = 1;
+
+	result = libbfio_file_io_handle_get_size(
+	          file_io_handle,
+	          &size,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_file_io_handle_get_device_size(
+	          NULL,
+	          &size,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_file_io_handle_get_device_size(
+	          file_io_handle,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_file_io_handle_close(
+	          file_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_file_io_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_file_io_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_file_io_handle_get_device_block_size function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_file_io_handle_get_device_block_size(
+     void )
+{
+	libbfio_file_io_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error                 = NULL;
+	size_t block_size                        = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_file_io_handle_initialize(
+	          &file_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The null device is a character device that does not require aligned reads
+	 */
+	result = libbfio_file_io_handle_set_name(
+	          file_io_handle,
+	          "/dev/null",
+	          9,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_file_io_handle_get_device_block_size(
+	          file_io_handle,
+	          &block_size,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_file_io_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_ASSERT_EQUAL_SIZE(
+	 "file_io_handle->alignment",
+	 file_io_handle->alignment,
+	 (size_t) 0 );
+
+	/* Test regular cases
+	 */
+	block_size = 1;
+
+	result = libbfio_file_io_handle_get_device_block_size(
+	          file_io_handle,
+	          &block_size,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_EQUAL_SIZE(
+	 "block_size",
+	 block_size,
+	 (size_t) 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_file_io_handle_get_device_block_size(
+	          NULL,
+	          &block_size,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_file_io_handle_get_device_block_size(
+	          file_io_handle,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_file_io_handle_close(
+	          file_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_file_io_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_file_io_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ ) */
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_DIRECT_IO )
+
+/* Tests the libbfio_file_io_handle_read_buffer_at_offset_aligned function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_file_io_handle_read_buffer_at_offset_aligned(
+     libbfio_file_io_handle_t *file_io_handle )
+{
+	uint8_t aligned_data[ 20480 ];
+	uint8_t expected_buffer[ 16384 ];
+
+	libbfio_file_io_handle_t *direct_file_io_handle = NULL;
+	libcerror_error_t *error                        = NULL;
+	uint8_t *buffer                                 = NULL;
+	size64_t file_size                              = 0;
+	ssize_t read_count                              = 0;
+	off64_t offset                                  = 0;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_file_io_handle_get_size(
+	          file_io_handle,
+	          &file_size,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( file_size < 32768 )
+	{
+		return( 1 );
+	}
+	result = libbfio_file_io_handle_clone(
+	          &direct_file_io_handle,
+	          file_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "direct_file_io_handle",
+	 direct_file_io_handle );
+
+	/* Test that direct IO requires read-only access
+	 */
+	result = libbfio_file_io_handle_open(
+	          direct_file_io_handle,
+	          LIBBFIO_OPEN_READ_WRITE | LIBBFIO_ACCESS_FLAG_DIRECT,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_file_io_handle_open(
+	          direct_file_io_handle,
+	          LIBBFIO_OPEN_READ_DIRECT,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The buffer is aligned so that reads of aligned data bypass the bounce buffer
+	 */
+	buffer = &( aligned_data[ LIBBFIO_FILE_IO_HANDLE_DIRECT_IO_ALIGNMENT - ( (intptr_t) aligned_data % LIBBFIO_FILE_IO_HANDLE_DIRECT_IO_ALIGNMENT ) ] );
+
+	/* Test regular cases
+	 */
+	read_count = libbfio_file_io_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              expected_buffer,
+	              100,
+	              13,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 100 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_file_io_handle_read_buffer_at_offset_aligned(
+	              direct_file_io_handle,
+	              buffer,
+	              100,
+	              13,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 100 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          expected_buffer,
+	          100 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a read that spans an alignment boundary
+	 */
+	read_count = libbfio_file_io_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              expected_buffer,
+	              200,
+	              4000,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 200 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_file_io_handle_read_buffer_at_offset_aligned(
+	              direct_file_io_handle,
+	              buffer,
+	              200,
+	              4000,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 200 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          expected_buffer,
+	          200 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a read of aligned data
+	 */
+	read_count = libbfio_file_io_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              expected_buffer,
+	              8192,
+	              8192,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 8192 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_file_io_handle_read_buffer_at_offset_aligned(
+	              direct_file_io_handle,
+	              buffer,
+	              8192,
+	              8192,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 8192 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          expected_buffer,
+	          8192 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a read of unaligned data that is larger than the alignment
+	 */
+	read_count = libbfio_file_io_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              expected_buffer,
+	              16384,
+	              4000,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16384 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_file_io_handle_read_buffer_at_offset_aligned(
+	              direct_file_io_handle,
+	              buffer,
+	              16384,
+	              4000,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16384 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          expected_buffer,
+	          16384 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a read that is truncated at the end of the file
+	 */
+	read_count = libbfio_file_io_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              expected_buffer,
+	              4096,
+	              (off64_t) file_size - 100,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 100 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_file_io_handle_read_buffer_at_offset_aligned(
+	              direct_file_io_handle,
+	              buffer,
+	              4096,
+	              (off64_t) file_size - 100,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 100 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          expected_buffer,
+	          100 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a read beyond the end of the file
+	 */
+	read_count = libbfio_file_io_handle_read_buffer_at_offset_aligned(
+	              direct_file_io_handle,
+	              buffer,
+	              4096,
+	              (off64_t) file_size,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a sequential read continues at the current offset
+	 */
+	offset = libbfio_file_io_handle_seek_offset(
+	          direct_file_io_handle,
+	          13,
+	          SEEK_SET,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 13 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_file_io_handle_read_buffer(
+	              direct_file_io_handle,
+	              buffer,
+	              100,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 100 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_file_io_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              expected_buffer,
+	              100,
+	              13,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 100 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          expected_buffer,
+	          100 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	offset = libbfio_file_io_handle_seek_offset(
+	          direct_file_io_handle,
+	          0,
+	          SEEK_CUR,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 113 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libbfio_file_io_handle_read_buffer_at_offset_aligned(
+	              NULL,
+	              buffer,
+	              100,
+	              13,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libbfio_file_io_handle_read_buffer_at_offset_aligned(
+	              direct_file_io_handle,
+	              NULL,
+	              100,
+	              13,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libbfio_file_io_handle_read_buffer_at_offset_aligned(
+	              direct_file_io_handle,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              13,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libbfio_file_io_handle_read_buffer_at_offset_aligned(
+	              direct_file_io_handle,
+	              buffer,
+	              100,
+	              -1,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_file_io_handle_close(
+	          direct_file_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_file_io_handle_free(
+	          &direct_file_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "direct_file_io_handle",
+	 direct_file_io_handle );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( direct_file_io_handle != NULL )
+	{
+		libbfio_file_io_handle_free(
+		 &direct_file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_DIRECT_IO ) */
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_DIRECT_IO )
+
+/* Tests reading unaligned data from a file IO handle opened for direct IO
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_file_io_handle_read_unaligned_direct(
+     void )
+{
+	char narrow_temporary_filename[ 17 ] = {
+		'b', 'f', 'i', 'o', '_', 't', 'e', 's', 't', '_', 'X', 'X', 'X', 'X', 'X', 'X', 0 };
+
+	uint8_t data[ 12388 ];
+	uint8_t read_buffer[ 8193 ];
+
+	libbfio_file_io_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error                 = NULL;
+	size_t data_offset                       = 0;
+	ssize_t read_count                       = 0;
+	ssize_t write_count                      = 0;
+	off64_t offset                           = 0;
+	int result                               = 0;
+	int with_temporary_file                  = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 12388;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( data_offset % 251 );
+	}
+	result = bfio_test_get_temporary_filename(
+	          narrow_temporary_filename,
+	          17,
+	          &error );
+
+	BFIO_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	with_temporary_file = result;
+
+	if( with_temporary_file == 0 )
+	{
+		return( 1 );
+	}
+	result = libbfio_file_io_handle_initialize(
+	          &file_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_file_io_handle_set_name(
+	          file_io_handle,
+	          narrow_temporary_filename,
+	          16,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_file_io_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_WRITE,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	write_count = libbfio_file_io_handle_write_buffer(
+	               file_io_handle,
+	               data,
+	               12388,
+	               &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) 12388 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_file_io_handle_close(
+	          file_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_file_io_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ_DIRECT,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The file system can reject O_DIRECT in which case the file is read buffered
+	 */
+	if( file_io_handle->direct_io != 0 )
+	{
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "file_io_handle->bounce_buffer_pool",
+		 file_io_handle->bounce_buffer_pool );
+	}
+	/* Test a read at an unaligned offset into an unaligned buffer
+	 */
+	read_count = libbfio_file_io_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              &( read_buffer[ 1 ] ),
+	              8192,
+	              4000,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 8192 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          &( read_buffer[ 1 ] ),
+	          &( data[ 4000 ] ),
+	          8192 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test an unaligned read that is truncated at the end of the file
+	 */
+	read_count = libbfio_file_io_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              &( read_buffer[ 1 ] ),
+	              4096,
+	              12300,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 88 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          &( read_buffer[ 1 ] ),
+	          &( data[ 12300 ] ),
+	          88 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test an unaligned sequential read
+	 */
+	offset = libbfio_file_io_handle_seek_offset(
+	          file_io_handle,
+	          13,
+	          SEEK_SET,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 13 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_file_io_handle_read_buffer(
+	              file_io_handle,
+	              &( read_buffer[ 1 ] ),
+	              5000,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 5000 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          &( read_buffer[ 1 ] ),
+	          &( data[ 13 ] ),
+	          5000 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	offset = libbfio_file_io_handle_seek_offset(
+	          file_io_handle,
+	          0,
+	          SEEK_CUR,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 5013 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libbfio_file_io_handle_close(
+	          file_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = bfio_test_remove_temporary_file(
+	          narrow_temporary_filename,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	with_temporary_file = 0;
+
+	result = libbfio_file_io_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_file_io_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( with_temporary_file != 0 )
+	{
+		bfio_test_remove_temporary_file(
+		 narrow_temporary_filename,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_DIRECT_IO ) */
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_EXTENTS )
+
+/* Tests the libbfio_file_io_handle_get_extent function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_file_io_handle_get_extent(
+     void )
+{
+	char narrow_temporary_filename[ 17 ] = {
+		'b', 'f', 'i', 'o', '_', 't', 'e', 's', 't', '_', 'X', 'X', 'X', 'X', 'X', 'X', 0 };
+
+	uint8_t data[ 4096 ];
+	struct stat file_statistics;
+
+	libbfio_file_io_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error                 = NULL;
+	size64_t extent_size                     = 0;
+	ssize_t write_count                      = 0;
+	uint32_t extent_flags                    = 0;
+	int result                               = 0;
+	int with_temporary_file                  = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     data,
+	     'A',
+	     4096 ) == NULL )
+	{
+		return( 0 );
+	}
+	result = bfio_test_get_temporary_filename(
+	          narrow_temporary_filename,
+	          17,
+	          &error );
+
+	BFIO_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	with_temporary_file = result;
+
+	if( with_temporary_file == 0 )
+	{
+		return( 1 );
+	}
+	result = libbfio_file_io_handle_initialize(
+	          &file_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_file_io_handle_set_name(
+	          file_io_handle,
+	          narrow_temporary_filename,
+	          16,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the extents cannot be determined of a file IO handle that is not open
+	 */
+	result = libbfio_file_io_handle_get_extent(
+	          file_io_handle,
+	          0,
+	          4096,
+	          &extent_size,
+	          &extent_flags,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_file_io_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ_WRITE,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Create a sparse file of 4 MiB of which only the first 4 KiB contains data
+	 */
+	write_count = libbfio_file_io_handle_write_buffer(
+	               file_io_handle,
+	               data,
+	               4096,
+	               &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) 4096 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = ftruncate(
+	          file_io_handle->descriptor,
+	          (off_t) ( 4 * 1024 * 1024 ) );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = fstat(
+	          file_io_handle->descriptor,
+	          &file_statistics );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test regular cases
+	 */
+	result = libbfio_file_io_handle_get_extent(
+	          file_io_handle,
+	          0,
+	          4096,
+	          &extent_size,
+	          &extent_flags,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "extent_size",
+	 (uint64_t) extent_size,
+	 (uint64_t) 4096 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT32(
+	 "extent_flags",
+	 extent_flags,
+	 (uint32_t) 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the hole is reported if the file system did not allocate it
+	 */
+	if( ( (uint64_t) file_statistics.st_blocks * 512 ) < (uint64_t) ( 4 * 1024 * 1024 ) )
+	{
+		result = libbfio_file_io_handle_get_extent(
+		          file_io_handle,
+		          0,
+		          4 * 1024 * 1024,
+		          &extent_size,
+		          &extent_flags,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_LESS_THAN_UINT64(
+		 "extent_size",
+		 (uint64_t) extent_size,
+		 (uint64_t) ( 4 * 1024 * 1024 ) );
+
+		BFIO_TEST_ASSERT_EQUAL_UINT32(
+		 "extent_flags",
+		 extent_flags,
+		 (uint32_t) 0 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_file_io_handle_get_extent(
+		          file_io_handle,
+		          2 * 1024 * 1024,
+		          2 * 1024 * 1024,
+		          &extent_size,
+		          &extent_flags,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_EQUAL_UINT64(
+		 "extent_size",
+		 (uint64_t) extent_size,
+		 (uint64_t) ( 2 * 1024 * 1024 ) );
+
+		BFIO_TEST_ASSERT_EQUAL_UINT32(
+		 "extent_flags",
+		 extent_flags,
+		 (uint32_t) LIBBFIO_EXTENT_FLAG_IS_SPARSE );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libbfio_file_io_handle_get_extent(
+	          NULL,
+	          0,
+	          4096,
+	          &extent_size,
+	          &extent_flags,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_file_io_handle_get_extent(
+	          file_io_handle,
+	          -1,
+	          4096,
+	          &extent_size,
+	          &extent_flags,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_file_io_handle_get_extent(
+	          file_io_handle,
+	          0,
+	          4096,
+	          NULL,
+	          &extent_flags,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_file_io_handle_get_extent(
+	          file_io_handle,
+	          0,
+	          4096,
+	          &extent_size,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_file_io_handle_close(
+	          file_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = bfio_test_remove_temporary_file(
+	          narrow_temporary_filename,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	with_temporary_file = 0;
+
+	result = libbfio_file_io_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_file_io_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( with_temporary_file != 0 )
+	{
+		bfio_test_remove_temporary_file(
+		 narrow_temporary_filename,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_EXTENTS ) */
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_VECTOR_READ )
+
+/* Tests the libbfio_file_io_handle_read_vector_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_file_io_handle_read_vector_at_offset(
+     libbfio_file_io_handle_t *file_io_handle )
+{
+	uint8_t *buffers[ 128 ];
+	uint8_t buffer[ 128 ];
+	uint8_t expected_buffer[ 128 ];
+	size_t buffer_sizes[ 128 ];
+
+	libbfio_file_io_handle_t *closed_file_io_handle = NULL;
+	libcerror_error_t *error                        = NULL;
+	size64_t file_size                              = 0;
+	ssize_t read_count                              = 0;
+	off64_t offset                                  = 0;
+	int buffer_index                                = 0;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_file_io_handle_get_size(
+	          file_io_handle,
+	          &file_size,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( file_size < 128 )
+	{
+		return( 1 );
+	}
+	offset = libbfio_file_io_handle_seek_offset(
+	          file_io_handle,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_file_io_handle_read_buffer(
+	              file_io_handle,
+	              expected_buffer,
+	              128,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 128 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	buffers[ 0 ]      = &( buffer[ 0 ] );
+	buffer_sizes[ 0 ] = 8;
+	buffers[ 1 ]      = &( buffer[ 8 ] );
+	buffer_sizes[ 1 ] = 0;
+	buffers[ 2 ]      = &( buffer[ 8 ] );
+	buffer_sizes[ 2 ] = 24;
+
+	read_count = libbfio_file_io_handle_read_vector_at_offset(
+	              file_io_handle,
+	              buffers,
+	              buffer_sizes,
+	              3,
+	              16,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 32 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( expected_buffer[ 16 ] ),
+	          32 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that the current offset was not changed
+	 */
+	offset = libbfio_file_io_handle_seek_offset(
+	          file_io_handle,
+	          0,
+	          SEEK_CUR,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 128 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read vector at offset with more buffers than are passed to a single preadv call
+	 */
+	for( buffer_index = 0;
+	     buffer_index < 128;
+	     buffer_index++ )
+	{
+		buffers[ buffer_index ]      = &( buffer[ buffer_index ] );
+		buffer_sizes[ buffer_index ] = 1;
+	}
+	read_count = libbfio_file_io_handle_read_vector_at_offset(
+	              file_io_handle,
+	              buffers,
+	              buffer_sizes,
+	              128,
+	              0,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 128 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          expected_buffer,
+	          128 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test read vector at offset that ends beyond the end of the file
+	 */
+	buffers[ 0 ]      = &( buffer[ 0 ] );
+	buffer_sizes[ 0 ] = 16;
+	buffers[ 1 ]      = &( buffer[ 16 ] );
+	buffer_sizes[ 1 ] = 16;
+
+	read_count = libbfio_file_io_handle_read_vector_at_offset(
+	              file_io_handle,
+	              buffers,
+	              buffer_sizes,
+	              2,
+	              (off64_t) file_size - 8,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 8 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libbfio_file_io_handle_read_vector_at_offset(
+	              NULL,
+	              buffers,
+	              buffer_sizes,
+	              2,
+	              0,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libbfio_file_io_handle_read_vector_at_offset(
+	              file_io_handle,
+	              NULL,
+	              buffer_sizes,
+	              2,
+	              0,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libbfio_file_io_handle_read_vector_at_offset(
+	              file_io_handle,
+	              buffers,
+	              NULL,
+	              2,
+	              0,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libbfio_file_io_handle_read_vector_at_offset(
+	              file_io_handle,
+	              buffers,
+	              buffer_sizes,
+	              -1,
+	              0,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libbfio_file_io_handle_read_vector_at_offset(
+	              file_io_handle,
+	              buffers,
+	              buffer_sizes,
+	              2,
+	              -1,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	buffers[ 1 ] = NULL;
+
+	read_count = libbfio_file_io_handle_read_vector_at_offset(
+	              file_io_handle,
+	              buffers,
+	              buffer_sizes,
+	              2,
+	              0,
+	              &error );
+
+	buffers[ 1 ] = &( buffer[ 16 ] );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	buffer_sizes[ 1 ] = (size_t) SSIZE_MAX;
+
+	read_count = libbfio_file_io_handle_read_vector_at_offset(
+	              file_io_handle,
+	              buffers,
+	              buffer_sizes,
+	              2,
+	              0,
+	              &error );
+
+	buffer_sizes[ 1 ] = 16;
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Initialize test
+	 */
+	result = libbfio_file_io_handle_initialize(
+	          &closed_file_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "closed_file_io_handle",
+	 closed_file_io_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read vector at offset on a closed file IO handle
+	 */
+	read_count = libbfio_file_io_handle_read_vector_at_offset(
+	              closed_file_io_handle,
+	              buffers,
+	              buffer_sizes,
+	              2,
+	              0,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_file_io_handle_free(
+	          &closed_file_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "closed_file_io_handle",
+	 closed_file_io_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( closed_file_io_handle != NULL )
+	{
+		libbfio_file_io_handle_free(
+		 &closed_file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_VECTOR_READ ) */
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_ACCESS_HINT )
+
+/* Tests the libbfio_file_io_handle_set_access_hint function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_file_io_handle_set_access_hint(
+     libbfio_file_io_handle_t *file_io_handle )
+{
+	libbfio_file_io_handle_t *closed_file_io_handle = NULL;
+	libcerror_error_t *error                        = NULL;
+	int result                                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libbfio_file_io_handle_set_access_hint(
+	          file_io_handle,
+	          0,
+	          0,
+	          LIBBFIO_ACCESS_HINT_SEQUENTIAL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_file_io_handle_set_access_hint(
+	          file_io_handle,
+	          512,
+	          4096,
+	          LIBBFIO_ACCESS_HINT_WILLNEED,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_file_io_handle_set_access_hint(
+	          file_io_handle,
+	          0,
+	          0,
+	          LIBBFIO_ACCESS_HINT_NORMAL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_file_io_handle_set_access_hint(
+	          NULL,
+	          0,
+	          0,
+	          LIBBFIO_ACCESS_HINT_SEQUENTIAL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_file_io_handle_set_access_hint(
+	          file_io_handle,
+	          -1,
+	          0,
+	          LIBBFIO_ACCESS_HINT_SEQUENTIAL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_file_io_handle_set_access_hint(
+	          file_io_handle,
+	          0,
+	          (size64_t) INT64_MAX + 1,
+	          LIBBFIO_ACCESS_HINT_SEQUENTIAL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_file_io_handle_set_access_hint(
+	          file_io_handle,
+	          0,
+	          0,
+	          -1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Initialize test
+	 */
+	result = libbfio_file_io_handle_initialize(
+	          &closed_file_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "closed_file_io_handle",
+	 closed_file_io_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test set access hint on a closed file IO handle
+	 */
+	result = libbfio_file_io_handle_set_access_hint(
+	          closed_file_io_handle,
+	          0,
+	          0,
+	          LIBBFIO_ACCESS_HINT_SEQUENTIAL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_file_io_handle_free(
+	          &closed_file_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "closed_file_io_handle",
+	 closed_file_io_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( closed_file_io_handle != NULL )
+	{
+		libbfio_file_io_handle_free(
+		 &closed_file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_ACCESS_HINT ) */
+
+/* Tests the libbfio_file_io_handle_write_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_file_io_handle_write_buffer(
+     void )
+{
+	char narrow_temporary_filename[ 17 ] = {
+		'b', 'f', 'i', 'o', '_', 't', 'e', 's', 't', '_', 'X', 'X', 'X', 'X', 'X', 'X', 0 };
+
+	uint8_t buffer[ 32 ] = {
+		'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+		'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', '0', '1', '2', '3', '4', '5' };
+
+	libbfio_file_io_handle_t *closed_file_io_handle = NULL;
+	libbfio_file_io_handle_t *file_io_handle        = NULL;
+	libcerror_error_t *error                        = NULL;
+	ssize_t write_count                             = 0;
+	int result                                      = 0;
+	int with_temporary_file                         = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_file_io_handle_initialize(
+	          &file_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = bfio_test_get_temporary_filename(
+	          narrow_temporary_filename,
+	          17,
+	          &error );
+
+	BFIO_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	with_temporary_file = result;
+
+	if( with_temporary_file != 0 )
+	{
+		result = libbfio_file_io_handle_set_name(
+		          file_io_handle,
+		          narrow_temporary_filename,
+		          16,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_file_io_handle_open(
+		          file_io_handle,
+		          LIBBFIO_OPEN_WRITE,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases
+		 */
+		write_count = libbfio_file_io_handle_write_buffer(
+		               file_io_handle,
+		               buffer,
+		               32,
+		               &error );
+
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) 32 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	write_count = libbfio_file_io_handle_write_buffer(
+	               NULL,
+	               buffer,
+	               0,
+	               &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	write_count = libbfio_file_io_handle_write_buffer(
+	               file_io_handle,
+	               NULL,
+	               0,
+	               &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	write_count = libbfio_file_io_handle_write_buffer(
+	               file_io_handle,
+	               buffer,
+	               (size_t) SSIZE_MAX + 1,
+	               &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Initialize test
+	 */
+	result = libbfio_file_io_handle_initialize(
+	          &closed_file_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "closed_file_io_handle",
+	 closed_file_io_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test write buffer with error code on a closed file IO handle
+	 */
+	write_count = libbfio_file_io_handle_write_buffer(
+	               closed_file_io_handle,
+	               buffer,
+	               0,
+	               &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_file_io_handle_free(
+	          &closed_file_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "closed_file_io_handle",
+	 closed_file_io_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( with_temporary_file != 0 )
+	{
+		result = libbfio_file_io_handle_close(
+		          file_io_handle,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = bfio_test_remove_temporary_file(
+		          narrow_temporary_filename,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		with_temporary_file = 0;
+	}
+	result = libbfio_file_io_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( closed_file_io_handle != NULL )
+	{
+		libbfio_file_io_handle_free(
+		 &closed_file_io_handle,
+		 NULL );
+	}
+	if( with_temporary_file != 0 )
+	{
+		bfio_test_remove_temporary_file(
+		 narrow_temporary_filename,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_file_io_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_WRITE )
+
+/* Tests the libbfio_file_io_handle_write_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_file_io_handle_write_buffer_at_offset(
+     void )
+{
+	char narrow_temporary_filename[ 17 ] = {
+		'b', 'f', 'i', 'o', '_', 't', 'e', 's', 't', '_', 'X', 'X', 'X', 'X', 'X', 'X', 0 };
+
+	uint8_t buffer[ 32 ] = {
+		'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+		'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', '0', '1', '2', '3', '4', '5' };
+
+	libbfio_file_io_handle_t *closed_file_io_handle = NULL;
+	libbfio_file_io_handle_t *file_io_handle        = NULL;
+	libcerror_error_t *error                        = NULL;
+	size64_t size                                   = 0;
+	ssize_t write_count                             = 0;
+	int result                                      = 0;
+	int with_temporary_file                         = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_file_io_handle_initialize(
+	          &file_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = bfio_test_get_temporary_filename(
+	          narrow_temporary_filename,
+	          17,
+	          &error );
+
+	BFIO_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	with_temporary_file = result;
+
+	if( with_temporary_file != 0 )
+	{
+		result = libbfio_file_io_handle_set_name(
+		          file_io_handle,
+		          narrow_temporary_filename,
+		          16,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_file_io_handle_open(
+		          file_io_handle,
+		          LIBBFIO_OPEN_WRITE,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases
+		 */
+		write_count = libbfio_file_io_handle_write_buffer_at_offset(
+		               file_io_handle,
+		               buffer,
+		               32,
+		               64,
+		               &error );
+
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) 32 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_file_io_handle_get_size(
+		          file_io_handle,
+		          &size,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_EQUAL_UINT64(
+		 "size",
+		 size,
+		 (uint64_t) 96 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	write_count = libbfio_file_io_handle_write_buffer_at_offset(
+	               NULL,
+	               buffer,
+	               0,
+	               0,
+	               &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	write_count = libbfio_file_io_handle_write_buffer_at_offset(
+	               file_io_handle,
+	               NULL,
+	               0,
+	               0,
+	               &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	write_count = libbfio_file_io_handle_write_buffer_at_offset(
+	               file_io_handle,
+	               buffer,
+	               (size_t) SSIZE_MAX + 1,
+	               0,
+	               &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	write_count = libbfio_file_io_handle_write_buffer_at_offset(
+	               file_io_handle,
+	               buffer,
+	               32,
+	               -1,
+	               &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Initialize test
+	 */
+	result = libbfio_file_io_handle_initialize(
+	          &closed_file_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "closed_file_io_handle",
+	 closed_file_io_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test write buffer with error code on a closed file IO handle
+	 */
+	write_count = libbfio_file_io_handle_write_buffer_at_offset(
+	               closed_file_io_handle,
+	               buffer,
+	               0,
+	               0,
+	               &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_file_io_handle_free(
+	          &closed_file_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "closed_file_io_handle",
+	 closed_file_io_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( with_temporary_file != 0 )
+	{
+		result = libbfio_file_io_handle_close(
+		          file_io_handle,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = bfio_test_remove_temporary_file(
+		          narrow_temporary_filename,
 		          &error );
 
 		BFIO_TEST_ASSERT_EQUAL_INT(
@@ -2368,6 +5691,8 @@ on_error:
 	return( 0 );
 }
 
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_WRITE ) */
+
 /* Tests the libbfio_file_io_handle_seek_offset function
  * Returns 1 if successful or 0 if not
  */
@@ -3060,6 +6385,46 @@ int main(
 	 "libbfio_file_io_handle_write_buffer",
 	 bfio_test_file_io_handle_write_buffer );
 
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_WRITE )
+
+	BFIO_TEST_RUN(
+	 "libbfio_file_io_handle_write_buffer_at_offset",
+	 bfio_test_file_io_handle_write_buffer_at_offset );
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_WRITE ) */
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+
+	BFIO_TEST_RUN(
+	 "libbfio_file_io_handle_read_block_aligned",
+	 bfio_test_file_io_handle_read_block_aligned );
+
+	BFIO_TEST_RUN(
+	 "libbfio_file_io_handle_get_device_size",
+	 bfio_test_file_io_handle_get_device_size );
+
+	BFIO_TEST_RUN(
+	 "libbfio_file_io_handle_get_device_block_size",
+	 bfio_test_file_io_handle_get_device_block_size );
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ ) */
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_DIRECT_IO )
+
+	BFIO_TEST_RUN(
+	 "libbfio_file_io_handle_read_unaligned_direct",
+	 bfio_test_file_io_handle_read_unaligned_direct );
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_DIRECT_IO ) */
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_EXTENTS )
+
+	BFIO_TEST_RUN(
+	 "libbfio_file_io_handle_get_extent",
+	 bfio_test_file_io_handle_get_extent );
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_EXTENTS ) */
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 	if( source != NULL )
 	{
@@ -3177,6 +6542,42 @@ int main(
 		 bfio_test_file_io_handle_read_buffer,
 		 file_io_handle );
 
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_file_io_handle_read_buffer_at_offset",
+		 bfio_test_file_io_handle_read_buffer_at_offset,
+		 file_io_handle );
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ ) */
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_DIRECT_IO )
+
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_file_io_handle_read_buffer_at_offset_aligned",
+		 bfio_test_file_io_handle_read_buffer_at_offset_aligned,
+		 file_io_handle );
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_DIRECT_IO ) */
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_VECTOR_READ )
+
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_file_io_handle_read_vector_at_offset",
+		 bfio_test_file_io_handle_read_vector_at_offset,
+		 file_io_handle );
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_VECTOR_READ ) */
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_ACCESS_HINT )
+
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_file_io_handle_set_access_hint",
+		 bfio_test_file_io_handle_set_access_hint,
+		 file_io_handle );
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_ACCESS_HINT ) */
+
 		BFIO_TEST_RUN_WITH_ARGS(
 		 "libbfio_file_io_handle_exists",
 		 bfio_test_file_io_handle_exists,
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -39,6 +40,7 @@
 #include "bfio_test_macros.h"
 #include "bfio_test_memory.h"
 
+#include "../libbfio/libbfio_file_io_handle.h"
 #include "../libbfio/libbfio_file_range.h"
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && SIZEOF_WCHAR_T != 2 && SIZEOF_WCHAR_T != 4
@@ -1057,6 +1059,613 @@ on_error:
 	return( 0 );
 }
 
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+
+/* Tests the libbfio_file_range_initialize_with_shared_file function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_file_range_initialize_with_shared_file(
+     const char *source )
+{
+	uint8_t buffer[ 64 ];
+	uint8_t shared_buffer[ 64 ];
+
+	libbfio_handle_t *handle        = NULL;
+	libbfio_handle_t *shared_handle = NULL;
+	libcerror_error_t *error        = NULL;
+	ssize_t read_count              = 0;
+	ssize_t shared_read_count       = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_file_range_initialize(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_file_range_set_name(
+	          handle,
+	          source,
+	          narrow_string_length(
+	           source ),
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbfio_file_range_initialize_with_shared_file(
+	          &shared_handle,
+	          handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "shared_handle",
+	 shared_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          shared_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The file ranges maintain their own current offset
+	 */
+	read_count = libbfio_handle_read_buffer(
+	              handle,
+	              buffer,
+	              64,
+	              &error );
+
+	BFIO_TEST_ASSERT_NOT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	shared_read_count = libbfio_handle_read_buffer(
+	                     shared_handle,
+	                     shared_buffer,
+	                     64,
+	                     &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "shared_read_count",
+	 shared_read_count,
+	 read_count );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          shared_buffer,
+	          (size_t) read_count );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libbfio_handle_close(
+	          handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The shared file remains open for the other file range
+	 */
+	shared_read_count = libbfio_handle_read_buffer_at_offset(
+	                     shared_handle,
+	                     shared_buffer,
+	                     64,
+	                     0,
+	                     &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "shared_read_count",
+	 shared_read_count,
+	 read_count );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_close(
+	          shared_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_file_range_initialize_with_shared_file(
+	          NULL,
+	          handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_file_range_initialize_with_shared_file(
+	          &shared_handle,
+	          handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libbfio_file_range_set_name with a shared file
+	 */
+	result = libbfio_file_range_set_name(
+	          shared_handle,
+	          source,
+	          narrow_string_length(
+	           source ),
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libbfio_handle_open with write access to a shared file
+	 */
+	result = libbfio_handle_open(
+	          shared_handle,
+	          LIBBFIO_OPEN_READ_WRITE,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &shared_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "shared_handle",
+	 shared_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( shared_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &shared_handle,
+		 NULL );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests that the descriptor cache accounts for a shared file once
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_file_range_shared_file_descriptor_cache(
+     const char *source )
+{
+	uint8_t buffer[ 64 ];
+
+	libbfio_handle_t *handles[ 3 ]               = { NULL, NULL, NULL };
+	libbfio_descriptor_cache_t *descriptor_cache = NULL;
+	libcerror_error_t *error                     = NULL;
+	uint64_t number_of_evictions                 = 0;
+	uint64_t number_of_expirations               = 0;
+	ssize_t read_count                           = 0;
+	int handle_index                             = 0;
+	int number_of_open_descriptors               = 0;
+	int peak_number_of_open_descriptors          = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_descriptor_cache_initialize(
+	          &descriptor_cache,
+	          2,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_file_range_initialize(
+	          &( handles[ 0 ] ),
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_file_range_set_name(
+	          handles[ 0 ],
+	          source,
+	          narrow_string_length(
+	           source ),
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( handle_index = 1;
+	     handle_index < 3;
+	     handle_index++ )
+	{
+		result = libbfio_file_range_initialize_with_shared_file(
+		          &( handles[ handle_index ] ),
+		          handles[ 0 ],
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( handle_index = 0;
+	     handle_index < 3;
+	     handle_index++ )
+	{
+		result = libbfio_handle_set_open_on_demand(
+		          handles[ handle_index ],
+		          1,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_handle_set_descriptor_cache(
+		          handles[ handle_index ],
+		          descriptor_cache,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_handle_open(
+		          handles[ handle_index ],
+		          LIBBFIO_OPEN_READ,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test that the file ranges that share a file use one descriptor of the descriptor cache
+	 */
+	for( handle_index = 0;
+	     handle_index < 3;
+	     handle_index++ )
+	{
+		read_count = libbfio_handle_read_buffer(
+		              handles[ handle_index ],
+		              buffer,
+		              64,
+		              &error );
+
+		BFIO_TEST_ASSERT_NOT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libbfio_descriptor_cache_get_statistics(
+	          descriptor_cache,
+	          &number_of_open_descriptors,
+	          &peak_number_of_open_descriptors,
+	          &number_of_evictions,
+	          &number_of_expirations,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "number_of_open_descriptors",
+	 number_of_open_descriptors,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "peak_number_of_open_descriptors",
+	 peak_number_of_open_descriptors,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_evictions",
+	 number_of_evictions,
+	 (uint64_t) 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the shared file is no longer accounted for when the last file range is closed
+	 */
+	for( handle_index = 0;
+	     handle_index < 3;
+	     handle_index++ )
+	{
+		result = libbfio_handle_close(
+		          handles[ handle_index ],
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_descriptor_cache_get_statistics(
+		          descriptor_cache,
+		          &number_of_open_descriptors,
+		          &peak_number_of_open_descriptors,
+		          &number_of_evictions,
+		          &number_of_expirations,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "number_of_open_descriptors",
+		 number_of_open_descriptors,
+		 ( handle_index < 2 ) ? 1 : 0 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	for( handle_index = 2;
+	     handle_index >= 0;
+	     handle_index-- )
+	{
+		result = libbfio_handle_free(
+		          &( handles[ handle_index ] ),
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libbfio_descriptor_cache_free(
+	          &descriptor_cache,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( handle_index = 2;
+	     handle_index >= 0;
+	     handle_index-- )
+	{
+		if( handles[ handle_index ] != NULL )
+		{
+			libbfio_handle_free(
+			 &( handles[ handle_index ] ),
+			 NULL );
+		}
+	}
+	if( descriptor_cache != NULL )
+	{
+		libbfio_descriptor_cache_free(
+		 &descriptor_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ ) */
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -1211,6 +1820,20 @@ int main(
 		 bfio_test_file_range_get,
 		 handle );
 
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_file_range_initialize_with_shared_file",
+		 bfio_test_file_range_initialize_with_shared_file,
+		 narrow_source );
+
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_file_range_shared_file_descriptor_cache",
+		 bfio_test_file_range_shared_file_descriptor_cache,
+		 narrow_source );
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ ) */
+
 		/* Clean up
 		 */
 		result = libbfio_handle_free(
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -1906,10 +1907,669 @@ on_error:
 	return( 0 );
 }
 
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+
+/* Tests the libbfio_file_range_io_handle_read_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_file_range_io_handle_read_buffer_at_offset(
+     libbfio_file_range_io_handle_t *file_range_io_handle )
+{
+	uint8_t buffer[ 32 ];
+	uint8_t expected_buffer[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	size64_t file_size       = 0;
+	size64_t range_size      = 0;
+	ssize_t read_count       = 0;
+	off64_t range_offset     = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_file_range_io_handle_get_size(
+	          file_range_io_handle,
+	          &file_size,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( file_size < 32 )
+	{
+		return( 1 );
+	}
+	result = libbfio_file_range_io_handle_get(
+	          file_range_io_handle,
+	          &range_offset,
+	          &range_size,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_file_io_handle_read_buffer_at_offset(
+	              file_range_io_handle->file_io_handle,
+	              expected_buffer,
+	              32,
+	              0,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 32 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_file_range_io_handle_set(
+	          file_range_io_handle,
+	          8,
+	          16,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_count = libbfio_file_range_io_handle_read_buffer_at_offset(
+	              file_range_io_handle,
+	              buffer,
+	              8,
+	              4,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 8 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( expected_buffer[ 12 ] ),
+	          8 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test read buffer at offset that is truncated at the end of the range
+	 */
+	read_count = libbfio_file_range_io_handle_read_buffer_at_offset(
+	              file_range_io_handle,
+	              buffer,
+	              32,
+	              8,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 8 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( expected_buffer[ 16 ] ),
+	          8 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test read buffer at offset beyond the end of the range
+	 */
+	read_count = libbfio_file_range_io_handle_read_buffer_at_offset(
+	              file_range_io_handle,
+	              buffer,
+	              32,
+	              16,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libbfio_file_range_io_handle_read_buffer_at_offset(
+	              NULL,
+	              buffer,
+	              32,
+	              0,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libbfio_file_range_io_handle_read_buffer_at_offset(
+	              file_range_io_handle,
+	              NULL,
+	              8,
+	              0,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libbfio_file_range_io_handle_read_buffer_at_offset(
+	              file_range_io_handle,
+	              buffer,
+	              32,
+	              -1,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_file_range_io_handle_set(
+	          file_range_io_handle,
+	          range_offset,
+	          range_size,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ ) */
+
 /* Tests the libbfio_file_range_io_handle_write_buffer function
  * Returns 1 if successful or 0 if not
  */
-int bfio_test_file_range_io_handle_write_buffer(
+int bfio_test_file_range_io_handle_write_buffer(
+     void )
+{
+	char narrow_temporary_filename[ 17 ] = {
+		'b', 'f', 'i', 'o', '_', 't', 'e', 's', 't', '_', 'X', 'X', 'X', 'X', 'X', 'X', 0 };
+
+	uint8_t buffer[ 32 ] = {
+		'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+		'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', '0', '1', '2', '3', '4', '5' };
+
+	libbfio_file_range_io_handle_t *closed_file_range_io_handle = NULL;
+	libbfio_file_range_io_handle_t *file_range_io_handle        = NULL;
+	libbfio_handle_t *handle                                    = NULL;
+	libcerror_error_t *error                                    = NULL;
+	ssize_t write_count                                         = 0;
+	int result                                                  = 0;
+	int with_temporary_file                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_file_range_io_handle_initialize(
+	          &file_range_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "file_range_io_handle",
+	 file_range_io_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = bfio_test_get_temporary_filename(
+	          narrow_temporary_filename,
+	          17,
+	          &error );
+
+	BFIO_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	with_temporary_file = result;
+
+	if( with_temporary_file != 0 )
+	{
+		/* Create a file to test with
+		 */
+		result = libbfio_file_initialize(
+		          &handle,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "handle",
+		 handle );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_file_set_name(
+		          handle,
+		          narrow_temporary_filename,
+		          16,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_handle_open(
+		          handle,
+		          LIBBFIO_OPEN_WRITE,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		write_count = libbfio_handle_write_buffer(
+		               handle,
+		               bfio_test_file_range_io_handle_data,
+		               4096,
+		               &error );
+
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) 4096 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_handle_close(
+		          handle,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_handle_free(
+		          &handle,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "handle",
+		 handle );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Open the file range IO handle
+		 */
+		result = libbfio_file_range_io_handle_set_name(
+		          file_range_io_handle,
+		          narrow_temporary_filename,
+		          16,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_file_range_io_handle_set(
+		          file_range_io_handle,
+		          512,
+		          4096 - 512,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_file_range_io_handle_open(
+		          file_range_io_handle,
+		          LIBBFIO_OPEN_WRITE,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases
+		 */
+		write_count = libbfio_file_range_io_handle_write_buffer(
+		               file_range_io_handle,
+		               buffer,
+		               32,
+		               &error );
+
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) 32 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	write_count = libbfio_file_range_io_handle_write_buffer(
+	               NULL,
+	               buffer,
+	               0,
+	               &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	write_count = libbfio_file_range_io_handle_write_buffer(
+	               file_range_io_handle,
+	               NULL,
+	               0,
+	               &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	write_count = libbfio_file_range_io_handle_write_buffer(
+	               file_range_io_handle,
+	               buffer,
+	               (size_t) SSIZE_MAX + 1,
+	               &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Initialize test
+	 */
+	result = libbfio_file_range_io_handle_initialize(
+	          &closed_file_range_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "closed_file_range_io_handle",
+	 closed_file_range_io_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test write buffer with error code on a closed file IO handle
+	 */
+	write_count = libbfio_file_range_io_handle_write_buffer(
+	               closed_file_range_io_handle,
+	               buffer,
+	               0,
+	               &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_file_range_io_handle_free(
+	          &closed_file_range_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "closed_file_range_io_handle",
+	 closed_file_range_io_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( with_temporary_file != 0 )
+	{
+		result = libbfio_file_range_io_handle_close(
+		          file_range_io_handle,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = bfio_test_remove_temporary_file(
+		          narrow_temporary_filename,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		with_temporary_file = 0;
+	}
+	result = libbfio_file_range_io_handle_free(
+	          &file_range_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "file_range_io_handle",
+	 file_range_io_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( closed_file_range_io_handle != NULL )
+	{
+		libbfio_file_range_io_handle_free(
+		 &closed_file_range_io_handle,
+		 NULL );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( with_temporary_file != 0 )
+	{
+		bfio_test_remove_temporary_file(
+		 narrow_temporary_filename,
+		 NULL );
+	}
+	if( file_range_io_handle != NULL )
+	{
+		libbfio_file_range_io_handle_free(
+		 &file_range_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_WRITE )
+
+/* Tests the libbfio_file_range_io_handle_write_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_file_range_io_handle_write_buffer_at_offset(
      void )
 {
 	char narrow_temporary_filename[ 17 ] = {
@@ -2105,10 +2765,11 @@ int bfio_test_file_range_io_handle_write_buffer(
 
 		/* Test regular cases
 		 */
-		write_count = libbfio_file_range_io_handle_write_buffer(
+		write_count = libbfio_file_range_io_handle_write_buffer_at_offset(
 		               file_range_io_handle,
 		               buffer,
 		               32,
+		               16,
 		               &error );
 
 		BFIO_TEST_ASSERT_EQUAL_SSIZE(
@@ -2122,10 +2783,11 @@ int bfio_test_file_range_io_handle_write_buffer(
 	}
 	/* Test error cases
 	 */
-	write_count = libbfio_file_range_io_handle_write_buffer(
+	write_count = libbfio_file_range_io_handle_write_buffer_at_offset(
 	               NULL,
 	               buffer,
 	               0,
+	               0,
 	               &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
@@ -2140,10 +2802,11 @@ int bfio_test_file_range_io_handle_write_buffer(
 	libcerror_error_free(
 	 &error );
 
-	write_count = libbfio_file_range_io_handle_write_buffer(
+	write_count = libbfio_file_range_io_handle_write_buffer_at_offset(
 	               file_range_io_handle,
 	               NULL,
 	               0,
+	               0,
 	               &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
@@ -2158,10 +2821,30 @@ int bfio_test_file_range_io_handle_write_buffer(
 	libcerror_error_free(
 	 &error );
 
-	write_count = libbfio_file_range_io_handle_write_buffer(
+	write_count = libbfio_file_range_io_handle_write_buffer_at_offset(
 	               file_range_io_handle,
 	               buffer,
 	               (size_t) SSIZE_MAX + 1,
+	               0,
+	               &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	write_count = libbfio_file_range_io_handle_write_buffer_at_offset(
+	               file_range_io_handle,
+	               buffer,
+	               32,
+	               -1,
 	               &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
@@ -2197,10 +2880,11 @@ int bfio_test_file_range_io_handle_write_buffer(
 
 	/* Test write buffer with error code on a closed file IO handle
 	 */
-	write_count = libbfio_file_range_io_handle_write_buffer(
+	write_count = libbfio_file_range_io_handle_write_buffer_at_offset(
 	               closed_file_range_io_handle,
 	               buffer,
 	               0,
+	               0,
 	               &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
@@ -2316,6 +3000,210 @@ on_error:
 	return( 0 );
 }
 
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_WRITE ) */
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_ACCESS_HINT )
+
+/* Tests the libbfio_file_range_io_handle_set_access_hint function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_file_range_io_handle_set_access_hint(
+     libbfio_file_range_io_handle_t *file_range_io_handle )
+{
+	libcerror_error_t *error = NULL;
+	size64_t range_size      = 0;
+	off64_t range_offset     = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_file_range_io_handle_get(
+	          file_range_io_handle,
+	          &range_offset,
+	          &range_size,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_file_range_io_handle_set(
+	          file_range_io_handle,
+	          8,
+	          16,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbfio_file_range_io_handle_set_access_hint(
+	          file_range_io_handle,
+	          0,
+	          0,
+	          LIBBFIO_ACCESS_HINT_SEQUENTIAL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_file_range_io_handle_set_access_hint(
+	          file_range_io_handle,
+	          4,
+	          64,
+	          LIBBFIO_ACCESS_HINT_WILLNEED,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test set access hint beyond the end of the range
+	 */
+	result = libbfio_file_range_io_handle_set_access_hint(
+	          file_range_io_handle,
+	          16,
+	          0,
+	          LIBBFIO_ACCESS_HINT_DONTNEED,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_file_range_io_handle_set_access_hint(
+	          file_range_io_handle,
+	          0,
+	          0,
+	          LIBBFIO_ACCESS_HINT_NORMAL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_file_range_io_handle_set_access_hint(
+	          NULL,
+	          0,
+	          0,
+	          LIBBFIO_ACCESS_HINT_SEQUENTIAL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_file_range_io_handle_set_access_hint(
+	          file_range_io_handle,
+	          -1,
+	          0,
+	          LIBBFIO_ACCESS_HINT_SEQUENTIAL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_file_range_io_handle_set_access_hint(
+	          file_range_io_handle,
+	          0,
+	          0,
+	          -1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_file_range_io_handle_set(
+	          file_range_io_handle,
+	          range_offset,
+	          range_size,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_ACCESS_HINT ) */
+
 /* Tests the libbfio_file_range_io_handle_seek_offset function
  * Returns 1 if successful or 0 if not
  */
@@ -2965,6 +3853,14 @@ int main(
 	 "libbfio_file_range_io_handle_write_buffer",
 	 bfio_test_file_range_io_handle_write_buffer );
 
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_WRITE )
+
+	BFIO_TEST_RUN(
+	 "libbfio_file_range_io_handle_write_buffer_at_offset",
+	 bfio_test_file_range_io_handle_write_buffer_at_offset );
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_WRITE ) */
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 	if( source != NULL )
 	{
@@ -3087,6 +3983,24 @@ int main(
 		 bfio_test_file_range_io_handle_read_buffer,
 		 file_range_io_handle );
 
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_file_range_io_handle_read_buffer_at_offset",
+		 bfio_test_file_range_io_handle_read_buffer_at_offset,
+		 file_range_io_handle );
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ ) */
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_ACCESS_HINT )
+
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_file_range_io_handle_set_access_hint",
+		 bfio_test_file_range_io_handle_set_access_hint,
+		 file_range_io_handle );
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_ACCESS_HINT ) */
+
 		BFIO_TEST_RUN_WITH_ARGS(
 		 "libbfio_file_range_io_handle_exists",
 		 bfio_test_file_range_io_handle_exists,
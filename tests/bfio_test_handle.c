@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -40,7 +41,10 @@
 #include "bfio_test_memory.h"
 #include "bfio_test_rwlock.h"
 
+#include "../libbfio/libbfio_definitions.h"
+#include "../libbfio/libbfio_file_io_handle.h"
 #include "../libbfio/libbfio_handle.h"
+#include "../libbfio/libbfio_memory_range_io_handle.h"
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && SIZEOF_WCHAR_T != 2 && SIZEOF_WCHAR_T != 4
 #error Unsupported size of wchar_t
@@ -1889,19 +1893,18 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) */
-
-/* Tests the libbfio_handle_read_buffer function
+/* Tests the libbfio_internal_handle_read_buffer_with_readahead function
  * Returns 1 if successful or 0 if not
  */
-int bfio_test_handle_read_buffer(
+int bfio_test_internal_handle_read_buffer_with_readahead(
      libbfio_handle_t *handle )
 {
-	uint8_t buffer[ 32 ];
+	uint8_t buffer[ 4096 ];
 
 	libcerror_error_t *error = NULL;
-	intptr_t *io_handle      = NULL;
+	uint8_t *data            = NULL;
 	size64_t file_size       = 0;
+	size_t data_offset       = 0;
 	ssize_t read_count       = 0;
 	off64_t offset           = 0;
 	int result               = 0;
@@ -1922,10 +1925,17 @@ int bfio_test_handle_read_buffer(
 	 "error",
 	 error );
 
-	if( file_size < 32 )
+	if( file_size < ( 4 * LIBBFIO_HANDLE_INITIAL_READAHEAD_SIZE ) )
 	{
 		return( 1 );
 	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * ( 4 * LIBBFIO_HANDLE_INITIAL_READAHEAD_SIZE ) );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
 	offset = libbfio_handle_seek_offset(
 	          handle,
 	          0,
@@ -1941,54 +1951,197 @@ int bfio_test_handle_read_buffer(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
 	read_count = libbfio_handle_read_buffer(
 	              handle,
-	              buffer,
-	              32,
+	              data,
+	              4 * LIBBFIO_HANDLE_INITIAL_READAHEAD_SIZE,
 	              &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
 	 "read_count",
 	 read_count,
-	 (ssize_t) 32 );
+	 (ssize_t) ( 4 * LIBBFIO_HANDLE_INITIAL_READAHEAD_SIZE ) );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	result = libbfio_handle_set_maximum_readahead_size(
+	          handle,
+	          2 * LIBBFIO_HANDLE_INITIAL_READAHEAD_SIZE,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libbfio_handle_seek_offset(
+	          handle,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( data_offset = 0;
+	     data_offset < ( 4 * LIBBFIO_HANDLE_INITIAL_READAHEAD_SIZE );
+	     data_offset += 4096 )
+	{
+		read_count = libbfio_handle_read_buffer(
+		              handle,
+		              buffer,
+		              4096,
+		              &error );
+
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 4096 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          buffer,
+		          &( data[ data_offset ] ),
+		          4096 );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* The first read is not detected as sequential
+		 */
+		if( data_offset > 0 )
+		{
+			BFIO_TEST_ASSERT_NOT_EQUAL_SSIZE(
+			 "readahead_size",
+			 (ssize_t) ( (libbfio_internal_handle_t *) handle )->readahead_size,
+			 (ssize_t) 0 );
+		}
+	}
+	BFIO_TEST_ASSERT_EQUAL_SIZE(
+	 "readahead_size",
+	 ( (libbfio_internal_handle_t *) handle )->readahead_size,
+	 (size_t) ( 2 * LIBBFIO_HANDLE_INITIAL_READAHEAD_SIZE ) );
+
+	BFIO_TEST_ASSERT_NOT_EQUAL_SSIZE(
+	 "readahead_data_size",
+	 (ssize_t) ( (libbfio_internal_handle_t *) handle )->readahead_data_size,
+	 (ssize_t) 0 );
+
+	/* Test seeking backwards within the data in the readahead buffer
 	 */
+	offset = libbfio_handle_seek_offset(
+	          handle,
+	          -4096,
+	          SEEK_CUR,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) ( ( 4 * LIBBFIO_HANDLE_INITIAL_READAHEAD_SIZE ) - 4096 ) );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	read_count = libbfio_handle_read_buffer(
-	              NULL,
+	              handle,
 	              buffer,
-	              32,
+	              4096,
 	              &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
 	 "read_count",
 	 read_count,
-	 (ssize_t) -1 );
+	 (ssize_t) 4096 );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = memory_compare(
+	          buffer,
+	          &( data[ ( 4 * LIBBFIO_HANDLE_INITIAL_READAHEAD_SIZE ) - 4096 ] ),
+	          4096 );
 
-	io_handle = ( (libbfio_internal_handle_t *) handle )->io_handle;
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-	( (libbfio_internal_handle_t *) handle )->io_handle = NULL;
+	/* A read that is not sequential resets the readahead size
+	 */
+	BFIO_TEST_ASSERT_EQUAL_SIZE(
+	 "readahead_size",
+	 ( (libbfio_internal_handle_t *) handle )->readahead_size,
+	 (size_t) 0 );
+
+	offset = libbfio_handle_seek_offset(
+	          handle,
+	          LIBBFIO_HANDLE_INITIAL_READAHEAD_SIZE,
+	          SEEK_SET,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) LIBBFIO_HANDLE_INITIAL_READAHEAD_SIZE );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	read_count = libbfio_handle_read_buffer(
 	              handle,
 	              buffer,
-	              32,
+	              4096,
 	              &error );
 
-	( (libbfio_internal_handle_t *) handle )->io_handle = io_handle;
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4096 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( data[ LIBBFIO_HANDLE_INITIAL_READAHEAD_SIZE ] ),
+	          4096 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	read_count = libbfio_internal_handle_read_buffer_with_readahead(
+	              NULL,
+	              buffer,
+	              4096,
+	              &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
 	 "read_count",
@@ -2002,10 +2155,10 @@ int bfio_test_handle_read_buffer(
 	libcerror_error_free(
 	 &error );
 
-	read_count = libbfio_handle_read_buffer(
-	              handle,
+	read_count = libbfio_internal_handle_read_buffer_with_readahead(
+	              (libbfio_internal_handle_t *) handle,
 	              NULL,
-	              32,
+	              4096,
 	              &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
@@ -2020,8 +2173,8 @@ int bfio_test_handle_read_buffer(
 	libcerror_error_free(
 	 &error );
 
-	read_count = libbfio_handle_read_buffer(
-	              handle,
+	read_count = libbfio_internal_handle_read_buffer_with_readahead(
+	              (libbfio_internal_handle_t *) handle,
 	              buffer,
 	              (size_t) SSIZE_MAX + 1,
 	              &error );
@@ -2038,65 +2191,24 @@ int bfio_test_handle_read_buffer(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_BFIO_TEST_RWLOCK )
-
-	/* Test libbfio_handle_read_buffer with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
-	 */
-	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
-
-	read_count = libbfio_handle_read_buffer(
-	              handle,
-	              buffer,
-	              32,
-	              &error );
-
-	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
-	{
-		bfio_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		BFIO_TEST_ASSERT_EQUAL_SSIZE(
-		 "read_count",
-		 read_count,
-		 (ssize_t) -1 );
-
-		BFIO_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libbfio_handle_read_buffer with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	/* Clean up
 	 */
-	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
-
-	read_count = libbfio_handle_read_buffer(
-	              handle,
-	              buffer,
-	              32,
-	              &error );
+	result = libbfio_handle_set_maximum_readahead_size(
+	          handle,
+	          0,
+	          &error );
 
-	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
-	{
-		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		BFIO_TEST_ASSERT_EQUAL_SSIZE(
-		 "read_count",
-		 read_count,
-		 (ssize_t) -1 );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		BFIO_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
+	memory_free(
+	 data );
 
 	return( 1 );
 
@@ -2106,25 +2218,41 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	libbfio_handle_set_maximum_readahead_size(
+	 handle,
+	 0,
+	 NULL );
+
 	return( 0 );
 }
 
-/* Tests the libbfio_handle_read_buffer_at_offset function
+/* Tests the libbfio_internal_handle_read_buffer_with_readahead function with prefetch enabled
  * Returns 1 if successful or 0 if not
  */
-int bfio_test_handle_read_buffer_at_offset(
+int bfio_test_internal_handle_read_buffer_with_prefetch(
      libbfio_handle_t *handle )
 {
-	uint8_t buffer[ 32 ];
+	uint8_t buffer[ 4096 ];
 
 	libcerror_error_t *error = NULL;
-	intptr_t *io_handle      = NULL;
+	uint8_t *data            = NULL;
 	size64_t file_size       = 0;
+	size_t data_offset       = 0;
 	ssize_t read_count       = 0;
+	off64_t offset           = 0;
 	int result               = 0;
 
 	/* Initialize test
 	 */
+	if( ( (libbfio_internal_handle_t *) handle )->read_at_offset == NULL )
+	{
+		return( 1 );
+	}
 	result = libbfio_handle_get_size(
 	          handle,
 	          &file_size,
@@ -2139,61 +2267,312 @@ int bfio_test_handle_read_buffer_at_offset(
 	 "error",
 	 error );
 
-	if( file_size < 32 )
+	if( file_size < ( 4 * LIBBFIO_HANDLE_INITIAL_READAHEAD_SIZE ) )
 	{
 		return( 1 );
 	}
-	/* Test regular cases
-	 */
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              handle,
-	              buffer,
-	              32,
-	              0,
-	              &error );
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * ( 4 * LIBBFIO_HANDLE_INITIAL_READAHEAD_SIZE ) );
 
-	BFIO_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) 32 );
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	offset = libbfio_handle_seek_offset(
+	          handle,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              NULL,
-	              buffer,
-	              32,
-	              0,
+	read_count = libbfio_handle_read_buffer(
+	              handle,
+	              data,
+	              4 * LIBBFIO_HANDLE_INITIAL_READAHEAD_SIZE,
 	              &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
 	 "read_count",
 	 read_count,
-	 (ssize_t) -1 );
+	 (ssize_t) ( 4 * LIBBFIO_HANDLE_INITIAL_READAHEAD_SIZE ) );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	io_handle = ( (libbfio_internal_handle_t *) handle )->io_handle;
+	result = libbfio_handle_set_maximum_readahead_size(
+	          handle,
+	          LIBBFIO_HANDLE_INITIAL_READAHEAD_SIZE,
+	          &error );
 
-	( (libbfio_internal_handle_t *) handle )->io_handle = NULL;
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	read_count = libbfio_handle_read_buffer_at_offset(
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_set_prefetch(
+	          handle,
+	          1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libbfio_handle_seek_offset(
+	          handle,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( data_offset = 0;
+	     data_offset < ( 4 * LIBBFIO_HANDLE_INITIAL_READAHEAD_SIZE );
+	     data_offset += 4096 )
+	{
+		read_count = libbfio_handle_read_buffer(
+		              handle,
+		              buffer,
+		              4096,
+		              &error );
+
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 4096 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          buffer,
+		          &( data[ data_offset ] ),
+		          4096 );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* The data following the readahead buffer is prefetched once the readahead buffer was filled
+		 */
+		if( data_offset > 0 )
+		{
+			BFIO_TEST_ASSERT_EQUAL_UINT8(
+			 "prefetcher->is_submitted",
+			 ( (libbfio_internal_handle_t *) handle )->prefetcher->is_submitted,
+			 (uint8_t) 1 );
+		}
+	}
+	/* Test reading after seeking outside the data in the readahead buffer
+	 */
+	offset = libbfio_handle_seek_offset(
+	          handle,
+	          LIBBFIO_HANDLE_INITIAL_READAHEAD_SIZE,
+	          SEEK_SET,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) LIBBFIO_HANDLE_INITIAL_READAHEAD_SIZE );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( data_offset = LIBBFIO_HANDLE_INITIAL_READAHEAD_SIZE;
+	     data_offset < ( 4 * LIBBFIO_HANDLE_INITIAL_READAHEAD_SIZE );
+	     data_offset += 4096 )
+	{
+		read_count = libbfio_handle_read_buffer(
+		              handle,
+		              buffer,
+		              4096,
+		              &error );
+
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 4096 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          buffer,
+		          &( data[ data_offset ] ),
+		          4096 );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Clean up
+	 */
+	result = libbfio_handle_set_prefetch(
+	          handle,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_set_maximum_readahead_size(
+	          handle,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	libbfio_handle_set_prefetch(
+	 handle,
+	 0,
+	 NULL );
+
+	libbfio_handle_set_maximum_readahead_size(
+	 handle,
+	 0,
+	 NULL );
+
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) */
+
+/* Tests the libbfio_handle_read_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_read_buffer(
+     libbfio_handle_t *handle )
+{
+	uint8_t buffer[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	intptr_t *io_handle      = NULL;
+	size64_t file_size       = 0;
+	ssize_t read_count       = 0;
+	off64_t offset           = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_handle_get_size(
+	          handle,
+	          &file_size,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( file_size < 32 )
+	{
+		return( 1 );
+	}
+	offset = libbfio_handle_seek_offset(
+	          handle,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_count = libbfio_handle_read_buffer(
 	              handle,
 	              buffer,
 	              32,
-	              0,
 	              &error );
 
-	( (libbfio_internal_handle_t *) handle )->io_handle = io_handle;
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 32 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libbfio_handle_read_buffer(
+	              NULL,
+	              buffer,
+	              32,
+	              &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
 	 "read_count",
@@ -2207,13 +2586,18 @@ int bfio_test_handle_read_buffer_at_offset(
 	libcerror_error_free(
 	 &error );
 
-	read_count = libbfio_handle_read_buffer_at_offset(
+	io_handle = ( (libbfio_internal_handle_t *) handle )->io_handle;
+
+	( (libbfio_internal_handle_t *) handle )->io_handle = NULL;
+
+	read_count = libbfio_handle_read_buffer(
 	              handle,
-	              NULL,
+	              buffer,
 	              32,
-	              0,
 	              &error );
 
+	( (libbfio_internal_handle_t *) handle )->io_handle = io_handle;
+
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
 	 "read_count",
 	 read_count,
@@ -2226,11 +2610,10 @@ int bfio_test_handle_read_buffer_at_offset(
 	libcerror_error_free(
 	 &error );
 
-	read_count = libbfio_handle_read_buffer_at_offset(
+	read_count = libbfio_handle_read_buffer(
 	              handle,
-	              buffer,
-	              (size_t) SSIZE_MAX + 1,
-	              0,
+	              NULL,
+	              32,
 	              &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
@@ -2245,11 +2628,10 @@ int bfio_test_handle_read_buffer_at_offset(
 	libcerror_error_free(
 	 &error );
 
-	read_count = libbfio_handle_read_buffer_at_offset(
+	read_count = libbfio_handle_read_buffer(
 	              handle,
 	              buffer,
-	              32,
-	              -1,
+	              (size_t) SSIZE_MAX + 1,
 	              &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
@@ -2266,15 +2648,14 @@ int bfio_test_handle_read_buffer_at_offset(
 
 #if defined( HAVE_BFIO_TEST_RWLOCK )
 
-	/* Test libbfio_handle_read_buffer_at_offset with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	/* Test libbfio_handle_read_buffer with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
 	 */
 	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
 
-	read_count = libbfio_handle_read_buffer_at_offset(
+	read_count = libbfio_handle_read_buffer(
 	              handle,
 	              buffer,
 	              32,
-	              0,
 	              &error );
 
 	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
@@ -2295,15 +2676,14 @@ int bfio_test_handle_read_buffer_at_offset(
 		libcerror_error_free(
 		 &error );
 	}
-	/* Test libbfio_handle_read_buffer_at_offset with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	/* Test libbfio_handle_read_buffer with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
 	 */
 	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
 
-	read_count = libbfio_handle_read_buffer_at_offset(
+	read_count = libbfio_handle_read_buffer(
 	              handle,
 	              buffer,
 	              32,
-	              0,
 	              &error );
 
 	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
@@ -2337,32 +2717,28 @@ on_error:
 	return( 0 );
 }
 
-#if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT )
-
-/* Tests the libbfio_internal_handle_write_buffer function
+/* Tests the libbfio_handle_read_buffer_at_offset function
  * Returns 1 if successful or 0 if not
  */
-int bfio_test_internal_handle_write_buffer(
-     void )
+int bfio_test_handle_read_buffer_at_offset(
+     libbfio_handle_t *handle )
 {
-	char narrow_temporary_filename[ 17 ] = {
-		'b', 'f', 'i', 'o', '_', 't', 'e', 's', 't', '_', 'X', 'X', 'X', 'X', 'X', 'X', 0 };
-
-	uint8_t buffer[ 32 ] = {
-		'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
-		'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', '0', '1', '2', '3', '4', '5' };
+	uint8_t buffer[ 32 ];
+	uint8_t expected_buffer[ 16 ];
 
-	libbfio_handle_t *handle = NULL;
 	libcerror_error_t *error = NULL;
-	intptr_t *write_function = NULL;
-	ssize_t write_count      = 0;
+	intptr_t *io_handle      = NULL;
+	size64_t file_size       = 0;
+	off64_t expected_offset  = 0;
+	off64_t offset           = 0;
+	ssize_t read_count       = 0;
 	int result               = 0;
-	int with_temporary_file  = 0;
 
 	/* Initialize test
 	 */
-	result = libbfio_file_initialize(
-	          &handle,
+	result = libbfio_handle_get_size(
+	          handle,
+	          &file_size,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -2370,89 +2746,151 @@ int bfio_test_internal_handle_write_buffer(
 	 result,
 	 1 );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
-	 "handle",
-	 handle );
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( file_size < 32 )
+	{
+		return( 1 );
+	}
+	/* Test regular cases
+	 */
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              32,
+	              0,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 32 );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = bfio_test_get_temporary_filename(
-	          narrow_temporary_filename,
-	          17,
+	/* Test read at offset without tracking the offsets read
+	 * which does not change the current offset
+	 */
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              expected_buffer,
+	              16,
+	              16,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	expected_offset = libbfio_handle_seek_offset(
+	                   handle,
+	                   8,
+	                   SEEK_SET,
+	                   &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "expected_offset",
+	 (int64_t) expected_offset,
+	 (int64_t) 8 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_set_track_offsets_read(
+	          handle,
+	          0,
 	          &error );
 
-	BFIO_TEST_ASSERT_NOT_EQUAL_INT(
+	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	with_temporary_file = result;
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              16,
+	              16,
+	              &error );
 
-	if( with_temporary_file != 0 )
-	{
-		result = libbfio_file_set_name(
-		          handle,
-		          narrow_temporary_filename,
-		          16,
-		          &error );
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
 
-		BFIO_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		BFIO_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	result = memory_compare(
+	          buffer,
+	          expected_buffer,
+	          16 );
 
-		result = libbfio_handle_open(
-		          handle,
-		          LIBBFIO_OPEN_WRITE,
-		          &error );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-		BFIO_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	result = libbfio_handle_get_offset(
+	          handle,
+	          &offset,
+	          &error );
 
-		BFIO_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		/* Test regular cases
-		 */
-		write_count = libbfio_internal_handle_write_buffer(
-		               (libbfio_internal_handle_t *) handle,
-		               buffer,
-		               32,
-		               &error );
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) expected_offset );
 
-		BFIO_TEST_ASSERT_EQUAL_SSIZE(
-		 "write_count",
-		 write_count,
-		 (ssize_t) 32 );
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_set_track_offsets_read(
+	          handle,
+	          1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		BFIO_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
 	/* Test error cases
 	 */
-	write_count = libbfio_internal_handle_write_buffer(
-	               NULL,
-	               buffer,
-	               32,
-	               &error );
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              NULL,
+	              buffer,
+	              32,
+	              0,
+	              &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
-	 "write_count",
-	 write_count,
+	 "read_count",
+	 read_count,
 	 (ssize_t) -1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
@@ -2462,21 +2900,22 @@ int bfio_test_internal_handle_write_buffer(
 	libcerror_error_free(
 	 &error );
 
-	write_function = (intptr_t *) ( (libbfio_internal_handle_t *) handle )->write;
+	io_handle = ( (libbfio_internal_handle_t *) handle )->io_handle;
 
-	( (libbfio_internal_handle_t *) handle )->write = NULL;
+	( (libbfio_internal_handle_t *) handle )->io_handle = NULL;
 
-	write_count = libbfio_internal_handle_write_buffer(
-	               (libbfio_internal_handle_t *) handle,
-	               buffer,
-	               32,
-	               &error );
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              32,
+	              0,
+	              &error );
 
-	( (libbfio_internal_handle_t *) handle )->write = (ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) write_function;
+	( (libbfio_internal_handle_t *) handle )->io_handle = io_handle;
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
-	 "write_count",
-	 write_count,
+	 "read_count",
+	 read_count,
 	 (ssize_t) -1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
@@ -2486,15 +2925,16 @@ int bfio_test_internal_handle_write_buffer(
 	libcerror_error_free(
 	 &error );
 
-	write_count = libbfio_internal_handle_write_buffer(
-	               (libbfio_internal_handle_t *) handle,
-	               NULL,
-	               32,
-	               &error );
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              NULL,
+	              32,
+	              0,
+	              &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
-	 "write_count",
-	 write_count,
+	 "read_count",
+	 read_count,
 	 (ssize_t) -1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
@@ -2504,15 +2944,16 @@ int bfio_test_internal_handle_write_buffer(
 	libcerror_error_free(
 	 &error );
 
-	write_count = libbfio_internal_handle_write_buffer(
-	               (libbfio_internal_handle_t *) handle,
-	               buffer,
-	               (size_t) SSIZE_MAX + 1,
-	               &error );
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              0,
+	              &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
-	 "write_count",
-	 write_count,
+	 "read_count",
+	 read_count,
 	 (ssize_t) -1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
@@ -2522,54 +2963,86 @@ int bfio_test_internal_handle_write_buffer(
 	libcerror_error_free(
 	 &error );
 
-	/* Clean up
-	 */
-	if( with_temporary_file != 0 )
-	{
-		result = libbfio_handle_close(
-		          handle,
-		          &error );
-
-		BFIO_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 0 );
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              32,
+	              -1,
+	              &error );
 
-		BFIO_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
 
-		result = bfio_test_remove_temporary_file(
-		          narrow_temporary_filename,
-		          &error );
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		BFIO_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	libcerror_error_free(
+	 &error );
 
-		BFIO_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+#if defined( HAVE_BFIO_TEST_RWLOCK )
 
-		with_temporary_file = 0;
+	/* Test libbfio_handle_read_buffer_at_offset with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	 */
+	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              32,
+	              0,
+	              &error );
+
+	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
 	}
-	result = libbfio_handle_free(
-	          &handle,
-	          &error );
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
 
-	BFIO_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
 
-	BFIO_TEST_ASSERT_IS_NULL(
-	 "handle",
-	 handle );
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libbfio_handle_read_buffer_at_offset with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	 */
+	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
 
-	BFIO_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              32,
+	              0,
+	              &error );
+
+	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
 
 	return( 1 );
 
@@ -2579,47 +3052,33 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( with_temporary_file != 0 )
-	{
-		bfio_test_remove_temporary_file(
-		 narrow_temporary_filename,
-		 NULL );
-	}
-	if( handle != NULL )
-	{
-		libbfio_handle_free(
-		 &handle,
-		 NULL );
-	}
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) */
-
-/* Tests the libbfio_handle_write_buffer function
+/* Tests the libbfio_handle_read_vector function
  * Returns 1 if successful or 0 if not
  */
-int bfio_test_handle_write_buffer(
-     void )
+int bfio_test_handle_read_vector(
+     libbfio_handle_t *handle )
 {
-	char narrow_temporary_filename[ 17 ] = {
-		'b', 'f', 'i', 'o', '_', 't', 'e', 's', 't', '_', 'X', 'X', 'X', 'X', 'X', 'X', 0 };
+	uint8_t *buffers[ 4 ];
+	uint8_t expected_buffer[ 64 ];
+	uint8_t vector_buffer[ 56 ];
+	size_t buffer_sizes[ 4 ];
+	off64_t offsets[ 4 ];
 
-	uint8_t buffer[ 32 ] = {
-		'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
-		'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', '0', '1', '2', '3', '4', '5' };
-
-	libbfio_handle_t *handle = NULL;
 	libcerror_error_t *error = NULL;
 	intptr_t *io_handle      = NULL;
-	ssize_t write_count      = 0;
+	size64_t file_size       = 0;
+	ssize_t read_count       = 0;
+	uint8_t track_offsets    = 0;
 	int result               = 0;
-	int with_temporary_file  = 0;
 
 	/* Initialize test
 	 */
-	result = libbfio_file_initialize(
-	          &handle,
+	result = libbfio_handle_get_size(
+	          handle,
+	          &file_size,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -2627,36 +3086,58 @@ int bfio_test_handle_write_buffer(
 	 result,
 	 1 );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
-	 "handle",
-	 handle );
-
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = bfio_test_get_temporary_filename(
-	          narrow_temporary_filename,
-	          17,
-	          &error );
+	if( file_size < 64 )
+	{
+		return( 1 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              expected_buffer,
+	              64,
+	              0,
+	              &error );
 
-	BFIO_TEST_ASSERT_NOT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 64 );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	with_temporary_file = result;
+	/* The first 3 buffers are adjacent in the data but are not provided
+	 * in order of offset, the last buffer is not adjacent
+	 */
+	buffers[ 0 ]      = &( vector_buffer[ 0 ] );
+	buffer_sizes[ 0 ] = 16;
+	offsets[ 0 ]      = 32;
 
-	if( with_temporary_file != 0 )
+	buffers[ 1 ]      = &( vector_buffer[ 16 ] );
+	buffer_sizes[ 1 ] = 16;
+	offsets[ 1 ]      = 0;
+
+	buffers[ 2 ]      = &( vector_buffer[ 32 ] );
+	buffer_sizes[ 2 ] = 16;
+	offsets[ 2 ]      = 16;
+
+	buffers[ 3 ]      = &( vector_buffer[ 48 ] );
+	buffer_sizes[ 3 ] = 8;
+	offsets[ 3 ]      = 56;
+
+	/* Test regular cases with and without tracking the offsets read
+	 */
+	for( track_offsets = 0;
+	     track_offsets < 2;
+	     track_offsets++ )
 	{
-		result = libbfio_file_set_name(
+		result = libbfio_handle_set_track_offsets_read(
 		          handle,
-		          narrow_temporary_filename,
-		          16,
+		          (uint8_t) ( 1 - track_offsets ),
 		          &error );
 
 		BFIO_TEST_ASSERT_EQUAL_INT(
@@ -2668,48 +3149,160 @@ int bfio_test_handle_write_buffer(
 		 "error",
 		 error );
 
-		result = libbfio_handle_open(
-		          handle,
-		          LIBBFIO_OPEN_WRITE,
-		          &error );
+		if( memory_set(
+		     vector_buffer,
+		     0,
+		     56 ) == NULL )
+		{
+			goto on_error;
+		}
+		read_count = libbfio_handle_read_vector(
+		              handle,
+		              buffers,
+		              buffer_sizes,
+		              offsets,
+		              4,
+		              &error );
+
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 56 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          &( vector_buffer[ 0 ] ),
+		          &( expected_buffer[ 32 ] ),
+		          16 );
 
 		BFIO_TEST_ASSERT_EQUAL_INT(
 		 "result",
 		 result,
-		 1 );
+		 0 );
+
+		result = memory_compare(
+		          &( vector_buffer[ 16 ] ),
+		          &( expected_buffer[ 0 ] ),
+		          16 );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = memory_compare(
+		          &( vector_buffer[ 32 ] ),
+		          &( expected_buffer[ 16 ] ),
+		          16 );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = memory_compare(
+		          &( vector_buffer[ 48 ] ),
+		          &( expected_buffer[ 56 ] ),
+		          8 );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* Test reading across the end of the data, the second buffer is
+		 * only partially filled hence the third buffer is not counted
+		 * although it is read before the second buffer
+		 */
+		offsets[ 0 ] = 0;
+		offsets[ 1 ] = (off64_t) file_size - 8;
+		offsets[ 2 ] = 16;
+
+		read_count = libbfio_handle_read_vector(
+		              handle,
+		              buffers,
+		              buffer_sizes,
+		              offsets,
+		              3,
+		              &error );
+
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 24 );
 
 		BFIO_TEST_ASSERT_IS_NULL(
 		 "error",
 		 error );
 
-		/* Test regular cases
+		result = memory_compare(
+		          &( vector_buffer[ 0 ] ),
+		          &( expected_buffer[ 0 ] ),
+		          16 );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* Test reading beyond the end of the data in the first buffer
 		 */
-		write_count = libbfio_handle_write_buffer(
-		               handle,
-		               buffer,
-		               32,
-		               &error );
+		offsets[ 0 ] = (off64_t) file_size;
+
+		read_count = libbfio_handle_read_vector(
+		              handle,
+		              buffers,
+		              buffer_sizes,
+		              offsets,
+		              3,
+		              &error );
 
 		BFIO_TEST_ASSERT_EQUAL_SSIZE(
-		 "write_count",
-		 write_count,
-		 (ssize_t) 32 );
+		 "read_count",
+		 read_count,
+		 (ssize_t) 0 );
 
 		BFIO_TEST_ASSERT_IS_NULL(
 		 "error",
 		 error );
+
+		offsets[ 0 ] = 32;
+		offsets[ 1 ] = 0;
+		offsets[ 2 ] = 16;
 	}
+	read_count = libbfio_handle_read_vector(
+	              handle,
+	              buffers,
+	              buffer_sizes,
+	              offsets,
+	              0,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test error cases
 	 */
-	write_count = libbfio_handle_write_buffer(
-	               NULL,
-	               buffer,
-	               32,
-	               &error );
+	read_count = libbfio_handle_read_vector(
+	              NULL,
+	              buffers,
+	              buffer_sizes,
+	              offsets,
+	              4,
+	              &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
-	 "write_count",
-	 write_count,
+	 "read_count",
+	 read_count,
 	 (ssize_t) -1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
@@ -2723,17 +3316,19 @@ int bfio_test_handle_write_buffer(
 
 	( (libbfio_internal_handle_t *) handle )->io_handle = NULL;
 
-	write_count = libbfio_handle_write_buffer(
-	               handle,
-	               buffer,
-	               32,
-	               &error );
+	read_count = libbfio_handle_read_vector(
+	              handle,
+	              buffers,
+	              buffer_sizes,
+	              offsets,
+	              4,
+	              &error );
 
 	( (libbfio_internal_handle_t *) handle )->io_handle = io_handle;
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
-	 "write_count",
-	 write_count,
+	 "read_count",
+	 read_count,
 	 (ssize_t) -1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
@@ -2743,15 +3338,17 @@ int bfio_test_handle_write_buffer(
 	libcerror_error_free(
 	 &error );
 
-	write_count = libbfio_handle_write_buffer(
-	               handle,
-	               NULL,
-	               32,
-	               &error );
+	read_count = libbfio_handle_read_vector(
+	              handle,
+	              NULL,
+	              buffer_sizes,
+	              offsets,
+	              4,
+	              &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
-	 "write_count",
-	 write_count,
+	 "read_count",
+	 read_count,
 	 (ssize_t) -1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
@@ -2761,15 +3358,17 @@ int bfio_test_handle_write_buffer(
 	libcerror_error_free(
 	 &error );
 
-	write_count = libbfio_handle_write_buffer(
-	               handle,
-	               buffer,
-	               (size_t) SSIZE_MAX + 1,
-	               &error );
+	read_count = libbfio_handle_read_vector(
+	              handle,
+	              buffers,
+	              NULL,
+	              offsets,
+	              4,
+	              &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
-	 "write_count",
-	 write_count,
+	 "read_count",
+	 read_count,
 	 (ssize_t) -1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
@@ -2779,17 +3378,131 @@ int bfio_test_handle_write_buffer(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_BFIO_TEST_RWLOCK )
-
-	/* Test libbfio_handle_write_buffer with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	read_count = libbfio_handle_read_vector(
+	              handle,
+	              buffers,
+	              buffer_sizes,
+	              NULL,
+	              4,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libbfio_handle_read_vector(
+	              handle,
+	              buffers,
+	              buffer_sizes,
+	              offsets,
+	              -1,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	buffers[ 3 ] = NULL;
+
+	read_count = libbfio_handle_read_vector(
+	              handle,
+	              buffers,
+	              buffer_sizes,
+	              offsets,
+	              4,
+	              &error );
+
+	buffers[ 3 ] = &( vector_buffer[ 48 ] );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	buffer_sizes[ 3 ] = (size_t) SSIZE_MAX + 1;
+
+	read_count = libbfio_handle_read_vector(
+	              handle,
+	              buffers,
+	              buffer_sizes,
+	              offsets,
+	              4,
+	              &error );
+
+	buffer_sizes[ 3 ] = 8;
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offsets[ 3 ] = -1;
+
+	read_count = libbfio_handle_read_vector(
+	              handle,
+	              buffers,
+	              buffer_sizes,
+	              offsets,
+	              4,
+	              &error );
+
+	offsets[ 3 ] = 56;
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_BFIO_TEST_RWLOCK )
+
+	/* Test libbfio_handle_read_vector with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
 	 */
 	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
 
-	write_count = libbfio_handle_write_buffer(
-	               handle,
-	               buffer,
-	               32,
-	               &error );
+	read_count = libbfio_handle_read_vector(
+	              handle,
+	              buffers,
+	              buffer_sizes,
+	              offsets,
+	              4,
+	              &error );
 
 	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
 	{
@@ -2798,8 +3511,8 @@ int bfio_test_handle_write_buffer(
 	else
 	{
 		BFIO_TEST_ASSERT_EQUAL_SSIZE(
-		 "write_count",
-		 write_count,
+		 "read_count",
+		 read_count,
 		 (ssize_t) -1 );
 
 		BFIO_TEST_ASSERT_IS_NOT_NULL(
@@ -2809,15 +3522,17 @@ int bfio_test_handle_write_buffer(
 		libcerror_error_free(
 		 &error );
 	}
-	/* Test libbfio_handle_write_buffer with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	/* Test libbfio_handle_read_vector with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
 	 */
 	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
 
-	write_count = libbfio_handle_write_buffer(
-	               handle,
-	               buffer,
-	               32,
-	               &error );
+	read_count = libbfio_handle_read_vector(
+	              handle,
+	              buffers,
+	              buffer_sizes,
+	              offsets,
+	              4,
+	              &error );
 
 	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
 	{
@@ -2826,8 +3541,8 @@ int bfio_test_handle_write_buffer(
 	else
 	{
 		BFIO_TEST_ASSERT_EQUAL_SSIZE(
-		 "write_count",
-		 write_count,
+		 "read_count",
+		 read_count,
 		 (ssize_t) -1 );
 
 		BFIO_TEST_ASSERT_IS_NOT_NULL(
@@ -2839,55 +3554,6 @@ int bfio_test_handle_write_buffer(
 	}
 #endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
 
-	/* Clean up
-	 */
-	if( with_temporary_file != 0 )
-	{
-		result = libbfio_handle_close(
-		          handle,
-		          &error );
-
-		BFIO_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 0 );
-
-		BFIO_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-
-		result = bfio_test_remove_temporary_file(
-		          narrow_temporary_filename,
-		          &error );
-
-		BFIO_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
-
-		BFIO_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-
-		with_temporary_file = 0;
-	}
-	result = libbfio_handle_free(
-	          &handle,
-	          &error );
-
-	BFIO_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	BFIO_TEST_ASSERT_IS_NULL(
-	 "handle",
-	 handle );
-
-	BFIO_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
 	return( 1 );
 
 on_error:
@@ -2896,25 +3562,15 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( with_temporary_file != 0 )
-	{
-		bfio_test_remove_temporary_file(
-		 narrow_temporary_filename,
-		 NULL );
-	}
-	if( handle != NULL )
-	{
-		libbfio_handle_free(
-		 &handle,
-		 NULL );
-	}
 	return( 0 );
 }
 
-/* Tests the libbfio_handle_write_buffer_at_offset function
+#if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT )
+
+/* Tests the libbfio_internal_handle_write_buffer function
  * Returns 1 if successful or 0 if not
  */
-int bfio_test_handle_write_buffer_at_offset(
+int bfio_test_internal_handle_write_buffer(
      void )
 {
 	char narrow_temporary_filename[ 17 ] = {
@@ -2926,7 +3582,7 @@ int bfio_test_handle_write_buffer_at_offset(
 
 	libbfio_handle_t *handle = NULL;
 	libcerror_error_t *error = NULL;
-	intptr_t *io_handle      = NULL;
+	intptr_t *write_function = NULL;
 	ssize_t write_count      = 0;
 	int result               = 0;
 	int with_temporary_file  = 0;
@@ -2999,11 +3655,10 @@ int bfio_test_handle_write_buffer_at_offset(
 
 		/* Test regular cases
 		 */
-		write_count = libbfio_handle_write_buffer_at_offset(
-		               handle,
+		write_count = libbfio_internal_handle_write_buffer(
+		               (libbfio_internal_handle_t *) handle,
 		               buffer,
 		               32,
-		               0,
 		               &error );
 
 		BFIO_TEST_ASSERT_EQUAL_SSIZE(
@@ -3017,11 +3672,10 @@ int bfio_test_handle_write_buffer_at_offset(
 	}
 	/* Test error cases
 	 */
-	write_count = libbfio_handle_write_buffer_at_offset(
+	write_count = libbfio_internal_handle_write_buffer(
 	               NULL,
 	               buffer,
 	               32,
-	               0,
 	               &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
@@ -3036,18 +3690,17 @@ int bfio_test_handle_write_buffer_at_offset(
 	libcerror_error_free(
 	 &error );
 
-	io_handle = ( (libbfio_internal_handle_t *) handle )->io_handle;
+	write_function = (intptr_t *) ( (libbfio_internal_handle_t *) handle )->write;
 
-	( (libbfio_internal_handle_t *) handle )->io_handle = NULL;
+	( (libbfio_internal_handle_t *) handle )->write = NULL;
 
-	write_count = libbfio_handle_write_buffer_at_offset(
-	               handle,
+	write_count = libbfio_internal_handle_write_buffer(
+	               (libbfio_internal_handle_t *) handle,
 	               buffer,
 	               32,
-	               0,
 	               &error );
 
-	( (libbfio_internal_handle_t *) handle )->io_handle = io_handle;
+	( (libbfio_internal_handle_t *) handle )->write = (ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) write_function;
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
 	 "write_count",
@@ -3061,11 +3714,10 @@ int bfio_test_handle_write_buffer_at_offset(
 	libcerror_error_free(
 	 &error );
 
-	write_count = libbfio_handle_write_buffer_at_offset(
-	               handle,
+	write_count = libbfio_internal_handle_write_buffer(
+	               (libbfio_internal_handle_t *) handle,
 	               NULL,
 	               32,
-	               0,
 	               &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
@@ -3080,11 +3732,10 @@ int bfio_test_handle_write_buffer_at_offset(
 	libcerror_error_free(
 	 &error );
 
-	write_count = libbfio_handle_write_buffer_at_offset(
-	               handle,
+	write_count = libbfio_internal_handle_write_buffer(
+	               (libbfio_internal_handle_t *) handle,
 	               buffer,
 	               (size_t) SSIZE_MAX + 1,
-	               0,
 	               &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
@@ -3099,37 +3750,274 @@ int bfio_test_handle_write_buffer_at_offset(
 	libcerror_error_free(
 	 &error );
 
-	write_count = libbfio_handle_write_buffer_at_offset(
-	               handle,
-	               buffer,
-	               32,
-	               -1,
-	               &error );
-
-	BFIO_TEST_ASSERT_EQUAL_SSIZE(
-	 "write_count",
-	 write_count,
-	 (ssize_t) -1 );
+	/* Clean up
+	 */
+	if( with_temporary_file != 0 )
+	{
+		result = libbfio_handle_close(
+		          handle,
+		          &error );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
 
-	libcerror_error_free(
-	 &error );
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-#if defined( HAVE_BFIO_TEST_RWLOCK )
+		result = bfio_test_remove_temporary_file(
+		          narrow_temporary_filename,
+		          &error );
 
-	/* Test libbfio_handle_write_buffer_at_offset with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
-	 */
-	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	write_count = libbfio_handle_write_buffer_at_offset(
-	               handle,
-	               buffer,
-	               32,
-	               0,
-	               &error );
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		with_temporary_file = 0;
+	}
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( with_temporary_file != 0 )
+	{
+		bfio_test_remove_temporary_file(
+		 narrow_temporary_filename,
+		 NULL );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) */
+
+/* Tests the libbfio_handle_write_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_write_buffer(
+     void )
+{
+	char narrow_temporary_filename[ 17 ] = {
+		'b', 'f', 'i', 'o', '_', 't', 'e', 's', 't', '_', 'X', 'X', 'X', 'X', 'X', 'X', 0 };
+
+	uint8_t buffer[ 32 ] = {
+		'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+		'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', '0', '1', '2', '3', '4', '5' };
+
+	libbfio_handle_t *handle = NULL;
+	libcerror_error_t *error = NULL;
+	intptr_t *io_handle      = NULL;
+	ssize_t write_count      = 0;
+	int result               = 0;
+	int with_temporary_file  = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_file_initialize(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = bfio_test_get_temporary_filename(
+	          narrow_temporary_filename,
+	          17,
+	          &error );
+
+	BFIO_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	with_temporary_file = result;
+
+	if( with_temporary_file != 0 )
+	{
+		result = libbfio_file_set_name(
+		          handle,
+		          narrow_temporary_filename,
+		          16,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_handle_open(
+		          handle,
+		          LIBBFIO_OPEN_WRITE,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases
+		 */
+		write_count = libbfio_handle_write_buffer(
+		               handle,
+		               buffer,
+		               32,
+		               &error );
+
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) 32 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	write_count = libbfio_handle_write_buffer(
+	               NULL,
+	               buffer,
+	               32,
+	               &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	io_handle = ( (libbfio_internal_handle_t *) handle )->io_handle;
+
+	( (libbfio_internal_handle_t *) handle )->io_handle = NULL;
+
+	write_count = libbfio_handle_write_buffer(
+	               handle,
+	               buffer,
+	               32,
+	               &error );
+
+	( (libbfio_internal_handle_t *) handle )->io_handle = io_handle;
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	write_count = libbfio_handle_write_buffer(
+	               handle,
+	               NULL,
+	               32,
+	               &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	write_count = libbfio_handle_write_buffer(
+	               handle,
+	               buffer,
+	               (size_t) SSIZE_MAX + 1,
+	               &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_BFIO_TEST_RWLOCK )
+
+	/* Test libbfio_handle_write_buffer with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	 */
+	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+
+	write_count = libbfio_handle_write_buffer(
+	               handle,
+	               buffer,
+	               32,
+	               &error );
 
 	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
 	{
@@ -3149,15 +4037,14 @@ int bfio_test_handle_write_buffer_at_offset(
 		libcerror_error_free(
 		 &error );
 	}
-	/* Test libbfio_handle_write_buffer_at_offset with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	/* Test libbfio_handle_write_buffer with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
 	 */
 	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
 
-	write_count = libbfio_handle_write_buffer_at_offset(
+	write_count = libbfio_handle_write_buffer(
 	               handle,
 	               buffer,
 	               32,
-	               0,
 	               &error );
 
 	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
@@ -3252,18 +4139,865 @@ on_error:
 	return( 0 );
 }
 
-#if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT )
-
-/* Tests the libbfio_internal_handle_seek_offset function
+/* Tests the libbfio_handle_write_buffer_at_offset function
  * Returns 1 if successful or 0 if not
  */
-int bfio_test_internal_handle_seek_offset(
-     libbfio_handle_t *handle )
+int bfio_test_handle_write_buffer_at_offset(
+     void )
 {
-	libbfio_handle_t *closed_handle = NULL;
-	libcerror_error_t *error        = NULL;
-	intptr_t *io_handle             = NULL;
-	intptr_t *seek_offset_function  = NULL;
+	char narrow_temporary_filename[ 17 ] = {
+		'b', 'f', 'i', 'o', '_', 't', 'e', 's', 't', '_', 'X', 'X', 'X', 'X', 'X', 'X', 0 };
+
+	uint8_t buffer[ 32 ] = {
+		'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+		'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', '0', '1', '2', '3', '4', '5' };
+
+	libbfio_handle_t *handle = NULL;
+	libcerror_error_t *error = NULL;
+	intptr_t *io_handle      = NULL;
+	size64_t size            = 0;
+	off64_t offset           = 0;
+	ssize_t write_count      = 0;
+	int result               = 0;
+	int with_temporary_file  = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_file_initialize(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = bfio_test_get_temporary_filename(
+	          narrow_temporary_filename,
+	          17,
+	          &error );
+
+	BFIO_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	with_temporary_file = result;
+
+	if( with_temporary_file != 0 )
+	{
+		result = libbfio_file_set_name(
+		          handle,
+		          narrow_temporary_filename,
+		          16,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_handle_open(
+		          handle,
+		          LIBBFIO_OPEN_WRITE,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases
+		 */
+		write_count = libbfio_handle_write_buffer_at_offset(
+		               handle,
+		               buffer,
+		               32,
+		               0,
+		               &error );
+
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) 32 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		write_count = libbfio_handle_write_buffer_at_offset(
+		               handle,
+		               buffer,
+		               32,
+		               64,
+		               &error );
+
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) 32 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_handle_get_size(
+		          handle,
+		          &size,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_EQUAL_UINT64(
+		 "size",
+		 size,
+		 (uint64_t) 96 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_WRITE )
+		/* The positional write does not change the current offset
+		 */
+		result = libbfio_handle_get_offset(
+		          handle,
+		          &offset,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 (int64_t) offset,
+		 (int64_t) 0 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_WRITE ) */
+	}
+	/* Test error cases
+	 */
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               NULL,
+	               buffer,
+	               32,
+	               0,
+	               &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	io_handle = ( (libbfio_internal_handle_t *) handle )->io_handle;
+
+	( (libbfio_internal_handle_t *) handle )->io_handle = NULL;
+
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               handle,
+	               buffer,
+	               32,
+	               0,
+	               &error );
+
+	( (libbfio_internal_handle_t *) handle )->io_handle = io_handle;
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               handle,
+	               NULL,
+	               32,
+	               0,
+	               &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               handle,
+	               buffer,
+	               (size_t) SSIZE_MAX + 1,
+	               0,
+	               &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               handle,
+	               buffer,
+	               32,
+	               -1,
+	               &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_BFIO_TEST_RWLOCK )
+
+	/* Test libbfio_handle_write_buffer_at_offset with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	 */
+	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               handle,
+	               buffer,
+	               32,
+	               0,
+	               &error );
+
+	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libbfio_handle_write_buffer_at_offset with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	 */
+	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               handle,
+	               buffer,
+	               32,
+	               0,
+	               &error );
+
+	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
+
+	/* Clean up
+	 */
+	if( with_temporary_file != 0 )
+	{
+		result = libbfio_handle_close(
+		          handle,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = bfio_test_remove_temporary_file(
+		          narrow_temporary_filename,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		with_temporary_file = 0;
+	}
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( with_temporary_file != 0 )
+	{
+		bfio_test_remove_temporary_file(
+		 narrow_temporary_filename,
+		 NULL );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT )
+
+/* Tests the libbfio_internal_handle_seek_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_internal_handle_seek_offset(
+     libbfio_handle_t *handle )
+{
+	libbfio_handle_t *closed_handle = NULL;
+	libcerror_error_t *error        = NULL;
+	intptr_t *io_handle             = NULL;
+	intptr_t *seek_offset_function  = NULL;
+	size64_t file_size              = 0;
+	off64_t offset                  = 0;
+	off64_t seek_offset             = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_handle_get_size(
+	          handle,
+	          &file_size,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: 0 and whence: SEEK_SET
+	 */
+	seek_offset = 0;
+
+	offset = libbfio_internal_handle_seek_offset(
+	          (libbfio_internal_handle_t *) handle,
+	          seek_offset,
+	          SEEK_SET,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) seek_offset );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: <file_size> and whence: SEEK_SET
+	 */
+	seek_offset = (off64_t) file_size;
+
+	offset = libbfio_internal_handle_seek_offset(
+	          (libbfio_internal_handle_t *) handle,
+	          seek_offset,
+	          SEEK_SET,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) seek_offset );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: <file_size / 5> and whence: SEEK_SET
+	 */
+	seek_offset = (off64_t) ( file_size / 5 );
+
+	offset = libbfio_internal_handle_seek_offset(
+	          (libbfio_internal_handle_t *) handle,
+	          seek_offset,
+	          SEEK_SET,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) seek_offset );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: <file_size / 5> and whence: SEEK_CUR
+	 */
+	offset = libbfio_internal_handle_seek_offset(
+	          (libbfio_internal_handle_t *) handle,
+	          seek_offset,
+	          SEEK_CUR,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) seek_offset + seek_offset );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: <-1 * (file_size / 5)> and whence: SEEK_CUR
+	 */
+	offset = libbfio_internal_handle_seek_offset(
+	          (libbfio_internal_handle_t *) handle,
+	          -1 * seek_offset,
+	          SEEK_CUR,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) seek_offset );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: <file_size + 987> and whence: SEEK_SET
+	 */
+	seek_offset = (off64_t) ( file_size + 987 );
+
+	offset = libbfio_internal_handle_seek_offset(
+	          (libbfio_internal_handle_t *) handle,
+	          seek_offset,
+	          SEEK_SET,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) seek_offset );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: 0 and whence: SEEK_CUR
+	 */
+	offset = libbfio_internal_handle_seek_offset(
+	          (libbfio_internal_handle_t *) handle,
+	          0,
+	          SEEK_CUR,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) seek_offset );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: 0 and whence: SEEK_END
+	 */
+	offset = libbfio_internal_handle_seek_offset(
+	          (libbfio_internal_handle_t *) handle,
+	          0,
+	          SEEK_END,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) file_size );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: <-1 * (file_size / 4)> and whence: SEEK_END
+	 */
+	seek_offset = (off64_t) ( file_size / 4 );
+
+	offset = libbfio_internal_handle_seek_offset(
+	          (libbfio_internal_handle_t *) handle,
+	          -1 * seek_offset,
+	          SEEK_END,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) file_size - seek_offset );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: 542 and whence: SEEK_END
+	 */
+	offset = libbfio_internal_handle_seek_offset(
+	          (libbfio_internal_handle_t *) handle,
+	          542,
+	          SEEK_END,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) file_size + 542 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: <-1 * file_size> and whence: SEEK_END
+	 */
+	offset = libbfio_internal_handle_seek_offset(
+	          (libbfio_internal_handle_t *) handle,
+	          -1 * file_size,
+	          SEEK_END,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	offset = libbfio_internal_handle_seek_offset(
+	          NULL,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	io_handle = ( (libbfio_internal_handle_t *) handle )->io_handle;
+
+	( (libbfio_internal_handle_t *) handle )->io_handle = NULL;
+
+	offset = libbfio_internal_handle_seek_offset(
+	          (libbfio_internal_handle_t *) handle,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	( (libbfio_internal_handle_t *) handle )->io_handle = io_handle;
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	seek_offset_function = (intptr_t *) ( (libbfio_internal_handle_t *) handle )->seek_offset;
+
+	( (libbfio_internal_handle_t *) handle )->seek_offset = NULL;
+
+	offset = libbfio_internal_handle_seek_offset(
+	          (libbfio_internal_handle_t *) handle,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	( (libbfio_internal_handle_t *) handle )->seek_offset = (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) seek_offset_function;
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test seek offset with offset: -987 and whence: SEEK_SET
+	 */
+	offset = libbfio_internal_handle_seek_offset(
+	          (libbfio_internal_handle_t *) handle,
+	          -987,
+	          SEEK_SET,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test seek offset with offset: <1 * (file_size + 542)> and whence: SEEK_END
+	 */
+	offset = libbfio_internal_handle_seek_offset(
+	          (libbfio_internal_handle_t *) handle,
+	          -1 * (file_size + 542),
+	          SEEK_END,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test seek offset with offset: 0 and whence: UNKNOWN (88)
+	 */
+	offset = libbfio_internal_handle_seek_offset(
+	          (libbfio_internal_handle_t *) handle,
+	          0,
+	          88,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Initialize test
+	 */
+	result = libbfio_handle_initialize(
+	          &closed_handle,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "closed_handle",
+	 closed_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset on a closed file IO handle
+	 */
+	offset = libbfio_internal_handle_seek_offset(
+	          (libbfio_internal_handle_t *) closed_handle,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &closed_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "closed_handle",
+	 closed_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( closed_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &closed_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) */
+
+/* Tests the libbfio_handle_seek_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_seek_offset(
+     libbfio_handle_t *handle )
+{
+	libbfio_handle_t *closed_handle = NULL;
+	libcerror_error_t *error        = NULL;
+	intptr_t *io_handle             = NULL;
+	intptr_t *seek_offset_function  = NULL;
 	size64_t file_size              = 0;
 	off64_t offset                  = 0;
 	off64_t seek_offset             = 0;
@@ -3271,9 +5005,2355 @@ int bfio_test_internal_handle_seek_offset(
 
 	/* Initialize test
 	 */
-	result = libbfio_handle_get_size(
+	result = libbfio_handle_get_size(
+	          handle,
+	          &file_size,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: 0 and whence: SEEK_SET
+	 */
+	seek_offset = 0;
+
+	offset = libbfio_handle_seek_offset(
+	          handle,
+	          seek_offset,
+	          SEEK_SET,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) seek_offset );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: <file_size> and whence: SEEK_SET
+	 */
+	seek_offset = (off64_t) file_size;
+
+	offset = libbfio_handle_seek_offset(
+	          handle,
+	          seek_offset,
+	          SEEK_SET,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) seek_offset );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: <file_size / 5> and whence: SEEK_SET
+	 */
+	seek_offset = (off64_t) ( file_size / 5 );
+
+	offset = libbfio_handle_seek_offset(
+	          handle,
+	          seek_offset,
+	          SEEK_SET,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) seek_offset );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: <file_size / 5> and whence: SEEK_CUR
+	 */
+	offset = libbfio_handle_seek_offset(
+	          handle,
+	          seek_offset,
+	          SEEK_CUR,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) seek_offset + seek_offset );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: <-1 * (file_size / 5)> and whence: SEEK_CUR
+	 */
+	offset = libbfio_handle_seek_offset(
+	          handle,
+	          -1 * seek_offset,
+	          SEEK_CUR,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) seek_offset );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: <file_size + 987> and whence: SEEK_SET
+	 */
+	seek_offset = (off64_t) ( file_size + 987 );
+
+	offset = libbfio_handle_seek_offset(
+	          handle,
+	          seek_offset,
+	          SEEK_SET,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) seek_offset );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: 0 and whence: SEEK_CUR
+	 */
+	offset = libbfio_handle_seek_offset(
+	          handle,
+	          0,
+	          SEEK_CUR,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) seek_offset );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: 0 and whence: SEEK_END
+	 */
+	offset = libbfio_handle_seek_offset(
+	          handle,
+	          0,
+	          SEEK_END,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) file_size );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: <-1 * (file_size / 4)> and whence: SEEK_END
+	 */
+	seek_offset = (off64_t) ( file_size / 4 );
+
+	offset = libbfio_handle_seek_offset(
+	          handle,
+	          -1 * seek_offset,
+	          SEEK_END,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) file_size - seek_offset );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: 542 and whence: SEEK_END
+	 */
+	offset = libbfio_handle_seek_offset(
+	          handle,
+	          542,
+	          SEEK_END,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) file_size + 542 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: <-1 * file_size> and whence: SEEK_END
+	 */
+	offset = libbfio_handle_seek_offset(
+	          handle,
+	          -1 * file_size,
+	          SEEK_END,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	offset = libbfio_handle_seek_offset(
+	          NULL,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	io_handle = ( (libbfio_internal_handle_t *) handle )->io_handle;
+
+	( (libbfio_internal_handle_t *) handle )->io_handle = NULL;
+
+	offset = libbfio_handle_seek_offset(
+	          handle,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	( (libbfio_internal_handle_t *) handle )->io_handle = io_handle;
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	seek_offset_function = (intptr_t *) ( (libbfio_internal_handle_t *) handle )->seek_offset;
+
+	( (libbfio_internal_handle_t *) handle )->seek_offset = NULL;
+
+	offset = libbfio_handle_seek_offset(
+	          handle,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	( (libbfio_internal_handle_t *) handle )->seek_offset = (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) seek_offset_function;
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test seek offset with offset: -987 and whence: SEEK_SET
+	 */
+	offset = libbfio_handle_seek_offset(
+	          handle,
+	          -987,
+	          SEEK_SET,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test seek offset with offset: <1 * (file_size + 542)> and whence: SEEK_END
+	 */
+	offset = libbfio_handle_seek_offset(
+	          handle,
+	          -1 * (file_size + 542),
+	          SEEK_END,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test seek offset with offset: 0 and whence: UNKNOWN (88)
+	 */
+	offset = libbfio_handle_seek_offset(
+	          handle,
+	          0,
+	          88,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_BFIO_TEST_RWLOCK )
+
+	/* Test libbfio_handle_seek_offset with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	 */
+	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+
+	offset = libbfio_handle_seek_offset(
+	          handle,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 offset,
+		 (int64_t) -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libbfio_handle_seek_offset with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	 */
+	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	offset = libbfio_handle_seek_offset(
+	          handle,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 offset,
+		 (int64_t) -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
+
+	/* Initialize test
+	 */
+	result = libbfio_handle_initialize(
+	          &closed_handle,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "closed_handle",
+	 closed_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset on a closed file IO handle
+	 */
+	offset = libbfio_handle_seek_offset(
+	          closed_handle,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &closed_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "closed_handle",
+	 closed_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( closed_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &closed_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_handle_exists function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_exists(
+     libbfio_handle_t *handle )
+{
+	libcerror_error_t *error  = NULL;
+	intptr_t *exists_function = NULL;
+	intptr_t *io_handle       = NULL;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libbfio_handle_exists(
+	          handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_handle_exists(
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	io_handle = ( (libbfio_internal_handle_t *) handle )->io_handle;
+
+	( (libbfio_internal_handle_t *) handle )->io_handle = NULL;
+
+	result = libbfio_handle_exists(
+	          handle,
+	          &error );
+
+	( (libbfio_internal_handle_t *) handle )->io_handle = io_handle;
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	exists_function = (intptr_t *) ( (libbfio_internal_handle_t *) handle )->exists;
+
+	( (libbfio_internal_handle_t *) handle )->exists = NULL;
+
+	result = libbfio_handle_exists(
+	          handle,
+	          &error );
+
+	( (libbfio_internal_handle_t *) handle )->exists = (int (*)(intptr_t *, libcerror_error_t **)) exists_function;
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_BFIO_TEST_RWLOCK )
+
+	/* Test libbfio_handle_exists with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
+	 */
+	bfio_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
+
+	result = libbfio_handle_exists(
+	          handle,
+	          &error );
+
+	if( bfio_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libbfio_handle_exists with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
+	 */
+	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	result = libbfio_handle_exists(
+	          handle,
+	          &error );
+
+	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_handle_is_open function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_is_open(
+     libbfio_handle_t *handle )
+{
+	libcerror_error_t *error   = NULL;
+	intptr_t *io_handle        = NULL;
+	intptr_t *is_open_function = NULL;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libbfio_handle_is_open(
+	          handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_handle_is_open(
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	io_handle = ( (libbfio_internal_handle_t *) handle )->io_handle;
+
+	( (libbfio_internal_handle_t *) handle )->io_handle = NULL;
+
+	result = libbfio_handle_is_open(
+	          handle,
+	          &error );
+
+	( (libbfio_internal_handle_t *) handle )->io_handle = io_handle;
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	is_open_function = (intptr_t *) ( (libbfio_internal_handle_t *) handle )->is_open;
+
+	( (libbfio_internal_handle_t *) handle )->is_open = NULL;
+
+	result = libbfio_handle_is_open(
+	          handle,
+	          &error );
+
+	( (libbfio_internal_handle_t *) handle )->is_open = (int (*)(intptr_t *, libcerror_error_t **)) is_open_function;
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_BFIO_TEST_RWLOCK )
+
+	/* Test libbfio_handle_is_open with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
+	 */
+	bfio_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
+
+	result = libbfio_handle_is_open(
+	          handle,
+	          &error );
+
+	if( bfio_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libbfio_handle_is_open with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
+	 */
+	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	result = libbfio_handle_is_open(
+	          handle,
+	          &error );
+
+	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_handle_get_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_get_io_handle(
+     libbfio_handle_t *handle )
+{
+	libcerror_error_t *error = NULL;
+	intptr_t *io_handle      = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libbfio_handle_get_io_handle(
+	          handle,
+	          &io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_handle_get_io_handle(
+	          NULL,
+	          &io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_get_io_handle(
+	          handle,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_BFIO_TEST_RWLOCK )
+
+	/* Test libbfio_handle_get_io_handle with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
+	 */
+	bfio_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
+
+	result = libbfio_handle_get_io_handle(
+	          handle,
+	          &io_handle,
+	          &error );
+
+	if( bfio_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libbfio_handle_get_io_handle with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
+	 */
+	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	result = libbfio_handle_get_io_handle(
+	          handle,
+	          &io_handle,
+	          &error );
+
+	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_handle_get_access_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_get_access_flags(
+     libbfio_handle_t *handle )
+{
+	libcerror_error_t *error = NULL;
+	int access_flags         = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libbfio_handle_get_access_flags(
+	          handle,
+	          &access_flags,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_handle_get_access_flags(
+	          NULL,
+	          &access_flags,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_get_access_flags(
+	          handle,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_BFIO_TEST_RWLOCK )
+
+	/* Test libbfio_handle_get_access_flags with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
+	 */
+	bfio_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
+
+	result = libbfio_handle_get_access_flags(
+	          handle,
+	          &access_flags,
+	          &error );
+
+	if( bfio_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libbfio_handle_get_access_flags with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
+	 */
+	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	result = libbfio_handle_get_access_flags(
+	          handle,
+	          &access_flags,
+	          &error );
+
+	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_handle_set_access_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_set_access_flags(
+     void )
+{
+	libbfio_handle_t *handle = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_handle_initialize(
+	          &handle,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbfio_handle_set_access_flags(
+	          handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_handle_set_access_flags(
+	          NULL,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_set_access_flags(
+	          handle,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_BFIO_TEST_RWLOCK )
+
+	/* Test libbfio_handle_set_access_flags with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	 */
+	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+
+	result = libbfio_handle_set_access_flags(
+	          handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libbfio_handle_set_access_flags with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	 */
+	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	result = libbfio_handle_set_access_flags(
+	          handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
+
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_handle_get_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_get_offset(
+     libbfio_handle_t *handle )
+{
+	libcerror_error_t *error = NULL;
+	off64_t offset           = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libbfio_handle_get_offset(
+	          handle,
+	          &offset,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_handle_get_offset(
+	          NULL,
+	          &offset,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_get_offset(
+	          handle,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_BFIO_TEST_RWLOCK )
+
+	/* Test libbfio_handle_get_offset with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
+	 */
+	bfio_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
+
+	result = libbfio_handle_get_offset(
+	          handle,
+	          &offset,
+	          &error );
+
+	if( bfio_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libbfio_handle_get_offset with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
+	 */
+	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	result = libbfio_handle_get_offset(
+	          handle,
+	          &offset,
+	          &error );
+
+	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_handle_get_size function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_get_size(
+     libbfio_handle_t *handle )
+{
+	libcerror_error_t *error = NULL;
+	intptr_t *io_handle      = NULL;
+	size64_t size            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libbfio_handle_get_size(
+	          handle,
+	          &size,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_handle_get_size(
+	          NULL,
+	          &size,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	io_handle = ( (libbfio_internal_handle_t *) handle )->io_handle;
+
+	( (libbfio_internal_handle_t *) handle )->io_handle = NULL;
+
+	result = libbfio_handle_get_size(
+	          handle,
+	          &size,
+	          &error );
+
+	( (libbfio_internal_handle_t *) handle )->io_handle = io_handle;
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_get_size(
+	          handle,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_BFIO_TEST_RWLOCK )
+
+	/* Test libbfio_handle_get_size with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
+	 */
+	bfio_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
+
+	result = libbfio_handle_get_size(
+	          handle,
+	          &size,
+	          &error );
+
+	if( bfio_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libbfio_handle_get_size with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
+	 */
+	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	result = libbfio_handle_get_size(
+	          handle,
+	          &size,
+	          &error );
+
+	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_handle_set_open_on_demand function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_set_open_on_demand(
+     void )
+{
+	libbfio_handle_t *handle = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_handle_initialize(
+	          &handle,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbfio_handle_set_open_on_demand(
+	          handle,
+	          1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_handle_set_open_on_demand(
+	          NULL,
+	          1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_BFIO_TEST_RWLOCK )
+
+	/* Test libbfio_handle_set_open_on_demand with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	 */
+	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+
+	result = libbfio_handle_set_open_on_demand(
+	          handle,
+	          1,
+	          &error );
+
+	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libbfio_handle_set_open_on_demand with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	 */
+	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	result = libbfio_handle_set_open_on_demand(
+	          handle,
+	          1,
+	          &error );
+
+	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
+
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_handle_get_number_of_offsets_read functions
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_get_number_of_offsets_read(
+     libbfio_handle_t *handle )
+{
+	libcerror_error_t *error   = NULL;
+	int number_of_offsets_read = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libbfio_handle_get_number_of_offsets_read(
+	          handle,
+	          &number_of_offsets_read,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_NOT_EQUAL_INT(
+	 "number_of_offsets_read",
+	 number_of_offsets_read,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_handle_get_number_of_offsets_read(
+	          NULL,
+	          &number_of_offsets_read,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_get_number_of_offsets_read(
+	          handle,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_BFIO_TEST_RWLOCK )
+
+	/* Test libbfio_handle_get_number_of_offsets_read with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
+	 */
+	bfio_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
+
+	result = libbfio_handle_get_number_of_offsets_read(
+	          handle,
+	          &number_of_offsets_read,
+	          &error );
+
+	if( bfio_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libbfio_handle_get_number_of_offsets_read with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
+	 */
+	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	result = libbfio_handle_get_number_of_offsets_read(
+	          handle,
+	          &number_of_offsets_read,
+	          &error );
+
+	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_handle_get_offset_read functions
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_get_offset_read(
+     libbfio_handle_t *handle )
+{
+	libcerror_error_t *error = NULL;
+	size64_t size            = 0;
+	off64_t offset           = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libbfio_handle_get_offset_read(
+	          handle,
+	          0,
+	          &offset,
+	          &size,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_handle_get_offset_read(
+	          NULL,
+	          0,
+	          &offset,
+	          &size,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_get_offset_read(
+	          handle,
+	          -1,
+	          &offset,
+	          &size,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_get_offset_read(
+	          handle,
+	          0,
+	          NULL,
+	          &size,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_get_offset_read(
+	          handle,
+	          0,
+	          &offset,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_BFIO_TEST_RWLOCK )
+
+	/* Test libbfio_handle_get_offset_read with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
+	 */
+	bfio_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
+
+	result = libbfio_handle_get_offset_read(
+	          handle,
+	          0,
+	          &offset,
+	          &size,
+	          &error );
+
+	if( bfio_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libbfio_handle_get_offset_read with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
+	 */
+	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	result = libbfio_handle_get_offset_read(
+	          handle,
+	          0,
+	          &offset,
+	          &size,
+	          &error );
+
+	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_handle_get_maximum_readahead_size function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_get_maximum_readahead_size(
+     libbfio_handle_t *handle )
+{
+	libcerror_error_t *error      = NULL;
+	size_t maximum_readahead_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = libbfio_handle_get_maximum_readahead_size(
+	          handle,
+	          &maximum_readahead_size,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_SIZE(
+	 "maximum_readahead_size",
+	 maximum_readahead_size,
+	 (size_t) 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_handle_get_maximum_readahead_size(
+	          NULL,
+	          &maximum_readahead_size,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_get_maximum_readahead_size(
+	          handle,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_BFIO_TEST_RWLOCK )
+
+	/* Test libbfio_handle_get_maximum_readahead_size with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
+	 */
+	bfio_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
+
+	result = libbfio_handle_get_maximum_readahead_size(
+	          handle,
+	          &maximum_readahead_size,
+	          &error );
+
+	if( bfio_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libbfio_handle_get_maximum_readahead_size with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
+	 */
+	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	result = libbfio_handle_get_maximum_readahead_size(
+	          handle,
+	          &maximum_readahead_size,
+	          &error );
+
+	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_handle_set_track_offsets_read function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_set_track_offsets_read(
+     void )
+{
+	libbfio_handle_t *handle = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_handle_initialize(
+	          &handle,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbfio_handle_set_track_offsets_read(
 	          handle,
-	          &file_size,
+	          1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_handle_set_track_offsets_read(
+	          NULL,
+	          1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_BFIO_TEST_RWLOCK )
+
+	/* Test libbfio_handle_set_track_offsets_read with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	 */
+	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+
+	result = libbfio_handle_set_track_offsets_read(
+	          handle,
+	          1,
+	          &error );
+
+	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libbfio_handle_set_track_offsets_read with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	 */
+	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	result = libbfio_handle_set_track_offsets_read(
+	          handle,
+	          1,
+	          &error );
+
+	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
+
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_handle_set_maximum_readahead_size function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_set_maximum_readahead_size(
+     void )
+{
+	libbfio_handle_t *handle = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_handle_initialize(
+	          &handle,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -3281,202 +7361,244 @@ int bfio_test_internal_handle_seek_offset(
 	 result,
 	 1 );
 
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test seek offset with offset: 0 and whence: SEEK_SET
+	/* Test regular cases
 	 */
-	seek_offset = 0;
-
-	offset = libbfio_internal_handle_seek_offset(
-	          (libbfio_internal_handle_t *) handle,
-	          seek_offset,
-	          SEEK_SET,
+	result = libbfio_handle_set_maximum_readahead_size(
+	          handle,
+	          1024 * 1024,
 	          &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) seek_offset );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test seek offset with offset: <file_size> and whence: SEEK_SET
+	/* Test error cases
 	 */
-	seek_offset = (off64_t) file_size;
-
-	offset = libbfio_internal_handle_seek_offset(
-	          (libbfio_internal_handle_t *) handle,
-	          seek_offset,
-	          SEEK_SET,
+	result = libbfio_handle_set_maximum_readahead_size(
+	          NULL,
+	          1024 * 1024,
 	          &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) seek_offset );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-	BFIO_TEST_ASSERT_IS_NULL(
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test seek offset with offset: <file_size / 5> and whence: SEEK_SET
-	 */
-	seek_offset = (off64_t) ( file_size / 5 );
+	libcerror_error_free(
+	 &error );
 
-	offset = libbfio_internal_handle_seek_offset(
-	          (libbfio_internal_handle_t *) handle,
-	          seek_offset,
-	          SEEK_SET,
+	result = libbfio_handle_set_maximum_readahead_size(
+	          handle,
+	          (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE + 1,
 	          &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) seek_offset );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-	BFIO_TEST_ASSERT_IS_NULL(
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test seek offset with offset: <file_size / 5> and whence: SEEK_CUR
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_BFIO_TEST_RWLOCK )
+
+	/* Test libbfio_handle_set_maximum_readahead_size with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
 	 */
-	offset = libbfio_internal_handle_seek_offset(
-	          (libbfio_internal_handle_t *) handle,
-	          seek_offset,
-	          SEEK_CUR,
+	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+
+	result = libbfio_handle_set_maximum_readahead_size(
+	          handle,
+	          1024 * 1024,
 	          &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) seek_offset + seek_offset );
+	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
 
-	BFIO_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
 
-	/* Test seek offset with offset: <-1 * (file_size / 5)> and whence: SEEK_CUR
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libbfio_handle_set_maximum_readahead_size with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
 	 */
-	offset = libbfio_internal_handle_seek_offset(
-	          (libbfio_internal_handle_t *) handle,
-	          -1 * seek_offset,
-	          SEEK_CUR,
+	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	result = libbfio_handle_set_maximum_readahead_size(
+	          handle,
+	          1024 * 1024,
 	          &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) seek_offset );
+	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
 
-	BFIO_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
 
-	/* Test seek offset with offset: <file_size + 987> and whence: SEEK_SET
-	 */
-	seek_offset = (off64_t) ( file_size + 987 );
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
 
-	offset = libbfio_internal_handle_seek_offset(
-	          (libbfio_internal_handle_t *) handle,
-	          seek_offset,
-	          SEEK_SET,
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &handle,
 	          &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) seek_offset );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test seek offset with offset: 0 and whence: SEEK_CUR
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_handle_set_prefetch function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_set_prefetch(
+     void )
+{
+	libbfio_handle_t *handle = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
 	 */
-	offset = libbfio_internal_handle_seek_offset(
-	          (libbfio_internal_handle_t *) handle,
-	          0,
-	          SEEK_CUR,
+	result = libbfio_memory_range_initialize(
+	          &handle,
 	          &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) seek_offset );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test seek offset with offset: 0 and whence: SEEK_END
+	/* Test regular cases
 	 */
-	offset = libbfio_internal_handle_seek_offset(
-	          (libbfio_internal_handle_t *) handle,
-	          0,
-	          SEEK_END,
+	result = libbfio_handle_set_prefetch(
+	          handle,
+	          1,
 	          &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) file_size );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test seek offset with offset: <-1 * (file_size / 4)> and whence: SEEK_END
-	 */
-	seek_offset = (off64_t) ( file_size / 4 );
-
-	offset = libbfio_internal_handle_seek_offset(
-	          (libbfio_internal_handle_t *) handle,
-	          -1 * seek_offset,
-	          SEEK_END,
+	result = libbfio_handle_set_prefetch(
+	          handle,
+	          1,
 	          &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) file_size - seek_offset );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test seek offset with offset: 542 and whence: SEEK_END
-	 */
-	offset = libbfio_internal_handle_seek_offset(
-	          (libbfio_internal_handle_t *) handle,
-	          542,
-	          SEEK_END,
+	result = libbfio_handle_set_prefetch(
+	          handle,
+	          0,
 	          &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) file_size + 542 );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test seek offset with offset: <-1 * file_size> and whence: SEEK_END
-	 */
-	offset = libbfio_internal_handle_seek_offset(
-	          (libbfio_internal_handle_t *) handle,
-	          -1 * file_size,
-	          SEEK_END,
+	/* The handle frees the prefetcher
+	 */
+	result = libbfio_handle_set_prefetch(
+	          handle,
+	          1,
 	          &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) 0 );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -3484,16 +7606,15 @@ int bfio_test_internal_handle_seek_offset(
 
 	/* Test error cases
 	 */
-	offset = libbfio_internal_handle_seek_offset(
+	result = libbfio_handle_set_prefetch(
 	          NULL,
-	          0,
-	          SEEK_SET,
+	          1,
 	          &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -3502,46 +7623,45 @@ int bfio_test_internal_handle_seek_offset(
 	libcerror_error_free(
 	 &error );
 
-	io_handle = ( (libbfio_internal_handle_t *) handle )->io_handle;
-
-	( (libbfio_internal_handle_t *) handle )->io_handle = NULL;
-
-	offset = libbfio_internal_handle_seek_offset(
-	          (libbfio_internal_handle_t *) handle,
+	/* Test libbfio_handle_set_prefetch with a handle without a read at offset function
+	 */
+	result = libbfio_handle_set_prefetch(
+	          handle,
 	          0,
-	          SEEK_SET,
 	          &error );
 
-	( (libbfio_internal_handle_t *) handle )->io_handle = io_handle;
-
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = libbfio_handle_set_read_at_offset_function(
+	          handle,
+	          NULL,
+	          &error );
 
-	seek_offset_function = (intptr_t *) ( (libbfio_internal_handle_t *) handle )->seek_offset;
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	( (libbfio_internal_handle_t *) handle )->seek_offset = NULL;
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	offset = libbfio_internal_handle_seek_offset(
-	          (libbfio_internal_handle_t *) handle,
-	          0,
-	          SEEK_SET,
+	result = libbfio_handle_set_prefetch(
+	          handle,
+	          1,
 	          &error );
 
-	( (libbfio_internal_handle_t *) handle )->seek_offset = (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) seek_offset_function;
-
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -3550,70 +7670,114 @@ int bfio_test_internal_handle_seek_offset(
 	libcerror_error_free(
 	 &error );
 
-	/* Test seek offset with offset: -987 and whence: SEEK_SET
+#if defined( HAVE_BFIO_TEST_RWLOCK )
+
+	/* Test libbfio_handle_set_prefetch with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
 	 */
-	offset = libbfio_internal_handle_seek_offset(
-	          (libbfio_internal_handle_t *) handle,
-	          -987,
-	          SEEK_SET,
-	          &error );
+	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	result = libbfio_handle_set_prefetch(
+	          handle,
+	          0,
+	          &error );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
 
-	libcerror_error_free(
-	 &error );
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
 
-	/* Test seek offset with offset: <1 * (file_size + 542)> and whence: SEEK_END
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libbfio_handle_set_prefetch with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
 	 */
-	offset = libbfio_internal_handle_seek_offset(
-	          (libbfio_internal_handle_t *) handle,
-	          -1 * (file_size + 542),
-	          SEEK_END,
+	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	result = libbfio_handle_set_prefetch(
+	          handle,
+	          0,
 	          &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
 
-	libcerror_error_free(
-	 &error );
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
 
-	/* Test seek offset with offset: 0 and whence: UNKNOWN (88)
+	/* Clean up
 	 */
-	offset = libbfio_internal_handle_seek_offset(
-	          (libbfio_internal_handle_t *) handle,
-	          0,
-	          88,
+	result = libbfio_handle_free(
+	          &handle,
 	          &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_handle_set_read_at_offset_function function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_set_read_at_offset_function(
+     void )
+{
+	libbfio_handle_t *handle = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
 
 	/* Initialize test
 	 */
 	result = libbfio_handle_initialize(
-	          &closed_handle,
+	          &handle,
 	          NULL,
 	          NULL,
 	          NULL,
@@ -3634,37 +7798,110 @@ int bfio_test_internal_handle_seek_offset(
 	 1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
-	 "closed_handle",
-	 closed_handle );
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbfio_handle_set_read_at_offset_function(
+	          handle,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_handle_set_read_at_offset_function(
+	          NULL,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_BFIO_TEST_RWLOCK )
+
+	/* Test libbfio_handle_set_read_at_offset_function with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	 */
+	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+
+	result = libbfio_handle_set_read_at_offset_function(
+	          handle,
+	          NULL,
+	          &error );
+
+	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
 
-	BFIO_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
 
-	/* Test seek offset on a closed file IO handle
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libbfio_handle_set_read_at_offset_function with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
 	 */
-	offset = libbfio_internal_handle_seek_offset(
-	          (libbfio_internal_handle_t *) closed_handle,
-	          0,
-	          SEEK_SET,
+	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	result = libbfio_handle_set_read_at_offset_function(
+	          handle,
+	          NULL,
 	          &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
 
-	libcerror_error_free(
-	 &error );
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
 
 	/* Clean up
 	 */
 	result = libbfio_handle_free(
-	          &closed_handle,
+	          &handle,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -3673,8 +7910,8 @@ int bfio_test_internal_handle_seek_offset(
 	 1 );
 
 	BFIO_TEST_ASSERT_IS_NULL(
-	 "closed_handle",
-	 closed_handle );
+	 "handle",
+	 handle );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -3688,37 +7925,41 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( closed_handle != NULL )
+	if( handle != NULL )
 	{
 		libbfio_handle_free(
-		 &closed_handle,
+		 &handle,
 		 NULL );
 	}
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) */
-
-/* Tests the libbfio_handle_seek_offset function
+/* Tests the libbfio_handle_set_write_at_offset_function function
  * Returns 1 if successful or 0 if not
  */
-int bfio_test_handle_seek_offset(
-     libbfio_handle_t *handle )
+int bfio_test_handle_set_write_at_offset_function(
+     void )
 {
-	libbfio_handle_t *closed_handle = NULL;
-	libcerror_error_t *error        = NULL;
-	intptr_t *io_handle             = NULL;
-	intptr_t *seek_offset_function  = NULL;
-	size64_t file_size              = 0;
-	off64_t offset                  = 0;
-	off64_t seek_offset             = 0;
-	int result                      = 0;
+	libbfio_handle_t *handle = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
 
 	/* Initialize test
 	 */
-	result = libbfio_handle_get_size(
-	          handle,
-	          &file_size,
+	result = libbfio_handle_initialize(
+	          &handle,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -3726,202 +7967,195 @@ int bfio_test_handle_seek_offset(
 	 result,
 	 1 );
 
-	BFIO_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	/* Test seek offset with offset: 0 and whence: SEEK_SET
-	 */
-	seek_offset = 0;
-
-	offset = libbfio_handle_seek_offset(
-	          handle,
-	          seek_offset,
-	          SEEK_SET,
-	          &error );
-
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) seek_offset );
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test seek offset with offset: <file_size> and whence: SEEK_SET
+	/* Test regular cases
 	 */
-	seek_offset = (off64_t) file_size;
-
-	offset = libbfio_handle_seek_offset(
+	result = libbfio_handle_set_write_at_offset_function(
 	          handle,
-	          seek_offset,
-	          SEEK_SET,
+	          NULL,
 	          &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) seek_offset );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test seek offset with offset: <file_size / 5> and whence: SEEK_SET
+	/* Test error cases
 	 */
-	seek_offset = (off64_t) ( file_size / 5 );
-
-	offset = libbfio_handle_seek_offset(
-	          handle,
-	          seek_offset,
-	          SEEK_SET,
+	result = libbfio_handle_set_write_at_offset_function(
+	          NULL,
+	          NULL,
 	          &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) seek_offset );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-	BFIO_TEST_ASSERT_IS_NULL(
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test seek offset with offset: <file_size / 5> and whence: SEEK_CUR
-	 */
-	offset = libbfio_handle_seek_offset(
-	          handle,
-	          seek_offset,
-	          SEEK_CUR,
-	          &error );
-
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) seek_offset + seek_offset );
+	libcerror_error_free(
+	 &error );
 
-	BFIO_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+#if defined( HAVE_BFIO_TEST_RWLOCK )
 
-	/* Test seek offset with offset: <-1 * (file_size / 5)> and whence: SEEK_CUR
+	/* Test libbfio_handle_set_write_at_offset_function with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
 	 */
-	offset = libbfio_handle_seek_offset(
+	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+
+	result = libbfio_handle_set_write_at_offset_function(
 	          handle,
-	          -1 * seek_offset,
-	          SEEK_CUR,
+	          NULL,
 	          &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) seek_offset );
+	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
 
-	BFIO_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
 
-	/* Test seek offset with offset: <file_size + 987> and whence: SEEK_SET
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libbfio_handle_set_write_at_offset_function with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
 	 */
-	seek_offset = (off64_t) ( file_size + 987 );
+	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
 
-	offset = libbfio_handle_seek_offset(
+	result = libbfio_handle_set_write_at_offset_function(
 	          handle,
-	          seek_offset,
-	          SEEK_SET,
+	          NULL,
 	          &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) seek_offset );
-
-	BFIO_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	/* Test seek offset with offset: 0 and whence: SEEK_CUR
-	 */
-	offset = libbfio_handle_seek_offset(
-	          handle,
-	          0,
-	          SEEK_CUR,
-	          &error );
+	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) seek_offset );
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
 
-	BFIO_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
 
-	/* Test seek offset with offset: 0 and whence: SEEK_END
+	/* Clean up
 	 */
-	offset = libbfio_handle_seek_offset(
-	          handle,
-	          0,
-	          SEEK_END,
+	result = libbfio_handle_free(
+	          &handle,
 	          &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) file_size );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test seek offset with offset: <-1 * (file_size / 4)> and whence: SEEK_END
-	 */
-	seek_offset = (off64_t) ( file_size / 4 );
-
-	offset = libbfio_handle_seek_offset(
-	          handle,
-	          -1 * seek_offset,
-	          SEEK_END,
-	          &error );
+	return( 1 );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) file_size - seek_offset );
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
 
-	BFIO_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+/* Tests the libbfio_handle_set_read_vector_at_offset_function function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_set_read_vector_at_offset_function(
+     void )
+{
+	libbfio_handle_t *handle = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
 
-	/* Test seek offset with offset: 542 and whence: SEEK_END
+	/* Initialize test
 	 */
-	offset = libbfio_handle_seek_offset(
-	          handle,
-	          542,
-	          SEEK_END,
+	result = libbfio_handle_initialize(
+	          &handle,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
 	          &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) file_size + 542 );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test seek offset with offset: <-1 * file_size> and whence: SEEK_END
+	/* Test regular cases
 	 */
-	offset = libbfio_handle_seek_offset(
+	result = libbfio_handle_set_read_vector_at_offset_function(
 	          handle,
-	          -1 * file_size,
-	          SEEK_END,
+	          NULL,
 	          &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) 0 );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -3929,16 +8163,15 @@ int bfio_test_handle_seek_offset(
 
 	/* Test error cases
 	 */
-	offset = libbfio_handle_seek_offset(
+	result = libbfio_handle_set_read_vector_at_offset_function(
+	          NULL,
 	          NULL,
-	          0,
-	          SEEK_SET,
 	          &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -3947,106 +8180,168 @@ int bfio_test_handle_seek_offset(
 	libcerror_error_free(
 	 &error );
 
-	io_handle = ( (libbfio_internal_handle_t *) handle )->io_handle;
+#if defined( HAVE_BFIO_TEST_RWLOCK )
 
-	( (libbfio_internal_handle_t *) handle )->io_handle = NULL;
+	/* Test libbfio_handle_set_read_vector_at_offset_function with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	 */
+	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
 
-	offset = libbfio_handle_seek_offset(
+	result = libbfio_handle_set_read_vector_at_offset_function(
 	          handle,
-	          0,
-	          SEEK_SET,
+	          NULL,
 	          &error );
 
-	( (libbfio_internal_handle_t *) handle )->io_handle = io_handle;
+	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libbfio_handle_set_read_vector_at_offset_function with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	 */
+	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
 
-	libcerror_error_free(
-	 &error );
+	result = libbfio_handle_set_read_vector_at_offset_function(
+	          handle,
+	          NULL,
+	          &error );
 
-	seek_offset_function = (intptr_t *) ( (libbfio_internal_handle_t *) handle )->seek_offset;
+	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
 
-	( (libbfio_internal_handle_t *) handle )->seek_offset = NULL;
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
 
-	offset = libbfio_handle_seek_offset(
-	          handle,
-	          0,
-	          SEEK_SET,
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
+
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &handle,
 	          &error );
 
-	( (libbfio_internal_handle_t *) handle )->seek_offset = (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) seek_offset_function;
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	return( 1 );
 
-	/* Test seek offset with offset: -987 and whence: SEEK_SET
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_handle_set_access_hint_function function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_set_access_hint_function(
+     void )
+{
+	libbfio_handle_t *handle = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
 	 */
-	offset = libbfio_handle_seek_offset(
-	          handle,
-	          -987,
-	          SEEK_SET,
+	result = libbfio_handle_initialize(
+	          &handle,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
 	          &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	/* Test seek offset with offset: <1 * (file_size + 542)> and whence: SEEK_END
+	/* Test regular cases
 	 */
-	offset = libbfio_handle_seek_offset(
+	result = libbfio_handle_set_access_hint_function(
 	          handle,
-	          -1 * (file_size + 542),
-	          SEEK_END,
-	          &error );
-
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	          NULL,
+	          &error );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	/* Test seek offset with offset: 0 and whence: UNKNOWN (88)
+	/* Test error cases
 	 */
-	offset = libbfio_handle_seek_offset(
-	          handle,
-	          0,
-	          88,
+	result = libbfio_handle_set_access_hint_function(
+	          NULL,
+	          NULL,
 	          &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -4057,14 +8352,13 @@ int bfio_test_handle_seek_offset(
 
 #if defined( HAVE_BFIO_TEST_RWLOCK )
 
-	/* Test libbfio_handle_seek_offset with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	/* Test libbfio_handle_set_access_hint_function with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
 	 */
 	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
 
-	offset = libbfio_handle_seek_offset(
+	result = libbfio_handle_set_access_hint_function(
 	          handle,
-	          0,
-	          SEEK_SET,
+	          NULL,
 	          &error );
 
 	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
@@ -4073,10 +8367,10 @@ int bfio_test_handle_seek_offset(
 	}
 	else
 	{
-		BFIO_TEST_ASSERT_EQUAL_INT64(
-		 "offset",
-		 offset,
-		 (int64_t) -1 );
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
 
 		BFIO_TEST_ASSERT_IS_NOT_NULL(
 		 "error",
@@ -4085,14 +8379,13 @@ int bfio_test_handle_seek_offset(
 		libcerror_error_free(
 		 &error );
 	}
-	/* Test libbfio_handle_seek_offset with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	/* Test libbfio_handle_set_access_hint_function with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
 	 */
 	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
 
-	offset = libbfio_handle_seek_offset(
+	result = libbfio_handle_set_access_hint_function(
 	          handle,
-	          0,
-	          SEEK_SET,
+	          NULL,
 	          &error );
 
 	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
@@ -4101,10 +8394,10 @@ int bfio_test_handle_seek_offset(
 	}
 	else
 	{
-		BFIO_TEST_ASSERT_EQUAL_INT64(
-		 "offset",
-		 offset,
-		 (int64_t) -1 );
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
 
 		BFIO_TEST_ASSERT_IS_NOT_NULL(
 		 "error",
@@ -4115,61 +8408,10 @@ int bfio_test_handle_seek_offset(
 	}
 #endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
 
-	/* Initialize test
-	 */
-	result = libbfio_handle_initialize(
-	          &closed_handle,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          0,
-	          &error );
-
-	BFIO_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
-	 "closed_handle",
-	 closed_handle );
-
-	BFIO_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	/* Test seek offset on a closed file IO handle
-	 */
-	offset = libbfio_handle_seek_offset(
-	          closed_handle,
-	          0,
-	          SEEK_SET,
-	          &error );
-
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
-
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
 	/* Clean up
 	 */
 	result = libbfio_handle_free(
-	          &closed_handle,
+	          &handle,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -4178,8 +8420,8 @@ int bfio_test_handle_seek_offset(
 	 1 );
 
 	BFIO_TEST_ASSERT_IS_NULL(
-	 "closed_handle",
-	 closed_handle );
+	 "handle",
+	 handle );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -4193,30 +8435,64 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( closed_handle != NULL )
+	if( handle != NULL )
 	{
 		libbfio_handle_free(
-		 &closed_handle,
+		 &handle,
 		 NULL );
 	}
 	return( 0 );
 }
 
-/* Tests the libbfio_handle_exists function
+/* Tests the libbfio_handle_set_access_hint function
  * Returns 1 if successful or 0 if not
  */
-int bfio_test_handle_exists(
+int bfio_test_handle_set_access_hint(
      libbfio_handle_t *handle )
 {
-	libcerror_error_t *error  = NULL;
-	intptr_t *exists_function = NULL;
-	intptr_t *io_handle       = NULL;
-	int result                = 0;
+	libcerror_error_t *error = NULL;
+	intptr_t *io_handle      = NULL;
+	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libbfio_handle_exists(
+	result = libbfio_handle_set_access_hint(
+	          handle,
+	          0,
+	          0,
+	          LIBBFIO_ACCESS_HINT_SEQUENTIAL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_set_access_hint(
+	          handle,
+	          512,
+	          4096,
+	          LIBBFIO_ACCESS_HINT_WILLNEED,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_set_access_hint(
 	          handle,
+	          0,
+	          0,
+	          LIBBFIO_ACCESS_HINT_NORMAL,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -4230,8 +8506,11 @@ int bfio_test_handle_exists(
 
 	/* Test error cases
 	 */
-	result = libbfio_handle_exists(
+	result = libbfio_handle_set_access_hint(
 	          NULL,
+	          0,
+	          0,
+	          LIBBFIO_ACCESS_HINT_SEQUENTIAL,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -4250,8 +8529,11 @@ int bfio_test_handle_exists(
 
 	( (libbfio_internal_handle_t *) handle )->io_handle = NULL;
 
-	result = libbfio_handle_exists(
+	result = libbfio_handle_set_access_hint(
 	          handle,
+	          0,
+	          0,
+	          LIBBFIO_ACCESS_HINT_SEQUENTIAL,
 	          &error );
 
 	( (libbfio_internal_handle_t *) handle )->io_handle = io_handle;
@@ -4268,15 +8550,50 @@ int bfio_test_handle_exists(
 	libcerror_error_free(
 	 &error );
 
-	exists_function = (intptr_t *) ( (libbfio_internal_handle_t *) handle )->exists;
+	result = libbfio_handle_set_access_hint(
+	          handle,
+	          -1,
+	          0,
+	          LIBBFIO_ACCESS_HINT_SEQUENTIAL,
+	          &error );
 
-	( (libbfio_internal_handle_t *) handle )->exists = NULL;
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-	result = libbfio_handle_exists(
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_set_access_hint(
 	          handle,
+	          0,
+	          (size64_t) INT64_MAX + 1,
+	          LIBBFIO_ACCESS_HINT_SEQUENTIAL,
 	          &error );
 
-	( (libbfio_internal_handle_t *) handle )->exists = (int (*)(intptr_t *, libcerror_error_t **)) exists_function;
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_set_access_hint(
+	          handle,
+	          0,
+	          0,
+	          -1,
+	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -4292,12 +8609,15 @@ int bfio_test_handle_exists(
 
 #if defined( HAVE_BFIO_TEST_RWLOCK )
 
-	/* Test libbfio_handle_exists with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
+	/* Test libbfio_handle_set_access_hint with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
 	 */
 	bfio_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
 
-	result = libbfio_handle_exists(
+	result = libbfio_handle_set_access_hint(
 	          handle,
+	          0,
+	          0,
+	          LIBBFIO_ACCESS_HINT_SEQUENTIAL,
 	          &error );
 
 	if( bfio_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
@@ -4318,12 +8638,15 @@ int bfio_test_handle_exists(
 		libcerror_error_free(
 		 &error );
 	}
-	/* Test libbfio_handle_exists with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
+	/* Test libbfio_handle_set_access_hint with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
 	 */
 	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
 
-	result = libbfio_handle_exists(
+	result = libbfio_handle_set_access_hint(
 	          handle,
+	          0,
+	          0,
+	          LIBBFIO_ACCESS_HINT_SEQUENTIAL,
 	          &error );
 
 	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
@@ -4357,21 +8680,68 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libbfio_handle_is_open function
+/* Tests the libbfio_handle_set_data_pointer_functions function
  * Returns 1 if successful or 0 if not
  */
-int bfio_test_handle_is_open(
-     libbfio_handle_t *handle )
+int bfio_test_handle_set_data_pointer_functions(
+     void )
 {
-	libcerror_error_t *error   = NULL;
-	intptr_t *io_handle        = NULL;
-	intptr_t *is_open_function = NULL;
-	int result                 = 0;
+	libbfio_handle_t *handle = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_handle_initialize(
+	          &handle,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbfio_handle_set_data_pointer_functions(
+	          handle,
+	          (int (*)(intptr_t *, off64_t, size_t, const uint8_t **, libcerror_error_t **)) libbfio_memory_range_io_handle_get_data_pointer,
+	          (int (*)(intptr_t *, off64_t, const uint8_t *, libcerror_error_t **)) libbfio_memory_range_io_handle_release_data_pointer,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Test regular cases
-	 */
-	result = libbfio_handle_is_open(
+	result = libbfio_handle_set_data_pointer_functions(
 	          handle,
+	          NULL,
+	          NULL,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -4385,7 +8755,9 @@ int bfio_test_handle_is_open(
 
 	/* Test error cases
 	 */
-	result = libbfio_handle_is_open(
+	result = libbfio_handle_set_data_pointer_functions(
+	          NULL,
+	          NULL,
 	          NULL,
 	          &error );
 
@@ -4401,16 +8773,12 @@ int bfio_test_handle_is_open(
 	libcerror_error_free(
 	 &error );
 
-	io_handle = ( (libbfio_internal_handle_t *) handle )->io_handle;
-
-	( (libbfio_internal_handle_t *) handle )->io_handle = NULL;
-
-	result = libbfio_handle_is_open(
+	result = libbfio_handle_set_data_pointer_functions(
 	          handle,
+	          (int (*)(intptr_t *, off64_t, size_t, const uint8_t **, libcerror_error_t **)) libbfio_memory_range_io_handle_get_data_pointer,
+	          NULL,
 	          &error );
 
-	( (libbfio_internal_handle_t *) handle )->io_handle = io_handle;
-
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -4423,16 +8791,12 @@ int bfio_test_handle_is_open(
 	libcerror_error_free(
 	 &error );
 
-	is_open_function = (intptr_t *) ( (libbfio_internal_handle_t *) handle )->is_open;
-
-	( (libbfio_internal_handle_t *) handle )->is_open = NULL;
-
-	result = libbfio_handle_is_open(
+	result = libbfio_handle_set_data_pointer_functions(
 	          handle,
+	          NULL,
+	          (int (*)(intptr_t *, off64_t, const uint8_t *, libcerror_error_t **)) libbfio_memory_range_io_handle_release_data_pointer,
 	          &error );
 
-	( (libbfio_internal_handle_t *) handle )->is_open = (int (*)(intptr_t *, libcerror_error_t **)) is_open_function;
-
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -4447,17 +8811,19 @@ int bfio_test_handle_is_open(
 
 #if defined( HAVE_BFIO_TEST_RWLOCK )
 
-	/* Test libbfio_handle_is_open with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
+	/* Test libbfio_handle_set_data_pointer_functions with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
 	 */
-	bfio_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
+	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
 
-	result = libbfio_handle_is_open(
+	result = libbfio_handle_set_data_pointer_functions(
 	          handle,
+	          NULL,
+	          NULL,
 	          &error );
 
-	if( bfio_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
+	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
 	{
-		bfio_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
+		bfio_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
 	}
 	else
 	{
@@ -4473,12 +8839,14 @@ int bfio_test_handle_is_open(
 		libcerror_error_free(
 		 &error );
 	}
-	/* Test libbfio_handle_is_open with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
+	/* Test libbfio_handle_set_data_pointer_functions with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
 	 */
 	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
 
-	result = libbfio_handle_is_open(
+	result = libbfio_handle_set_data_pointer_functions(
 	          handle,
+	          NULL,
+	          NULL,
 	          &error );
 
 	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
@@ -4501,6 +8869,25 @@ int bfio_test_handle_is_open(
 	}
 #endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
 
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -4509,40 +8896,55 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libbfio_handle_get_io_handle function
+/* Tests the libbfio_handle_get_data_pointer function
  * Returns 1 if successful or 0 if not
  */
-int bfio_test_handle_get_io_handle(
+int bfio_test_handle_get_data_pointer(
      libbfio_handle_t *handle )
 {
+	const uint8_t *data      = NULL;
 	libcerror_error_t *error = NULL;
 	intptr_t *io_handle      = NULL;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libbfio_handle_get_io_handle(
+	result = libbfio_handle_get_data_pointer(
 	          handle,
-	          &io_handle,
+	          0,
+	          16,
+	          &data,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "data",
+	 data );
+
 	/* Test error cases
 	 */
-	result = libbfio_handle_get_io_handle(
+	result = libbfio_handle_get_data_pointer(
 	          NULL,
-	          &io_handle,
+	          0,
+	          16,
+	          &data,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -4557,8 +8959,73 @@ int bfio_test_handle_get_io_handle(
 	libcerror_error_free(
 	 &error );
 
-	result = libbfio_handle_get_io_handle(
+	io_handle = ( (libbfio_internal_handle_t *) handle )->io_handle;
+
+	( (libbfio_internal_handle_t *) handle )->io_handle = NULL;
+
+	result = libbfio_handle_get_data_pointer(
+	          handle,
+	          0,
+	          16,
+	          &data,
+	          &error );
+
+	( (libbfio_internal_handle_t *) handle )->io_handle = io_handle;
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_get_data_pointer(
+	          handle,
+	          -1,
+	          16,
+	          &data,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_get_data_pointer(
+	          handle,
+	          0,
+	          (size_t) SSIZE_MAX + 1,
+	          &data,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_get_data_pointer(
 	          handle,
+	          0,
+	          16,
 	          NULL,
 	          &error );
 
@@ -4576,13 +9043,15 @@ int bfio_test_handle_get_io_handle(
 
 #if defined( HAVE_BFIO_TEST_RWLOCK )
 
-	/* Test libbfio_handle_get_io_handle with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
+	/* Test libbfio_handle_get_data_pointer with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
 	 */
 	bfio_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
 
-	result = libbfio_handle_get_io_handle(
+	result = libbfio_handle_get_data_pointer(
 	          handle,
-	          &io_handle,
+	          0,
+	          16,
+	          &data,
 	          &error );
 
 	if( bfio_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
@@ -4603,13 +9072,15 @@ int bfio_test_handle_get_io_handle(
 		libcerror_error_free(
 		 &error );
 	}
-	/* Test libbfio_handle_get_io_handle with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
+	/* Test libbfio_handle_get_data_pointer with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
 	 */
 	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
 
-	result = libbfio_handle_get_io_handle(
+	result = libbfio_handle_get_data_pointer(
 	          handle,
-	          &io_handle,
+	          0,
+	          16,
+	          &data,
 	          &error );
 
 	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
@@ -4643,39 +9114,50 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libbfio_handle_get_access_flags function
+/* Tests the libbfio_handle_release_data_pointer function
  * Returns 1 if successful or 0 if not
  */
-int bfio_test_handle_get_access_flags(
+int bfio_test_handle_release_data_pointer(
      libbfio_handle_t *handle )
 {
+	uint8_t data[ 16 ];
+
 	libcerror_error_t *error = NULL;
-	int access_flags         = 0;
+	intptr_t *io_handle      = NULL;
 	int result               = 0;
 
-	/* Test regular cases
+	/* Test error cases
 	 */
-	result = libbfio_handle_get_access_flags(
-	          handle,
-	          &access_flags,
+	result = libbfio_handle_release_data_pointer(
+	          NULL,
+	          0,
+	          data,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	BFIO_TEST_ASSERT_IS_NULL(
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libbfio_handle_get_access_flags(
-	          NULL,
-	          &access_flags,
+	libcerror_error_free(
+	 &error );
+
+	io_handle = ( (libbfio_internal_handle_t *) handle )->io_handle;
+
+	( (libbfio_internal_handle_t *) handle )->io_handle = NULL;
+
+	result = libbfio_handle_release_data_pointer(
+	          handle,
+	          0,
+	          data,
 	          &error );
 
+	( (libbfio_internal_handle_t *) handle )->io_handle = io_handle;
+
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -4688,9 +9170,10 @@ int bfio_test_handle_get_access_flags(
 	libcerror_error_free(
 	 &error );
 
-	result = libbfio_handle_get_access_flags(
+	result = libbfio_handle_release_data_pointer(
 	          handle,
-	          NULL,
+	          -1,
+	          data,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -4705,63 +9188,43 @@ int bfio_test_handle_get_access_flags(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_BFIO_TEST_RWLOCK )
-
-	/* Test libbfio_handle_get_access_flags with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
-	 */
-	bfio_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
-
-	result = libbfio_handle_get_access_flags(
+	result = libbfio_handle_release_data_pointer(
 	          handle,
-	          &access_flags,
+	          0,
+	          NULL,
 	          &error );
 
-	if( bfio_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
-	{
-		bfio_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		BFIO_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		BFIO_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libbfio_handle_get_access_flags with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
-	 */
-	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+	libcerror_error_free(
+	 &error );
 
-	result = libbfio_handle_get_access_flags(
+	/* Test release data pointer without a release data pointer function
+	 */
+	result = libbfio_handle_release_data_pointer(
 	          handle,
-	          &access_flags,
+	          0,
+	          data,
 	          &error );
 
-	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
-	{
-		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		BFIO_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		BFIO_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
+	libcerror_error_free(
+	 &error );
 
 	return( 1 );
 
@@ -4774,10 +9237,10 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libbfio_handle_set_access_flags function
+/* Tests the libbfio_handle_set_descriptor_functions function
  * Returns 1 if successful or 0 if not
  */
-int bfio_test_handle_set_access_flags(
+int bfio_test_handle_set_descriptor_functions(
      void )
 {
 	libbfio_handle_t *handle = NULL;
@@ -4817,9 +9280,11 @@ int bfio_test_handle_set_access_flags(
 
 	/* Test regular cases
 	 */
-	result = libbfio_handle_set_access_flags(
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ )
+	result = libbfio_handle_set_descriptor_functions(
 	          handle,
-	          LIBBFIO_OPEN_READ,
+	          (int (*)(intptr_t *, int *, off64_t *, libcerror_error_t **)) libbfio_file_io_handle_get_descriptor,
+	          NULL,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -4831,28 +9296,29 @@ int bfio_test_handle_set_access_flags(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libbfio_handle_set_access_flags(
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ ) */
+
+	result = libbfio_handle_set_descriptor_functions(
+	          handle,
+	          NULL,
 	          NULL,
-	          LIBBFIO_OPEN_READ,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libbfio_handle_set_access_flags(
-	          handle,
-	          0,
+	/* Test error cases
+	 */
+	result = libbfio_handle_set_descriptor_functions(
+	          NULL,
+	          NULL,
+	          NULL,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -4869,13 +9335,14 @@ int bfio_test_handle_set_access_flags(
 
 #if defined( HAVE_BFIO_TEST_RWLOCK )
 
-	/* Test libbfio_handle_set_access_flags with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	/* Test libbfio_handle_set_descriptor_functions with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
 	 */
 	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
 
-	result = libbfio_handle_set_access_flags(
+	result = libbfio_handle_set_descriptor_functions(
 	          handle,
-	          LIBBFIO_OPEN_READ,
+	          NULL,
+	          NULL,
 	          &error );
 
 	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
@@ -4896,13 +9363,14 @@ int bfio_test_handle_set_access_flags(
 		libcerror_error_free(
 		 &error );
 	}
-	/* Test libbfio_handle_set_access_flags with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	/* Test libbfio_handle_set_descriptor_functions with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
 	 */
 	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
 
-	result = libbfio_handle_set_access_flags(
+	result = libbfio_handle_set_descriptor_functions(
 	          handle,
-	          LIBBFIO_OPEN_READ,
+	          NULL,
+	          NULL,
 	          &error );
 
 	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
@@ -4961,21 +9429,35 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libbfio_handle_get_offset function
+/* Tests the libbfio_handle_copy_range function
  * Returns 1 if successful or 0 if not
  */
-int bfio_test_handle_get_offset(
-     libbfio_handle_t *handle )
+int bfio_test_handle_copy_range(
+     const system_character_t *source )
 {
-	libcerror_error_t *error = NULL;
-	off64_t offset           = 0;
-	int result               = 0;
+	char narrow_temporary_filename[ 17 ] = {
+		'b', 'f', 'i', 'o', '_', 't', 'e', 's', 't', '_', 'X', 'X', 'X', 'X', 'X', 'X', 0 };
 
-	/* Test regular cases
+	uint8_t copy_data[ 256 ];
+	uint8_t expected_data[ 256 ];
+	uint8_t memory_range_data[ 256 ];
+
+	libbfio_handle_t *destination_handle = NULL;
+	libbfio_handle_t *file_handle        = NULL;
+	libbfio_handle_t *same_file_handle   = NULL;
+	libbfio_handle_t *source_handle      = NULL;
+	libcerror_error_t *error             = NULL;
+	size64_t size                        = 0;
+	ssize_t copy_count                   = 0;
+	ssize_t read_count                   = 0;
+	int result                           = 0;
+	int with_temporary_file              = 0;
+
+	/* Initialize test
 	 */
-	result = libbfio_handle_get_offset(
-	          handle,
-	          &offset,
+	result = bfio_test_handle_open_source(
+	          &source_handle,
+	          source,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -4983,338 +9465,629 @@ int bfio_test_handle_get_offset(
 	 result,
 	 1 );
 
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "source_handle",
+	 source_handle );
+
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libbfio_handle_get_offset(
-	          NULL,
-	          &offset,
+	result = libbfio_handle_get_size(
+	          source_handle,
+	          &size,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( size < 4096 )
+	{
+		result = bfio_test_handle_close_source(
+		          &source_handle,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		return( 1 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              source_handle,
+	              expected_data,
+	              256,
+	              1024,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 256 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_initialize(
+	          &destination_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_handle",
+	 destination_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = libbfio_memory_range_set(
+	          destination_handle,
+	          memory_range_data,
+	          256,
+	          &error );
 
-	result = libbfio_handle_get_offset(
-	          handle,
-	          NULL,
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          destination_handle,
+	          LIBBFIO_OPEN_READ_WRITE,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( memory_set(
+	     memory_range_data,
+	     0,
+	     256 ) == NULL )
+	{
+		goto on_error;
+	}
+	/* Test regular cases
+	 */
+	copy_count = libbfio_handle_copy_range(
+	              source_handle,
+	              1024,
+	              destination_handle,
+	              0,
+	              256,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "copy_count",
+	 copy_count,
+	 (ssize_t) 256 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          memory_range_data,
+	          expected_data,
+	          256 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test copying more data than the destination can hold
+	 */
+	copy_count = libbfio_handle_copy_range(
+	              source_handle,
+	              1024,
+	              destination_handle,
+	              128,
+	              256,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "copy_count",
+	 copy_count,
+	 (ssize_t) 128 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          &( memory_range_data[ 128 ] ),
+	          expected_data,
+	          128 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test copying within a memory range
+	 */
+	copy_count = libbfio_handle_copy_range(
+	              destination_handle,
+	              128,
+	              destination_handle,
+	              0,
+	              128,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "copy_count",
+	 copy_count,
+	 (ssize_t) 128 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          memory_range_data,
+	          expected_data,
+	          128 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test copying from beyond the end of the source
+	 */
+	copy_count = libbfio_handle_copy_range(
+	              source_handle,
+	              (off64_t) size,
+	              destination_handle,
+	              0,
+	              256,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "copy_count",
+	 copy_count,
+	 (ssize_t) 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test copying from a file to a file
+	 */
+	result = bfio_test_get_temporary_filename(
+	          narrow_temporary_filename,
+	          17,
 	          &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+	BFIO_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	with_temporary_file = result;
+
+	if( with_temporary_file != 0 )
+	{
+		result = libbfio_file_initialize(
+		          &file_handle,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "file_handle",
+		 file_handle );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_file_set_name(
+		          file_handle,
+		          narrow_temporary_filename,
+		          16,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_handle_open(
+		          file_handle,
+		          LIBBFIO_OPEN_READ_WRITE,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		copy_count = libbfio_handle_copy_range(
+		              source_handle,
+		              1024,
+		              file_handle,
+		              512,
+		              256,
+		              &error );
+
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "copy_count",
+		 copy_count,
+		 (ssize_t) 256 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_handle_get_size(
+		          file_handle,
+		          &size,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_EQUAL_UINT64(
+		 "size",
+		 size,
+		 (uint64_t) 768 );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	libcerror_error_free(
-	 &error );
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_handle,
+		              copy_data,
+		              256,
+		              512,
+		              &error );
 
-#if defined( HAVE_BFIO_TEST_RWLOCK )
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 256 );
 
-	/* Test libbfio_handle_get_offset with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
-	 */
-	bfio_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	result = libbfio_handle_get_offset(
-	          handle,
-	          &offset,
-	          &error );
+		result = memory_compare(
+		          copy_data,
+		          expected_data,
+		          256 );
 
-	if( bfio_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
-	{
-		bfio_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
-	}
-	else
-	{
 		BFIO_TEST_ASSERT_EQUAL_INT(
 		 "result",
 		 result,
-		 -1 );
+		 0 );
 
-		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		/* Test copying from a memory range to a file
+		 */
+		copy_count = libbfio_handle_copy_range(
+		              destination_handle,
+		              0,
+		              file_handle,
+		              0,
+		              128,
+		              &error );
+
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "copy_count",
+		 copy_count,
+		 (ssize_t) 128 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
 		 "error",
 		 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libbfio_handle_get_offset with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
-	 */
-	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_handle,
+		              copy_data,
+		              128,
+		              0,
+		              &error );
 
-	result = libbfio_handle_get_offset(
-	          handle,
-	          &offset,
-	          &error );
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 128 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          copy_data,
+		          expected_data,
+		          128 );
 
-	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
-	{
-		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
-	}
-	else
-	{
 		BFIO_TEST_ASSERT_EQUAL_INT(
 		 "result",
 		 result,
-		 -1 );
+		 0 );
+
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ ) && defined( HAVE_FSTAT )
+
+		/* Test copying between different handles of the same file
+		 */
+		result = libbfio_handle_clone(
+		          &same_file_handle,
+		          file_handle,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
 		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "same_file_handle",
+		 same_file_handle );
+
+		BFIO_TEST_ASSERT_IS_NULL(
 		 "error",
 		 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
+		copy_count = libbfio_handle_copy_range(
+		              file_handle,
+		              512,
+		              same_file_handle,
+		              768,
+		              128,
+		              &error );
 
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "copy_count",
+		 copy_count,
+		 (ssize_t) 128 );
 
-/* Tests the libbfio_handle_get_size function
- * Returns 1 if successful or 0 if not
- */
-int bfio_test_handle_get_size(
-     libbfio_handle_t *handle )
-{
-	libcerror_error_t *error = NULL;
-	intptr_t *io_handle      = NULL;
-	size64_t size            = 0;
-	int result               = 0;
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	/* Test regular cases
-	 */
-	result = libbfio_handle_get_size(
-	          handle,
-	          &size,
-	          &error );
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_handle,
+		              copy_data,
+		              128,
+		              768,
+		              &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 128 );
 
-	BFIO_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	/* Test error cases
-	 */
-	result = libbfio_handle_get_size(
-	          NULL,
-	          &size,
-	          &error );
+		result = memory_compare(
+		          copy_data,
+		          expected_data,
+		          128 );
 
-	BFIO_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+		/* Test copying overlapping ranges between different handles of the same file
+		 */
+		copy_count = libbfio_handle_copy_range(
+		              file_handle,
+		              512,
+		              same_file_handle,
+		              576,
+		              128,
+		              &error );
 
-	libcerror_error_free(
-	 &error );
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "copy_count",
+		 copy_count,
+		 (ssize_t) -1 );
 
-	io_handle = ( (libbfio_internal_handle_t *) handle )->io_handle;
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
 
-	( (libbfio_internal_handle_t *) handle )->io_handle = NULL;
+		libcerror_error_free(
+		 &error );
 
-	result = libbfio_handle_get_size(
-	          handle,
-	          &size,
-	          &error );
+		result = libbfio_handle_close(
+		          same_file_handle,
+		          &error );
 
-	( (libbfio_internal_handle_t *) handle )->io_handle = io_handle;
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
 
-	BFIO_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+		result = libbfio_handle_free(
+		          &same_file_handle,
+		          &error );
 
-	libcerror_error_free(
-	 &error );
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	result = libbfio_handle_get_size(
-	          handle,
-	          NULL,
-	          &error );
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "same_file_handle",
+		 same_file_handle );
 
-	BFIO_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_POSITIONAL_READ ) && defined( HAVE_FSTAT ) */
 
-	libcerror_error_free(
-	 &error );
+		/* Clean up
+		 */
+		result = libbfio_handle_close(
+		          file_handle,
+		          &error );
 
-#if defined( HAVE_BFIO_TEST_RWLOCK )
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
 
-	/* Test libbfio_handle_get_size with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
-	 */
-	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	result = libbfio_handle_get_size(
-	          handle,
-	          &size,
-	          &error );
+		result = libbfio_handle_free(
+		          &file_handle,
+		          &error );
 
-	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
-	{
-		bfio_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
-	}
-	else
-	{
 		BFIO_TEST_ASSERT_EQUAL_INT(
 		 "result",
 		 result,
-		 -1 );
+		 1 );
 
-		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "file_handle",
+		 file_handle );
+
+		BFIO_TEST_ASSERT_IS_NULL(
 		 "error",
 		 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libbfio_handle_get_size with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
-	 */
-	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
-
-	result = libbfio_handle_get_size(
-	          handle,
-	          &size,
-	          &error );
+		result = bfio_test_remove_temporary_file(
+		          narrow_temporary_filename,
+		          &error );
 
-	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
-	{
-		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		BFIO_TEST_ASSERT_EQUAL_INT(
+		BFIO_TEST_ASSERT_NOT_EQUAL_INT(
 		 "result",
 		 result,
 		 -1 );
 
-		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		BFIO_TEST_ASSERT_IS_NULL(
 		 "error",
 		 error );
 
-		libcerror_error_free(
-		 &error );
+		with_temporary_file = 0;
 	}
-#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
+	/* Test error cases
+	 */
+	copy_count = libbfio_handle_copy_range(
+	              NULL,
+	              0,
+	              destination_handle,
+	              0,
+	              256,
+	              &error );
 
-	return( 1 );
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "copy_count",
+	 copy_count,
+	 (ssize_t) -1 );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-/* Tests the libbfio_handle_set_open_on_demand function
- * Returns 1 if successful or 0 if not
- */
-int bfio_test_handle_set_open_on_demand(
-     void )
-{
-	libbfio_handle_t *handle = NULL;
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	libcerror_error_free(
+	 &error );
 
-	/* Initialize test
-	 */
-	result = libbfio_handle_initialize(
-	          &handle,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          0,
-	          &error );
+	copy_count = libbfio_handle_copy_range(
+	              source_handle,
+	              -1,
+	              destination_handle,
+	              0,
+	              256,
+	              &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "copy_count",
+	 copy_count,
+	 (ssize_t) -1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
-	 "handle",
-	 handle );
-
-	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	result = libbfio_handle_set_open_on_demand(
-	          handle,
-	          1,
-	          &error );
+	libcerror_error_free(
+	 &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	copy_count = libbfio_handle_copy_range(
+	              source_handle,
+	              0,
+	              NULL,
+	              0,
+	              256,
+	              &error );
 
-	BFIO_TEST_ASSERT_IS_NULL(
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "copy_count",
+	 copy_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libbfio_handle_set_open_on_demand(
-	          NULL,
-	          1,
-	          &error );
+	libcerror_error_free(
+	 &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+	copy_count = libbfio_handle_copy_range(
+	              source_handle,
+	              0,
+	              destination_handle,
+	              -1,
+	              256,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "copy_count",
+	 copy_count,
+	 (ssize_t) -1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -5323,68 +10096,65 @@ int bfio_test_handle_set_open_on_demand(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_BFIO_TEST_RWLOCK )
-
-	/* Test libbfio_handle_set_open_on_demand with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
-	 */
-	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+	copy_count = libbfio_handle_copy_range(
+	              source_handle,
+	              0,
+	              destination_handle,
+	              0,
+	              (size_t) SSIZE_MAX + 1,
+	              &error );
 
-	result = libbfio_handle_set_open_on_demand(
-	          handle,
-	          1,
-	          &error );
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "copy_count",
+	 copy_count,
+	 (ssize_t) -1 );
 
-	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
-	{
-		bfio_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		BFIO_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		BFIO_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	libcerror_error_free(
+	 &error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libbfio_handle_set_open_on_demand with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	/* Test copying overlapping ranges within the same handle
 	 */
-	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
-
-	result = libbfio_handle_set_open_on_demand(
-	          handle,
-	          1,
-	          &error );
+	copy_count = libbfio_handle_copy_range(
+	              destination_handle,
+	              0,
+	              destination_handle,
+	              16,
+	              64,
+	              &error );
 
-	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
-	{
-		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		BFIO_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "copy_count",
+	 copy_count,
+	 (ssize_t) -1 );
 
-		BFIO_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
+	libcerror_error_free(
+	 &error );
 
 	/* Clean up
 	 */
+	result = libbfio_handle_close(
+	          destination_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libbfio_handle_free(
-	          &handle,
+	          &destination_handle,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -5393,8 +10163,25 @@ int bfio_test_handle_set_open_on_demand(
 	 1 );
 
 	BFIO_TEST_ASSERT_IS_NULL(
-	 "handle",
-	 handle );
+	 "destination_handle",
+	 destination_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = bfio_test_handle_close_source(
+	          &source_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "source_handle",
+	 source_handle );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -5408,30 +10195,86 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( handle != NULL )
+	if( same_file_handle != NULL )
 	{
 		libbfio_handle_free(
-		 &handle,
+		 &same_file_handle,
+		 NULL );
+	}
+	if( file_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_handle,
+		 NULL );
+	}
+	if( with_temporary_file != 0 )
+	{
+		bfio_test_remove_temporary_file(
+		 narrow_temporary_filename,
+		 NULL );
+	}
+	if( destination_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &destination_handle,
+		 NULL );
+	}
+	if( source_handle != NULL )
+	{
+		bfio_test_handle_close_source(
+		 &source_handle,
 		 NULL );
 	}
 	return( 0 );
 }
 
-/* Tests the libbfio_handle_get_number_of_offsets_read functions
- * Returns 1 if successful or 0 if not
- */
-int bfio_test_handle_get_number_of_offsets_read(
-     libbfio_handle_t *handle )
-{
-	libcerror_error_t *error   = NULL;
-	int number_of_offsets_read = 0;
-	int result                 = 0;
+/* Tests the libbfio_handle_set_extent_function function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_set_extent_function(
+     void )
+{
+	libbfio_handle_t *handle = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_handle_initialize(
+	          &handle,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test regular cases
 	 */
-	result = libbfio_handle_get_number_of_offsets_read(
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_EXTENTS )
+	result = libbfio_handle_set_extent_function(
 	          handle,
-	          &number_of_offsets_read,
+	          (int (*)(intptr_t *, off64_t, size64_t, size64_t *, uint32_t *, libcerror_error_t **)) libbfio_file_io_handle_get_extent,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -5439,36 +10282,30 @@ int bfio_test_handle_get_number_of_offsets_read(
 	 result,
 	 1 );
 
-	BFIO_TEST_ASSERT_NOT_EQUAL_INT(
-	 "number_of_offsets_read",
-	 number_of_offsets_read,
-	 0 );
-
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libbfio_handle_get_number_of_offsets_read(
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_EXTENTS ) */
+
+	result = libbfio_handle_set_extent_function(
+	          handle,
 	          NULL,
-	          &number_of_offsets_read,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libbfio_handle_get_number_of_offsets_read(
-	          handle,
+	/* Test error cases
+	 */
+	result = libbfio_handle_set_extent_function(
+	          NULL,
 	          NULL,
 	          &error );
 
@@ -5486,18 +10323,18 @@ int bfio_test_handle_get_number_of_offsets_read(
 
 #if defined( HAVE_BFIO_TEST_RWLOCK )
 
-	/* Test libbfio_handle_get_number_of_offsets_read with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
+	/* Test libbfio_handle_set_extent_function with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
 	 */
-	bfio_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
+	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
 
-	result = libbfio_handle_get_number_of_offsets_read(
+	result = libbfio_handle_set_extent_function(
 	          handle,
-	          &number_of_offsets_read,
+	          NULL,
 	          &error );
 
-	if( bfio_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
+	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
 	{
-		bfio_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
+		bfio_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
 	}
 	else
 	{
@@ -5513,13 +10350,13 @@ int bfio_test_handle_get_number_of_offsets_read(
 		libcerror_error_free(
 		 &error );
 	}
-	/* Test libbfio_handle_get_number_of_offsets_read with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
+	/* Test libbfio_handle_set_extent_function with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
 	 */
 	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
 
-	result = libbfio_handle_get_number_of_offsets_read(
+	result = libbfio_handle_set_extent_function(
 	          handle,
-	          &number_of_offsets_read,
+	          NULL,
 	          &error );
 
 	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
@@ -5542,6 +10379,25 @@ int bfio_test_handle_get_number_of_offsets_read(
 	}
 #endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
 
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -5550,27 +10406,48 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libbfio_handle_get_offset_read functions
+/* Tests the libbfio_handle_get_extent_at_offset function
  * Returns 1 if successful or 0 if not
  */
-int bfio_test_handle_get_offset_read(
-     libbfio_handle_t *handle )
+int bfio_test_handle_get_extent_at_offset(
+     void )
 {
-	libcerror_error_t *error = NULL;
-	size64_t size            = 0;
-	off64_t offset           = 0;
-	int result               = 0;
+	char narrow_temporary_filename[ 17 ] = {
+		'b', 'f', 'i', 'o', '_', 't', 'e', 's', 't', '_', 'X', 'X', 'X', 'X', 'X', 'X', 0 };
 
-	/* Test regular cases
+	uint8_t data[ 512 ];
+
+	libbfio_handle_t *file_handle = NULL;
+	libbfio_handle_t *handle      = NULL;
+	libcerror_error_t *error      = NULL;
+	size64_t extent_size          = 0;
+	size64_t extents_size         = 0;
+	ssize_t write_count           = 0;
+	off64_t extent_offset         = 0;
+	uint32_t extent_flags         = 0;
+	int result                    = 0;
+	int with_temporary_file       = 0;
+
+	/* Initialize test
 	 */
-	result = libbfio_handle_get_offset_read(
-	          handle,
-	          0,
-	          &offset,
-	          &size,
+	if( memory_set(
+	     data,
+	     'A',
+	     512 ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libbfio_memory_range_initialize(
+	          &handle,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -5578,223 +10455,333 @@ int bfio_test_handle_get_offset_read(
 	 result,
 	 1 );
 
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libbfio_handle_get_offset_read(
-	          NULL,
-	          0,
-	          &offset,
-	          &size,
+	result = libbfio_memory_range_set(
+	          handle,
+	          data,
+	          512,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libbfio_handle_get_offset_read(
+	result = libbfio_handle_open(
 	          handle,
-	          -1,
-	          &offset,
-	          &size,
+	          LIBBFIO_OPEN_READ,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libbfio_handle_get_offset_read(
+	/* Test regular cases
+	 */
+	result = libbfio_handle_get_extent_at_offset(
 	          handle,
-	          0,
-	          NULL,
-	          &size,
+	          128,
+	          &extent_size,
+	          &extent_flags,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "extent_size",
+	 (uint64_t) extent_size,
+	 (uint64_t) 384 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT32(
+	 "extent_flags",
+	 extent_flags,
+	 (uint32_t) 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libbfio_handle_get_offset_read(
+	/* Test retrieving an extent at the end of the data
+	 */
+	result = libbfio_handle_get_extent_at_offset(
 	          handle,
-	          0,
-	          &offset,
-	          NULL,
+	          512,
+	          &extent_size,
+	          &extent_flags,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test retrieving the extents of a sparse file
+	 */
+	result = bfio_test_get_temporary_filename(
+	          narrow_temporary_filename,
+	          17,
+	          &error );
+
+	BFIO_TEST_ASSERT_NOT_EQUAL_INT(
 	 "result",
 	 result,
 	 -1 );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	with_temporary_file = result;
+
+	if( with_temporary_file != 0 )
+	{
+		result = libbfio_file_initialize(
+		          &file_handle,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "file_handle",
+		 file_handle );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_file_set_name(
+		          file_handle,
+		          narrow_temporary_filename,
+		          16,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_handle_open(
+		          file_handle,
+		          LIBBFIO_OPEN_READ_WRITE,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Writing past the end of the file leaves a hole before the data
+		 * on file systems that support sparse files
+		 */
+		write_count = libbfio_handle_write_buffer_at_offset(
+		               file_handle,
+		               data,
+		               512,
+		               1024 * 1024,
+		               &error );
+
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) 512 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		extent_offset = 0;
+		extents_size  = 0;
+
+		do
+		{
+			result = libbfio_handle_get_extent_at_offset(
+			          file_handle,
+			          extent_offset,
+			          &extent_size,
+			          &extent_flags,
+			          &error );
+
+			BFIO_TEST_ASSERT_NOT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			BFIO_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			if( result != 0 )
+			{
+				BFIO_TEST_ASSERT_NOT_EQUAL_INT64(
+				 "extent_size",
+				 (int64_t) extent_size,
+				 (int64_t) 0 );
+
+				extent_offset += (off64_t) extent_size;
+				extents_size  += extent_size;
+			}
+		}
+		while( result != 0 );
+
+		BFIO_TEST_ASSERT_EQUAL_UINT64(
+		 "extents_size",
+		 (uint64_t) extents_size,
+		 (uint64_t) ( 1024 * 1024 + 512 ) );
+
+		/* The data written is never reported as a hole
+		 */
+		result = libbfio_handle_get_extent_at_offset(
+		          file_handle,
+		          1024 * 1024,
+		          &extent_size,
+		          &extent_flags,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_EQUAL_UINT64(
+		 "extent_size",
+		 (uint64_t) extent_size,
+		 (uint64_t) 512 );
 
-#if defined( HAVE_BFIO_TEST_RWLOCK )
+		BFIO_TEST_ASSERT_EQUAL_UINT32(
+		 "extent_flags",
+		 extent_flags,
+		 (uint32_t) 0 );
 
-	/* Test libbfio_handle_get_offset_read with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
-	 */
-	bfio_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	result = libbfio_handle_get_offset_read(
-	          handle,
-	          0,
-	          &offset,
-	          &size,
-	          &error );
+		/* Clean up
+		 */
+		result = libbfio_handle_close(
+		          file_handle,
+		          &error );
 
-	if( bfio_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
-	{
-		bfio_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
-	}
-	else
-	{
 		BFIO_TEST_ASSERT_EQUAL_INT(
 		 "result",
 		 result,
-		 -1 );
+		 0 );
 
-		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		BFIO_TEST_ASSERT_IS_NULL(
 		 "error",
 		 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libbfio_handle_get_offset_read with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
-	 */
-	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
-
-	result = libbfio_handle_get_offset_read(
-	          handle,
-	          0,
-	          &offset,
-	          &size,
-	          &error );
+		result = libbfio_handle_free(
+		          &file_handle,
+		          &error );
 
-	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
-	{
-		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
-	}
-	else
-	{
 		BFIO_TEST_ASSERT_EQUAL_INT(
 		 "result",
 		 result,
-		 -1 );
+		 1 );
 
-		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "file_handle",
+		 file_handle );
+
+		BFIO_TEST_ASSERT_IS_NULL(
 		 "error",
 		 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
-
-	return( 1 );
+		result = bfio_test_remove_temporary_file(
+		          narrow_temporary_filename,
+		          &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+		BFIO_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
 
-/* Tests the libbfio_handle_set_track_offsets_read function
- * Returns 1 if successful or 0 if not
- */
-int bfio_test_handle_set_track_offsets_read(
-     void )
-{
-	libbfio_handle_t *handle = NULL;
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	/* Initialize test
+		with_temporary_file = 0;
+	}
+	/* Test error cases
 	 */
-	result = libbfio_handle_initialize(
-	          &handle,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
+	result = libbfio_handle_get_extent_at_offset(
 	          NULL,
 	          0,
+	          &extent_size,
+	          &extent_flags,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
-	 "handle",
-	 handle );
-
-	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	result = libbfio_handle_set_track_offsets_read(
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_get_extent_at_offset(
 	          handle,
-	          1,
+	          -1,
+	          &extent_size,
+	          &extent_flags,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	BFIO_TEST_ASSERT_IS_NULL(
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libbfio_handle_set_track_offsets_read(
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_get_extent_at_offset(
+	          handle,
+	          0,
 	          NULL,
-	          1,
+	          &extent_flags,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -5809,66 +10796,40 @@ int bfio_test_handle_set_track_offsets_read(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_BFIO_TEST_RWLOCK )
-
-	/* Test libbfio_handle_set_track_offsets_read with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
-	 */
-	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
-
-	result = libbfio_handle_set_track_offsets_read(
+	result = libbfio_handle_get_extent_at_offset(
 	          handle,
-	          1,
+	          0,
+	          &extent_size,
+	          NULL,
 	          &error );
 
-	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
-	{
-		bfio_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		BFIO_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		BFIO_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libbfio_handle_set_track_offsets_read with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
-	 */
-	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+	libcerror_error_free(
+	 &error );
 
-	result = libbfio_handle_set_track_offsets_read(
+	/* Clean up
+	 */
+	result = libbfio_handle_close(
 	          handle,
-	          1,
 	          &error );
 
-	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
-	{
-		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		BFIO_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		BFIO_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Clean up
-	 */
 	result = libbfio_handle_free(
 	          &handle,
 	          &error );
@@ -5894,6 +10855,18 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( file_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_handle,
+		 NULL );
+	}
+	if( with_temporary_file != 0 )
+	{
+		bfio_test_remove_temporary_file(
+		 narrow_temporary_filename,
+		 NULL );
+	}
 	if( handle != NULL )
 	{
 		libbfio_handle_free(
@@ -5982,6 +10955,46 @@ int main(
 	 "libbfio_handle_set_track_offsets_read",
 	 bfio_test_handle_set_track_offsets_read );
 
+	BFIO_TEST_RUN(
+	 "libbfio_handle_set_maximum_readahead_size",
+	 bfio_test_handle_set_maximum_readahead_size );
+
+	BFIO_TEST_RUN(
+	 "libbfio_handle_set_prefetch",
+	 bfio_test_handle_set_prefetch );
+
+	BFIO_TEST_RUN(
+	 "libbfio_handle_set_read_at_offset_function",
+	 bfio_test_handle_set_read_at_offset_function );
+
+	BFIO_TEST_RUN(
+	 "libbfio_handle_set_write_at_offset_function",
+	 bfio_test_handle_set_write_at_offset_function );
+
+	BFIO_TEST_RUN(
+	 "libbfio_handle_set_read_vector_at_offset_function",
+	 bfio_test_handle_set_read_vector_at_offset_function );
+
+	BFIO_TEST_RUN(
+	 "libbfio_handle_set_access_hint_function",
+	 bfio_test_handle_set_access_hint_function );
+
+	BFIO_TEST_RUN(
+	 "libbfio_handle_set_data_pointer_functions",
+	 bfio_test_handle_set_data_pointer_functions );
+
+	BFIO_TEST_RUN(
+	 "libbfio_handle_set_descriptor_functions",
+	 bfio_test_handle_set_descriptor_functions );
+
+	BFIO_TEST_RUN(
+	 "libbfio_handle_set_extent_function",
+	 bfio_test_handle_set_extent_function );
+
+	BFIO_TEST_RUN(
+	 "libbfio_handle_get_extent_at_offset",
+	 bfio_test_handle_get_extent_at_offset );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 	if( source != NULL )
 	{
@@ -5999,6 +11012,11 @@ int main(
 		 "libbfio_handle_close",
 		 bfio_test_handle_close );
 
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_handle_copy_range",
+		 bfio_test_handle_copy_range,
+		 source );
+
 		/* Initialize test
 		 */
 		result = bfio_test_handle_open_source(
@@ -6040,6 +11058,16 @@ int main(
 		 bfio_test_internal_handle_read_buffer,
 		 handle );
 
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_internal_handle_read_buffer_with_readahead",
+		 bfio_test_internal_handle_read_buffer_with_readahead,
+		 handle );
+
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_internal_handle_read_buffer_with_prefetch",
+		 bfio_test_internal_handle_read_buffer_with_prefetch,
+		 handle );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) */
 
 		BFIO_TEST_RUN_WITH_ARGS(
@@ -6052,6 +11080,11 @@ int main(
 		 bfio_test_handle_read_buffer_at_offset,
 		 handle );
 
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_handle_read_vector",
+		 bfio_test_handle_read_vector,
+		 handle );
+
 #if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT )
 
 		BFIO_TEST_RUN_WITH_ARGS(
@@ -6106,6 +11139,26 @@ int main(
 		 bfio_test_handle_get_offset_read,
 		 handle );
 
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_handle_get_maximum_readahead_size",
+		 bfio_test_handle_get_maximum_readahead_size,
+		 handle );
+
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_handle_set_access_hint",
+		 bfio_test_handle_set_access_hint,
+		 handle );
+
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_handle_get_data_pointer",
+		 bfio_test_handle_get_data_pointer,
+		 handle );
+
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_handle_release_data_pointer",
+		 bfio_test_handle_release_data_pointer,
+		 handle );
+
 		/* Clean up
 		 */
 		result = bfio_test_handle_close_source(
@@ -0,0 +1,507 @@
+/*
+ * Library handle metadata query benchmark program
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <time.h>
+
+#include "bfio_test_getopt.h"
+#include "bfio_test_libbfio.h"
+#include "bfio_test_libcerror.h"
+#include "bfio_test_libcthreads.h"
+#include "bfio_test_unused.h"
+
+#define BFIO_TEST_HANDLE_BENCHMARK_DEFAULT_NUMBER_OF_ITERATIONS	1000000
+#define BFIO_TEST_HANDLE_BENCHMARK_MAXIMUM_NUMBER_OF_THREADS		64
+
+uint8_t bfio_test_handle_benchmark_data[ 4096 ];
+
+typedef struct bfio_test_handle_benchmark_arguments bfio_test_handle_benchmark_arguments_t;
+
+struct bfio_test_handle_benchmark_arguments
+{
+	/* The handle
+	 */
+	libbfio_handle_t *handle;
+
+	/* The number of iterations
+	 */
+	int number_of_iterations;
+
+	/* The result
+	 */
+	int result;
+};
+
+/* Prints usage information
+ */
+void bfio_test_handle_benchmark_usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use bfio_test_handle_benchmark to determine how the throughput of\n"
+	                 "the handle metadata queries scales with the number of threads.\n"
+	                 "It prints the number of queries per second for each number of threads.\n\n" );
+
+	fprintf( stream, "Usage: bfio_test_handle_benchmark [ -i iterations ] [ -t threads ] [ -h ]\n\n" );
+
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-i:     number of iterations per thread, default is: %d\n",
+	 BFIO_TEST_HANDLE_BENCHMARK_DEFAULT_NUMBER_OF_ITERATIONS );
+	fprintf( stream, "\t-t:     maximum number of threads, default is the number of\n"
+	                 "\t        online processors, the maximum is: %d\n",
+	 BFIO_TEST_HANDLE_BENCHMARK_MAXIMUM_NUMBER_OF_THREADS );
+}
+
+/* Retrieves the current time in nanoseconds
+ * Returns the current time
+ */
+uint64_t bfio_test_handle_benchmark_get_time(
+          void )
+{
+#if defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_structure;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_structure ) == 0 )
+	{
+		return( ( (uint64_t) time_structure.tv_sec * 1000000000UL ) + (uint64_t) time_structure.tv_nsec );
+	}
+#endif
+	return( (uint64_t) time( NULL ) * 1000000000UL );
+}
+
+/* Queries the metadata of the handle
+ * Callback function for the benchmark threads
+ * Returns 1 if successful or -1 on error
+ */
+int bfio_test_handle_benchmark_query_metadata(
+     bfio_test_handle_benchmark_arguments_t *arguments )
+{
+	libcerror_error_t *error = NULL;
+	size64_t size            = 0;
+	off64_t offset           = 0;
+	int iteration            = 0;
+
+	if( arguments == NULL )
+	{
+		return( -1 );
+	}
+	arguments->result = 1;
+
+	for( iteration = 0;
+	     iteration < arguments->number_of_iterations;
+	     iteration++ )
+	{
+		if( libbfio_handle_get_size(
+		     arguments->handle,
+		     &size,
+		     &error ) != 1 )
+		{
+			arguments->result = -1;
+
+			break;
+		}
+		if( libbfio_handle_get_offset(
+		     arguments->handle,
+		     &offset,
+		     &error ) != 1 )
+		{
+			arguments->result = -1;
+
+			break;
+		}
+		if( libbfio_handle_is_open(
+		     arguments->handle,
+		     &error ) != 1 )
+		{
+			arguments->result = -1;
+
+			break;
+		}
+	}
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( arguments->result );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Runs the metadata queries on a number of threads
+ * Returns 1 if successful or -1 on error
+ */
+int bfio_test_handle_benchmark_run(
+     libbfio_handle_t *handle,
+     int number_of_threads,
+     int number_of_iterations,
+     uint64_t *elapsed_time,
+     libcerror_error_t **error )
+{
+	bfio_test_handle_benchmark_arguments_t arguments[ BFIO_TEST_HANDLE_BENCHMARK_MAXIMUM_NUMBER_OF_THREADS ];
+	libcthreads_thread_t *threads[ BFIO_TEST_HANDLE_BENCHMARK_MAXIMUM_NUMBER_OF_THREADS ];
+
+	static char *function = "bfio_test_handle_benchmark_run";
+	uint64_t start_time   = 0;
+	int result            = 1;
+	int thread_index      = 0;
+
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > BFIO_TEST_HANDLE_BENCHMARK_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( elapsed_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elapsed time.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     threads,
+	     0,
+	     sizeof( libcthreads_thread_t * ) * BFIO_TEST_HANDLE_BENCHMARK_MAXIMUM_NUMBER_OF_THREADS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear threads.",
+		 function );
+
+		return( -1 );
+	}
+	start_time = bfio_test_handle_benchmark_get_time();
+
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		arguments[ thread_index ].handle               = handle;
+		arguments[ thread_index ].number_of_iterations = number_of_iterations;
+		arguments[ thread_index ].result               = 0;
+
+		if( libcthreads_thread_create(
+		     &( threads[ thread_index ] ),
+		     NULL,
+		     (int (*)(void *)) &bfio_test_handle_benchmark_query_metadata,
+		     (void *) &( arguments[ thread_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread: %d.",
+			 function,
+			 thread_index );
+
+			result = -1;
+
+			break;
+		}
+	}
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		if( threads[ thread_index ] == NULL )
+		{
+			continue;
+		}
+		if( libcthreads_thread_join(
+		     &( threads[ thread_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread: %d.",
+			 function,
+			 thread_index );
+
+			result = -1;
+		}
+		else if( arguments[ thread_index ].result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to query metadata in thread: %d.",
+			 function,
+			 thread_index );
+
+			result = -1;
+		}
+	}
+	*elapsed_time = bfio_test_handle_benchmark_get_time() - start_time;
+
+	return( result );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	libbfio_handle_t *handle              = NULL;
+	libcerror_error_t *error              = NULL;
+	system_character_t *option_iterations = NULL;
+	system_character_t *option_threads    = NULL;
+	system_integer_t option               = 0;
+	uint64_t elapsed_time                 = 0;
+	uint64_t number_of_queries            = 0;
+	int maximum_number_of_threads         = 0;
+	int number_of_iterations              = BFIO_TEST_HANDLE_BENCHMARK_DEFAULT_NUMBER_OF_ITERATIONS;
+	int number_of_threads                 = 0;
+
+	while( ( option = bfio_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "hi:t:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				bfio_test_handle_benchmark_usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'h':
+				bfio_test_handle_benchmark_usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'i':
+				option_iterations = optarg;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_threads = optarg;
+
+				break;
+		}
+	}
+	if( option_iterations != NULL )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		number_of_iterations = (int) wcstol( option_iterations, NULL, 10 );
+#else
+		number_of_iterations = atoi( option_iterations );
+#endif
+		if( number_of_iterations <= 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid number of iterations.\n" );
+
+			return( EXIT_FAILURE );
+		}
+	}
+	if( option_threads != NULL )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		maximum_number_of_threads = (int) wcstol( option_threads, NULL, 10 );
+#else
+		maximum_number_of_threads = atoi( option_threads );
+#endif
+	}
+#if defined( HAVE_SYSCONF ) && defined( _SC_NPROCESSORS_ONLN )
+	else
+	{
+		maximum_number_of_threads = (int) sysconf( _SC_NPROCESSORS_ONLN );
+	}
+#endif
+	if( maximum_number_of_threads <= 0 )
+	{
+		maximum_number_of_threads = 4;
+	}
+	else if( maximum_number_of_threads > BFIO_TEST_HANDLE_BENCHMARK_MAXIMUM_NUMBER_OF_THREADS )
+	{
+		maximum_number_of_threads = BFIO_TEST_HANDLE_BENCHMARK_MAXIMUM_NUMBER_OF_THREADS;
+	}
+	if( libbfio_memory_range_initialize(
+	     &handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize handle.\n" );
+
+		goto on_error;
+	}
+	if( libbfio_memory_range_set(
+	     handle,
+	     bfio_test_handle_benchmark_data,
+	     4096,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set memory range.\n" );
+
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     handle,
+	     LIBBFIO_OPEN_READ,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open handle.\n" );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	fprintf(
+	 stdout,
+	 "Number of iterations per thread: %d\n\n",
+	 number_of_iterations );
+
+	for( number_of_threads = 1;
+	     number_of_threads <= maximum_number_of_threads;
+	     number_of_threads *= 2 )
+	{
+		if( bfio_test_handle_benchmark_run(
+		     handle,
+		     number_of_threads,
+		     number_of_iterations,
+		     &elapsed_time,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to run benchmark with: %d threads.\n",
+			 number_of_threads );
+
+			goto on_error;
+		}
+		/* Every iteration queries the size, the offset and if the handle is open
+		 */
+		number_of_queries = (uint64_t) number_of_threads * (uint64_t) number_of_iterations * 3;
+
+		if( elapsed_time == 0 )
+		{
+			elapsed_time = 1;
+		}
+		fprintf(
+		 stdout,
+		 "Threads: %2d\tqueries: %" PRIu64 "\telapsed: %" PRIu64 " ms\tqueries per second: %" PRIu64 "\n",
+		 number_of_threads,
+		 number_of_queries,
+		 elapsed_time / 1000000,
+		 (uint64_t) ( ( (double) number_of_queries * 1000000000.0 ) / (double) elapsed_time ) );
+	}
+#else
+	fprintf(
+	 stdout,
+	 "Multi-threading support not available.\n" );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	if( libbfio_handle_close(
+	     handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close handle.\n" );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free handle.\n" );
+
+		goto on_error;
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,947 @@
+/*
+ * Library handle_range type test program
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "bfio_test_libbfio.h"
+#include "bfio_test_libcerror.h"
+#include "bfio_test_macros.h"
+#include "bfio_test_memory.h"
+#include "bfio_test_unused.h"
+
+#include "../libbfio/libbfio_handle_range.h"
+
+/* Define to make bfio_test_handle_range generate verbose output
+#define BFIO_TEST_HANDLE_RANGE_VERBOSE
+ */
+
+#define BFIO_TEST_HANDLE_RANGE_OFFSET	1000
+#define BFIO_TEST_HANDLE_RANGE_SIZE	2000
+
+uint8_t bfio_test_handle_range_data[ 4096 ];
+
+/* Tests the libbfio_handle_range_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_range_initialize(
+     libbfio_handle_t *parent_handle )
+{
+	libbfio_handle_t *handle        = NULL;
+	libbfio_handle_t *range_handle  = NULL;
+	libcerror_error_t *error        = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_BFIO_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 2;
+	int number_of_memset_fail_tests = 2;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libbfio_handle_range_initialize(
+	          &handle,
+	          parent_handle,
+	          BFIO_TEST_HANDLE_RANGE_OFFSET,
+	          BFIO_TEST_HANDLE_RANGE_SIZE,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_handle_range_initialize(
+	          NULL,
+	          parent_handle,
+	          BFIO_TEST_HANDLE_RANGE_OFFSET,
+	          BFIO_TEST_HANDLE_RANGE_SIZE,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	handle = (libbfio_handle_t *) 0x12345678UL;
+
+	result = libbfio_handle_range_initialize(
+	          &handle,
+	          parent_handle,
+	          BFIO_TEST_HANDLE_RANGE_OFFSET,
+	          BFIO_TEST_HANDLE_RANGE_SIZE,
+	          &error );
+
+	handle = NULL;
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_range_initialize(
+	          &handle,
+	          NULL,
+	          BFIO_TEST_HANDLE_RANGE_OFFSET,
+	          BFIO_TEST_HANDLE_RANGE_SIZE,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_range_initialize(
+	          &handle,
+	          parent_handle,
+	          -1,
+	          BFIO_TEST_HANDLE_RANGE_SIZE,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a nested range that exceeds the parent range
+	 */
+	result = libbfio_handle_range_initialize(
+	          &range_handle,
+	          parent_handle,
+	          BFIO_TEST_HANDLE_RANGE_OFFSET,
+	          BFIO_TEST_HANDLE_RANGE_SIZE,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_range_initialize(
+	          &handle,
+	          range_handle,
+	          BFIO_TEST_HANDLE_RANGE_SIZE,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_range_initialize(
+	          &handle,
+	          range_handle,
+	          100,
+	          BFIO_TEST_HANDLE_RANGE_SIZE,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_free(
+	          &range_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_BFIO_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libbfio_handle_range_initialize with malloc failing
+		 */
+		bfio_test_malloc_attempts_before_fail = test_number;
+
+		result = libbfio_handle_range_initialize(
+		          &handle,
+		          parent_handle,
+		          BFIO_TEST_HANDLE_RANGE_OFFSET,
+		          BFIO_TEST_HANDLE_RANGE_SIZE,
+		          &error );
+
+		if( bfio_test_malloc_attempts_before_fail != -1 )
+		{
+			bfio_test_malloc_attempts_before_fail = -1;
+
+			if( handle != NULL )
+			{
+				libbfio_handle_free(
+				 &handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			BFIO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			BFIO_TEST_ASSERT_IS_NULL(
+			 "handle",
+			 handle );
+
+			BFIO_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libbfio_handle_range_initialize with memset failing
+		 */
+		bfio_test_memset_attempts_before_fail = test_number;
+
+		result = libbfio_handle_range_initialize(
+		          &handle,
+		          parent_handle,
+		          BFIO_TEST_HANDLE_RANGE_OFFSET,
+		          BFIO_TEST_HANDLE_RANGE_SIZE,
+		          &error );
+
+		if( bfio_test_memset_attempts_before_fail != -1 )
+		{
+			bfio_test_memset_attempts_before_fail = -1;
+
+			if( handle != NULL )
+			{
+				libbfio_handle_free(
+				 &handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			BFIO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			BFIO_TEST_ASSERT_IS_NULL(
+			 "handle",
+			 handle );
+
+			BFIO_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_BFIO_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( range_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &range_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_handle_read_buffer_at_offset function on a handle range
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_range_read_buffer_at_offset(
+     libbfio_handle_t *parent_handle )
+{
+	uint8_t buffer[ 512 ];
+
+	libbfio_handle_t *handle = NULL;
+	libcerror_error_t *error = NULL;
+	size64_t size            = 0;
+	ssize_t read_count       = 0;
+	off64_t offset           = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_handle_range_initialize(
+	          &handle,
+	          parent_handle,
+	          BFIO_TEST_HANDLE_RANGE_OFFSET,
+	          BFIO_TEST_HANDLE_RANGE_SIZE,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_get_size(
+	          handle,
+	          &size,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) BFIO_TEST_HANDLE_RANGE_SIZE );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a read at the start of the range
+	 */
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              512,
+	              0,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( bfio_test_handle_range_data[ BFIO_TEST_HANDLE_RANGE_OFFSET ] ),
+	          512 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a read that is truncated at the end of the range
+	 */
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              512,
+	              BFIO_TEST_HANDLE_RANGE_SIZE - 100,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 100 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( bfio_test_handle_range_data[ BFIO_TEST_HANDLE_RANGE_OFFSET + BFIO_TEST_HANDLE_RANGE_SIZE - 100 ] ),
+	          100 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a read beyond the end of the range
+	 */
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              512,
+	              BFIO_TEST_HANDLE_RANGE_SIZE,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a read relative to the end of the range
+	 */
+	offset = libbfio_handle_seek_offset(
+	          handle,
+	          -50,
+	          SEEK_END,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) ( BFIO_TEST_HANDLE_RANGE_SIZE - 50 ) );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_handle_read_buffer(
+	              handle,
+	              buffer,
+	              512,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 50 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( bfio_test_handle_range_data[ BFIO_TEST_HANDLE_RANGE_OFFSET + BFIO_TEST_HANDLE_RANGE_SIZE - 50 ] ),
+	          50 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              512,
+	              -1,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_close(
+	          handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests a handle range of a handle range
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_range_nested(
+     libbfio_handle_t *parent_handle )
+{
+	uint8_t buffer[ 512 ];
+
+	libbfio_handle_t *handle       = NULL;
+	libbfio_handle_t *range_handle = NULL;
+	libcerror_error_t *error       = NULL;
+	size64_t size                  = 0;
+	ssize_t read_count             = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_handle_range_initialize(
+	          &range_handle,
+	          parent_handle,
+	          BFIO_TEST_HANDLE_RANGE_OFFSET,
+	          BFIO_TEST_HANDLE_RANGE_SIZE,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A range size of 0 continues until the end of the parent range
+	 */
+	result = libbfio_handle_range_initialize(
+	          &handle,
+	          range_handle,
+	          500,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The nested range does not depend on the parent range after initialization
+	 */
+	result = libbfio_handle_free(
+	          &range_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_get_size(
+	          handle,
+	          &size,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) ( BFIO_TEST_HANDLE_RANGE_SIZE - 500 ) );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              512,
+	              100,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( bfio_test_handle_range_data[ BFIO_TEST_HANDLE_RANGE_OFFSET + 500 + 100 ] ),
+	          512 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_close(
+	          handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( range_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &range_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc BFIO_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] BFIO_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc BFIO_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] BFIO_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libbfio_handle_t *parent_handle = NULL;
+	libcerror_error_t *error        = NULL;
+	size_t data_index               = 0;
+	int result                      = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( BFIO_TEST_HANDLE_RANGE_VERBOSE )
+	libbfio_notify_set_verbose(
+	 1 );
+	libbfio_notify_set_stream(
+	 stderr,
+	 NULL );
+#endif
+
+	for( data_index = 0;
+	     data_index < 4096;
+	     data_index++ )
+	{
+		bfio_test_handle_range_data[ data_index ] = (uint8_t) ( data_index % 251 );
+	}
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize test
+	 */
+	result = libbfio_memory_range_initialize(
+	          &parent_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "parent_handle",
+	 parent_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          parent_handle,
+	          bfio_test_handle_range_data,
+	          4096,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_RUN_WITH_ARGS(
+	 "libbfio_handle_range_initialize",
+	 bfio_test_handle_range_initialize,
+	 parent_handle );
+
+	BFIO_TEST_RUN_WITH_ARGS(
+	 "libbfio_handle_read_buffer_at_offset",
+	 bfio_test_handle_range_read_buffer_at_offset,
+	 parent_handle );
+
+	BFIO_TEST_RUN_WITH_ARGS(
+	 "libbfio_handle_range_initialize_nested",
+	 bfio_test_handle_range_nested,
+	 parent_handle );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &parent_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "parent_handle",
+	 parent_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parent_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &parent_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1933 @@
+/*
+ * Library io_queue type test program
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "bfio_test_functions.h"
+#include "bfio_test_libbfio.h"
+#include "bfio_test_libcerror.h"
+#include "bfio_test_macros.h"
+#include "bfio_test_memory.h"
+#include "bfio_test_unused.h"
+
+#include "../libbfio/libbfio_io_queue.h"
+
+/* Define to make bfio_test_io_queue generate verbose output
+#define BFIO_TEST_IO_QUEUE_VERBOSE
+ */
+
+#define BFIO_TEST_IO_QUEUE_NUMBER_OF_REQUESTS	64
+#define BFIO_TEST_IO_QUEUE_REQUEST_SIZE		64
+
+uint8_t bfio_test_io_queue_data[ BFIO_TEST_IO_QUEUE_NUMBER_OF_REQUESTS * BFIO_TEST_IO_QUEUE_REQUEST_SIZE ];
+
+/* Tests the libbfio_io_queue_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_io_queue_initialize(
+     void )
+{
+	libbfio_io_queue_t *io_queue    = NULL;
+	libcerror_error_t *error        = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_BFIO_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libbfio_io_queue_initialize(
+	          &io_queue,
+	          4,
+	          16,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "io_queue",
+	 io_queue );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_io_queue_free(
+	          &io_queue,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "io_queue",
+	 io_queue );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_io_queue_initialize(
+	          NULL,
+	          4,
+	          16,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	io_queue = (libbfio_io_queue_t *) 0x12345678UL;
+
+	result = libbfio_io_queue_initialize(
+	          &io_queue,
+	          4,
+	          16,
+	          &error );
+
+	io_queue = NULL;
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_io_queue_initialize(
+	          &io_queue,
+	          0,
+	          16,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "io_queue",
+	 io_queue );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_io_queue_initialize(
+	          &io_queue,
+	          4,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "io_queue",
+	 io_queue );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_BFIO_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libbfio_io_queue_initialize with malloc failing
+		 */
+		bfio_test_malloc_attempts_before_fail = test_number;
+
+		result = libbfio_io_queue_initialize(
+		          &io_queue,
+		          4,
+		          16,
+		          &error );
+
+		if( bfio_test_malloc_attempts_before_fail != -1 )
+		{
+			bfio_test_malloc_attempts_before_fail = -1;
+
+			if( io_queue != NULL )
+			{
+				libbfio_io_queue_free(
+				 &io_queue,
+				 NULL );
+			}
+		}
+		else
+		{
+			BFIO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			BFIO_TEST_ASSERT_IS_NULL(
+			 "io_queue",
+			 io_queue );
+
+			BFIO_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libbfio_io_queue_initialize with memset failing
+		 */
+		bfio_test_memset_attempts_before_fail = test_number;
+
+		result = libbfio_io_queue_initialize(
+		          &io_queue,
+		          4,
+		          16,
+		          &error );
+
+		if( bfio_test_memset_attempts_before_fail != -1 )
+		{
+			bfio_test_memset_attempts_before_fail = -1;
+
+			if( io_queue != NULL )
+			{
+				libbfio_io_queue_free(
+				 &io_queue,
+				 NULL );
+			}
+		}
+		else
+		{
+			BFIO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			BFIO_TEST_ASSERT_IS_NULL(
+			 "io_queue",
+			 io_queue );
+
+			BFIO_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_BFIO_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_queue != NULL )
+	{
+		libbfio_io_queue_free(
+		 &io_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_io_queue_free function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_io_queue_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libbfio_io_queue_free(
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_io_queue_submit_read_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_io_queue_submit_read_buffer_at_offset(
+     libbfio_handle_t *handle )
+{
+	uint8_t buffer[ BFIO_TEST_IO_QUEUE_NUMBER_OF_REQUESTS * BFIO_TEST_IO_QUEUE_REQUEST_SIZE ];
+
+	libbfio_io_queue_t *io_queue = NULL;
+	libcerror_error_t *error     = NULL;
+	intptr_t *request_data       = NULL;
+	ssize_t io_count             = 0;
+	off64_t offset               = 0;
+	int number_of_requests       = 0;
+	int request_index            = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_io_queue_initialize(
+	          &io_queue,
+	          4,
+	          16,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "io_queue",
+	 io_queue );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( memory_set(
+	     buffer,
+	     0,
+	     BFIO_TEST_IO_QUEUE_NUMBER_OF_REQUESTS * BFIO_TEST_IO_QUEUE_REQUEST_SIZE ) == NULL )
+	{
+		goto on_error;
+	}
+	/* Test regular cases
+	 * Submit more requests than can be queued at once
+	 */
+	for( request_index = 0;
+	     request_index < BFIO_TEST_IO_QUEUE_NUMBER_OF_REQUESTS;
+	     request_index++ )
+	{
+		offset = (off64_t) request_index * BFIO_TEST_IO_QUEUE_REQUEST_SIZE;
+
+		result = libbfio_io_queue_submit_read_buffer_at_offset(
+		          io_queue,
+		          handle,
+		          &( buffer[ offset ] ),
+		          BFIO_TEST_IO_QUEUE_REQUEST_SIZE,
+		          offset,
+		          (intptr_t *) &( buffer[ offset ] ),
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libbfio_io_queue_get_number_of_submitted_requests(
+	          io_queue,
+	          &number_of_requests,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "number_of_requests",
+	 number_of_requests,
+	 BFIO_TEST_IO_QUEUE_NUMBER_OF_REQUESTS );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( request_index = 0;
+	     request_index < BFIO_TEST_IO_QUEUE_NUMBER_OF_REQUESTS;
+	     request_index++ )
+	{
+		result = libbfio_io_queue_get_completion(
+		          io_queue,
+		          &request_data,
+		          &io_count,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "io_count",
+		 io_count,
+		 (ssize_t) BFIO_TEST_IO_QUEUE_REQUEST_SIZE );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "request_data",
+		 request_data );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = memory_compare(
+	          buffer,
+	          bfio_test_io_queue_data,
+	          BFIO_TEST_IO_QUEUE_NUMBER_OF_REQUESTS * BFIO_TEST_IO_QUEUE_REQUEST_SIZE );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test get completion without submitted requests
+	 */
+	result = libbfio_io_queue_get_completion(
+	          io_queue,
+	          &request_data,
+	          &io_count,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_io_queue_submit_read_buffer_at_offset(
+	          NULL,
+	          handle,
+	          buffer,
+	          BFIO_TEST_IO_QUEUE_REQUEST_SIZE,
+	          0,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_io_queue_submit_read_buffer_at_offset(
+	          io_queue,
+	          NULL,
+	          buffer,
+	          BFIO_TEST_IO_QUEUE_REQUEST_SIZE,
+	          0,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_io_queue_submit_read_buffer_at_offset(
+	          io_queue,
+	          handle,
+	          NULL,
+	          BFIO_TEST_IO_QUEUE_REQUEST_SIZE,
+	          0,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_io_queue_submit_read_buffer_at_offset(
+	          io_queue,
+	          handle,
+	          buffer,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_io_queue_submit_read_buffer_at_offset(
+	          io_queue,
+	          handle,
+	          buffer,
+	          BFIO_TEST_IO_QUEUE_REQUEST_SIZE,
+	          -1,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_io_queue_get_number_of_submitted_requests(
+	          io_queue,
+	          &number_of_requests,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "number_of_requests",
+	 number_of_requests,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libbfio_io_queue_free(
+	          &io_queue,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "io_queue",
+	 io_queue );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_queue != NULL )
+	{
+		libbfio_io_queue_free(
+		 &io_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_io_queue_submit_write_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_io_queue_submit_write_buffer_at_offset(
+     void )
+{
+	uint8_t data[ 4 * BFIO_TEST_IO_QUEUE_REQUEST_SIZE ];
+
+	libbfio_handle_t *handle     = NULL;
+	libbfio_io_queue_t *io_queue = NULL;
+	libcerror_error_t *error     = NULL;
+	intptr_t *request_data       = NULL;
+	ssize_t io_count             = 0;
+	off64_t offset               = 0;
+	int request_index            = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     data,
+	     0,
+	     4 * BFIO_TEST_IO_QUEUE_REQUEST_SIZE ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libbfio_memory_range_initialize(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          handle,
+	          data,
+	          4 * BFIO_TEST_IO_QUEUE_REQUEST_SIZE,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          handle,
+	          LIBBFIO_OPEN_READ_WRITE,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_io_queue_initialize(
+	          &io_queue,
+	          2,
+	          2,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "io_queue",
+	 io_queue );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( request_index = 0;
+	     request_index < 4;
+	     request_index++ )
+	{
+		offset = (off64_t) request_index * BFIO_TEST_IO_QUEUE_REQUEST_SIZE;
+
+		result = libbfio_io_queue_submit_write_buffer_at_offset(
+		          io_queue,
+		          handle,
+		          &( bfio_test_io_queue_data[ offset ] ),
+		          BFIO_TEST_IO_QUEUE_REQUEST_SIZE,
+		          offset,
+		          NULL,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( request_index = 0;
+	     request_index < 4;
+	     request_index++ )
+	{
+		result = libbfio_io_queue_get_completion(
+		          io_queue,
+		          &request_data,
+		          &io_count,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "io_count",
+		 io_count,
+		 (ssize_t) BFIO_TEST_IO_QUEUE_REQUEST_SIZE );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = memory_compare(
+	          data,
+	          bfio_test_io_queue_data,
+	          4 * BFIO_TEST_IO_QUEUE_REQUEST_SIZE );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libbfio_io_queue_submit_write_buffer_at_offset(
+	          NULL,
+	          handle,
+	          bfio_test_io_queue_data,
+	          BFIO_TEST_IO_QUEUE_REQUEST_SIZE,
+	          0,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_io_queue_submit_write_buffer_at_offset(
+	          io_queue,
+	          NULL,
+	          bfio_test_io_queue_data,
+	          BFIO_TEST_IO_QUEUE_REQUEST_SIZE,
+	          0,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_io_queue_free(
+	          &io_queue,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "io_queue",
+	 io_queue );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_close(
+	          handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_queue != NULL )
+	{
+		libbfio_io_queue_free(
+		 &io_queue,
+		 NULL );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_io_queue_submit_read_buffer_at_offset and libbfio_io_queue_submit_write_buffer_at_offset
+ * functions on a file handle, which are submitted to the io_uring if it is supported
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_io_queue_file_handle(
+     void )
+{
+	char narrow_temporary_filename[ 17 ] = {
+		'b', 'f', 'i', 'o', '_', 't', 'e', 's', 't', '_', 'X', 'X', 'X', 'X', 'X', 'X', 0 };
+
+	uint8_t data[ 4 * BFIO_TEST_IO_QUEUE_REQUEST_SIZE ];
+
+	libbfio_handle_t *handle     = NULL;
+	libbfio_io_queue_t *io_queue = NULL;
+	libcerror_error_t *error     = NULL;
+	intptr_t *request_data       = NULL;
+	ssize_t io_count             = 0;
+	ssize_t total_io_count       = 0;
+	off64_t offset               = 0;
+	int request_index            = 0;
+	int result                   = 0;
+	int with_temporary_file      = 0;
+
+	/* Initialize test
+	 */
+	result = bfio_test_get_temporary_filename(
+	          narrow_temporary_filename,
+	          17,
+	          &error );
+
+	BFIO_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	with_temporary_file = result;
+
+	if( with_temporary_file == 0 )
+	{
+		return( 1 );
+	}
+	if( memory_set(
+	     data,
+	     0,
+	     4 * BFIO_TEST_IO_QUEUE_REQUEST_SIZE ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libbfio_file_initialize(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_file_set_name(
+	          handle,
+	          narrow_temporary_filename,
+	          16,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          handle,
+	          LIBBFIO_OPEN_READ_WRITE_TRUNCATE,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Writes within the size of the handle can be submitted to the io_uring
+	 */
+	io_count = libbfio_handle_write_buffer_at_offset(
+	            handle,
+	            data,
+	            4 * BFIO_TEST_IO_QUEUE_REQUEST_SIZE,
+	            0,
+	            &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "io_count",
+	 io_count,
+	 (ssize_t) ( 4 * BFIO_TEST_IO_QUEUE_REQUEST_SIZE ) );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_io_queue_initialize(
+	          &io_queue,
+	          2,
+	          4,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "io_queue",
+	 io_queue );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( request_index = 0;
+	     request_index < 4;
+	     request_index++ )
+	{
+		offset = (off64_t) request_index * BFIO_TEST_IO_QUEUE_REQUEST_SIZE;
+
+		result = libbfio_io_queue_submit_write_buffer_at_offset(
+		          io_queue,
+		          handle,
+		          &( bfio_test_io_queue_data[ offset ] ),
+		          BFIO_TEST_IO_QUEUE_REQUEST_SIZE,
+		          offset,
+		          NULL,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( request_index = 0;
+	     request_index < 4;
+	     request_index++ )
+	{
+		result = libbfio_io_queue_get_completion(
+		          io_queue,
+		          &request_data,
+		          &io_count,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "io_count",
+		 io_count,
+		 (ssize_t) BFIO_TEST_IO_QUEUE_REQUEST_SIZE );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* The last read starts half a request before the end of the data
+	 * and is limited to the size of the handle
+	 */
+	for( request_index = 0;
+	     request_index < 4;
+	     request_index++ )
+	{
+		offset = (off64_t) request_index * BFIO_TEST_IO_QUEUE_REQUEST_SIZE;
+
+		if( request_index == 3 )
+		{
+			offset += BFIO_TEST_IO_QUEUE_REQUEST_SIZE / 2;
+		}
+		result = libbfio_io_queue_submit_read_buffer_at_offset(
+		          io_queue,
+		          handle,
+		          &( data[ request_index * BFIO_TEST_IO_QUEUE_REQUEST_SIZE ] ),
+		          BFIO_TEST_IO_QUEUE_REQUEST_SIZE,
+		          offset,
+		          NULL,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( request_index = 0;
+	     request_index < 4;
+	     request_index++ )
+	{
+		result = libbfio_io_queue_get_completion(
+		          io_queue,
+		          &request_data,
+		          &io_count,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_NOT_EQUAL_SSIZE(
+		 "io_count",
+		 io_count,
+		 (ssize_t) -1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		total_io_count += io_count;
+	}
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "total_io_count",
+	 total_io_count,
+	 (ssize_t) ( ( 4 * BFIO_TEST_IO_QUEUE_REQUEST_SIZE ) - ( BFIO_TEST_IO_QUEUE_REQUEST_SIZE / 2 ) ) );
+
+	result = memory_compare(
+	          data,
+	          bfio_test_io_queue_data,
+	          3 * BFIO_TEST_IO_QUEUE_REQUEST_SIZE );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( data[ 3 * BFIO_TEST_IO_QUEUE_REQUEST_SIZE ] ),
+	          &( bfio_test_io_queue_data[ ( 3 * BFIO_TEST_IO_QUEUE_REQUEST_SIZE ) + ( BFIO_TEST_IO_QUEUE_REQUEST_SIZE / 2 ) ] ),
+	          BFIO_TEST_IO_QUEUE_REQUEST_SIZE / 2 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libbfio_io_queue_free(
+	          &io_queue,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "io_queue",
+	 io_queue );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_close(
+	          handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = bfio_test_remove_temporary_file(
+	          narrow_temporary_filename,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_queue != NULL )
+	{
+		libbfio_io_queue_free(
+		 &io_queue,
+		 NULL );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( with_temporary_file != 0 )
+	{
+		bfio_test_remove_temporary_file(
+		 narrow_temporary_filename,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_io_queue_get_completion function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_io_queue_get_completion(
+     void )
+{
+	uint8_t buffer[ BFIO_TEST_IO_QUEUE_REQUEST_SIZE ];
+
+	libbfio_handle_t *handle     = NULL;
+	libbfio_io_queue_t *io_queue = NULL;
+	libcerror_error_t *error     = NULL;
+	intptr_t *request_data       = NULL;
+	ssize_t io_count             = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_memory_range_initialize(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_io_queue_initialize(
+	          &io_queue,
+	          1,
+	          1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "io_queue",
+	 io_queue );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * A read from a handle that is not open completes with an IO count of -1
+	 */
+	result = libbfio_io_queue_submit_read_buffer_at_offset(
+	          io_queue,
+	          handle,
+	          buffer,
+	          BFIO_TEST_IO_QUEUE_REQUEST_SIZE,
+	          0,
+	          (intptr_t *) buffer,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_io_queue_get_completion(
+	          io_queue,
+	          &request_data,
+	          &io_count,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INTPTR(
+	 "request_data",
+	 (intptr_t) request_data,
+	 (intptr_t) buffer );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "io_count",
+	 io_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_io_queue_get_completion(
+	          NULL,
+	          &request_data,
+	          &io_count,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_io_queue_get_completion(
+	          io_queue,
+	          NULL,
+	          &io_count,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_io_queue_get_completion(
+	          io_queue,
+	          &request_data,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_io_queue_free(
+	          &io_queue,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "io_queue",
+	 io_queue );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_queue != NULL )
+	{
+		libbfio_io_queue_free(
+		 &io_queue,
+		 NULL );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_io_queue_poll_completion function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_io_queue_poll_completion(
+     libbfio_handle_t *handle )
+{
+	uint8_t buffer[ BFIO_TEST_IO_QUEUE_REQUEST_SIZE ];
+
+	libbfio_io_queue_t *io_queue = NULL;
+	libcerror_error_t *error     = NULL;
+	intptr_t *request_data       = NULL;
+	ssize_t io_count             = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_io_queue_initialize(
+	          &io_queue,
+	          1,
+	          1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "io_queue",
+	 io_queue );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbfio_io_queue_poll_completion(
+	          io_queue,
+	          &request_data,
+	          &io_count,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_io_queue_submit_read_buffer_at_offset(
+	          io_queue,
+	          handle,
+	          buffer,
+	          BFIO_TEST_IO_QUEUE_REQUEST_SIZE,
+	          BFIO_TEST_IO_QUEUE_REQUEST_SIZE,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	do
+	{
+		result = libbfio_io_queue_poll_completion(
+		          io_queue,
+		          &request_data,
+		          &io_count,
+		          &error );
+	}
+	while( result == 0 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "io_count",
+	 io_count,
+	 (ssize_t) BFIO_TEST_IO_QUEUE_REQUEST_SIZE );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( bfio_test_io_queue_data[ BFIO_TEST_IO_QUEUE_REQUEST_SIZE ] ),
+	          BFIO_TEST_IO_QUEUE_REQUEST_SIZE );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libbfio_io_queue_poll_completion(
+	          NULL,
+	          &request_data,
+	          &io_count,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_io_queue_free(
+	          &io_queue,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "io_queue",
+	 io_queue );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_queue != NULL )
+	{
+		libbfio_io_queue_free(
+		 &io_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_io_queue_get_number_of_submitted_requests function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_io_queue_get_number_of_submitted_requests(
+     void )
+{
+	libbfio_io_queue_t *io_queue = NULL;
+	libcerror_error_t *error     = NULL;
+	int number_of_requests       = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_io_queue_initialize(
+	          &io_queue,
+	          1,
+	          1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "io_queue",
+	 io_queue );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbfio_io_queue_get_number_of_submitted_requests(
+	          io_queue,
+	          &number_of_requests,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "number_of_requests",
+	 number_of_requests,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_io_queue_get_number_of_submitted_requests(
+	          NULL,
+	          &number_of_requests,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_io_queue_get_number_of_submitted_requests(
+	          io_queue,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_io_queue_free(
+	          &io_queue,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "io_queue",
+	 io_queue );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_queue != NULL )
+	{
+		libbfio_io_queue_free(
+		 &io_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc BFIO_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] BFIO_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc BFIO_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] BFIO_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libbfio_handle_t *handle = NULL;
+	libcerror_error_t *error = NULL;
+	size_t data_index        = 0;
+	int result               = 0;
+
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( BFIO_TEST_IO_QUEUE_VERBOSE )
+	libbfio_notify_set_verbose(
+	 1 );
+	libbfio_notify_set_stream(
+	 stderr,
+	 NULL );
+#endif
+	for( data_index = 0;
+	     data_index < BFIO_TEST_IO_QUEUE_NUMBER_OF_REQUESTS * BFIO_TEST_IO_QUEUE_REQUEST_SIZE;
+	     data_index++ )
+	{
+		bfio_test_io_queue_data[ data_index ] = (uint8_t) ( data_index % 251 );
+	}
+	BFIO_TEST_RUN(
+	 "libbfio_io_queue_initialize",
+	 bfio_test_io_queue_initialize );
+
+	BFIO_TEST_RUN(
+	 "libbfio_io_queue_free",
+	 bfio_test_io_queue_free );
+
+	BFIO_TEST_RUN(
+	 "libbfio_io_queue_submit_write_buffer_at_offset",
+	 bfio_test_io_queue_submit_write_buffer_at_offset );
+
+	BFIO_TEST_RUN(
+	 "libbfio_io_queue_file_handle",
+	 bfio_test_io_queue_file_handle );
+
+	BFIO_TEST_RUN(
+	 "libbfio_io_queue_get_completion",
+	 bfio_test_io_queue_get_completion );
+
+	BFIO_TEST_RUN(
+	 "libbfio_io_queue_get_number_of_submitted_requests",
+	 bfio_test_io_queue_get_number_of_submitted_requests );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize test
+	 */
+	result = libbfio_memory_range_initialize(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          handle,
+	          bfio_test_io_queue_data,
+	          BFIO_TEST_IO_QUEUE_NUMBER_OF_REQUESTS * BFIO_TEST_IO_QUEUE_REQUEST_SIZE,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_RUN_WITH_ARGS(
+	 "libbfio_io_queue_submit_read_buffer_at_offset",
+	 bfio_test_io_queue_submit_read_buffer_at_offset,
+	 handle );
+
+	BFIO_TEST_RUN_WITH_ARGS(
+	 "libbfio_io_queue_poll_completion",
+	 bfio_test_io_queue_poll_completion,
+	 handle );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_close(
+	          handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -1505,26 +1506,27 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libbfio_memory_range_io_handle_write_buffer function
+/* Tests the libbfio_memory_range_io_handle_read_buffer_at_offset function
  * Returns 1 if successful or 0 if not
  */
-int bfio_test_memory_range_io_handle_write_buffer(
-     void )
+int bfio_test_memory_range_io_handle_read_buffer_at_offset(
+     libbfio_memory_range_io_handle_t *memory_range_io_handle )
 {
-	uint8_t buffer[ 32 ] = {
-		'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
-		'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', '0', '1', '2', '3', '4', '5' };
+	uint8_t buffer[ 32 ];
+	uint8_t expected_buffer[ 32 ];
 
 	libbfio_memory_range_io_handle_t *closed_memory_range_io_handle = NULL;
-	libbfio_memory_range_io_handle_t *memory_range_io_handle        = NULL;
 	libcerror_error_t *error                                        = NULL;
-	ssize_t write_count                                             = 0;
+	size64_t file_size                                              = 0;
+	ssize_t read_count                                              = 0;
+	off64_t offset                                                  = 0;
 	int result                                                      = 0;
 
 	/* Initialize test
 	 */
-	result = libbfio_memory_range_io_handle_initialize(
-	          &memory_range_io_handle,
+	result = libbfio_memory_range_io_handle_get_size(
+	          memory_range_io_handle,
+	          &file_size,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -1532,106 +1534,119 @@ int bfio_test_memory_range_io_handle_write_buffer(
 	 result,
 	 1 );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
-	 "memory_range_io_handle",
-	 memory_range_io_handle );
-
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libbfio_memory_range_io_handle_set(
+	if( file_size < 32 )
+	{
+		return( 1 );
+	}
+	offset = libbfio_memory_range_io_handle_seek_offset(
 	          memory_range_io_handle,
-	          bfio_test_memory_range_io_handle_data,
-	          4096,
+	          0,
+	          SEEK_SET,
 	          &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	write_count = libbfio_memory_range_io_handle_write_buffer(
-	               NULL,
-	               buffer,
-	               32,
-	               &error );
+	read_count = libbfio_memory_range_io_handle_read_buffer(
+	              memory_range_io_handle,
+	              expected_buffer,
+	              32,
+	              &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
-	 "write_count",
-	 write_count,
-	 (ssize_t) -1 );
+	 "read_count",
+	 read_count,
+	 (ssize_t) 32 );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	memory_range_io_handle->range_start = NULL;
-
-	write_count = libbfio_memory_range_io_handle_write_buffer(
-	               memory_range_io_handle,
-	               buffer,
-	               32,
-	               &error );
-
-	memory_range_io_handle->range_start = bfio_test_memory_range_io_handle_data;
+	/* Test regular cases
+	 */
+	read_count = libbfio_memory_range_io_handle_read_buffer_at_offset(
+	              memory_range_io_handle,
+	              buffer,
+	              16,
+	              16,
+	              &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
-	 "write_count",
-	 write_count,
-	 (ssize_t) -1 );
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	memory_range_io_handle->is_open = 0;
+	result = memory_compare(
+	          buffer,
+	          &( expected_buffer[ 16 ] ),
+	          16 );
 
-	write_count = libbfio_memory_range_io_handle_write_buffer(
-	               memory_range_io_handle,
-	               buffer,
-	               32,
-	               &error );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-	memory_range_io_handle->is_open = 1;
+	/* Test that the current offset was not changed
+	 */
+	offset = libbfio_memory_range_io_handle_seek_offset(
+	          memory_range_io_handle,
+	          0,
+	          SEEK_CUR,
+	          &error );
 
-	BFIO_TEST_ASSERT_EQUAL_SSIZE(
-	 "write_count",
-	 write_count,
-	 (ssize_t) -1 );
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 32 );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	/* Test read buffer at offset beyond the end of the memory range
+	 */
+	read_count = libbfio_memory_range_io_handle_read_buffer_at_offset(
+	              memory_range_io_handle,
+	              buffer,
+	              32,
+	              (off64_t) file_size,
+	              &error );
 
-	memory_range_io_handle->access_flags = 0;
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
 
-	write_count = libbfio_memory_range_io_handle_write_buffer(
-	               memory_range_io_handle,
-	               buffer,
-	               32,
-	               &error );
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	memory_range_io_handle->access_flags = LIBBFIO_ACCESS_FLAG_WRITE;
+	/* Test error cases
+	 */
+	read_count = libbfio_memory_range_io_handle_read_buffer_at_offset(
+	              NULL,
+	              buffer,
+	              32,
+	              0,
+	              &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
-	 "write_count",
-	 write_count,
+	 "read_count",
+	 read_count,
 	 (ssize_t) -1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
@@ -1641,15 +1656,16 @@ int bfio_test_memory_range_io_handle_write_buffer(
 	libcerror_error_free(
 	 &error );
 
-	write_count = libbfio_memory_range_io_handle_write_buffer(
-	               memory_range_io_handle,
-	               NULL,
-	               32,
-	               &error );
+	read_count = libbfio_memory_range_io_handle_read_buffer_at_offset(
+	              memory_range_io_handle,
+	              NULL,
+	              32,
+	              0,
+	              &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
-	 "write_count",
-	 write_count,
+	 "read_count",
+	 read_count,
 	 (ssize_t) -1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
@@ -1659,15 +1675,16 @@ int bfio_test_memory_range_io_handle_write_buffer(
 	libcerror_error_free(
 	 &error );
 
-	write_count = libbfio_memory_range_io_handle_write_buffer(
-	               memory_range_io_handle,
-	               buffer,
-	               (size_t) SSIZE_MAX + 1,
-	               &error );
+	read_count = libbfio_memory_range_io_handle_read_buffer_at_offset(
+	              memory_range_io_handle,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              0,
+	              &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
-	 "write_count",
-	 write_count,
+	 "read_count",
+	 read_count,
 	 (ssize_t) -1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
@@ -1677,19 +1694,16 @@ int bfio_test_memory_range_io_handle_write_buffer(
 	libcerror_error_free(
 	 &error );
 
-	memory_range_io_handle->range_offset = 4096 + 1;
-
-	write_count = libbfio_memory_range_io_handle_write_buffer(
-	               memory_range_io_handle,
-	               buffer,
-	               32,
-	               &error );
-
-	memory_range_io_handle->range_offset = 0;
+	read_count = libbfio_memory_range_io_handle_read_buffer_at_offset(
+	              memory_range_io_handle,
+	              buffer,
+	              32,
+	              -1,
+	              &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
-	 "write_count",
-	 write_count,
+	 "read_count",
+	 read_count,
 	 (ssize_t) -1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
@@ -1699,38 +1713,6 @@ int bfio_test_memory_range_io_handle_write_buffer(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_BFIO_TEST_MEMORY ) && defined( OPTIMIZATION_DISABLED )
-
-	/* Test libbfio_memory_range_io_handle_write_buffer with memcpy failing
-	 */
-	bfio_test_memcpy_attempts_before_fail = 0;
-
-	write_count = libbfio_memory_range_io_handle_write_buffer(
-	               memory_range_io_handle,
-	               buffer,
-	               32,
-	               &error );
-
-	if( bfio_test_memcpy_attempts_before_fail != -1 )
-	{
-		bfio_test_memcpy_attempts_before_fail = -1;
-	}
-	else
-	{
-		BFIO_TEST_ASSERT_EQUAL_SSIZE(
-		 "write_count",
-		 write_count,
-		 (ssize_t) -1 );
-
-		BFIO_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_BFIO_TEST_MEMORY ) && defined( OPTIMIZATION_DISABLED ) */
-
 	/* Initialize test
 	 */
 	result = libbfio_memory_range_io_handle_initialize(
@@ -1750,17 +1732,18 @@ int bfio_test_memory_range_io_handle_write_buffer(
 	 "error",
 	 error );
 
-	/* Test write buffer with error code on a closed file IO handle
+	/* Test read buffer at offset on a closed memory range IO handle
 	 */
-	write_count = libbfio_memory_range_io_handle_write_buffer(
-	               closed_memory_range_io_handle,
-	               buffer,
-	               0,
-	               &error );
+	read_count = libbfio_memory_range_io_handle_read_buffer_at_offset(
+	              closed_memory_range_io_handle,
+	              buffer,
+	              32,
+	              0,
+	              &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
-	 "write_count",
-	 write_count,
+	 "read_count",
+	 read_count,
 	 (ssize_t) -1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
@@ -1789,282 +1772,1299 @@ int bfio_test_memory_range_io_handle_write_buffer(
 	 "error",
 	 error );
 
-	result = libbfio_memory_range_io_handle_set(
-	          memory_range_io_handle,
-	          bfio_test_memory_range_io_handle_data,
-	          4096,
-	          &error );
-
-	BFIO_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	BFIO_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = libbfio_memory_range_io_handle_free(
-	          &memory_range_io_handle,
-	          &error );
+	return( 1 );
 
-	BFIO_TEST_ASSERT_EQUAL_INT(
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( closed_memory_range_io_handle != NULL )
+	{
+		libbfio_memory_range_io_handle_free(
+		 &closed_memory_range_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_memory_range_io_handle_write_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_memory_range_io_handle_write_buffer(
+     void )
+{
+	uint8_t buffer[ 32 ] = {
+		'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+		'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', '0', '1', '2', '3', '4', '5' };
+
+	libbfio_memory_range_io_handle_t *closed_memory_range_io_handle = NULL;
+	libbfio_memory_range_io_handle_t *memory_range_io_handle        = NULL;
+	libcerror_error_t *error                                        = NULL;
+	ssize_t write_count                                             = 0;
+	int result                                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_memory_range_io_handle_initialize(
+	          &memory_range_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_range_io_handle",
+	 memory_range_io_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_io_handle_set(
+	          memory_range_io_handle,
+	          bfio_test_memory_range_io_handle_data,
+	          4096,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	write_count = libbfio_memory_range_io_handle_write_buffer(
+	               NULL,
+	               buffer,
+	               32,
+	               &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	memory_range_io_handle->range_start = NULL;
+
+	write_count = libbfio_memory_range_io_handle_write_buffer(
+	               memory_range_io_handle,
+	               buffer,
+	               32,
+	               &error );
+
+	memory_range_io_handle->range_start = bfio_test_memory_range_io_handle_data;
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	memory_range_io_handle->is_open = 0;
+
+	write_count = libbfio_memory_range_io_handle_write_buffer(
+	               memory_range_io_handle,
+	               buffer,
+	               32,
+	               &error );
+
+	memory_range_io_handle->is_open = 1;
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	memory_range_io_handle->access_flags = 0;
+
+	write_count = libbfio_memory_range_io_handle_write_buffer(
+	               memory_range_io_handle,
+	               buffer,
+	               32,
+	               &error );
+
+	memory_range_io_handle->access_flags = LIBBFIO_ACCESS_FLAG_WRITE;
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	write_count = libbfio_memory_range_io_handle_write_buffer(
+	               memory_range_io_handle,
+	               NULL,
+	               32,
+	               &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	write_count = libbfio_memory_range_io_handle_write_buffer(
+	               memory_range_io_handle,
+	               buffer,
+	               (size_t) SSIZE_MAX + 1,
+	               &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	memory_range_io_handle->range_offset = 4096 + 1;
+
+	write_count = libbfio_memory_range_io_handle_write_buffer(
+	               memory_range_io_handle,
+	               buffer,
+	               32,
+	               &error );
+
+	memory_range_io_handle->range_offset = 0;
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_BFIO_TEST_MEMORY ) && defined( OPTIMIZATION_DISABLED )
+
+	/* Test libbfio_memory_range_io_handle_write_buffer with memcpy failing
+	 */
+	bfio_test_memcpy_attempts_before_fail = 0;
+
+	write_count = libbfio_memory_range_io_handle_write_buffer(
+	               memory_range_io_handle,
+	               buffer,
+	               32,
+	               &error );
+
+	if( bfio_test_memcpy_attempts_before_fail != -1 )
+	{
+		bfio_test_memcpy_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_BFIO_TEST_MEMORY ) && defined( OPTIMIZATION_DISABLED ) */
+
+	/* Initialize test
+	 */
+	result = libbfio_memory_range_io_handle_initialize(
+	          &closed_memory_range_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "closed_memory_range_io_handle",
+	 closed_memory_range_io_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test write buffer with error code on a closed file IO handle
+	 */
+	write_count = libbfio_memory_range_io_handle_write_buffer(
+	               closed_memory_range_io_handle,
+	               buffer,
+	               0,
+	               &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_memory_range_io_handle_free(
+	          &closed_memory_range_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "closed_memory_range_io_handle",
+	 closed_memory_range_io_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_io_handle_set(
+	          memory_range_io_handle,
+	          bfio_test_memory_range_io_handle_data,
+	          4096,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_io_handle_free(
+	          &memory_range_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "memory_range_io_handle",
+	 memory_range_io_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( closed_memory_range_io_handle != NULL )
+	{
+		libbfio_memory_range_io_handle_free(
+		 &closed_memory_range_io_handle,
+		 NULL );
+	}
+	if( memory_range_io_handle != NULL )
+	{
+		libbfio_memory_range_io_handle_free(
+		 &memory_range_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_memory_range_io_handle_write_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_memory_range_io_handle_write_buffer_at_offset(
+     void )
+{
+	uint8_t buffer[ 32 ] = {
+		'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+		'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', '0', '1', '2', '3', '4', '5' };
+
+	libbfio_memory_range_io_handle_t *closed_memory_range_io_handle = NULL;
+	libbfio_memory_range_io_handle_t *memory_range_io_handle        = NULL;
+	libcerror_error_t *error                                        = NULL;
+	ssize_t write_count                                             = 0;
+	int result                                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_memory_range_io_handle_initialize(
+	          &memory_range_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_range_io_handle",
+	 memory_range_io_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_io_handle_set(
+	          memory_range_io_handle,
+	          bfio_test_memory_range_io_handle_data,
+	          4096,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_io_handle_open(
+	          memory_range_io_handle,
+	          LIBBFIO_OPEN_WRITE,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	write_count = libbfio_memory_range_io_handle_write_buffer_at_offset(
+	               memory_range_io_handle,
+	               buffer,
+	               32,
+	               4096 - 16,
+	               &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) 16 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          &( bfio_test_memory_range_io_handle_data[ 4096 - 16 ] ),
+	          buffer,
+	          16 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	write_count = libbfio_memory_range_io_handle_write_buffer_at_offset(
+	               memory_range_io_handle,
+	               buffer,
+	               32,
+	               4096,
+	               &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	write_count = libbfio_memory_range_io_handle_write_buffer_at_offset(
+	               NULL,
+	               buffer,
+	               32,
+	               0,
+	               &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	memory_range_io_handle->range_start = NULL;
+
+	write_count = libbfio_memory_range_io_handle_write_buffer_at_offset(
+	               memory_range_io_handle,
+	               buffer,
+	               32,
+	               0,
+	               &error );
+
+	memory_range_io_handle->range_start = bfio_test_memory_range_io_handle_data;
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	memory_range_io_handle->is_open = 0;
+
+	write_count = libbfio_memory_range_io_handle_write_buffer_at_offset(
+	               memory_range_io_handle,
+	               buffer,
+	               32,
+	               0,
+	               &error );
+
+	memory_range_io_handle->is_open = 1;
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	memory_range_io_handle->access_flags = 0;
+
+	write_count = libbfio_memory_range_io_handle_write_buffer_at_offset(
+	               memory_range_io_handle,
+	               buffer,
+	               32,
+	               0,
+	               &error );
+
+	memory_range_io_handle->access_flags = LIBBFIO_ACCESS_FLAG_WRITE;
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	write_count = libbfio_memory_range_io_handle_write_buffer_at_offset(
+	               memory_range_io_handle,
+	               NULL,
+	               32,
+	               0,
+	               &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	write_count = libbfio_memory_range_io_handle_write_buffer_at_offset(
+	               memory_range_io_handle,
+	               buffer,
+	               (size_t) SSIZE_MAX + 1,
+	               0,
+	               &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	write_count = libbfio_memory_range_io_handle_write_buffer_at_offset(
+	               memory_range_io_handle,
+	               buffer,
+	               32,
+	               -1,
+	               &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_BFIO_TEST_MEMORY ) && defined( OPTIMIZATION_DISABLED )
+
+	/* Test libbfio_memory_range_io_handle_write_buffer with memcpy failing
+	 */
+	bfio_test_memcpy_attempts_before_fail = 0;
+
+	write_count = libbfio_memory_range_io_handle_write_buffer_at_offset(
+	               memory_range_io_handle,
+	               buffer,
+	               32,
+	               0,
+	               &error );
+
+	if( bfio_test_memcpy_attempts_before_fail != -1 )
+	{
+		bfio_test_memcpy_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_BFIO_TEST_MEMORY ) && defined( OPTIMIZATION_DISABLED ) */
+
+	/* Initialize test
+	 */
+	result = libbfio_memory_range_io_handle_initialize(
+	          &closed_memory_range_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "closed_memory_range_io_handle",
+	 closed_memory_range_io_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test write buffer with error code on a closed file IO handle
+	 */
+	write_count = libbfio_memory_range_io_handle_write_buffer_at_offset(
+	               closed_memory_range_io_handle,
+	               buffer,
+	               0,
+	               0,
+	               &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_memory_range_io_handle_free(
+	          &closed_memory_range_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "closed_memory_range_io_handle",
+	 closed_memory_range_io_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_io_handle_set(
+	          memory_range_io_handle,
+	          bfio_test_memory_range_io_handle_data,
+	          4096,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_io_handle_free(
+	          &memory_range_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "memory_range_io_handle",
+	 memory_range_io_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( closed_memory_range_io_handle != NULL )
+	{
+		libbfio_memory_range_io_handle_free(
+		 &closed_memory_range_io_handle,
+		 NULL );
+	}
+	if( memory_range_io_handle != NULL )
+	{
+		libbfio_memory_range_io_handle_free(
+		 &memory_range_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_memory_range_io_handle_seek_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_memory_range_io_handle_seek_offset(
+     libbfio_memory_range_io_handle_t *memory_range_io_handle )
+{
+	libbfio_memory_range_io_handle_t *closed_memory_range_io_handle = NULL;
+	libcerror_error_t *error                                        = NULL;
+	size64_t file_size                                              = 0;
+	off64_t offset                                                  = 0;
+	off64_t seek_offset                                             = 0;
+	int result                                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_memory_range_io_handle_get_size(
+	          memory_range_io_handle,
+	          &file_size,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 1 );
 
-	BFIO_TEST_ASSERT_IS_NULL(
-	 "memory_range_io_handle",
-	 memory_range_io_handle );
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: 0 and whence: SEEK_SET
+	 */
+	seek_offset = 0;
+
+	offset = libbfio_memory_range_io_handle_seek_offset(
+	          memory_range_io_handle,
+	          seek_offset,
+	          SEEK_SET,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) seek_offset );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: <file_size> and whence: SEEK_SET
+	 */
+	seek_offset = (off64_t) file_size;
+
+	offset = libbfio_memory_range_io_handle_seek_offset(
+	          memory_range_io_handle,
+	          seek_offset,
+	          SEEK_SET,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) seek_offset );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: <file_size / 5> and whence: SEEK_SET
+	 */
+	seek_offset = (off64_t) ( file_size / 5 );
+
+	offset = libbfio_memory_range_io_handle_seek_offset(
+	          memory_range_io_handle,
+	          seek_offset,
+	          SEEK_SET,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) seek_offset );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: <file_size / 5> and whence: SEEK_CUR
+	 */
+	offset = libbfio_memory_range_io_handle_seek_offset(
+	          memory_range_io_handle,
+	          seek_offset,
+	          SEEK_CUR,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) seek_offset + seek_offset );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: <-1 * (file_size / 5)> and whence: SEEK_CUR
+	 */
+	offset = libbfio_memory_range_io_handle_seek_offset(
+	          memory_range_io_handle,
+	          -1 * seek_offset,
+	          SEEK_CUR,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) seek_offset );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: <file_size + 987> and whence: SEEK_SET
+	 */
+	seek_offset = (off64_t) ( file_size + 987 );
+
+	offset = libbfio_memory_range_io_handle_seek_offset(
+	          memory_range_io_handle,
+	          seek_offset,
+	          SEEK_SET,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) seek_offset );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: 0 and whence: SEEK_CUR
+	 */
+	offset = libbfio_memory_range_io_handle_seek_offset(
+	          memory_range_io_handle,
+	          0,
+	          SEEK_CUR,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) seek_offset );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	return( 1 );
+	/* Test seek offset with offset: 0 and whence: SEEK_END
+	 */
+	offset = libbfio_memory_range_io_handle_seek_offset(
+	          memory_range_io_handle,
+	          0,
+	          SEEK_END,
+	          &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( closed_memory_range_io_handle != NULL )
-	{
-		libbfio_memory_range_io_handle_free(
-		 &closed_memory_range_io_handle,
-		 NULL );
-	}
-	if( memory_range_io_handle != NULL )
-	{
-		libbfio_memory_range_io_handle_free(
-		 &memory_range_io_handle,
-		 NULL );
-	}
-	return( 0 );
-}
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) file_size );
 
-/* Tests the libbfio_memory_range_io_handle_seek_offset function
- * Returns 1 if successful or 0 if not
- */
-int bfio_test_memory_range_io_handle_seek_offset(
-     libbfio_memory_range_io_handle_t *memory_range_io_handle )
-{
-	libbfio_memory_range_io_handle_t *closed_memory_range_io_handle = NULL;
-	libcerror_error_t *error                                        = NULL;
-	size64_t file_size                                              = 0;
-	off64_t offset                                                  = 0;
-	off64_t seek_offset                                             = 0;
-	int result                                                      = 0;
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Initialize test
+	/* Test seek offset with offset: <-1 * (file_size / 4)> and whence: SEEK_END
 	 */
-	result = libbfio_memory_range_io_handle_get_size(
+	seek_offset = (off64_t) ( file_size / 4 );
+
+	offset = libbfio_memory_range_io_handle_seek_offset(
 	          memory_range_io_handle,
-	          &file_size,
+	          -1 * seek_offset,
+	          SEEK_END,
 	          &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) file_size - seek_offset );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test seek offset with offset: 0 and whence: SEEK_SET
+	/* Test seek offset with offset: 542 and whence: SEEK_END
 	 */
-	seek_offset = 0;
+	offset = libbfio_memory_range_io_handle_seek_offset(
+	          memory_range_io_handle,
+	          542,
+	          SEEK_END,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) file_size + 542 );
 
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek offset with offset: <-1 * file_size> and whence: SEEK_END
+	 */
 	offset = libbfio_memory_range_io_handle_seek_offset(
 	          memory_range_io_handle,
-	          seek_offset,
-	          SEEK_SET,
+	          -1 * file_size,
+	          SEEK_END,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT64(
 	 "offset",
 	 offset,
-	 (int64_t) seek_offset );
+	 (int64_t) 0 );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test seek offset with offset: <file_size> and whence: SEEK_SET
+	/* Test error cases
 	 */
-	seek_offset = (off64_t) file_size;
+	offset = libbfio_memory_range_io_handle_seek_offset(
+	          NULL,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	memory_range_io_handle->is_open = 0;
 
 	offset = libbfio_memory_range_io_handle_seek_offset(
 	          memory_range_io_handle,
-	          seek_offset,
+	          0,
 	          SEEK_SET,
 	          &error );
 
+	memory_range_io_handle->is_open = 1;
+
 	BFIO_TEST_ASSERT_EQUAL_INT64(
 	 "offset",
 	 offset,
-	 (int64_t) seek_offset );
+	 (int64_t) -1 );
 
-	BFIO_TEST_ASSERT_IS_NULL(
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test seek offset with offset: <file_size / 5> and whence: SEEK_SET
-	 */
-	seek_offset = (off64_t) ( file_size / 5 );
+	libcerror_error_free(
+	 &error );
 
+	/* Test seek offset with offset: -987 and whence: SEEK_SET
+	 */
 	offset = libbfio_memory_range_io_handle_seek_offset(
 	          memory_range_io_handle,
-	          seek_offset,
+	          -987,
 	          SEEK_SET,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT64(
 	 "offset",
 	 offset,
-	 (int64_t) seek_offset );
+	 (int64_t) -1 );
 
-	BFIO_TEST_ASSERT_IS_NULL(
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test seek offset with offset: <file_size / 5> and whence: SEEK_CUR
+	libcerror_error_free(
+	 &error );
+
+	/* Test seek offset with offset: <1 * (file_size + 542)> and whence: SEEK_END
 	 */
 	offset = libbfio_memory_range_io_handle_seek_offset(
 	          memory_range_io_handle,
-	          seek_offset,
-	          SEEK_CUR,
+	          -1 * (file_size + 542),
+	          SEEK_END,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT64(
 	 "offset",
 	 offset,
-	 (int64_t) seek_offset + seek_offset );
+	 (int64_t) -1 );
 
-	BFIO_TEST_ASSERT_IS_NULL(
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test seek offset with offset: <-1 * (file_size / 5)> and whence: SEEK_CUR
+	libcerror_error_free(
+	 &error );
+
+	/* Test seek offset with offset: 0 and whence: UNKNOWN (88)
 	 */
 	offset = libbfio_memory_range_io_handle_seek_offset(
 	          memory_range_io_handle,
-	          -1 * seek_offset,
-	          SEEK_CUR,
+	          0,
+	          88,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT64(
 	 "offset",
 	 offset,
-	 (int64_t) seek_offset );
+	 (int64_t) -1 );
 
-	BFIO_TEST_ASSERT_IS_NULL(
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test seek offset with offset: <file_size + 987> and whence: SEEK_SET
+	libcerror_error_free(
+	 &error );
+
+	/* Initialize test
 	 */
-	seek_offset = (off64_t) ( file_size + 987 );
+	result = libbfio_memory_range_io_handle_initialize(
+	          &closed_memory_range_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "closed_memory_range_io_handle",
+	 closed_memory_range_io_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
+	/* Test seek offset on a closed file IO handle
+	 */
 	offset = libbfio_memory_range_io_handle_seek_offset(
-	          memory_range_io_handle,
-	          seek_offset,
+	          closed_memory_range_io_handle,
+	          0,
 	          SEEK_SET,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT64(
 	 "offset",
 	 offset,
-	 (int64_t) seek_offset );
+	 (int64_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_memory_range_io_handle_free(
+	          &closed_memory_range_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "closed_memory_range_io_handle",
+	 closed_memory_range_io_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( closed_memory_range_io_handle != NULL )
+	{
+		libbfio_memory_range_io_handle_free(
+		 &closed_memory_range_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_memory_range_io_handle_get_data_pointer function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_memory_range_io_handle_get_data_pointer(
+     libbfio_memory_range_io_handle_t *memory_range_io_handle )
+{
+	uint8_t expected_buffer[ 32 ];
+
+	const uint8_t *data      = NULL;
+	libcerror_error_t *error = NULL;
+	size64_t file_size       = 0;
+	ssize_t read_count       = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_memory_range_io_handle_get_size(
+	         memory_range_io_handle,
+	         &file_size,
+	         &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test seek offset with offset: 0 and whence: SEEK_CUR
-	 */
-	offset = libbfio_memory_range_io_handle_seek_offset(
-	          memory_range_io_handle,
-	          0,
-	          SEEK_CUR,
-	          &error );
+	if( file_size < 32 )
+	{
+		return( 1 );
+	}
+	read_count = libbfio_memory_range_io_handle_read_buffer_at_offset(
+	             memory_range_io_handle,
+	             expected_buffer,
+	             8,
+	             12,
+	             &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) seek_offset );
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 8 );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test seek offset with offset: 0 and whence: SEEK_END
+	/* Test regular cases
 	 */
-	offset = libbfio_memory_range_io_handle_seek_offset(
-	          memory_range_io_handle,
-	          0,
-	          SEEK_END,
-	          &error );
+	result = libbfio_memory_range_io_handle_get_data_pointer(
+	         memory_range_io_handle,
+	         12,
+	         8,
+	         &data,
+	         &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) file_size );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test seek offset with offset: <-1 * (file_size / 4)> and whence: SEEK_END
-	 */
-	seek_offset = (off64_t) ( file_size / 4 );
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
 
-	offset = libbfio_memory_range_io_handle_seek_offset(
-	          memory_range_io_handle,
-	          -1 * seek_offset,
-	          SEEK_END,
-	          &error );
+	result = memory_compare(
+	          data,
+	          expected_buffer,
+	          8 );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) file_size - seek_offset );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libbfio_memory_range_io_handle_release_data_pointer(
+	         memory_range_io_handle,
+	         12,
+	         data,
+	         &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test seek offset with offset: 542 and whence: SEEK_END
+	/* Test get data pointer that exceeds the end of the data
 	 */
-	offset = libbfio_memory_range_io_handle_seek_offset(
-	          memory_range_io_handle,
-	          542,
-	          SEEK_END,
-	          &error );
+	result = libbfio_memory_range_io_handle_get_data_pointer(
+	         memory_range_io_handle,
+	         (off64_t) file_size - 8,
+	         32,
+	         &data,
+	         &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) file_size + 542 );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test seek offset with offset: <-1 * file_size> and whence: SEEK_END
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "data",
+	 data );
+
+	/* Test get data pointer beyond the end of the data
 	 */
-	offset = libbfio_memory_range_io_handle_seek_offset(
-	          memory_range_io_handle,
-	          -1 * file_size,
-	          SEEK_END,
-	          &error );
+	result = libbfio_memory_range_io_handle_get_data_pointer(
+	         memory_range_io_handle,
+	         (off64_t) file_size,
+	         8,
+	         &data,
+	         &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) 0 );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -2072,16 +3072,17 @@ int bfio_test_memory_range_io_handle_seek_offset(
 
 	/* Test error cases
 	 */
-	offset = libbfio_memory_range_io_handle_seek_offset(
-	          NULL,
-	          0,
-	          SEEK_SET,
-	          &error );
+	result = libbfio_memory_range_io_handle_get_data_pointer(
+	         NULL,
+	         12,
+	         8,
+	         &data,
+	         &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -2090,20 +3091,36 @@ int bfio_test_memory_range_io_handle_seek_offset(
 	libcerror_error_free(
 	 &error );
 
-	memory_range_io_handle->is_open = 0;
+	result = libbfio_memory_range_io_handle_get_data_pointer(
+	         memory_range_io_handle,
+	         -1,
+	         8,
+	         &data,
+	         &error );
 
-	offset = libbfio_memory_range_io_handle_seek_offset(
-	          memory_range_io_handle,
-	          0,
-	          SEEK_SET,
-	          &error );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-	memory_range_io_handle->is_open = 1;
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_memory_range_io_handle_get_data_pointer(
+	         memory_range_io_handle,
+	         12,
+	         (size_t) SSIZE_MAX + 1,
+	         &data,
+	         &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -2112,18 +3129,17 @@ int bfio_test_memory_range_io_handle_seek_offset(
 	libcerror_error_free(
 	 &error );
 
-	/* Test seek offset with offset: -987 and whence: SEEK_SET
-	 */
-	offset = libbfio_memory_range_io_handle_seek_offset(
-	          memory_range_io_handle,
-	          -987,
-	          SEEK_SET,
-	          &error );
+	result = libbfio_memory_range_io_handle_get_data_pointer(
+	         memory_range_io_handle,
+	         12,
+	         8,
+	         NULL,
+	         &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -2132,18 +3148,57 @@ int bfio_test_memory_range_io_handle_seek_offset(
 	libcerror_error_free(
 	 &error );
 
-	/* Test seek offset with offset: <1 * (file_size + 542)> and whence: SEEK_END
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_memory_range_io_handle_release_data_pointer function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_memory_range_io_handle_release_data_pointer(
+     libbfio_memory_range_io_handle_t *memory_range_io_handle )
+{
+	const uint8_t *data      = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
 	 */
-	offset = libbfio_memory_range_io_handle_seek_offset(
-	          memory_range_io_handle,
-	          -1 * (file_size + 542),
-	          SEEK_END,
-	          &error );
+	result = libbfio_memory_range_io_handle_get_data_pointer(
+	         memory_range_io_handle,
+	         0,
+	         8,
+	         &data,
+	         &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_memory_range_io_handle_release_data_pointer(
+	         NULL,
+	         0,
+	         data,
+	         &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -2152,18 +3207,16 @@ int bfio_test_memory_range_io_handle_seek_offset(
 	libcerror_error_free(
 	 &error );
 
-	/* Test seek offset with offset: 0 and whence: UNKNOWN (88)
-	 */
-	offset = libbfio_memory_range_io_handle_seek_offset(
-	          memory_range_io_handle,
-	          0,
-	          88,
-	          &error );
+	result = libbfio_memory_range_io_handle_release_data_pointer(
+	         memory_range_io_handle,
+	         -1,
+	         data,
+	         &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -2172,37 +3225,34 @@ int bfio_test_memory_range_io_handle_seek_offset(
 	libcerror_error_free(
 	 &error );
 
-	/* Initialize test
-	 */
-	result = libbfio_memory_range_io_handle_initialize(
-	          &closed_memory_range_io_handle,
-	          &error );
+	result = libbfio_memory_range_io_handle_release_data_pointer(
+	         memory_range_io_handle,
+	         0,
+	         NULL,
+	         &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
-	 "closed_memory_range_io_handle",
-	 closed_memory_range_io_handle );
-
-	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test seek offset on a closed file IO handle
-	 */
-	offset = libbfio_memory_range_io_handle_seek_offset(
-	          closed_memory_range_io_handle,
-	          0,
-	          SEEK_SET,
-	          &error );
+	libcerror_error_free(
+	 &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	result = libbfio_memory_range_io_handle_release_data_pointer(
+	         memory_range_io_handle,
+	         1,
+	         data,
+	         &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -2213,19 +3263,17 @@ int bfio_test_memory_range_io_handle_seek_offset(
 
 	/* Clean up
 	 */
-	result = libbfio_memory_range_io_handle_free(
-	          &closed_memory_range_io_handle,
-	          &error );
+	result = libbfio_memory_range_io_handle_release_data_pointer(
+	         memory_range_io_handle,
+	         0,
+	         data,
+	         &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 1 );
 
-	BFIO_TEST_ASSERT_IS_NULL(
-	 "closed_memory_range_io_handle",
-	 closed_memory_range_io_handle );
-
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
@@ -2238,12 +3286,6 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( closed_memory_range_io_handle != NULL )
-	{
-		libbfio_memory_range_io_handle_free(
-		 &closed_memory_range_io_handle,
-		 NULL );
-	}
 	return( 0 );
 }
 
@@ -2516,6 +3558,10 @@ int main(
 	 "libbfio_memory_range_io_handle_write_buffer",
 	 bfio_test_memory_range_io_handle_write_buffer );
 
+	BFIO_TEST_RUN(
+	 "libbfio_memory_range_io_handle_write_buffer_at_offset",
+	 bfio_test_memory_range_io_handle_write_buffer_at_offset );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 	BFIO_TEST_RUN(
 	 "libbfio_memory_range_io_handle_open",
@@ -2597,6 +3643,21 @@ int main(
 	 bfio_test_memory_range_io_handle_read_buffer,
 	 memory_range_io_handle );
 
+	BFIO_TEST_RUN_WITH_ARGS(
+	 "libbfio_memory_range_io_handle_read_buffer_at_offset",
+	 bfio_test_memory_range_io_handle_read_buffer_at_offset,
+	 memory_range_io_handle );
+
+	BFIO_TEST_RUN_WITH_ARGS(
+	 "libbfio_memory_range_io_handle_get_data_pointer",
+	 bfio_test_memory_range_io_handle_get_data_pointer,
+	 memory_range_io_handle );
+
+	BFIO_TEST_RUN_WITH_ARGS(
+	 "libbfio_memory_range_io_handle_release_data_pointer",
+	 bfio_test_memory_range_io_handle_release_data_pointer,
+	 memory_range_io_handle );
+
 	BFIO_TEST_RUN_WITH_ARGS(
 	 "libbfio_memory_range_io_handle_exists",
 	 bfio_test_memory_range_io_handle_exists,
@@ -41,6 +41,8 @@
 #include "bfio_test_memory.h"
 #include "bfio_test_rwlock.h"
 
+#include "../libbfio/libbfio_definitions.h"
+#include "../libbfio/libbfio_handle.h"
 #include "../libbfio/libbfio_pool.h"
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && SIZEOF_WCHAR_T != 2 && SIZEOF_WCHAR_T != 4
@@ -1154,14 +1156,13 @@ int bfio_test_internal_pool_open_handle(
 {
 	char narrow_source[ 256 ];
 
-	libbfio_handle_t *handle        = NULL;
-	libbfio_handle_t *test_handle   = NULL;
-	libbfio_pool_t *pool            = NULL;
-	libcdata_list_t *last_used_list = NULL;
-	libcerror_error_t *error        = NULL;
-	size_t source_length            = 0;
-	int entry_index                 = 0;
-	int result                      = 0;
+	libbfio_handle_t *handle      = NULL;
+	libbfio_handle_t *test_handle = NULL;
+	libbfio_pool_t *pool          = NULL;
+	libcerror_error_t *error      = NULL;
+	size_t source_length          = 0;
+	int entry_index               = 0;
+	int result                    = 0;
 
 	/* Initialize test
 	 */
@@ -1307,17 +1308,253 @@ int bfio_test_internal_pool_open_handle(
 	libcerror_error_free(
 	 &error );
 
-	last_used_list = ( (libbfio_internal_pool_t *) pool )->last_used_list;
+	result = libbfio_internal_pool_open_handle(
+	          (libbfio_internal_pool_t *) pool,
+	          NULL,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_pool_close_all(
+	          pool,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_free(
+	          &pool,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "pool",
+	 pool );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( pool != NULL )
+	{
+		libbfio_pool_free(
+		 &pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_internal_pool_close_evicted_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_internal_pool_close_evicted_handle(
+     const system_character_t *source )
+{
+	char narrow_source[ 256 ];
+
+	libbfio_handle_t *handle             = NULL;
+	libbfio_handle_t *test_handles[ 2 ]  = { NULL, NULL };
+	libbfio_pool_t *pool                 = NULL;
+	libcerror_error_t *error             = NULL;
+	size_t source_length                 = 0;
+	int entry_index                      = 0;
+	int handle_index                     = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = bfio_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_initialize(
+	          &pool,
+	          0,
+	          1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "pool",
+	 pool );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	source_length = narrow_string_length(
+	                 narrow_source );
+
+	for( handle_index = 0;
+	     handle_index < 2;
+	     handle_index++ )
+	{
+		result = libbfio_file_initialize(
+		          &handle,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "handle",
+		 handle );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_file_set_name(
+		          handle,
+		          narrow_source,
+		          source_length,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_pool_append_handle(
+		          pool,
+		          &entry_index,
+		          handle,
+		          LIBBFIO_OPEN_READ,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	( (libbfio_internal_pool_t *) pool )->last_used_list = NULL;
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
+		test_handles[ handle_index ] = handle;
+		handle                       = NULL;
+	}
+	/* Test regular cases
+	 */
 	result = libbfio_internal_pool_open_handle(
 	          (libbfio_internal_pool_t *) pool,
-	          test_handle,
+	          test_handles[ 0 ],
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Opening the second handle evicts and closes the first handle
+	 */
+	result = libbfio_internal_pool_open_handle(
+	          (libbfio_internal_pool_t *) pool,
+	          test_handles[ 1 ],
 	          LIBBFIO_OPEN_READ,
 	          &error );
 
-	( (libbfio_internal_pool_t *) pool )->last_used_list = last_used_list;
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_is_open(
+	          test_handles[ 0 ],
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT8(
+	 "pool_state",
+	 ( (libbfio_internal_handle_t *) test_handles[ 0 ] )->pool_state,
+	 (uint8_t) LIBBFIO_POOL_HANDLE_STATE_IDLE );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "number_of_open_handles",
+	 ( (libbfio_internal_pool_t *) pool )->number_of_open_handles,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libbfio_internal_pool_close_evicted_handle(
+	          NULL,
+	          test_handles[ 0 ],
+	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1331,10 +1568,9 @@ int bfio_test_internal_pool_open_handle(
 	libcerror_error_free(
 	 &error );
 
-	result = libbfio_internal_pool_open_handle(
+	result = libbfio_internal_pool_close_evicted_handle(
 	          (libbfio_internal_pool_t *) pool,
 	          NULL,
-	          LIBBFIO_OPEN_READ,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -1412,14 +1648,14 @@ int bfio_test_internal_pool_append_handle_to_last_used_list(
 {
 	char narrow_source[ 256 ];
 
-	libbfio_handle_t *handle        = NULL;
-	libbfio_handle_t *test_handle   = NULL;
-	libbfio_pool_t *pool            = NULL;
-	libcdata_list_t *last_used_list = NULL;
-	libcerror_error_t *error        = NULL;
-	size_t source_length            = 0;
-	int entry_index                 = 0;
-	int result                      = 0;
+	libbfio_handle_t *evicted_handle = NULL;
+	libbfio_handle_t *handle         = NULL;
+	libbfio_handle_t *test_handle    = NULL;
+	libbfio_pool_t *pool             = NULL;
+	libcerror_error_t *error         = NULL;
+	size_t source_length             = 0;
+	int entry_index                  = 0;
+	int result                       = 0;
 
 	/* Initialize test
 	 */
@@ -1531,6 +1767,7 @@ int bfio_test_internal_pool_append_handle_to_last_used_list(
 	result = libbfio_internal_pool_append_handle_to_last_used_list(
 	          (libbfio_internal_pool_t *) pool,
 	          test_handle,
+	          &evicted_handle,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -1538,6 +1775,10 @@ int bfio_test_internal_pool_append_handle_to_last_used_list(
 	 result,
 	 1 );
 
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "evicted_handle",
+	 evicted_handle );
+
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
@@ -1549,6 +1790,7 @@ int bfio_test_internal_pool_append_handle_to_last_used_list(
 	result = libbfio_internal_pool_append_handle_to_last_used_list(
 	          NULL,
 	          test_handle,
+	          &evicted_handle,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -1563,17 +1805,12 @@ int bfio_test_internal_pool_append_handle_to_last_used_list(
 	libcerror_error_free(
 	 &error );
 
-	last_used_list = ( (libbfio_internal_pool_t *) pool )->last_used_list;
-
-	( (libbfio_internal_pool_t *) pool )->last_used_list = NULL;
-
 	result = libbfio_internal_pool_append_handle_to_last_used_list(
 	          (libbfio_internal_pool_t *) pool,
-	          test_handle,
+	          NULL,
+	          &evicted_handle,
 	          &error );
 
-	( (libbfio_internal_pool_t *) pool )->last_used_list = last_used_list;
-
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -1588,6 +1825,7 @@ int bfio_test_internal_pool_append_handle_to_last_used_list(
 
 	result = libbfio_internal_pool_append_handle_to_last_used_list(
 	          (libbfio_internal_pool_t *) pool,
+	          test_handle,
 	          NULL,
 	          &error );
 
@@ -1666,14 +1904,14 @@ int bfio_test_internal_pool_move_handle_to_front_of_last_used_list(
 {
 	char narrow_source[ 256 ];
 
-	libbfio_handle_t *handle        = NULL;
-	libbfio_handle_t *test_handle   = NULL;
-	libbfio_pool_t *pool            = NULL;
-	libcdata_list_t *last_used_list = NULL;
-	libcerror_error_t *error        = NULL;
-	size_t source_length            = 0;
-	int entry_index                 = 0;
-	int result                      = 0;
+	libbfio_handle_t *evicted_handle = NULL;
+	libbfio_handle_t *handle         = NULL;
+	libbfio_handle_t *test_handle    = NULL;
+	libbfio_pool_t *pool             = NULL;
+	libcerror_error_t *error         = NULL;
+	size_t source_length             = 0;
+	int entry_index                  = 0;
+	int result                       = 0;
 
 	/* Initialize test
 	 */
@@ -1768,6 +2006,7 @@ int bfio_test_internal_pool_move_handle_to_front_of_last_used_list(
 	result = libbfio_internal_pool_append_handle_to_last_used_list(
 	          (libbfio_internal_pool_t *) pool,
 	          test_handle,
+	          &evicted_handle,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -1802,29 +2041,6 @@ int bfio_test_internal_pool_move_handle_to_front_of_last_used_list(
 	          test_handle,
 	          &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	last_used_list = ( (libbfio_internal_pool_t *) pool )->last_used_list;
-
-	( (libbfio_internal_pool_t *) pool )->last_used_list = NULL;
-
-	result = libbfio_internal_pool_move_handle_to_front_of_last_used_list(
-	          (libbfio_internal_pool_t *) pool,
-	          test_handle,
-	          &error );
-
-	( (libbfio_internal_pool_t *) pool )->last_used_list = last_used_list;
-
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -1909,21 +2125,29 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) */
-
-/* Tests the libbfio_pool_get_number_of_handles functions
+/* Tests the libbfio_internal_pool_remove_handle_from_last_used_list function
  * Returns 1 if successful or 0 if not
  */
-int bfio_test_pool_get_number_of_handles(
-     libbfio_pool_t *pool )
+int bfio_test_internal_pool_remove_handle_from_last_used_list(
+     const system_character_t *source )
 {
-	libcerror_error_t *error = NULL;
-	int number_of_handles    = 0;
-	int result               = 0;
+	char narrow_source[ 256 ];
 
-	result = libbfio_pool_get_number_of_handles(
-	          pool,
-	          &number_of_handles,
+	libbfio_handle_t *evicted_handle = NULL;
+	libbfio_handle_t *handle         = NULL;
+	libbfio_handle_t *test_handle    = NULL;
+	libbfio_pool_t *pool             = NULL;
+	libcerror_error_t *error         = NULL;
+	size_t source_length             = 0;
+	int entry_index                  = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = bfio_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -1935,128 +2159,128 @@ int bfio_test_pool_get_number_of_handles(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libbfio_pool_get_number_of_handles(
-	          NULL,
-	          &number_of_handles,
+	result = libbfio_pool_initialize(
+	          &pool,
+	          0,
+	          LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "pool",
+	 pool );
+
+	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libbfio_pool_get_number_of_handles(
-	          pool,
-	          NULL,
+	result = libbfio_file_initialize(
+	          &handle,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	source_length = narrow_string_length(
+	                 narrow_source );
 
-#if defined( HAVE_BFIO_TEST_RWLOCK )
+	result = libbfio_file_set_name(
+	          handle,
+	          narrow_source,
+	          source_length,
+	          &error );
 
-	/* Test libbfio_pool_get_number_of_handles with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
-	 */
-	bfio_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	result = libbfio_pool_get_number_of_handles(
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_append_handle(
 	          pool,
-	          &number_of_handles,
+	          &entry_index,
+	          handle,
+	          LIBBFIO_OPEN_READ,
 	          &error );
 
-	if( bfio_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
-	{
-		bfio_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		BFIO_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		BFIO_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		libcerror_error_free(
-		 &error );
-	}
-#if defined( HAVE_LOCAL_LIBCDATA )
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Test libbfio_pool_get_number_of_handles with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
-	 */
-	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+	test_handle = handle;
+	handle      = NULL;
 
-	result = libbfio_pool_get_number_of_handles(
-	          pool,
-	          &number_of_handles,
+	result = libbfio_internal_pool_append_handle_to_last_used_list(
+	          (libbfio_internal_pool_t *) pool,
+	          test_handle,
+	          &evicted_handle,
 	          &error );
 
-	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
-	{
-		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		BFIO_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		BFIO_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_LOCAL_LIBCDATA ) */
-#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
+	/* Test regular cases
+	 */
+	result = libbfio_internal_pool_remove_handle_from_last_used_list(
+	          (libbfio_internal_pool_t *) pool,
+	          test_handle,
+	          &error );
 
-	return( 1 );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-/* Tests the libbfio_pool_get_handle functions
- * Returns 1 if successful or 0 if not
- */
-int bfio_test_pool_get_handle(
-     libbfio_pool_t *pool )
-{
-	libbfio_handle_t *handle = NULL;
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "pool->last_used_list_first_handle",
+	 ( (libbfio_internal_pool_t *) pool )->last_used_list_first_handle );
 
-	result = libbfio_pool_get_handle(
-	          pool,
-	          0,
-	          &handle,
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "pool->last_used_list_last_handle",
+	 ( (libbfio_internal_pool_t *) pool )->last_used_list_last_handle );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "pool->number_of_open_handles",
+	 ( (libbfio_internal_pool_t *) pool )->number_of_open_handles,
+	 0 );
+
+	/* Test remove of a handle that is not in the last used list
+	 */
+	result = libbfio_internal_pool_remove_handle_from_last_used_list(
+	          (libbfio_internal_pool_t *) pool,
+	          test_handle,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -2070,10 +2294,9 @@ int bfio_test_pool_get_handle(
 
 	/* Test error cases
 	 */
-	result = libbfio_pool_get_handle(
-	          NULL,
-	          0,
-	          &handle,
+	result = libbfio_internal_pool_move_handle_to_front_of_last_used_list(
+	          (libbfio_internal_pool_t *) pool,
+	          test_handle,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -2088,10 +2311,9 @@ int bfio_test_pool_get_handle(
 	libcerror_error_free(
 	 &error );
 
-	result = libbfio_pool_get_handle(
-	          pool,
-	          -1,
-	          &handle,
+	result = libbfio_internal_pool_remove_handle_from_last_used_list(
+	          NULL,
+	          test_handle,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -2106,9 +2328,8 @@ int bfio_test_pool_get_handle(
 	libcerror_error_free(
 	 &error );
 
-	result = libbfio_pool_get_handle(
-	          pool,
-	          0,
+	result = libbfio_internal_pool_remove_handle_from_last_used_list(
+	          (libbfio_internal_pool_t *) pool,
 	          NULL,
 	          &error );
 
@@ -2124,68 +2345,37 @@ int bfio_test_pool_get_handle(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_BFIO_TEST_RWLOCK )
-
-	/* Test libbfio_pool_get_handle with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
+	/* Clean up
 	 */
-	bfio_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
-
-	result = libbfio_pool_get_handle(
+	result = libbfio_pool_close_all(
 	          pool,
-	          0,
-	          &handle,
 	          &error );
 
-	if( bfio_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
-	{
-		bfio_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		BFIO_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		BFIO_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
-#if defined( HAVE_LOCAL_LIBCDATA )
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-	/* Test libbfio_pool_get_handle with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
-	 */
-	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	result = libbfio_pool_get_handle(
-	          pool,
-	          0,
-	          &handle,
+	result = libbfio_pool_free(
+	          &pool,
 	          &error );
 
-	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
-	{
-		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		BFIO_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		BFIO_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "pool",
+	 pool );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_LOCAL_LIBCDATA ) */
-#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	return( 1 );
 
@@ -2195,22 +2385,36 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( pool != NULL )
+	{
+		libbfio_pool_free(
+		 &pool,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libbfio_pool_get_maximum_number_of_open_handles functions
+#endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) */
+
+/* Tests the libbfio_pool_get_number_of_handles functions
  * Returns 1 if successful or 0 if not
  */
-int bfio_test_pool_get_maximum_number_of_open_handles(
+int bfio_test_pool_get_number_of_handles(
      libbfio_pool_t *pool )
 {
-	libcerror_error_t *error           = NULL;
-	int maximum_number_of_open_handles = 0;
-	int result                         = 0;
+	libcerror_error_t *error = NULL;
+	int number_of_handles    = 0;
+	int result               = 0;
 
-	result = libbfio_pool_get_maximum_number_of_open_handles(
+	result = libbfio_pool_get_number_of_handles(
 	          pool,
-	          &maximum_number_of_open_handles,
+	          &number_of_handles,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -2224,9 +2428,9 @@ int bfio_test_pool_get_maximum_number_of_open_handles(
 
 	/* Test error cases
 	 */
-	result = libbfio_pool_get_maximum_number_of_open_handles(
+	result = libbfio_pool_get_number_of_handles(
 	          NULL,
-	          &maximum_number_of_open_handles,
+	          &number_of_handles,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -2241,7 +2445,7 @@ int bfio_test_pool_get_maximum_number_of_open_handles(
 	libcerror_error_free(
 	 &error );
 
-	result = libbfio_pool_get_maximum_number_of_open_handles(
+	result = libbfio_pool_get_number_of_handles(
 	          pool,
 	          NULL,
 	          &error );
@@ -2260,13 +2464,13 @@ int bfio_test_pool_get_maximum_number_of_open_handles(
 
 #if defined( HAVE_BFIO_TEST_RWLOCK )
 
-	/* Test libbfio_pool_get_maximum_number_of_open_handles with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
+	/* Test libbfio_pool_get_number_of_handles with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
 	 */
 	bfio_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
 
-	result = libbfio_pool_get_maximum_number_of_open_handles(
+	result = libbfio_pool_get_number_of_handles(
 	          pool,
-	          &maximum_number_of_open_handles,
+	          &number_of_handles,
 	          &error );
 
 	if( bfio_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
@@ -2287,13 +2491,15 @@ int bfio_test_pool_get_maximum_number_of_open_handles(
 		libcerror_error_free(
 		 &error );
 	}
-	/* Test libbfio_pool_get_maximum_number_of_open_handles with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
+#if defined( HAVE_LOCAL_LIBCDATA )
+
+	/* Test libbfio_pool_get_number_of_handles with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
 	 */
 	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
 
-	result = libbfio_pool_get_maximum_number_of_open_handles(
+	result = libbfio_pool_get_number_of_handles(
 	          pool,
-	          &maximum_number_of_open_handles,
+	          &number_of_handles,
 	          &error );
 
 	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
@@ -2314,6 +2520,7 @@ int bfio_test_pool_get_maximum_number_of_open_handles(
 		libcerror_error_free(
 		 &error );
 	}
+#endif /* defined( HAVE_LOCAL_LIBCDATA ) */
 #endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
 
 	return( 1 );
@@ -2327,18 +2534,20 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libbfio_pool_set_maximum_number_of_open_handles functions
+/* Tests the libbfio_pool_get_handle functions
  * Returns 1 if successful or 0 if not
  */
-int bfio_test_pool_set_maximum_number_of_open_handles(
+int bfio_test_pool_get_handle(
      libbfio_pool_t *pool )
 {
+	libbfio_handle_t *handle = NULL;
 	libcerror_error_t *error = NULL;
 	int result               = 0;
 
-	result = libbfio_pool_set_maximum_number_of_open_handles(
+	result = libbfio_pool_get_handle(
 	          pool,
-	          LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
+	          0,
+	          &handle,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -2352,9 +2561,10 @@ int bfio_test_pool_set_maximum_number_of_open_handles(
 
 	/* Test error cases
 	 */
-	result = libbfio_pool_set_maximum_number_of_open_handles(
+	result = libbfio_pool_get_handle(
 	          NULL,
-	          LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
+	          0,
+	          &handle,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -2369,9 +2579,28 @@ int bfio_test_pool_set_maximum_number_of_open_handles(
 	libcerror_error_free(
 	 &error );
 
-	result = libbfio_pool_set_maximum_number_of_open_handles(
+	result = libbfio_pool_get_handle(
 	          pool,
 	          -1,
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_pool_get_handle(
+	          pool,
+	          0,
+	          NULL,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -2388,18 +2617,19 @@ int bfio_test_pool_set_maximum_number_of_open_handles(
 
 #if defined( HAVE_BFIO_TEST_RWLOCK )
 
-	/* Test libbfio_pool_set_maximum_number_of_open_handles with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	/* Test libbfio_pool_get_handle with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
 	 */
-	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+	bfio_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
 
-	result = libbfio_pool_set_maximum_number_of_open_handles(
+	result = libbfio_pool_get_handle(
 	          pool,
-	          LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
+	          0,
+	          &handle,
 	          &error );
 
-	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	if( bfio_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
 	{
-		bfio_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+		bfio_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
 	}
 	else
 	{
@@ -2417,13 +2647,14 @@ int bfio_test_pool_set_maximum_number_of_open_handles(
 	}
 #if defined( HAVE_LOCAL_LIBCDATA )
 
-	/* Test libbfio_pool_set_maximum_number_of_open_handles with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	/* Test libbfio_pool_get_handle with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
 	 */
 	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
 
-	result = libbfio_pool_set_maximum_number_of_open_handles(
+	result = libbfio_pool_get_handle(
 	          pool,
-	          LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
+	          0,
+	          &handle,
 	          &error );
 
 	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
@@ -2458,29 +2689,19 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libbfio_pool_append_handle function
+/* Tests the libbfio_pool_get_maximum_number_of_open_handles functions
  * Returns 1 if successful or 0 if not
  */
-int bfio_test_pool_append_handle(
-     const system_character_t *source )
+int bfio_test_pool_get_maximum_number_of_open_handles(
+     libbfio_pool_t *pool )
 {
-	char narrow_source[ 256 ];
-
-	libbfio_handle_t *handle        = NULL;
-	libbfio_handle_t *test_handle   = NULL;
-	libbfio_pool_t *pool            = NULL;
-	libcdata_list_t *last_used_list = NULL;
-	libcerror_error_t *error        = NULL;
-	size_t source_length            = 0;
-	int entry_index                 = 0;
-	int result                      = 0;
+	libcerror_error_t *error           = NULL;
+	int maximum_number_of_open_handles = 0;
+	int result                         = 0;
 
-	/* Initialize test
-	 */
-	result = bfio_test_get_narrow_source(
-	          source,
-	          narrow_source,
-	          256,
+	result = libbfio_pool_get_maximum_number_of_open_handles(
+	          pool,
+	          &maximum_number_of_open_handles,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -2492,113 +2713,123 @@ int bfio_test_pool_append_handle(
 	 "error",
 	 error );
 
-	result = libbfio_pool_initialize(
-	          &pool,
-	          0,
-	          LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
+	/* Test error cases
+	 */
+	result = libbfio_pool_get_maximum_number_of_open_handles(
+	          NULL,
+	          &maximum_number_of_open_handles,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
-	 "pool",
-	 pool );
-
-	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libbfio_file_initialize(
-	          &handle,
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_pool_get_maximum_number_of_open_handles(
+	          pool,
+	          NULL,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	BFIO_TEST_ASSERT_IS_NOT_NULL(
-	 "handle",
-	 handle );
-
-	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	source_length = narrow_string_length(
-	                 narrow_source );
-
-	result = libbfio_file_set_name(
-	          handle,
-	          narrow_source,
-	          source_length,
-	          &error );
-
-	BFIO_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	BFIO_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	libcerror_error_free(
+	 &error );
 
-	test_handle = handle;
+#if defined( HAVE_BFIO_TEST_RWLOCK )
 
-	/* Test regular cases
+	/* Test libbfio_pool_get_maximum_number_of_open_handles with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
 	 */
-	result = libbfio_handle_open(
-	          handle,
-	          LIBBFIO_OPEN_WRITE,
+	bfio_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
+
+	result = libbfio_pool_get_maximum_number_of_open_handles(
+	          pool,
+	          &maximum_number_of_open_handles,
 	          &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	if( bfio_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
 
-	BFIO_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
 
-	result = libbfio_pool_append_handle(
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libbfio_pool_get_maximum_number_of_open_handles with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
+	 */
+	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	result = libbfio_pool_get_maximum_number_of_open_handles(
 	          pool,
-	          &entry_index,
-	          test_handle,
-	          LIBBFIO_OPEN_READ,
+	          &maximum_number_of_open_handles,
 	          &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
 
-	BFIO_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
 
-	result = libbfio_handle_close(
-	          handle,
-	          &error );
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
 
-	BFIO_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
+	return( 1 );
 
-	BFIO_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
 
-	/* Clean up
-	 */
-	result = libbfio_pool_remove_handle(
+/* Tests the libbfio_pool_set_maximum_number_of_open_handles functions
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_pool_set_maximum_number_of_open_handles(
+     libbfio_pool_t *pool )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	result = libbfio_pool_set_maximum_number_of_open_handles(
 	          pool,
-	          0,
-	          &test_handle,
+	          LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -2610,78 +2841,11 @@ int bfio_test_pool_append_handle(
 	 "error",
 	 error );
 
-	test_handle = handle;
-
 	/* Test error cases
 	 */
-	result = libbfio_pool_append_handle(
-	          NULL,
-	          &entry_index,
-	          test_handle,
-	          LIBBFIO_OPEN_READ,
-	          &error );
-
-	BFIO_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	last_used_list = ( (libbfio_internal_pool_t *) pool )->last_used_list;
-
-	( (libbfio_internal_pool_t *) pool )->last_used_list = NULL;
-
-	result = libbfio_pool_append_handle(
-	          pool,
-	          &entry_index,
-	          test_handle,
-	          LIBBFIO_OPEN_READ,
-	          &error );
-
-	( (libbfio_internal_pool_t *) pool )->last_used_list = last_used_list;
-
-	BFIO_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	result = libbfio_pool_append_handle(
-	          pool,
-	          NULL,
-	          test_handle,
-	          LIBBFIO_OPEN_READ,
-	          &error );
-
-	BFIO_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	result = libbfio_pool_append_handle(
-	          pool,
-	          &entry_index,
+	result = libbfio_pool_set_maximum_number_of_open_handles(
 	          NULL,
-	          LIBBFIO_OPEN_READ,
+	          LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -2696,11 +2860,9 @@ int bfio_test_pool_append_handle(
 	libcerror_error_free(
 	 &error );
 
-	result = libbfio_pool_append_handle(
+	result = libbfio_pool_set_maximum_number_of_open_handles(
 	          pool,
-	          &entry_index,
-	          test_handle,
-	          0,
+	          -1,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -2717,42 +2879,18 @@ int bfio_test_pool_append_handle(
 
 #if defined( HAVE_BFIO_TEST_RWLOCK )
 
-	/* Test libbfio_pool_append_handle with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	/* Test libbfio_pool_set_maximum_number_of_open_handles with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
 	 */
 	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
 
-	result = libbfio_pool_append_handle(
+	result = libbfio_pool_set_maximum_number_of_open_handles(
 	          pool,
-	          &entry_index,
-	          test_handle,
-	          LIBBFIO_OPEN_READ,
+	          LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
 	          &error );
 
 	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
 	{
 		bfio_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
-
-		if( result == 1 )
-		{
-			/* Clean up
-			 */
-			result = libbfio_pool_remove_handle(
-			          pool,
-			          0,
-			          &test_handle,
-			          &error );
-
-			BFIO_TEST_ASSERT_EQUAL_INT(
-			 "result",
-			 result,
-			 1 );
-
-			BFIO_TEST_ASSERT_IS_NULL(
-			 "error",
-			 error );
-
-			test_handle = handle;
-		}
 	}
 	else
 	{
@@ -2770,42 +2908,18 @@ int bfio_test_pool_append_handle(
 	}
 #if defined( HAVE_LOCAL_LIBCDATA )
 
-	/* Test libbfio_pool_append_handle with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	/* Test libbfio_pool_set_maximum_number_of_open_handles with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
 	 */
-	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 2;
+	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
 
-	result = libbfio_pool_append_handle(
+	result = libbfio_pool_set_maximum_number_of_open_handles(
 	          pool,
-	          &entry_index,
-	          test_handle,
-	          LIBBFIO_OPEN_READ,
+	          LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
 	          &error );
 
 	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
 	{
 		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
-
-		if( result == 1 )
-		{
-			/* Clean up
-			 */
-			result = libbfio_pool_remove_handle(
-			          pool,
-			          0,
-			          &test_handle,
-			          &error );
-
-			BFIO_TEST_ASSERT_EQUAL_INT(
-			 "result",
-			 result,
-			 1 );
-
-			BFIO_TEST_ASSERT_IS_NULL(
-			 "error",
-			 error );
-
-			test_handle = handle;
-		}
 	}
 	else
 	{
@@ -2824,42 +2938,6 @@ int bfio_test_pool_append_handle(
 #endif /* defined( HAVE_LOCAL_LIBCDATA ) */
 #endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
 
-	/* Clean up
-	 */
-	result = libbfio_handle_free(
-	          &handle,
-	          &error );
-
-	BFIO_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	BFIO_TEST_ASSERT_IS_NULL(
-	 "handle",
-	 handle );
-
-	BFIO_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = libbfio_pool_free(
-	          &pool,
-	          &error );
-
-	BFIO_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	BFIO_TEST_ASSERT_IS_NULL(
-	 "pool",
-	 pool );
-
-	BFIO_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
 	return( 1 );
 
 on_error:
@@ -2868,43 +2946,24 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( handle != NULL )
-	{
-		libbfio_handle_free(
-		 &handle,
-		 NULL );
-	}
-	if( pool != NULL )
-	{
-		libbfio_pool_free(
-		 &pool,
-		 NULL );
-	}
 	return( 0 );
 }
 
-/* Tests the libbfio_pool_set_handle function
+/* Tests the libbfio_pool_get_maximum_number_of_pending_closes and libbfio_pool_set_maximum_number_of_pending_closes functions
  * Returns 1 if successful or 0 if not
  */
-int bfio_test_pool_set_handle(
-     const system_character_t *source )
+int bfio_test_pool_set_maximum_number_of_pending_closes(
+     libbfio_pool_t *pool )
 {
-	char narrow_source[ 256 ];
-
-	libbfio_handle_t *handle        = NULL;
-	libbfio_handle_t *test_handle   = NULL;
-	libbfio_pool_t *pool            = NULL;
-	libcdata_list_t *last_used_list = NULL;
-	libcerror_error_t *error        = NULL;
-	size_t source_length            = 0;
-	int result                      = 0;
+	libcerror_error_t *error             = NULL;
+	int maximum_number_of_pending_closes = 0;
+	int result                           = 0;
 
-	/* Initialize test
+	/* Test regular cases
 	 */
-	result = bfio_test_get_narrow_source(
-	          source,
-	          narrow_source,
-	          256,
+	result = libbfio_pool_set_maximum_number_of_pending_closes(
+	          pool,
+	          4,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -2916,10 +2975,9 @@ int bfio_test_pool_set_handle(
 	 "error",
 	 error );
 
-	result = libbfio_pool_initialize(
-	          &pool,
-	          1,
-	          LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
+	result = libbfio_pool_get_maximum_number_of_pending_closes(
+	          pool,
+	          &maximum_number_of_pending_closes,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -2927,16 +2985,18 @@ int bfio_test_pool_set_handle(
 	 result,
 	 1 );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
-	 "pool",
-	 pool );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "maximum_number_of_pending_closes",
+	 maximum_number_of_pending_closes,
+	 4 );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libbfio_file_initialize(
-	          &handle,
+	result = libbfio_pool_set_maximum_number_of_pending_closes(
+	          pool,
+	          0,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -2944,21 +3004,13 @@ int bfio_test_pool_set_handle(
 	 result,
 	 1 );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
-	 "handle",
-	 handle );
-
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	source_length = narrow_string_length(
-	                 narrow_source );
-
-	result = libbfio_file_set_name(
-	          handle,
-	          narrow_source,
-	          source_length,
+	result = libbfio_pool_get_maximum_number_of_pending_closes(
+	          pool,
+	          &maximum_number_of_pending_closes,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -2966,309 +3018,337 @@ int bfio_test_pool_set_handle(
 	 result,
 	 1 );
 
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "maximum_number_of_pending_closes",
+	 maximum_number_of_pending_closes,
+	 0 );
+
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	test_handle = handle;
-
-	/* Test regular cases
+	/* Test error cases
 	 */
-	result = libbfio_handle_open(
-	          handle,
-	          LIBBFIO_OPEN_WRITE,
+	result = libbfio_pool_set_maximum_number_of_pending_closes(
+	          NULL,
+	          0,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	BFIO_TEST_ASSERT_IS_NULL(
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libbfio_pool_set_handle(
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_pool_set_maximum_number_of_pending_closes(
 	          pool,
-	          0,
-	          test_handle,
-	          LIBBFIO_OPEN_READ,
+	          -1,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	BFIO_TEST_ASSERT_IS_NULL(
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libbfio_handle_close(
-	          handle,
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_pool_get_maximum_number_of_pending_closes(
+	          NULL,
+	          &maximum_number_of_pending_closes,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	BFIO_TEST_ASSERT_IS_NULL(
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Clean up
-	 */
-	result = libbfio_pool_remove_handle(
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_pool_get_maximum_number_of_pending_closes(
 	          pool,
-	          0,
-	          &test_handle,
+	          NULL,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	BFIO_TEST_ASSERT_IS_NULL(
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	test_handle = handle;
+	libcerror_error_free(
+	 &error );
 
-	/* Test error cases
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_pool_set_block_cache function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_pool_set_block_cache(
+     libbfio_pool_t *pool )
+{
+	uint8_t cached_buffer[ 32 ];
+	uint8_t buffer[ 32 ];
+
+	libbfio_handle_t *handle     = NULL;
+	libcerror_error_t *error     = NULL;
+	uint64_t number_of_evictions = 0;
+	uint64_t number_of_hits      = 0;
+	uint64_t number_of_misses    = 0;
+	size64_t file_size           = 0;
+	size_t read_size             = 0;
+	ssize_t read_count           = 0;
+	off64_t offset               = 0;
+	int result                   = 0;
+
+	/* Initialize test
 	 */
-	result = libbfio_pool_set_handle(
-	          NULL,
+	result = libbfio_pool_get_size(
+	          pool,
 	          0,
-	          test_handle,
-	          LIBBFIO_OPEN_READ,
+	          &file_size,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	if( file_size < 32 )
+	{
+		return( 1 );
+	}
+	read_count = libbfio_pool_read_buffer_at_offset(
+	              pool,
+	              0,
+	              buffer,
+	              32,
+	              0,
+	              &error );
 
-	last_used_list = ( (libbfio_internal_pool_t *) pool )->last_used_list;
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 32 );
 
-	( (libbfio_internal_pool_t *) pool )->last_used_list = NULL;
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	result = libbfio_pool_set_handle(
+	/* Test regular cases
+	 */
+	result = libbfio_pool_set_block_cache(
 	          pool,
-	          0,
-	          test_handle,
-	          LIBBFIO_OPEN_READ,
+	          512,
+	          4 * 512,
 	          &error );
 
-	( (libbfio_internal_pool_t *) pool )->last_used_list = last_used_list;
-
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	read_count = libbfio_pool_read_buffer_at_offset(
+	              pool,
+	              0,
+	              cached_buffer,
+	              32,
+	              0,
+	              &error );
 
-	result = libbfio_pool_set_handle(
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 32 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          cached_buffer,
+	          buffer,
+	          32 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Close the handle to make sure the cached data remains available
+	 */
+	result = libbfio_pool_close(
 	          pool,
-	          -1,
-	          test_handle,
-	          LIBBFIO_OPEN_READ,
+	          0,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 0 );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libbfio_pool_set_handle(
+	result = libbfio_pool_open(
 	          pool,
 	          0,
-	          NULL,
 	          LIBBFIO_OPEN_READ,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	read_count = libbfio_pool_read_buffer_at_offset(
+	              pool,
+	              0,
+	              cached_buffer,
+	              32,
+	              0,
+	              &error );
 
-	result = libbfio_pool_set_handle(
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 32 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_pool_read_buffer_at_offset(
+	              pool,
+	              0,
+	              cached_buffer,
+	              32,
+	              0,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 32 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          cached_buffer,
+	          buffer,
+	          32 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libbfio_pool_get_cache_statistics(
 	          pool,
-	          0,
-	          test_handle,
-	          0,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &number_of_evictions,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 number_of_hits,
+	 (uint64_t) 1 );
 
-#if defined( HAVE_BFIO_TEST_RWLOCK )
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 (uint64_t) 2 );
 
-	/* Test libbfio_pool_set_handle with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	/* Test that libbfio_pool_read_buffer advances the current offset
 	 */
-	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
-
-	result = libbfio_pool_set_handle(
+	offset = libbfio_pool_seek_offset(
 	          pool,
 	          0,
-	          test_handle,
-	          LIBBFIO_OPEN_READ,
+	          0,
+	          SEEK_SET,
 	          &error );
 
-	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
-	{
-		bfio_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
 
-		if( result == 1 )
-		{
-			/* Clean up
-			 */
-			result = libbfio_pool_remove_handle(
-			          pool,
-			          0,
-			          &test_handle,
-			          &error );
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-			BFIO_TEST_ASSERT_EQUAL_INT(
-			 "result",
-			 result,
-			 1 );
+	read_count = libbfio_pool_read_buffer(
+	              pool,
+	              0,
+	              cached_buffer,
+	              32,
+	              &error );
 
-			BFIO_TEST_ASSERT_IS_NULL(
-			 "error",
-			 error );
-
-			test_handle = handle;
-		}
-	}
-	else
-	{
-		BFIO_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		BFIO_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
-#if defined( HAVE_LOCAL_LIBCDATA )
-
-	/* Test libbfio_pool_set_handle with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
-	 */
-	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 2;
-
-	result = libbfio_pool_set_handle(
-	          pool,
-	          0,
-	          test_handle,
-	          LIBBFIO_OPEN_READ,
-	          &error );
-
-	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
-	{
-		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
-
-		if( result == 1 )
-		{
-			/* Clean up
-			 */
-			result = libbfio_pool_remove_handle(
-			          pool,
-			          0,
-			          &test_handle,
-			          &error );
-
-			BFIO_TEST_ASSERT_EQUAL_INT(
-			 "result",
-			 result,
-			 1 );
-
-			BFIO_TEST_ASSERT_IS_NULL(
-			 "error",
-			 error );
-
-			test_handle = handle;
-		}
-	}
-	else
-	{
-		BFIO_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		BFIO_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_LOCAL_LIBCDATA ) */
-#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
-
-	/* Clean up
-	 */
-	result = libbfio_handle_free(
-	          &handle,
-	          &error );
-
-	BFIO_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	BFIO_TEST_ASSERT_IS_NULL(
-	 "handle",
-	 handle );
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 32 );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libbfio_pool_free(
-	          &pool,
+	result = libbfio_pool_get_offset(
+	          pool,
+	          0,
+	          &offset,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -3276,90 +3356,56 @@ int bfio_test_pool_set_handle(
 	 result,
 	 1 );
 
-	BFIO_TEST_ASSERT_IS_NULL(
-	 "pool",
-	 pool );
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 32 );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	return( 1 );
+	/* Test that libbfio_pool_read_buffer does not open the handle for cached data
+	 */
+	read_size = 32;
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( handle != NULL )
-	{
-		libbfio_handle_free(
-		 &handle,
-		 NULL );
-	}
-	if( pool != NULL )
+	if( file_size < 64 )
 	{
-		libbfio_pool_free(
-		 &pool,
-		 NULL );
+		read_size = (size_t) ( file_size - 32 );
 	}
-	return( 0 );
-}
-
-/* Tests the libbfio_pool_remove_handle function
- * Returns 1 if successful or 0 if not
- */
-int bfio_test_pool_remove_handle(
-     const system_character_t *source )
-{
-	char narrow_source[ 256 ];
-
-	libbfio_handle_t *handle        = NULL;
-	libbfio_handle_t *test_handle   = NULL;
-	libbfio_pool_t *pool            = NULL;
-	libcdata_list_t *last_used_list = NULL;
-	libcerror_error_t *error        = NULL;
-	size_t source_length            = 0;
-	int result                      = 0;
-
-	/* Initialize test
-	 */
-	result = bfio_test_get_narrow_source(
-	          source,
-	          narrow_source,
-	          256,
+	result = libbfio_pool_close(
+	          pool,
+	          0,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libbfio_pool_initialize(
-	          &pool,
-	          1,
-	          LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
-	          &error );
-
-	BFIO_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	read_count = libbfio_pool_read_buffer(
+	              pool,
+	              0,
+	              cached_buffer,
+	              32,
+	              &error );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
-	 "pool",
-	 pool );
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) read_size );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libbfio_file_initialize(
+	result = libbfio_pool_get_handle(
+	          pool,
+	          0,
 	          &handle,
 	          &error );
 
@@ -3368,37 +3414,27 @@ int bfio_test_pool_remove_handle(
 	 result,
 	 1 );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
-	 "handle",
-	 handle );
-
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	source_length = narrow_string_length(
-	                 narrow_source );
-
-	result = libbfio_file_set_name(
+	result = libbfio_handle_is_open(
 	          handle,
-	          narrow_source,
-	          source_length,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libbfio_pool_set_handle(
+	result = libbfio_pool_get_offset(
 	          pool,
 	          0,
-	          handle,
-	          LIBBFIO_OPEN_READ,
+	          &offset,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -3406,18 +3442,21 @@ int bfio_test_pool_remove_handle(
 	 result,
 	 1 );
 
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) ( 32 + read_size ) );
+
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	handle = NULL;
-
-	/* Test regular cases
+	/* Remove the block cache
 	 */
-	result = libbfio_pool_remove_handle(
+	result = libbfio_pool_set_block_cache(
 	          pool,
+	          512,
 	          0,
-	          &test_handle,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -3429,19 +3468,17 @@ int bfio_test_pool_remove_handle(
 	 "error",
 	 error );
 
-	/* Initialize test
-	 */
-	result = libbfio_pool_set_handle(
+	result = libbfio_pool_get_cache_statistics(
 	          pool,
-	          0,
-	          test_handle,
-	          LIBBFIO_OPEN_READ,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &number_of_evictions,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -3449,12 +3486,10 @@ int bfio_test_pool_remove_handle(
 
 	/* Test error cases
 	 */
-	test_handle = NULL;
-
-	result = libbfio_pool_remove_handle(
+	result = libbfio_pool_set_block_cache(
 	          NULL,
-	          0,
-	          &test_handle,
+	          512,
+	          4 * 512,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -3469,18 +3504,12 @@ int bfio_test_pool_remove_handle(
 	libcerror_error_free(
 	 &error );
 
-	last_used_list = ( (libbfio_internal_pool_t *) pool )->last_used_list;
-
-	( (libbfio_internal_pool_t *) pool )->last_used_list = NULL;
-
-	result = libbfio_pool_remove_handle(
+	result = libbfio_pool_set_block_cache(
 	          pool,
 	          0,
-	          &test_handle,
+	          4 * 512,
 	          &error );
 
-	( (libbfio_internal_pool_t *) pool )->last_used_list = last_used_list;
-
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -3493,10 +3522,10 @@ int bfio_test_pool_remove_handle(
 	libcerror_error_free(
 	 &error );
 
-	result = libbfio_pool_remove_handle(
+	result = libbfio_pool_set_block_cache(
 	          pool,
-	          -1,
-	          &test_handle,
+	          512,
+	          256,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -3511,129 +3540,183 @@ int bfio_test_pool_remove_handle(
 	libcerror_error_free(
 	 &error );
 
-	result = libbfio_pool_remove_handle(
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libbfio_pool_set_block_cache(
+	 pool,
+	 512,
+	 0,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libbfio_pool_get_cache_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_pool_get_cache_statistics(
+     libbfio_pool_t *pool )
+{
+	libcerror_error_t *error     = NULL;
+	uint64_t number_of_evictions = 0;
+	uint64_t number_of_hits      = 0;
+	uint64_t number_of_misses    = 0;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+	result = libbfio_pool_get_cache_statistics(
 	          pool,
-	          0,
-	          NULL,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &number_of_evictions,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 0 );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-#if defined( HAVE_BFIO_TEST_RWLOCK )
+	result = libbfio_pool_set_block_cache(
+	          pool,
+	          512,
+	          4 * 512,
+	          &error );
 
-	/* Test libbfio_pool_remove_handle with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
-	 */
-	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	result = libbfio_pool_remove_handle(
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_get_cache_statistics(
 	          pool,
-	          0,
-	          &test_handle,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &number_of_evictions,
 	          &error );
 
-	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
-	{
-		bfio_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
-
-		if( result == 1 )
-		{
-			result = libbfio_pool_set_handle(
-			          pool,
-			          0,
-			          test_handle,
-			          LIBBFIO_OPEN_READ,
-			          &error );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-			BFIO_TEST_ASSERT_EQUAL_INT(
-			 "result",
-			 result,
-			 1 );
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-			BFIO_TEST_ASSERT_IS_NULL(
-			 "error",
-			 error );
-		}
-	}
-	else
-	{
-		BFIO_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 number_of_hits,
+	 (uint64_t) 0 );
 
-		BFIO_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 (uint64_t) 0 );
 
-		libcerror_error_free(
-		 &error );
-	}
-#if defined( HAVE_LOCAL_LIBCDATA )
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_evictions",
+	 number_of_evictions,
+	 (uint64_t) 0 );
 
-	/* Test libbfio_pool_remove_handle with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	/* Test error cases
 	 */
-	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+	result = libbfio_pool_get_cache_statistics(
+	          NULL,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &number_of_evictions,
+	          &error );
 
-	result = libbfio_pool_remove_handle(
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_pool_get_cache_statistics(
 	          pool,
-	          0,
-	          &test_handle,
+	          NULL,
+	          &number_of_misses,
+	          &number_of_evictions,
 	          &error );
 
-	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
-	{
-		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		if( result == 1 )
-		{
-			result = libbfio_pool_set_handle(
-			          pool,
-			          0,
-			          test_handle,
-			          LIBBFIO_OPEN_READ,
-			          &error );
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-			BFIO_TEST_ASSERT_EQUAL_INT(
-			 "result",
-			 result,
-			 1 );
+	libcerror_error_free(
+	 &error );
 
-			BFIO_TEST_ASSERT_IS_NULL(
-			 "error",
-			 error );
-		}
-	}
-	else
-	{
-		BFIO_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	result = libbfio_pool_get_cache_statistics(
+	          pool,
+	          &number_of_hits,
+	          NULL,
+	          &number_of_evictions,
+	          &error );
 
-		BFIO_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_LOCAL_LIBCDATA ) */
-#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_pool_get_cache_statistics(
+	          pool,
+	          &number_of_hits,
+	          &number_of_misses,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
 
 	/* Clean up
 	 */
-	result = libbfio_pool_free(
-	          &pool,
+	result = libbfio_pool_set_block_cache(
+	          pool,
+	          512,
+	          0,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -3641,10 +3724,6 @@ int bfio_test_pool_remove_handle(
 	 result,
 	 1 );
 
-	BFIO_TEST_ASSERT_IS_NULL(
-	 "pool",
-	 pool );
-
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
@@ -3657,37 +3736,31 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( handle != NULL )
-	{
-		libbfio_handle_free(
-		 &handle,
-		 NULL );
-	}
-	if( pool != NULL )
-	{
-		libbfio_pool_free(
-		 &pool,
-		 NULL );
-	}
+	libbfio_pool_set_block_cache(
+	 pool,
+	 512,
+	 0,
+	 NULL );
+
 	return( 0 );
 }
 
-#if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT )
-
-/* Tests the libbfio_internal_pool_open function
+/* Tests the libbfio_pool_append_handle function
  * Returns 1 if successful or 0 if not
  */
-int bfio_test_internal_pool_open(
+int bfio_test_pool_append_handle(
      const system_character_t *source )
 {
 	char narrow_source[ 256 ];
 
-	libbfio_handle_t *handle = NULL;
-	libbfio_pool_t *pool     = NULL;
-	libcerror_error_t *error = NULL;
-	size_t source_length     = 0;
-	int entry_index          = 0;
-	int result               = 0;
+	libbfio_handle_t *handle      = NULL;
+	libbfio_handle_t *test_handle = NULL;
+	libbfio_pool_t *other_pool    = NULL;
+	libbfio_pool_t *pool          = NULL;
+	libcerror_error_t *error      = NULL;
+	size_t source_length          = 0;
+	int entry_index               = 0;
+	int result                    = 0;
 
 	/* Initialize test
 	 */
@@ -3725,6 +3798,25 @@ int bfio_test_internal_pool_open(
 	 "error",
 	 error );
 
+	result = libbfio_pool_initialize(
+	          &other_pool,
+	          0,
+	          LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "other_pool",
+	 other_pool );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libbfio_file_initialize(
 	          &handle,
 	          &error );
@@ -3760,11 +3852,13 @@ int bfio_test_internal_pool_open(
 	 "error",
 	 error );
 
-	result = libbfio_pool_append_handle(
-	          pool,
-	          &entry_index,
+	test_handle = handle;
+
+	/* Test regular cases
+	 */
+	result = libbfio_handle_open(
 	          handle,
-	          LIBBFIO_OPEN_READ,
+	          LIBBFIO_OPEN_WRITE,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -3776,13 +3870,10 @@ int bfio_test_internal_pool_open(
 	 "error",
 	 error );
 
-	handle = NULL;
-
-	/* Test regular cases
-	 */
-	result = libbfio_internal_pool_open(
-	          (libbfio_internal_pool_t *) pool,
-	          0,
+	result = libbfio_pool_append_handle(
+	          pool,
+	          &entry_index,
+	          test_handle,
 	          LIBBFIO_OPEN_READ,
 	          &error );
 
@@ -3795,11 +3886,12 @@ int bfio_test_internal_pool_open(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test libbfio_pool_append_handle with a handle that is already in a pool
 	 */
-	result = libbfio_internal_pool_open(
-	          (libbfio_internal_pool_t *) pool,
-	          0,
+	result = libbfio_pool_append_handle(
+	          pool,
+	          &entry_index,
+	          test_handle,
 	          LIBBFIO_OPEN_READ,
 	          &error );
 
@@ -3815,27 +3907,10 @@ int bfio_test_internal_pool_open(
 	libcerror_error_free(
 	 &error );
 
-	/* Clean up
-	 */
-	result = libbfio_pool_close(
-	          pool,
-	          0,
-	          &error );
-
-	BFIO_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
-
-	BFIO_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	/* Test error cases
-	 */
-	result = libbfio_internal_pool_open(
-	          NULL,
-	          0,
+	result = libbfio_pool_append_handle(
+	          other_pool,
+	          &entry_index,
+	          test_handle,
 	          LIBBFIO_OPEN_READ,
 	          &error );
 
@@ -3851,10 +3926,45 @@ int bfio_test_internal_pool_open(
 	libcerror_error_free(
 	 &error );
 
-	result = libbfio_internal_pool_open(
-	          (libbfio_internal_pool_t *) pool,
-	          -1,
-	          LIBBFIO_OPEN_READ,
+	result = libbfio_handle_close(
+	          handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libbfio_pool_remove_handle(
+	          pool,
+	          0,
+	          &test_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	test_handle = handle;
+
+	/* Test error cases
+	 */
+	result = libbfio_pool_append_handle(
+	          NULL,
+	          &entry_index,
+	          test_handle,
+	          LIBBFIO_OPEN_READ,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -3869,9 +3979,48 @@ int bfio_test_internal_pool_open(
 	libcerror_error_free(
 	 &error );
 
-	result = libbfio_internal_pool_open(
-	          (libbfio_internal_pool_t *) pool,
-	          0,
+	result = libbfio_pool_append_handle(
+	          pool,
+	          NULL,
+	          test_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_pool_append_handle(
+	          pool,
+	          &entry_index,
+	          NULL,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_pool_append_handle(
+	          pool,
+	          &entry_index,
+	          test_handle,
 	          0,
 	          &error );
 
@@ -3887,16 +4036,146 @@ int bfio_test_internal_pool_open(
 	libcerror_error_free(
 	 &error );
 
-	/* Clean up
+#if defined( HAVE_BFIO_TEST_RWLOCK )
+
+	/* Test libbfio_pool_append_handle with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
 	 */
-	result = libbfio_pool_close_all(
+	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+
+	result = libbfio_pool_append_handle(
+	          pool,
+	          &entry_index,
+	          test_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+
+		if( result == 1 )
+		{
+			/* Clean up
+			 */
+			result = libbfio_pool_remove_handle(
+			          pool,
+			          0,
+			          &test_handle,
+			          &error );
+
+			BFIO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			BFIO_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			test_handle = handle;
+		}
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#if defined( HAVE_LOCAL_LIBCDATA )
+
+	/* Test libbfio_pool_append_handle with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	 */
+	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 2;
+
+	result = libbfio_pool_append_handle(
 	          pool,
+	          &entry_index,
+	          test_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+
+		if( result == 1 )
+		{
+			/* Clean up
+			 */
+			result = libbfio_pool_remove_handle(
+			          pool,
+			          0,
+			          &test_handle,
+			          &error );
+
+			BFIO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			BFIO_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			test_handle = handle;
+		}
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_LOCAL_LIBCDATA ) */
+#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
+
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &handle,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_free(
+	          &other_pool,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "other_pool",
+	 other_pool );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -3933,6 +4212,12 @@ on_error:
 		 &handle,
 		 NULL );
 	}
+	if( other_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &other_pool,
+		 NULL );
+	}
 	if( pool != NULL )
 	{
 		libbfio_pool_free(
@@ -3942,22 +4227,21 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) */
-
-/* Tests the libbfio_pool_open function
+/* Tests the libbfio_pool_set_handle function
  * Returns 1 if successful or 0 if not
  */
-int bfio_test_pool_open(
+int bfio_test_pool_set_handle(
      const system_character_t *source )
 {
 	char narrow_source[ 256 ];
 
-	libbfio_handle_t *handle = NULL;
-	libbfio_pool_t *pool     = NULL;
-	libcerror_error_t *error = NULL;
-	size_t source_length     = 0;
-	int entry_index          = 0;
-	int result               = 0;
+	libbfio_handle_t *handle      = NULL;
+	libbfio_handle_t *test_handle = NULL;
+	libbfio_pool_t *other_pool    = NULL;
+	libbfio_pool_t *pool          = NULL;
+	libcerror_error_t *error      = NULL;
+	size_t source_length          = 0;
+	int result                    = 0;
 
 	/* Initialize test
 	 */
@@ -3978,7 +4262,7 @@ int bfio_test_pool_open(
 
 	result = libbfio_pool_initialize(
 	          &pool,
-	          0,
+	          1,
 	          LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
 	          &error );
 
@@ -3995,6 +4279,25 @@ int bfio_test_pool_open(
 	 "error",
 	 error );
 
+	result = libbfio_pool_initialize(
+	          &other_pool,
+	          1,
+	          LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "other_pool",
+	 other_pool );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libbfio_file_initialize(
 	          &handle,
 	          &error );
@@ -4030,12 +4333,14 @@ int bfio_test_pool_open(
 	 "error",
 	 error );
 
-	result = libbfio_pool_append_handle(
-	          pool,
-	          &entry_index,
-	          handle,
-	          LIBBFIO_OPEN_READ,
-	          &error );
+	test_handle = handle;
+
+	/* Test regular cases
+	 */
+	result = libbfio_handle_open(
+	          handle,
+	          LIBBFIO_OPEN_WRITE,
+	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -4046,13 +4351,10 @@ int bfio_test_pool_open(
 	 "error",
 	 error );
 
-	handle = NULL;
-
-	/* Test regular cases
-	 */
-	result = libbfio_pool_open(
+	result = libbfio_pool_set_handle(
 	          pool,
 	          0,
+	          test_handle,
 	          LIBBFIO_OPEN_READ,
 	          &error );
 
@@ -4065,27 +4367,65 @@ int bfio_test_pool_open(
 	 "error",
 	 error );
 
+	/* Test libbfio_pool_set_handle with a handle that is already in a pool
+	 */
+	result = libbfio_pool_set_handle(
+	          other_pool,
+	          0,
+	          test_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_close(
+	          handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Clean up
 	 */
-	result = libbfio_pool_close(
+	result = libbfio_pool_remove_handle(
 	          pool,
 	          0,
+	          &test_handle,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	test_handle = handle;
+
 	/* Test error cases
 	 */
-	result = libbfio_pool_open(
+	result = libbfio_pool_set_handle(
 	          NULL,
 	          0,
+	          test_handle,
 	          LIBBFIO_OPEN_READ,
 	          &error );
 
@@ -4101,9 +4441,29 @@ int bfio_test_pool_open(
 	libcerror_error_free(
 	 &error );
 
-	result = libbfio_pool_open(
+	result = libbfio_pool_set_handle(
 	          pool,
 	          -1,
+	          test_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_pool_set_handle(
+	          pool,
+	          0,
+	          NULL,
 	          LIBBFIO_OPEN_READ,
 	          &error );
 
@@ -4119,21 +4479,63 @@ int bfio_test_pool_open(
 	libcerror_error_free(
 	 &error );
 
+	result = libbfio_pool_set_handle(
+	          pool,
+	          0,
+	          test_handle,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
 #if defined( HAVE_BFIO_TEST_RWLOCK )
 
-	/* Test libbfio_pool_open with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	/* Test libbfio_pool_set_handle with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
 	 */
 	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
 
-	result = libbfio_pool_open(
+	result = libbfio_pool_set_handle(
 	          pool,
 	          0,
+	          test_handle,
 	          LIBBFIO_OPEN_READ,
 	          &error );
 
 	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
 	{
 		bfio_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+
+		if( result == 1 )
+		{
+			/* Clean up
+			 */
+			result = libbfio_pool_remove_handle(
+			          pool,
+			          0,
+			          &test_handle,
+			          &error );
+
+			BFIO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			BFIO_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			test_handle = handle;
+		}
 	}
 	else
 	{
@@ -4151,19 +4553,42 @@ int bfio_test_pool_open(
 	}
 #if defined( HAVE_LOCAL_LIBCDATA )
 
-	/* Test libbfio_pool_open with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	/* Test libbfio_pool_set_handle with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
 	 */
-	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 4;
+	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 2;
 
-	result = libbfio_pool_open(
+	result = libbfio_pool_set_handle(
 	          pool,
 	          0,
+	          test_handle,
 	          LIBBFIO_OPEN_READ,
 	          &error );
 
 	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
 	{
 		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+
+		if( result == 1 )
+		{
+			/* Clean up
+			 */
+			result = libbfio_pool_remove_handle(
+			          pool,
+			          0,
+			          &test_handle,
+			          &error );
+
+			BFIO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			BFIO_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			test_handle = handle;
+		}
 	}
 	else
 	{
@@ -4184,14 +4609,35 @@ int bfio_test_pool_open(
 
 	/* Clean up
 	 */
-	result = libbfio_pool_close_all(
-	          pool,
+	result = libbfio_handle_free(
+	          &handle,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_free(
+	          &other_pool,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "other_pool",
+	 other_pool );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -4228,6 +4674,12 @@ on_error:
 		 &handle,
 		 NULL );
 	}
+	if( other_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &other_pool,
+		 NULL );
+	}
 	if( pool != NULL )
 	{
 		libbfio_pool_free(
@@ -4237,20 +4689,20 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libbfio_pool_reopen function
+/* Tests the libbfio_pool_remove_handle function
  * Returns 1 if successful or 0 if not
  */
-int bfio_test_pool_reopen(
+int bfio_test_pool_remove_handle(
      const system_character_t *source )
 {
 	char narrow_source[ 256 ];
 
-	libbfio_handle_t *handle = NULL;
-	libbfio_pool_t *pool     = NULL;
-	libcerror_error_t *error = NULL;
-	size_t source_length     = 0;
-	int entry_index          = 0;
-	int result               = 0;
+	libbfio_handle_t *handle      = NULL;
+	libbfio_handle_t *test_handle = NULL;
+	libbfio_pool_t *pool          = NULL;
+	libcerror_error_t *error      = NULL;
+	size_t source_length          = 0;
+	int result                    = 0;
 
 	/* Initialize test
 	 */
@@ -4271,7 +4723,7 @@ int bfio_test_pool_reopen(
 
 	result = libbfio_pool_initialize(
 	          &pool,
-	          0,
+	          1,
 	          LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
 	          &error );
 
@@ -4323,9 +4775,9 @@ int bfio_test_pool_reopen(
 	 "error",
 	 error );
 
-	result = libbfio_pool_append_handle(
+	result = libbfio_pool_set_handle(
 	          pool,
-	          &entry_index,
+	          0,
 	          handle,
 	          LIBBFIO_OPEN_READ,
 	          &error );
@@ -4341,10 +4793,12 @@ int bfio_test_pool_reopen(
 
 	handle = NULL;
 
-	result = libbfio_pool_open(
+	/* Test regular cases
+	 */
+	result = libbfio_pool_remove_handle(
 	          pool,
 	          0,
-	          LIBBFIO_OPEN_READ,
+	          &test_handle,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -4356,11 +4810,12 @@ int bfio_test_pool_reopen(
 	 "error",
 	 error );
 
-	/* Test regular cases
+	/* Initialize test
 	 */
-	result = libbfio_pool_reopen(
+	result = libbfio_pool_set_handle(
 	          pool,
 	          0,
+	          test_handle,
 	          LIBBFIO_OPEN_READ,
 	          &error );
 
@@ -4375,10 +4830,12 @@ int bfio_test_pool_reopen(
 
 	/* Test error cases
 	 */
-	result = libbfio_pool_reopen(
+	test_handle = NULL;
+
+	result = libbfio_pool_remove_handle(
 	          NULL,
 	          0,
-	          LIBBFIO_OPEN_READ,
+	          &test_handle,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -4393,10 +4850,10 @@ int bfio_test_pool_reopen(
 	libcerror_error_free(
 	 &error );
 
-	result = libbfio_pool_reopen(
+	result = libbfio_pool_remove_handle(
 	          pool,
 	          -1,
-	          LIBBFIO_OPEN_READ,
+	          &test_handle,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -4411,10 +4868,10 @@ int bfio_test_pool_reopen(
 	libcerror_error_free(
 	 &error );
 
-	result = libbfio_pool_reopen(
+	result = libbfio_pool_remove_handle(
 	          pool,
 	          0,
-	          0,
+	          NULL,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -4431,19 +4888,38 @@ int bfio_test_pool_reopen(
 
 #if defined( HAVE_BFIO_TEST_RWLOCK )
 
-	/* Test libbfio_pool_reopen with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	/* Test libbfio_pool_remove_handle with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
 	 */
 	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
 
-	result = libbfio_pool_reopen(
+	result = libbfio_pool_remove_handle(
 	          pool,
 	          0,
-	          LIBBFIO_OPEN_READ,
+	          &test_handle,
 	          &error );
 
 	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
 	{
 		bfio_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+
+		if( result == 1 )
+		{
+			result = libbfio_pool_set_handle(
+			          pool,
+			          0,
+			          test_handle,
+			          LIBBFIO_OPEN_READ,
+			          &error );
+
+			BFIO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			BFIO_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
 	}
 	else
 	{
@@ -4461,20 +4937,39 @@ int bfio_test_pool_reopen(
 	}
 #if defined( HAVE_LOCAL_LIBCDATA )
 
-	/* Test libbfio_pool_reopen with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	/* Test libbfio_pool_remove_handle with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
 	 */
-	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 1;
+	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 0;
 
-	result = libbfio_pool_reopen(
+	result = libbfio_pool_remove_handle(
 	          pool,
 	          0,
-	          LIBBFIO_OPEN_READ,
+	          &test_handle,
 	          &error );
 
 	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
 	{
 		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
-	}
+
+		if( result == 1 )
+		{
+			result = libbfio_pool_set_handle(
+			          pool,
+			          0,
+			          test_handle,
+			          LIBBFIO_OPEN_READ,
+			          &error );
+
+			BFIO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			BFIO_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
 	else
 	{
 		BFIO_TEST_ASSERT_EQUAL_INT(
@@ -4494,19 +4989,6 @@ int bfio_test_pool_reopen(
 
 	/* Clean up
 	 */
-	result = libbfio_pool_close_all(
-	          pool,
-	          &error );
-
-	BFIO_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
-
-	BFIO_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
 	result = libbfio_pool_free(
 	          &pool,
 	          &error );
@@ -4549,10 +5031,10 @@ on_error:
 
 #if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT )
 
-/* Tests the libbfio_internal_pool_close function
+/* Tests the libbfio_internal_pool_open function
  * Returns 1 if successful or 0 if not
  */
-int bfio_test_internal_pool_close(
+int bfio_test_internal_pool_open(
      const system_character_t *source )
 {
 	char narrow_source[ 256 ];
@@ -4561,6 +5043,7 @@ int bfio_test_internal_pool_close(
 	libbfio_pool_t *pool     = NULL;
 	libcerror_error_t *error = NULL;
 	size_t source_length     = 0;
+	int entry_index          = 0;
 	int result               = 0;
 
 	/* Initialize test
@@ -4582,8 +5065,8 @@ int bfio_test_internal_pool_close(
 
 	result = libbfio_pool_initialize(
 	          &pool,
-	          1,
-	          2,
+	          0,
+	          LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -4599,27 +5082,6 @@ int bfio_test_internal_pool_close(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libbfio_internal_pool_close(
-	          (libbfio_internal_pool_t *) pool,
-	          0,
-	          &error );
-
-	BFIO_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	/* Initialize test
-	 */
 	result = libbfio_file_initialize(
 	          &handle,
 	          &error );
@@ -4655,9 +5117,9 @@ int bfio_test_internal_pool_close(
 	 "error",
 	 error );
 
-	result = libbfio_pool_set_handle(
+	result = libbfio_pool_append_handle(
 	          pool,
-	          0,
+	          &entry_index,
 	          handle,
 	          LIBBFIO_OPEN_READ,
 	          &error );
@@ -4673,8 +5135,10 @@ int bfio_test_internal_pool_close(
 
 	handle = NULL;
 
-	result = libbfio_pool_open(
-	          pool,
+	/* Test regular cases
+	 */
+	result = libbfio_internal_pool_open(
+	          (libbfio_internal_pool_t *) pool,
 	          0,
 	          LIBBFIO_OPEN_READ,
 	          &error );
@@ -4688,11 +5152,31 @@ int bfio_test_internal_pool_close(
 	 "error",
 	 error );
 
-	/* Test regular cases
+	/* Test error cases
 	 */
-	result = libbfio_internal_pool_close(
+	result = libbfio_internal_pool_open(
 	          (libbfio_internal_pool_t *) pool,
 	          0,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_pool_close(
+	          pool,
+	          0,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -4706,9 +5190,10 @@ int bfio_test_internal_pool_close(
 
 	/* Test error cases
 	 */
-	result = libbfio_internal_pool_close(
+	result = libbfio_internal_pool_open(
 	          NULL,
 	          0,
+	          LIBBFIO_OPEN_READ,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -4723,9 +5208,28 @@ int bfio_test_internal_pool_close(
 	libcerror_error_free(
 	 &error );
 
-	result = libbfio_internal_pool_close(
+	result = libbfio_internal_pool_open(
 	          (libbfio_internal_pool_t *) pool,
 	          -1,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_internal_pool_open(
+	          (libbfio_internal_pool_t *) pool,
+	          0,
+	          0,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -4759,10 +5263,6 @@ int bfio_test_internal_pool_close(
 	          &pool,
 	          &error );
 
-	result = libbfio_pool_free(
-	          &pool,
-	          &error );
-
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -4801,10 +5301,10 @@ on_error:
 
 #endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) */
 
-/* Tests the libbfio_pool_close function
+/* Tests the libbfio_pool_open function
  * Returns 1 if successful or 0 if not
  */
-int bfio_test_pool_close(
+int bfio_test_pool_open(
      const system_character_t *source )
 {
 	char narrow_source[ 256 ];
@@ -4905,6 +5405,8 @@ int bfio_test_pool_close(
 
 	handle = NULL;
 
+	/* Test regular cases
+	 */
 	result = libbfio_pool_open(
 	          pool,
 	          0,
@@ -4920,7 +5422,7 @@ int bfio_test_pool_close(
 	 "error",
 	 error );
 
-	/* Test regular cases
+	/* Clean up
 	 */
 	result = libbfio_pool_close(
 	          pool,
@@ -4938,9 +5440,10 @@ int bfio_test_pool_close(
 
 	/* Test error cases
 	 */
-	result = libbfio_pool_close(
+	result = libbfio_pool_open(
 	          NULL,
 	          0,
+	          LIBBFIO_OPEN_READ,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -4955,9 +5458,10 @@ int bfio_test_pool_close(
 	libcerror_error_free(
 	 &error );
 
-	result = libbfio_pool_close(
+	result = libbfio_pool_open(
 	          pool,
 	          -1,
+	          LIBBFIO_OPEN_READ,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -4974,13 +5478,14 @@ int bfio_test_pool_close(
 
 #if defined( HAVE_BFIO_TEST_RWLOCK )
 
-	/* Test libbfio_pool_close with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	/* Test libbfio_pool_open with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
 	 */
 	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
 
-	result = libbfio_pool_close(
+	result = libbfio_pool_open(
 	          pool,
 	          0,
+	          LIBBFIO_OPEN_READ,
 	          &error );
 
 	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
@@ -5003,13 +5508,14 @@ int bfio_test_pool_close(
 	}
 #if defined( HAVE_LOCAL_LIBCDATA )
 
-	/* Test libbfio_pool_close with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	/* Test libbfio_pool_open with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
 	 */
-	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 1;
+	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 4;
 
-	result = libbfio_pool_close(
+	result = libbfio_pool_open(
 	          pool,
 	          0,
+	          LIBBFIO_OPEN_READ,
 	          &error );
 
 	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
@@ -5088,10 +5594,10 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libbfio_pool_close_all function
+/* Tests the libbfio_pool_reopen function
  * Returns 1 if successful or 0 if not
  */
-int bfio_test_pool_close_all(
+int bfio_test_pool_reopen(
      const system_character_t *source )
 {
 	char narrow_source[ 256 ];
@@ -5209,14 +5715,16 @@ int bfio_test_pool_close_all(
 
 	/* Test regular cases
 	 */
-	result = libbfio_pool_close_all(
+	result = libbfio_pool_reopen(
 	          pool,
+	          0,
+	          LIBBFIO_OPEN_READ,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -5224,8 +5732,46 @@ int bfio_test_pool_close_all(
 
 	/* Test error cases
 	 */
-	result = libbfio_pool_close_all(
+	result = libbfio_pool_reopen(
 	          NULL,
+	          0,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_pool_reopen(
+	          pool,
+	          -1,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_pool_reopen(
+	          pool,
+	          0,
+	          0,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -5242,12 +5788,14 @@ int bfio_test_pool_close_all(
 
 #if defined( HAVE_BFIO_TEST_RWLOCK )
 
-	/* Test libbfio_pool_close_all with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	/* Test libbfio_pool_reopen with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
 	 */
 	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
 
-	result = libbfio_pool_close_all(
+	result = libbfio_pool_reopen(
 	          pool,
+	          0,
+	          LIBBFIO_OPEN_READ,
 	          &error );
 
 	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
@@ -5270,13 +5818,1424 @@ int bfio_test_pool_close_all(
 	}
 #if defined( HAVE_LOCAL_LIBCDATA )
 
-	/* Test libbfio_pool_close_all with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	/* Test libbfio_pool_reopen with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	 */
+	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 1;
+
+	result = libbfio_pool_reopen(
+	          pool,
+	          0,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_LOCAL_LIBCDATA ) */
+#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
+
+	/* Clean up
+	 */
+	result = libbfio_pool_close_all(
+	          pool,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_free(
+	          &pool,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "pool",
+	 pool );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( pool != NULL )
+	{
+		libbfio_pool_free(
+		 &pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT )
+
+/* Tests the libbfio_internal_pool_close function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_internal_pool_close(
+     const system_character_t *source )
+{
+	char narrow_source[ 256 ];
+
+	libbfio_handle_t *handle = NULL;
+	libbfio_pool_t *pool     = NULL;
+	libcerror_error_t *error = NULL;
+	size_t source_length     = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = bfio_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_initialize(
+	          &pool,
+	          1,
+	          2,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "pool",
+	 pool );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_internal_pool_close(
+	          (libbfio_internal_pool_t *) pool,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Initialize test
+	 */
+	result = libbfio_file_initialize(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	source_length = narrow_string_length(
+	                 narrow_source );
+
+	result = libbfio_file_set_name(
+	          handle,
+	          narrow_source,
+	          source_length,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_set_handle(
+	          pool,
+	          0,
+	          handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	handle = NULL;
+
+	result = libbfio_pool_open(
+	          pool,
+	          0,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbfio_internal_pool_close(
+	          (libbfio_internal_pool_t *) pool,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_internal_pool_close(
+	          NULL,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_internal_pool_close(
+	          (libbfio_internal_pool_t *) pool,
+	          -1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_pool_close_all(
+	          pool,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_free(
+	          &pool,
+	          &error );
+
+	result = libbfio_pool_free(
+	          &pool,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "pool",
+	 pool );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( pool != NULL )
+	{
+		libbfio_pool_free(
+		 &pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) */
+
+/* Tests the libbfio_pool_close function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_pool_close(
+     const system_character_t *source )
+{
+	char narrow_source[ 256 ];
+
+	libbfio_handle_t *handle = NULL;
+	libbfio_pool_t *pool     = NULL;
+	libcerror_error_t *error = NULL;
+	size_t source_length     = 0;
+	int entry_index          = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = bfio_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_initialize(
+	          &pool,
+	          0,
+	          LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "pool",
+	 pool );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_file_initialize(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	source_length = narrow_string_length(
+	                 narrow_source );
+
+	result = libbfio_file_set_name(
+	          handle,
+	          narrow_source,
+	          source_length,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_append_handle(
+	          pool,
+	          &entry_index,
+	          handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	handle = NULL;
+
+	result = libbfio_pool_open(
+	          pool,
+	          0,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbfio_pool_close(
+	          pool,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_pool_close(
+	          NULL,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_pool_close(
+	          pool,
+	          -1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_BFIO_TEST_RWLOCK )
+
+	/* Test libbfio_pool_close with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	 */
+	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+
+	result = libbfio_pool_close(
+	          pool,
+	          0,
+	          &error );
+
+	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#if defined( HAVE_LOCAL_LIBCDATA )
+
+	/* Test libbfio_pool_close with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	 */
+	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 1;
+
+	result = libbfio_pool_close(
+	          pool,
+	          0,
+	          &error );
+
+	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_LOCAL_LIBCDATA ) */
+#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
+
+	/* Clean up
+	 */
+	result = libbfio_pool_close_all(
+	          pool,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_free(
+	          &pool,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "pool",
+	 pool );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( pool != NULL )
+	{
+		libbfio_pool_free(
+		 &pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_pool_close_all function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_pool_close_all(
+     const system_character_t *source )
+{
+	char narrow_source[ 256 ];
+
+	libbfio_handle_t *handle = NULL;
+	libbfio_pool_t *pool     = NULL;
+	libcerror_error_t *error = NULL;
+	size_t source_length     = 0;
+	int entry_index          = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = bfio_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_initialize(
+	          &pool,
+	          0,
+	          LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "pool",
+	 pool );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_file_initialize(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	source_length = narrow_string_length(
+	                 narrow_source );
+
+	result = libbfio_file_set_name(
+	          handle,
+	          narrow_source,
+	          source_length,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_append_handle(
+	          pool,
+	          &entry_index,
+	          handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	handle = NULL;
+
+	result = libbfio_pool_open(
+	          pool,
+	          0,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbfio_pool_close_all(
+	          pool,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_pool_close_all(
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_BFIO_TEST_RWLOCK )
+
+	/* Test libbfio_pool_close_all with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	 */
+	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+
+	result = libbfio_pool_close_all(
+	          pool,
+	          &error );
+
+	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#if defined( HAVE_LOCAL_LIBCDATA )
+
+	/* Test libbfio_pool_close_all with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	 */
+	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 1;
+
+	result = libbfio_pool_close_all(
+	          pool,
+	          &error );
+
+	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_LOCAL_LIBCDATA ) */
+#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
+
+	/* Clean up
+	 */
+	result = libbfio_pool_close_all(
+	          pool,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_free(
+	          &pool,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "pool",
+	 pool );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( pool != NULL )
+	{
+		libbfio_pool_free(
+		 &pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT )
+
+/* Tests the libbfio_internal_pool_get_open_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_internal_pool_get_open_handle(
+     libbfio_pool_t *pool )
+{
+	libbfio_handle_t *handle = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libbfio_internal_pool_get_open_handle(
+	          (libbfio_internal_pool_t *) pool,
+	          0,
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "handle->pool_number_of_references",
+	 ( (libbfio_internal_handle_t *) handle )->pool_number_of_references,
+	 1 );
+
+	result = libbfio_internal_pool_release_open_handle(
+	          (libbfio_internal_pool_t *) pool,
+	          handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "handle->pool_number_of_references",
+	 ( (libbfio_internal_handle_t *) handle )->pool_number_of_references,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libbfio_internal_pool_get_open_handle(
+	          NULL,
+	          0,
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_internal_pool_get_open_handle(
+	          (libbfio_internal_pool_t *) pool,
+	          -1,
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_internal_pool_get_open_handle(
+	          (libbfio_internal_pool_t *) pool,
+	          0,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_internal_pool_release_open_handle(
+	          NULL,
+	          handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_internal_pool_release_open_handle(
+	          (libbfio_internal_pool_t *) pool,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libbfio_internal_pool_release_open_handle with a handle that is not in use
+	 */
+	result = libbfio_internal_pool_release_open_handle(
+	          (libbfio_internal_pool_t *) pool,
+	          handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+
+/* Tests the libbfio_internal_pool_claim_handle_offset and libbfio_internal_pool_release_handle_offset functions
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_internal_pool_claim_handle_offset(
+     libbfio_pool_t *pool )
+{
+	libbfio_handle_t *handle = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_pool_get_handle(
+	          pool,
+	          0,
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbfio_internal_pool_claim_handle_offset(
+	          (libbfio_internal_pool_t *) pool,
+	          handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "handle->pool_offset_claimed",
+	 (int) ( (libbfio_internal_handle_t *) handle )->pool_offset_claimed,
+	 1 );
+
+	result = libbfio_internal_pool_release_handle_offset(
+	          (libbfio_internal_pool_t *) pool,
+	          handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "handle->pool_offset_claimed",
+	 (int) ( (libbfio_internal_handle_t *) handle )->pool_offset_claimed,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libbfio_internal_pool_claim_handle_offset(
+	          NULL,
+	          handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_internal_pool_claim_handle_offset(
+	          (libbfio_internal_pool_t *) pool,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_internal_pool_release_handle_offset(
+	          NULL,
+	          handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_internal_pool_release_handle_offset(
+	          (libbfio_internal_pool_t *) pool,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) */
+
+/* Tests the libbfio_pool_read_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_pool_read_buffer(
+     libbfio_pool_t *pool )
+{
+	uint8_t buffer[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	size64_t file_size       = 0;
+	ssize_t read_count       = 0;
+	off64_t offset           = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_pool_get_size(
+	          pool,
+	          0,
+	          &file_size,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( file_size < 32 )
+	{
+		return( 1 );
+	}
+	offset = libbfio_pool_seek_offset(
+	          pool,
+	          0,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_count = libbfio_pool_read_buffer(
+	              pool,
+	              0,
+	              buffer,
+	              32,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 32 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libbfio_pool_read_buffer(
+	              NULL,
+	              0,
+	              buffer,
+	              32,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libbfio_pool_read_buffer(
+	              pool,
+	              -1,
+	              buffer,
+	              32,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libbfio_pool_read_buffer(
+	              pool,
+	              0,
+	              NULL,
+	              32,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libbfio_pool_read_buffer(
+	              pool,
+	              0,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_BFIO_TEST_RWLOCK )
+
+	/* Test libbfio_pool_read_buffer with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
+	 */
+	bfio_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
+
+	read_count = libbfio_pool_read_buffer(
+	              pool,
+	              0,
+	              buffer,
+	              32,
+	              &error );
+
+	if( bfio_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#if defined( HAVE_LOCAL_LIBCDATA )
+
+	/* Test libbfio_pool_read_buffer with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
 	 */
-	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 1;
+	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 2;
 
-	result = libbfio_pool_close_all(
-	          pool,
-	          &error );
+	read_count = libbfio_pool_read_buffer(
+	              pool,
+	              0,
+	              buffer,
+	              32,
+	              &error );
 
 	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
 	{
@@ -5284,10 +7243,10 @@ int bfio_test_pool_close_all(
 	}
 	else
 	{
-		BFIO_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
 
 		BFIO_TEST_ASSERT_IS_NOT_NULL(
 		 "error",
@@ -5299,38 +7258,6 @@ int bfio_test_pool_close_all(
 #endif /* defined( HAVE_LOCAL_LIBCDATA ) */
 #endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
 
-	/* Clean up
-	 */
-	result = libbfio_pool_close_all(
-	          pool,
-	          &error );
-
-	BFIO_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
-
-	BFIO_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = libbfio_pool_free(
-	          &pool,
-	          &error );
-
-	BFIO_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	BFIO_TEST_ASSERT_IS_NULL(
-	 "pool",
-	 pool );
-
-	BFIO_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
 	return( 1 );
 
 on_error:
@@ -5339,31 +7266,13 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( handle != NULL )
-	{
-		libbfio_handle_free(
-		 &handle,
-		 NULL );
-	}
-	if( pool != NULL )
-	{
-		libbfio_pool_free(
-		 &pool,
-		 NULL );
-	}
 	return( 0 );
 }
 
-#if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT )
-
-	/* TODO add tests for libbfio_internal_pool_get_open_handle */
-
-#endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) */
-
-/* Tests the libbfio_pool_read_buffer function
+/* Tests the libbfio_pool_read_buffer_at_offset function
  * Returns 1 if successful or 0 if not
  */
-int bfio_test_pool_read_buffer(
+int bfio_test_pool_read_buffer_at_offset(
      libbfio_pool_t *pool )
 {
 	uint8_t buffer[ 32 ];
@@ -5413,11 +7322,12 @@ int bfio_test_pool_read_buffer(
 
 	/* Test regular cases
 	 */
-	read_count = libbfio_pool_read_buffer(
+	read_count = libbfio_pool_read_buffer_at_offset(
 	              pool,
 	              0,
 	              buffer,
 	              32,
+	              0,
 	              &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
@@ -5431,11 +7341,12 @@ int bfio_test_pool_read_buffer(
 
 	/* Test error cases
 	 */
-	read_count = libbfio_pool_read_buffer(
+	read_count = libbfio_pool_read_buffer_at_offset(
 	              NULL,
 	              0,
 	              buffer,
 	              32,
+	              0,
 	              &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
@@ -5450,11 +7361,12 @@ int bfio_test_pool_read_buffer(
 	libcerror_error_free(
 	 &error );
 
-	read_count = libbfio_pool_read_buffer(
+	read_count = libbfio_pool_read_buffer_at_offset(
 	              pool,
 	              -1,
 	              buffer,
 	              32,
+	              0,
 	              &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
@@ -5469,11 +7381,12 @@ int bfio_test_pool_read_buffer(
 	libcerror_error_free(
 	 &error );
 
-	read_count = libbfio_pool_read_buffer(
+	read_count = libbfio_pool_read_buffer_at_offset(
 	              pool,
 	              0,
 	              NULL,
 	              32,
+	              0,
 	              &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
@@ -5488,11 +7401,32 @@ int bfio_test_pool_read_buffer(
 	libcerror_error_free(
 	 &error );
 
-	read_count = libbfio_pool_read_buffer(
+	read_count = libbfio_pool_read_buffer_at_offset(
 	              pool,
 	              0,
 	              buffer,
 	              (size_t) SSIZE_MAX + 1,
+	              0,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libbfio_pool_read_buffer_at_offset(
+	              pool,
+	              0,
+	              buffer,
+	              32,
+	              -1,
 	              &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
@@ -5500,77 +7434,282 @@ int bfio_test_pool_read_buffer(
 	 read_count,
 	 (ssize_t) -1 );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_BFIO_TEST_RWLOCK )
+
+	/* Test libbfio_pool_read_buffer_at_offset with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
+	 */
+	bfio_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
+
+	read_count = libbfio_pool_read_buffer_at_offset(
+	              pool,
+	              0,
+	              buffer,
+	              32,
+	              0,
+	              &error );
+
+	if( bfio_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#if defined( HAVE_LOCAL_LIBCDATA )
+
+	/* Test libbfio_pool_read_buffer_at_offset with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
+	 */
+	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 2;
+
+	read_count = libbfio_pool_read_buffer_at_offset(
+	              pool,
+	              0,
+	              buffer,
+	              32,
+	              0,
+	              &error );
+
+	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_LOCAL_LIBCDATA ) */
+#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_pool_read_buffer_at_offset function with pending closes
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_pool_read_buffer_at_offset_with_pending_closes(
+     void )
+{
+	uint8_t buffer[ 16 ];
+	uint8_t data[ 256 ];
+
+	libbfio_handle_t *handle   = NULL;
+	libbfio_pool_t *pool       = NULL;
+	libcerror_error_t *error   = NULL;
+	ssize_t read_count         = 0;
+	int data_index             = 0;
+	int entry_index            = 0;
+	int handle_index           = 0;
+	int number_of_open_handles = 0;
+	int read_index             = 0;
+	int result                 = 0;
+
+	for( data_index = 0;
+	     data_index < 256;
+	     data_index++ )
+	{
+		data[ data_index ] = (uint8_t) data_index;
+	}
+	/* Initialize test
+	 */
+	result = libbfio_pool_initialize(
+	          &pool,
+	          0,
+	          2,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "pool",
+	 pool );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_set_maximum_number_of_pending_closes(
+	          pool,
+	          1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( handle_index = 0;
+	     handle_index < 3;
+	     handle_index++ )
+	{
+		result = libbfio_memory_range_initialize(
+		          &handle,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_memory_range_set(
+		          handle,
+		          data,
+		          256,
+		          &error );
 
-	libcerror_error_free(
-	 &error );
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-#if defined( HAVE_BFIO_TEST_RWLOCK )
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	/* Test libbfio_pool_read_buffer with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
-	 */
-	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+		result = libbfio_pool_append_handle(
+		          pool,
+		          &entry_index,
+		          handle,
+		          LIBBFIO_OPEN_READ,
+		          &error );
 
-	read_count = libbfio_pool_read_buffer(
-	              pool,
-	              0,
-	              buffer,
-	              32,
-	              &error );
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
-	{
-		bfio_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		handle = NULL;
 	}
-	else
+	/* Test regular cases
+	 * reading the entries in turn evicts a handle on every read
+	 */
+	for( read_index = 0;
+	     read_index < 9;
+	     read_index++ )
 	{
+		read_count = libbfio_pool_read_buffer_at_offset(
+		              pool,
+		              read_index % 3,
+		              buffer,
+		              16,
+		              (off64_t) ( read_index * 16 ),
+		              &error );
+
 		BFIO_TEST_ASSERT_EQUAL_SSIZE(
 		 "read_count",
 		 read_count,
-		 (ssize_t) -1 );
+		 (ssize_t) 16 );
 
-		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		BFIO_TEST_ASSERT_IS_NULL(
 		 "error",
 		 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-#if defined( HAVE_LOCAL_LIBCDATA )
+		result = memory_compare(
+		          buffer,
+		          &( data[ read_index * 16 ] ),
+		          16 );
 
-	/* Test libbfio_pool_read_buffer with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
-	 */
-	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 2;
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
 
-	read_count = libbfio_pool_read_buffer(
-	              pool,
-	              0,
-	              buffer,
-	              32,
-	              &error );
+		/* A handle is only evicted when the pool is full
+		 */
+		number_of_open_handles = read_index + 1;
 
-	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
-	{
-		bfio_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+		if( number_of_open_handles > 2 )
+		{
+			number_of_open_handles = 2;
+		}
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "number_of_open_handles",
+		 ( (libbfio_internal_pool_t *) pool )->number_of_open_handles,
+		 number_of_open_handles );
 	}
-	else
-	{
-		BFIO_TEST_ASSERT_EQUAL_SSIZE(
-		 "read_count",
-		 read_count,
-		 (ssize_t) -1 );
+	/* Test that handles pending to be closed are closed by close all
+	 */
+	result = libbfio_pool_close_all(
+	          pool,
+	          &error );
 
-		BFIO_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_LOCAL_LIBCDATA ) */
-#endif /* defined( HAVE_BFIO_TEST_RWLOCK ) */
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libbfio_pool_free(
+	          &pool,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "pool",
+	 pool );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	return( 1 );
 
@@ -5580,16 +7719,31 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( pool != NULL )
+	{
+		libbfio_pool_free(
+		 &pool,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libbfio_pool_read_buffer_at_offset function
+/* Tests the libbfio_pool_read_vector function
  * Returns 1 if successful or 0 if not
  */
-int bfio_test_pool_read_buffer_at_offset(
+int bfio_test_pool_read_vector(
      libbfio_pool_t *pool )
 {
+	uint8_t *buffers[ 2 ];
 	uint8_t buffer[ 32 ];
+	size_t buffer_sizes[ 2 ];
+	off64_t offsets[ 2 ];
 
 	libcerror_error_t *error = NULL;
 	size64_t file_size       = 0;
@@ -5634,14 +7788,23 @@ int bfio_test_pool_read_buffer_at_offset(
 	 "error",
 	 error );
 
+	buffers[ 0 ]      = &( buffer[ 16 ] );
+	buffer_sizes[ 0 ] = 16;
+	offsets[ 0 ]      = 16;
+
+	buffers[ 1 ]      = &( buffer[ 0 ] );
+	buffer_sizes[ 1 ] = 16;
+	offsets[ 1 ]      = 0;
+
 	/* Test regular cases
 	 */
-	read_count = libbfio_pool_read_buffer_at_offset(
+	read_count = libbfio_pool_read_vector(
 	              pool,
 	              0,
-	              buffer,
-	              32,
-	              0,
+	              buffers,
+	              buffer_sizes,
+	              offsets,
+	              2,
 	              &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
@@ -5655,12 +7818,13 @@ int bfio_test_pool_read_buffer_at_offset(
 
 	/* Test error cases
 	 */
-	read_count = libbfio_pool_read_buffer_at_offset(
+	read_count = libbfio_pool_read_vector(
 	              NULL,
 	              0,
-	              buffer,
-	              32,
-	              0,
+	              buffers,
+	              buffer_sizes,
+	              offsets,
+	              2,
 	              &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
@@ -5675,12 +7839,13 @@ int bfio_test_pool_read_buffer_at_offset(
 	libcerror_error_free(
 	 &error );
 
-	read_count = libbfio_pool_read_buffer_at_offset(
+	read_count = libbfio_pool_read_vector(
 	              pool,
 	              -1,
-	              buffer,
-	              32,
-	              0,
+	              buffers,
+	              buffer_sizes,
+	              offsets,
+	              2,
 	              &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
@@ -5695,52 +7860,13 @@ int bfio_test_pool_read_buffer_at_offset(
 	libcerror_error_free(
 	 &error );
 
-	read_count = libbfio_pool_read_buffer_at_offset(
+	read_count = libbfio_pool_read_vector(
 	              pool,
 	              0,
 	              NULL,
-	              32,
-	              0,
-	              &error );
-
-	BFIO_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) -1 );
-
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	read_count = libbfio_pool_read_buffer_at_offset(
-	              pool,
-	              0,
-	              buffer,
-	              (size_t) SSIZE_MAX + 1,
-	              0,
-	              &error );
-
-	BFIO_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) -1 );
-
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	read_count = libbfio_pool_read_buffer_at_offset(
-	              pool,
-	              0,
-	              buffer,
-	              32,
-	              -1,
+	              buffer_sizes,
+	              offsets,
+	              2,
 	              &error );
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
@@ -5757,21 +7883,22 @@ int bfio_test_pool_read_buffer_at_offset(
 
 #if defined( HAVE_BFIO_TEST_RWLOCK )
 
-	/* Test libbfio_pool_read_buffer_at_offset with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	/* Test libbfio_pool_read_vector with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
 	 */
-	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+	bfio_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
 
-	read_count = libbfio_pool_read_buffer_at_offset(
+	read_count = libbfio_pool_read_vector(
 	              pool,
 	              0,
-	              buffer,
-	              32,
-	              0,
+	              buffers,
+	              buffer_sizes,
+	              offsets,
+	              2,
 	              &error );
 
-	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	if( bfio_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
 	{
-		bfio_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+		bfio_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
 	}
 	else
 	{
@@ -5789,16 +7916,17 @@ int bfio_test_pool_read_buffer_at_offset(
 	}
 #if defined( HAVE_LOCAL_LIBCDATA )
 
-	/* Test libbfio_pool_read_buffer_at_offset with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	/* Test libbfio_pool_read_vector with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
 	 */
 	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 2;
 
-	read_count = libbfio_pool_read_buffer_at_offset(
+	read_count = libbfio_pool_read_vector(
 	              pool,
 	              0,
-	              buffer,
-	              32,
-	              0,
+	              buffers,
+	              buffer_sizes,
+	              offsets,
+	              2,
 	              &error );
 
 	if( bfio_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
@@ -6055,9 +8183,9 @@ int bfio_test_pool_write_buffer(
 
 #if defined( HAVE_BFIO_TEST_RWLOCK )
 
-	/* Test libbfio_pool_write_buffer with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	/* Test libbfio_pool_write_buffer with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
 	 */
-	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+	bfio_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
 
 	write_count = libbfio_pool_write_buffer(
 	               pool,
@@ -6066,9 +8194,9 @@ int bfio_test_pool_write_buffer(
 	               32,
 	               &error );
 
-	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	if( bfio_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
 	{
-		bfio_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+		bfio_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
 	}
 	else
 	{
@@ -6086,7 +8214,7 @@ int bfio_test_pool_write_buffer(
 	}
 #if defined( HAVE_LOCAL_LIBCDATA )
 
-	/* Test libbfio_pool_write_buffer with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	/* Test libbfio_pool_write_buffer with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
 	 */
 	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 2;
 
@@ -6437,9 +8565,9 @@ int bfio_test_pool_write_buffer_at_offset(
 
 #if defined( HAVE_BFIO_TEST_RWLOCK )
 
-	/* Test libbfio_pool_write_buffer_at_offset with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	/* Test libbfio_pool_write_buffer_at_offset with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
 	 */
-	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+	bfio_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
 
 	write_count = libbfio_pool_write_buffer_at_offset(
 	               pool,
@@ -6449,9 +8577,9 @@ int bfio_test_pool_write_buffer_at_offset(
 	               0,
 	               &error );
 
-	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	if( bfio_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
 	{
-		bfio_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+		bfio_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
 	}
 	else
 	{
@@ -6469,7 +8597,7 @@ int bfio_test_pool_write_buffer_at_offset(
 	}
 #if defined( HAVE_LOCAL_LIBCDATA )
 
-	/* Test libbfio_pool_write_buffer_at_offset with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	/* Test libbfio_pool_write_buffer_at_offset with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
 	 */
 	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 2;
 
@@ -6916,9 +9044,9 @@ int bfio_test_pool_seek_offset(
 
 #if defined( HAVE_BFIO_TEST_RWLOCK )
 
-	/* Test libbfio_pool_seek_offset with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	/* Test libbfio_pool_seek_offset with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
 	 */
-	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+	bfio_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
 
 	offset = libbfio_pool_seek_offset(
 	          pool,
@@ -6927,9 +9055,9 @@ int bfio_test_pool_seek_offset(
 	          SEEK_SET,
 	          &error );
 
-	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	if( bfio_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
 	{
-		bfio_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+		bfio_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
 	}
 	else
 	{
@@ -6947,7 +9075,7 @@ int bfio_test_pool_seek_offset(
 	}
 #if defined( HAVE_LOCAL_LIBCDATA )
 
-	/* Test libbfio_pool_seek_offset with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	/* Test libbfio_pool_seek_offset with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
 	 */
 	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 2;
 
@@ -7075,9 +9203,9 @@ int bfio_test_pool_get_offset(
 
 #if defined( HAVE_BFIO_TEST_RWLOCK )
 
-	/* Test libbfio_pool_get_offset with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	/* Test libbfio_pool_get_offset with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
 	 */
-	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+	bfio_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
 
 	result = libbfio_pool_get_offset(
 	          pool,
@@ -7085,9 +9213,9 @@ int bfio_test_pool_get_offset(
 	          &offset,
 	          &error );
 
-	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	if( bfio_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
 	{
-		bfio_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+		bfio_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
 	}
 	else
 	{
@@ -7105,7 +9233,7 @@ int bfio_test_pool_get_offset(
 	}
 #if defined( HAVE_LOCAL_LIBCDATA )
 
-	/* Test libbfio_pool_get_offset with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	/* Test libbfio_pool_get_offset with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
 	 */
 	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 2;
 
@@ -7232,9 +9360,9 @@ int bfio_test_pool_get_size(
 
 #if defined( HAVE_BFIO_TEST_RWLOCK )
 
-	/* Test libbfio_pool_get_size with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	/* Test libbfio_pool_get_size with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
 	 */
-	bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+	bfio_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
 
 	result = libbfio_pool_get_size(
 	          pool,
@@ -7242,9 +9370,9 @@ int bfio_test_pool_get_size(
 	          &size,
 	          &error );
 
-	if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	if( bfio_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
 	{
-		bfio_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+		bfio_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
 	}
 	else
 	{
@@ -7262,7 +9390,7 @@ int bfio_test_pool_get_size(
 	}
 #if defined( HAVE_LOCAL_LIBCDATA )
 
-	/* Test libbfio_pool_get_size with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	/* Test libbfio_pool_get_size with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
 	 */
 	bfio_test_pthread_rwlock_unlock_attempts_before_fail = 2;
 
@@ -7375,6 +9503,10 @@ int main(
 	 "libbfio_pool_write_buffer_at_offset",
 	 bfio_test_pool_write_buffer_at_offset );
 
+	BFIO_TEST_RUN(
+	 "libbfio_pool_read_buffer_at_offset_with_pending_closes",
+	 bfio_test_pool_read_buffer_at_offset_with_pending_closes );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 	if( source != NULL )
 	{
@@ -7385,6 +9517,11 @@ int main(
 		 bfio_test_internal_pool_open_handle,
 		 source );
 
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_internal_pool_close_evicted_handle",
+		 bfio_test_internal_pool_close_evicted_handle,
+		 source );
+
 		BFIO_TEST_RUN_WITH_ARGS(
 		 "libbfio_internal_pool_append_handle_to_last_used_list",
 		 bfio_test_internal_pool_append_handle_to_last_used_list,
@@ -7395,7 +9532,10 @@ int main(
 		 bfio_test_internal_pool_move_handle_to_front_of_last_used_list,
 		 source );
 
-		/* TODO add tests for libbfio_internal_pool_remove_handle_from_last_used_list */
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_internal_pool_remove_handle_from_last_used_list",
+		 bfio_test_internal_pool_remove_handle_from_last_used_list,
+		 source );
 
 #endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) */
 
@@ -7492,9 +9632,36 @@ int main(
 		 bfio_test_pool_set_maximum_number_of_open_handles,
 		 pool );
 
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_pool_set_maximum_number_of_pending_closes",
+		 bfio_test_pool_set_maximum_number_of_pending_closes,
+		 pool );
+
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_pool_set_block_cache",
+		 bfio_test_pool_set_block_cache,
+		 pool );
+
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_pool_get_cache_statistics",
+		 bfio_test_pool_get_cache_statistics,
+		 pool );
+
 #if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT )
 
-		/* TODO add tests for libbfio_internal_pool_get_open_handle */
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_internal_pool_get_open_handle",
+		 bfio_test_internal_pool_get_open_handle,
+		 pool );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_internal_pool_claim_handle_offset",
+		 bfio_test_internal_pool_claim_handle_offset,
+		 pool );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO ) */
 
 #endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) */
 
@@ -7508,6 +9675,11 @@ int main(
 		 bfio_test_pool_read_buffer_at_offset,
 		 pool );
 
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_pool_read_vector",
+		 bfio_test_pool_read_vector,
+		 pool );
+
 		BFIO_TEST_RUN_WITH_ARGS(
 		 "libbfio_pool_seek_offset",
 		 bfio_test_pool_seek_offset,
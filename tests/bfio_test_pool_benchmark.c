@@ -0,0 +1,508 @@
+/*
+ * Library pool open handle eviction benchmark program
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <time.h>
+
+#include "bfio_test_getopt.h"
+#include "bfio_test_libbfio.h"
+#include "bfio_test_libcerror.h"
+#include "bfio_test_unused.h"
+
+#define BFIO_TEST_POOL_BENCHMARK_DEFAULT_NUMBER_OF_ENTRIES		100000
+#define BFIO_TEST_POOL_BENCHMARK_DEFAULT_MAXIMUM_NUMBER_OF_OPEN_HANDLES	64
+#define BFIO_TEST_POOL_BENCHMARK_DEFAULT_NUMBER_OF_ACCESSES		1000000
+
+uint8_t bfio_test_pool_benchmark_data[ 4096 ];
+
+/* Prints usage information
+ */
+void bfio_test_pool_benchmark_usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use bfio_test_pool_benchmark to determine the overhead of\n"
+	                 "the pool open handle bookkeeping on random entry access.\n"
+	                 "It prints the average time per access in nanoseconds.\n\n" );
+
+	fprintf( stream, "Usage: bfio_test_pool_benchmark [ -a accesses ] [ -e entries ]\n"
+	                 "                                [ -m maximum ] [ -h ]\n\n" );
+
+	fprintf( stream, "\t-a:     number of accesses, default is: %d\n",
+	 BFIO_TEST_POOL_BENCHMARK_DEFAULT_NUMBER_OF_ACCESSES );
+	fprintf( stream, "\t-e:     number of entries in the pool, default is: %d\n",
+	 BFIO_TEST_POOL_BENCHMARK_DEFAULT_NUMBER_OF_ENTRIES );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-m:     maximum number of open handles, default is: %d\n",
+	 BFIO_TEST_POOL_BENCHMARK_DEFAULT_MAXIMUM_NUMBER_OF_OPEN_HANDLES );
+}
+
+/* Retrieves the current time in nanoseconds
+ * Returns the current time
+ */
+uint64_t bfio_test_pool_benchmark_get_time(
+          void )
+{
+#if defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_structure;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_structure ) == 0 )
+	{
+		return( ( (uint64_t) time_structure.tv_sec * 1000000000UL ) + (uint64_t) time_structure.tv_nsec );
+	}
+#endif
+	return( (uint64_t) time( NULL ) * 1000000000UL );
+}
+
+/* Creates a pool of memory range handles that share the same data
+ * Returns 1 if successful or -1 on error
+ */
+int bfio_test_pool_benchmark_create_pool(
+     libbfio_pool_t **pool,
+     int number_of_entries,
+     int maximum_number_of_open_handles,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *handle = NULL;
+	static char *function    = "bfio_test_pool_benchmark_create_pool";
+	int entry_index          = 0;
+	int handle_index         = 0;
+
+	if( libbfio_pool_initialize(
+	     pool,
+	     0,
+	     maximum_number_of_open_handles,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize pool.",
+		 function );
+
+		goto on_error;
+	}
+	for( handle_index = 0;
+	     handle_index < number_of_entries;
+	     handle_index++ )
+	{
+		if( libbfio_memory_range_initialize(
+		     &handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize handle: %d.",
+			 function,
+			 handle_index );
+
+			goto on_error;
+		}
+		if( libbfio_memory_range_set(
+		     handle,
+		     bfio_test_pool_benchmark_data,
+		     4096,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set memory range of handle: %d.",
+			 function,
+			 handle_index );
+
+			goto on_error;
+		}
+		if( libbfio_pool_append_handle(
+		     *pool,
+		     &entry_index,
+		     handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append handle: %d to pool.",
+			 function,
+			 handle_index );
+
+			goto on_error;
+		}
+		handle = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( *pool != NULL )
+	{
+		libbfio_pool_free(
+		 pool,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads from random entries in the pool
+ * Only the first number of entries of the working set size are accessed
+ * Returns 1 if successful or -1 on error
+ */
+int bfio_test_pool_benchmark_run(
+     libbfio_pool_t *pool,
+     int working_set_size,
+     int number_of_accesses,
+     uint64_t *elapsed_time,
+     libcerror_error_t **error )
+{
+	uint8_t buffer[ 16 ];
+
+	static char *function = "bfio_test_pool_benchmark_run";
+	uint64_t start_time   = 0;
+	uint32_t random_value = 1;
+	ssize_t read_count    = 0;
+	off64_t offset        = 0;
+	int access_index      = 0;
+	int entry             = 0;
+
+	if( working_set_size <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid working set size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( elapsed_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elapsed time.",
+		 function );
+
+		return( -1 );
+	}
+	start_time = bfio_test_pool_benchmark_get_time();
+
+	for( access_index = 0;
+	     access_index < number_of_accesses;
+	     access_index++ )
+	{
+		/* Use a linear congruential generator so that every run accesses the same entries
+		 */
+		random_value = ( random_value * 1103515245UL ) + 12345UL;
+
+		entry  = (int) ( ( random_value >> 8 ) % (uint32_t) working_set_size );
+		offset = (off64_t) ( random_value & 0x00000ff0UL );
+
+		read_count = libbfio_pool_read_buffer_at_offset(
+		              pool,
+		              entry,
+		              buffer,
+		              16,
+		              offset,
+		              error );
+
+		if( read_count != (ssize_t) 16 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from entry: %d.",
+			 function,
+			 entry );
+
+			return( -1 );
+		}
+	}
+	*elapsed_time = bfio_test_pool_benchmark_get_time() - start_time;
+
+	return( 1 );
+}
+
+/* Prints the result of a benchmark run
+ */
+void bfio_test_pool_benchmark_result_fprint(
+      FILE *stream,
+      const char *description,
+      int number_of_accesses,
+      uint64_t elapsed_time )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	if( elapsed_time == 0 )
+	{
+		elapsed_time = 1;
+	}
+	fprintf(
+	 stream,
+	 "%s\taccesses: %d\telapsed: %" PRIu64 " ms\tnanoseconds per access: %" PRIu64 "\n",
+	 description,
+	 number_of_accesses,
+	 elapsed_time / 1000000,
+	 elapsed_time / (uint64_t) number_of_accesses );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	libbfio_pool_t *pool                = NULL;
+	libcerror_error_t *error            = NULL;
+	system_character_t *option_accesses = NULL;
+	system_character_t *option_entries  = NULL;
+	system_character_t *option_maximum  = NULL;
+	system_integer_t option             = 0;
+	uint64_t elapsed_time               = 0;
+	int maximum_number_of_open_handles  = BFIO_TEST_POOL_BENCHMARK_DEFAULT_MAXIMUM_NUMBER_OF_OPEN_HANDLES;
+	int number_of_accesses              = BFIO_TEST_POOL_BENCHMARK_DEFAULT_NUMBER_OF_ACCESSES;
+	int number_of_entries               = BFIO_TEST_POOL_BENCHMARK_DEFAULT_NUMBER_OF_ENTRIES;
+
+	while( ( option = bfio_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "a:e:hm:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				bfio_test_pool_benchmark_usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'a':
+				option_accesses = optarg;
+
+				break;
+
+			case (system_integer_t) 'e':
+				option_entries = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				bfio_test_pool_benchmark_usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'm':
+				option_maximum = optarg;
+
+				break;
+		}
+	}
+	if( option_accesses != NULL )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		number_of_accesses = (int) wcstol( option_accesses, NULL, 10 );
+#else
+		number_of_accesses = atoi( option_accesses );
+#endif
+		if( number_of_accesses <= 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid number of accesses.\n" );
+
+			return( EXIT_FAILURE );
+		}
+	}
+	if( option_entries != NULL )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		number_of_entries = (int) wcstol( option_entries, NULL, 10 );
+#else
+		number_of_entries = atoi( option_entries );
+#endif
+		if( number_of_entries <= 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid number of entries.\n" );
+
+			return( EXIT_FAILURE );
+		}
+	}
+	if( option_maximum != NULL )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		maximum_number_of_open_handles = (int) wcstol( option_maximum, NULL, 10 );
+#else
+		maximum_number_of_open_handles = atoi( option_maximum );
+#endif
+		if( maximum_number_of_open_handles <= 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid maximum number of open handles.\n" );
+
+			return( EXIT_FAILURE );
+		}
+	}
+	if( bfio_test_pool_benchmark_create_pool(
+	     &pool,
+	     number_of_entries,
+	     maximum_number_of_open_handles,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create pool.\n" );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "Number of entries: %d\tmaximum number of open handles: %d\n\n",
+	 number_of_entries,
+	 maximum_number_of_open_handles );
+
+	/* Access all entries, most accesses require another handle to be closed
+	 */
+	if( bfio_test_pool_benchmark_run(
+	     pool,
+	     number_of_entries,
+	     number_of_accesses,
+	     &elapsed_time,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to run benchmark on all entries.\n" );
+
+		goto on_error;
+	}
+	bfio_test_pool_benchmark_result_fprint(
+	 stdout,
+	 "All entries:\t",
+	 number_of_accesses,
+	 elapsed_time );
+
+	/* Access a working set that fits the maximum number of open handles,
+	 * the accesses only reorder the last used handles
+	 */
+	if( bfio_test_pool_benchmark_run(
+	     pool,
+	     ( maximum_number_of_open_handles < number_of_entries ) ? maximum_number_of_open_handles : number_of_entries,
+	     number_of_accesses,
+	     &elapsed_time,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to run benchmark on working set.\n" );
+
+		goto on_error;
+	}
+	bfio_test_pool_benchmark_result_fprint(
+	 stdout,
+	 "Working set:\t",
+	 number_of_accesses,
+	 elapsed_time );
+
+	if( libbfio_pool_close_all(
+	     pool,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close pool.\n" );
+
+		goto on_error;
+	}
+	if( libbfio_pool_free(
+	     &pool,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free pool.\n" );
+
+		goto on_error;
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( pool != NULL )
+	{
+		libbfio_pool_free(
+		 &pool,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
@@ -0,0 +1,1225 @@
+/*
+ * Library prefetcher type test program
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "bfio_test_libbfio.h"
+#include "bfio_test_libcerror.h"
+#include "bfio_test_macros.h"
+#include "bfio_test_memory.h"
+#include "bfio_test_unused.h"
+
+#include "../libbfio/libbfio_definitions.h"
+#include "../libbfio/libbfio_memory_range_io_handle.h"
+#include "../libbfio/libbfio_prefetcher.h"
+
+/* Define to make bfio_test_prefetcher generate verbose output
+#define BFIO_TEST_PREFETCHER_VERBOSE
+ */
+
+uint8_t bfio_test_prefetcher_data[ 64 ];
+
+#if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT )
+
+/* Tests the libbfio_prefetcher_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_prefetcher_initialize(
+     intptr_t *io_handle )
+{
+	libbfio_prefetcher_t *prefetcher = NULL;
+	libcerror_error_t *error         = NULL;
+	int result                       = 0;
+
+#if defined( HAVE_BFIO_TEST_MEMORY )
+	int number_of_malloc_fail_tests  = 1;
+	int number_of_memset_fail_tests  = 1;
+	int test_number                  = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libbfio_prefetcher_initialize(
+	          &prefetcher,
+	          io_handle,
+	          (ssize_t (*)(intptr_t *, uint8_t *, size_t, off64_t, libcerror_error_t **)) &libbfio_memory_range_io_handle_read_buffer_at_offset,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "prefetcher",
+	 prefetcher );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_prefetcher_free(
+	          &prefetcher,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "prefetcher",
+	 prefetcher );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_prefetcher_initialize(
+	          NULL,
+	          io_handle,
+	          (ssize_t (*)(intptr_t *, uint8_t *, size_t, off64_t, libcerror_error_t **)) &libbfio_memory_range_io_handle_read_buffer_at_offset,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	prefetcher = (libbfio_prefetcher_t *) 0x12345678UL;
+
+	result = libbfio_prefetcher_initialize(
+	          &prefetcher,
+	          io_handle,
+	          (ssize_t (*)(intptr_t *, uint8_t *, size_t, off64_t, libcerror_error_t **)) &libbfio_memory_range_io_handle_read_buffer_at_offset,
+	          &error );
+
+	prefetcher = NULL;
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_prefetcher_initialize(
+	          &prefetcher,
+	          io_handle,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "prefetcher",
+	 prefetcher );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_BFIO_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libbfio_prefetcher_initialize with malloc failing
+		 */
+		bfio_test_malloc_attempts_before_fail = test_number;
+
+		result = libbfio_prefetcher_initialize(
+		          &prefetcher,
+		          io_handle,
+		          (ssize_t (*)(intptr_t *, uint8_t *, size_t, off64_t, libcerror_error_t **)) &libbfio_memory_range_io_handle_read_buffer_at_offset,
+		          &error );
+
+		if( bfio_test_malloc_attempts_before_fail != -1 )
+		{
+			bfio_test_malloc_attempts_before_fail = -1;
+
+			if( prefetcher != NULL )
+			{
+				libbfio_prefetcher_free(
+				 &prefetcher,
+				 NULL );
+			}
+		}
+		else
+		{
+			BFIO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			BFIO_TEST_ASSERT_IS_NULL(
+			 "prefetcher",
+			 prefetcher );
+
+			BFIO_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libbfio_prefetcher_initialize with memset failing
+		 */
+		bfio_test_memset_attempts_before_fail = test_number;
+
+		result = libbfio_prefetcher_initialize(
+		          &prefetcher,
+		          io_handle,
+		          (ssize_t (*)(intptr_t *, uint8_t *, size_t, off64_t, libcerror_error_t **)) &libbfio_memory_range_io_handle_read_buffer_at_offset,
+		          &error );
+
+		if( bfio_test_memset_attempts_before_fail != -1 )
+		{
+			bfio_test_memset_attempts_before_fail = -1;
+
+			if( prefetcher != NULL )
+			{
+				libbfio_prefetcher_free(
+				 &prefetcher,
+				 NULL );
+			}
+		}
+		else
+		{
+			BFIO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			BFIO_TEST_ASSERT_IS_NULL(
+			 "prefetcher",
+			 prefetcher );
+
+			BFIO_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_BFIO_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( prefetcher != NULL )
+	{
+		libbfio_prefetcher_free(
+		 &prefetcher,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_prefetcher_free function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_prefetcher_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libbfio_prefetcher_free(
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_prefetcher_submit function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_prefetcher_submit(
+     libbfio_prefetcher_t *prefetcher )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libbfio_prefetcher_submit(
+	          prefetcher,
+	          0,
+	          16,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT8(
+	 "prefetcher->is_submitted",
+	 prefetcher->is_submitted,
+	 (uint8_t) 1 );
+
+	/* Test error cases
+	 */
+	result = libbfio_prefetcher_submit(
+	          NULL,
+	          0,
+	          16,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libbfio_prefetcher_submit with a prefetch already submitted
+	 */
+	result = libbfio_prefetcher_submit(
+	          prefetcher,
+	          0,
+	          16,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_prefetcher_cancel(
+	          prefetcher,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_prefetcher_submit(
+	          prefetcher,
+	          -1,
+	          16,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_prefetcher_submit(
+	          prefetcher,
+	          0,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_prefetcher_submit(
+	          prefetcher,
+	          0,
+	          (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE + 1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT8(
+	 "prefetcher->is_submitted",
+	 prefetcher->is_submitted,
+	 (uint8_t) 0 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_prefetcher_process function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_prefetcher_process(
+     libbfio_prefetcher_t *prefetcher )
+{
+	uint8_t *buffer          = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test libbfio_prefetcher_process with a read that fails
+	 */
+	buffer = prefetcher->buffer;
+
+	prefetcher->buffer = NULL;
+	prefetcher->offset = 0;
+	prefetcher->size   = 16;
+
+	result = libbfio_prefetcher_process(
+	          prefetcher,
+	          NULL );
+
+	prefetcher->buffer = buffer;
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "prefetcher->read_count",
+	 prefetcher->read_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT8(
+	 "prefetcher->is_completed",
+	 prefetcher->is_completed,
+	 (uint8_t) 1 );
+
+	/* Test error cases
+	 */
+	result = libbfio_prefetcher_process(
+	          NULL,
+	          NULL );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_prefetcher_exchange_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_prefetcher_exchange_buffer(
+     libbfio_prefetcher_t *prefetcher )
+{
+	libcerror_error_t *error = NULL;
+	uint8_t *buffer          = NULL;
+	size_t buffer_size       = 0;
+	ssize_t read_count       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libbfio_prefetcher_submit(
+	          prefetcher,
+	          8,
+	          16,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_prefetcher_exchange_buffer(
+	          prefetcher,
+	          8,
+	          &buffer,
+	          &buffer_size,
+	          &read_count,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	BFIO_TEST_ASSERT_EQUAL_SIZE(
+	 "buffer_size",
+	 buffer_size,
+	 (size_t) 16 );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT8(
+	 "prefetcher->is_submitted",
+	 prefetcher->is_submitted,
+	 (uint8_t) 0 );
+
+	result = memory_compare(
+	          buffer,
+	          &( bfio_test_prefetcher_data[ 8 ] ),
+	          16 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test libbfio_prefetcher_exchange_buffer without a submitted prefetch
+	 */
+	result = libbfio_prefetcher_exchange_buffer(
+	          prefetcher,
+	          24,
+	          &buffer,
+	          &buffer_size,
+	          &read_count,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test libbfio_prefetcher_exchange_buffer with a prefetch of another offset
+	 */
+	result = libbfio_prefetcher_submit(
+	          prefetcher,
+	          24,
+	          16,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_prefetcher_exchange_buffer(
+	          prefetcher,
+	          0,
+	          &buffer,
+	          &buffer_size,
+	          &read_count,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT8(
+	 "prefetcher->is_submitted",
+	 prefetcher->is_submitted,
+	 (uint8_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libbfio_prefetcher_exchange_buffer(
+	          NULL,
+	          8,
+	          &buffer,
+	          &buffer_size,
+	          &read_count,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_prefetcher_exchange_buffer(
+	          prefetcher,
+	          8,
+	          NULL,
+	          &buffer_size,
+	          &read_count,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_prefetcher_exchange_buffer(
+	          prefetcher,
+	          8,
+	          &buffer,
+	          NULL,
+	          &read_count,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_prefetcher_exchange_buffer(
+	          prefetcher,
+	          8,
+	          &buffer,
+	          &buffer_size,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 buffer );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_prefetcher_cancel function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_prefetcher_cancel(
+     libbfio_prefetcher_t *prefetcher )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libbfio_prefetcher_submit(
+	          prefetcher,
+	          0,
+	          16,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_prefetcher_cancel(
+	          prefetcher,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT8(
+	 "prefetcher->is_submitted",
+	 prefetcher->is_submitted,
+	 (uint8_t) 0 );
+
+	result = libbfio_prefetcher_cancel(
+	          prefetcher,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_prefetcher_cancel(
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_prefetcher_overlaps function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_prefetcher_overlaps(
+     libbfio_prefetcher_t *prefetcher )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libbfio_prefetcher_overlaps(
+	          prefetcher,
+	          0,
+	          64,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_prefetcher_submit(
+	          prefetcher,
+	          16,
+	          16,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_prefetcher_overlaps(
+	          prefetcher,
+	          31,
+	          1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_prefetcher_overlaps(
+	          prefetcher,
+	          0,
+	          16,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_prefetcher_overlaps(
+	          prefetcher,
+	          32,
+	          16,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_prefetcher_cancel(
+	          prefetcher,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_prefetcher_overlaps(
+	          prefetcher,
+	          16,
+	          16,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_prefetcher_overlaps(
+	          NULL,
+	          0,
+	          16,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_prefetcher_overlaps(
+	          prefetcher,
+	          -1,
+	          16,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libbfio_prefetcher_cancel(
+	 prefetcher,
+	 NULL );
+
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc BFIO_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] BFIO_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc BFIO_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] BFIO_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT )
+	libbfio_memory_range_io_handle_t *memory_range_io_handle = NULL;
+	libbfio_prefetcher_t *prefetcher                         = NULL;
+	libcerror_error_t *error                                 = NULL;
+	size_t data_index                                        = 0;
+	int result                                               = 0;
+#endif
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( BFIO_TEST_PREFETCHER_VERBOSE )
+	libbfio_notify_set_verbose(
+	 1 );
+	libbfio_notify_set_stream(
+	 stderr,
+	 NULL );
+#endif
+
+#if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT )
+
+	BFIO_TEST_RUN(
+	 "libbfio_prefetcher_free",
+	 bfio_test_prefetcher_free );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize test
+	 */
+	for( data_index = 0;
+	     data_index < 64;
+	     data_index++ )
+	{
+		bfio_test_prefetcher_data[ data_index ] = (uint8_t) data_index;
+	}
+	result = libbfio_memory_range_io_handle_initialize(
+	          &memory_range_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_range_io_handle",
+	 memory_range_io_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_io_handle_set(
+	          memory_range_io_handle,
+	          bfio_test_prefetcher_data,
+	          64,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_io_handle_open(
+	          memory_range_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_RUN_WITH_ARGS(
+	 "libbfio_prefetcher_initialize",
+	 bfio_test_prefetcher_initialize,
+	 (intptr_t *) memory_range_io_handle );
+
+	result = libbfio_prefetcher_initialize(
+	          &prefetcher,
+	          (intptr_t *) memory_range_io_handle,
+	          (ssize_t (*)(intptr_t *, uint8_t *, size_t, off64_t, libcerror_error_t **)) &libbfio_memory_range_io_handle_read_buffer_at_offset,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "prefetcher",
+	 prefetcher );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_RUN_WITH_ARGS(
+	 "libbfio_prefetcher_submit",
+	 bfio_test_prefetcher_submit,
+	 prefetcher );
+
+	BFIO_TEST_RUN_WITH_ARGS(
+	 "libbfio_prefetcher_process",
+	 bfio_test_prefetcher_process,
+	 prefetcher );
+
+	BFIO_TEST_RUN_WITH_ARGS(
+	 "libbfio_prefetcher_exchange_buffer",
+	 bfio_test_prefetcher_exchange_buffer,
+	 prefetcher );
+
+	BFIO_TEST_RUN_WITH_ARGS(
+	 "libbfio_prefetcher_cancel",
+	 bfio_test_prefetcher_cancel,
+	 prefetcher );
+
+	BFIO_TEST_RUN_WITH_ARGS(
+	 "libbfio_prefetcher_overlaps",
+	 bfio_test_prefetcher_overlaps,
+	 prefetcher );
+
+	/* Clean up
+	 */
+	result = libbfio_prefetcher_free(
+	          &prefetcher,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "prefetcher",
+	 prefetcher );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_io_handle_free(
+	          &memory_range_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "memory_range_io_handle",
+	 memory_range_io_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT )
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( prefetcher != NULL )
+	{
+		libbfio_prefetcher_free(
+		 &prefetcher,
+		 NULL );
+	}
+	if( memory_range_io_handle != NULL )
+	{
+		libbfio_memory_range_io_handle_free(
+		 &memory_range_io_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) */
+}
+
@@ -6,8 +6,8 @@ $ExitSuccess = 0
 $ExitFailure = 1
 $ExitIgnore = 77
 
-$LibraryTests = "error support system_string"
-$LibraryTestsWithInput = "file file_io_handle file_pool file_range file_range_io_handle handle memory_range memory_range_io_handle pool"
+$LibraryTests = "buffer_pool cached_handle descriptor_cache error handle_range io_queue io_request prefetcher segmented_file support system_string"
+$LibraryTestsWithInput = "file file_io_handle file_pool file_range file_range_io_handle handle memory_range memory_range_io_handle mmap mmap_io_handle pool"
 $OptionSets = ""
 
 $InputGlob = "*"